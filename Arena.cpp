@@ -0,0 +1,70 @@
+/* ************************************************************************** *
+ *                           Frank Nathan Beckwith                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** *
+ *                                                                            *
+ * Source file for the implementation of the Arena abstraction.               *
+ * Class definition given in Arena.h.                                         *
+ *                                                                            *
+ * ************************************************************************** */
+
+// Project-specific headers;
+#include "Arena.h"
+
+// System headers;
+#include <algorithm>
+#include <cstdint>
+
+/* ***********************  PUBLIC MEMBER FUNCTIONS  ************************ */
+
+/* Given the size and alignment (a power of two), return uninitialized memory
+ * that stays valid until `release.' */
+void * fem::Arena::allocate( std::size_t size, std::size_t align )
+{
+  // Round the address up to the alignment, starting a block if it overflows;
+  if( blocks.empty( ) || used + size + align > blocks.back( ).size )
+    add_block( size + align );
+  std::uintptr_t base = reinterpret_cast<std::uintptr_t>( blocks.back( ).data );
+  std::uintptr_t addr = ( base + used + align - 1 ) & ~( align - 1 );
+  used = addr - base + size;
+  return blocks.back( ).data + ( addr - base );
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given a number of bytes, make sure the next allocations totalling that many
+ * bytes (plus alignment padding) need no new block. */
+void fem::Arena::reserve( std::size_t size )
+{
+  if( blocks.empty( ) || used + size > blocks.back( ).size )
+    add_block( size );
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Free every block at once.  Objects in the arena are not destroyed. */
+void fem::Arena::release( )
+{
+  for( auto & block : blocks )
+    ::operator delete( block.data );
+  blocks.clear( );
+  used = 0;
+}
+
+
+/* ***********************  PRIVATE MEMBER FUNCTIONS  *********************** */
+
+/* Given a number of bytes, start a new block holding at least that many. */
+void fem::Arena::add_block( std::size_t size )
+{
+  // Grow geometrically so n objects take O( log n ) blocks;
+  std::size_t block_size = std::max( size, next_size );
+  next_size = 2 * block_size;
+  Block block;
+  block.data = static_cast<char *>( ::operator new( block_size ) );
+  block.size = block_size;
+  blocks.push_back( block );
+  used = 0;
+}
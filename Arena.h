@@ -0,0 +1,94 @@
+/* ************************************************************************** *
+ *                           Frank Nathan Beckwith                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** */
+
+#ifndef GUARD_ARENA_H
+#define GUARD_ARENA_H
+
+// Project-specific headers;
+
+// System headers;
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace fem {
+
+/* Bump allocator for objects that live as long as their owner (the elements
+ * and materials of a domain; nodes live in the `Node_Store').  Memory is
+ * carved from large blocks by advancing an offset, so creating an object costs
+ * no call to `new,' and every block is returned at once when the arena is
+ * destroyed.  The arena never runs destructors:  the owner destroys the
+ * objects it created (see `Domain::~Domain') before the arena releases the
+ * memory. */
+class Arena {
+
+public:
+
+  /* ****************************  COPY CONTROL  **************************** */
+
+  /* Default constructor */
+  Arena( ) : blocks{ }, used{ 0 }, next_size{ 4096 } { }
+
+  /* Copy and move (Deleted) */
+  Arena( const Arena & other ) = delete;
+  Arena( Arena && other ) = delete;
+  Arena & operator=( const Arena & rhs ) = delete;
+  Arena && operator=( Arena && rhs ) = delete;
+
+  /* Destructor */
+  ~Arena( ) { release( ); }
+
+  /* **********************  PUBLIC MEMBER FUNCTIONS  *********************** */
+
+  /* Given the size and alignment (a power of two), return uninitialized
+   * memory that stays valid until `release.' */
+  void * allocate( std::size_t size, std::size_t align );
+
+  /* Given the constructor arguments, construct a `T' in the arena. */
+  template <typename T, typename... Args>
+    T * create( Args &&... args ) {
+      void * mem = allocate( sizeof( T ), alignof( T ) );
+      return new( mem ) T( std::forward<Args>( args )... );
+    }
+
+  /* Given a number of bytes, make sure the next allocations totalling that
+   * many bytes (plus alignment padding) need no new block. */
+  void reserve( std::size_t size );
+
+  /* Free every block at once.  Objects in the arena are not destroyed. */
+  void release( );
+
+private:
+
+  /* ************************  PRIVATE DATA MEMBERS  ************************ */
+
+  struct Block {
+    char * data;
+    std::size_t size;
+  };
+
+  std::vector<Block> blocks;  // Allocations come from the last block;
+  std::size_t used;           // Bytes used in the last block;
+  std::size_t next_size;      // Size of the next block (doubles);
+
+  /* **********************  PRIVATE MEMBER FUNCTIONS  ********************** */
+
+  /* Given a number of bytes, start a new block holding at least that many. */
+  void add_block( std::size_t size );
+
+};
+
+} // namespace fem;
+
+#endif
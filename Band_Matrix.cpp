@@ -0,0 +1,216 @@
+/* ************************************************************************** *
+ *                           Frank Nathan Beckwith                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** *
+ *                                                                            *
+ * Source file for the implementation of the Band_Matrix abstraction.         *
+ * Class definition given in Band_Matrix.h.                                   *
+ *                                                                            *
+ * ************************************************************************** */
+
+// Project-specific headers;
+#include "Band_Matrix.h"
+
+// System headers;
+#include <algorithm>
+#include <cmath>
+
+/* ***********************  PUBLIC MEMBER FUNCTIONS  ************************ */
+
+/* Given the number of rows and the half-bandwidth, resize and zero the
+ * matrix. */
+void fem::Band_Matrix::resize( std::size_t n, std::size_t bw )
+{
+  num_rows = n;
+  band_width = bw;
+  coeffs.assign( n * ( bw + 1 ), 0.0 );
+  factored = NONE;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Zero the coefficients, keeping the current size. */
+void fem::Band_Matrix::set_zero( )
+{
+  std::fill( coeffs.begin( ), coeffs.end( ), 0.0 );
+  factored = NONE;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Overwrite the matrix with its lower Cholesky factor, L.  Returns false if a
+ * non-positive pivot is found (matrix not positive definite). */
+bool fem::Band_Matrix::factorize( )
+{
+  const std::size_t stride = band_width + 1;
+
+  // Column-oriented Cholesky restricted to the band;
+  for( std::size_t j{ 0 }; j != num_rows; ++j ) {
+    double * col_j = &coeffs[j * stride];
+
+    // Take the square root of the pivot and scale the column below it;
+    if( !( col_j[0] > 0.0 ) )
+      return false;
+    double pivot = std::sqrt( col_j[0] );
+    col_j[0] = pivot;
+    std::size_t len = std::min( band_width, num_rows - 1 - j );
+    for( std::size_t k{ 1 }; k <= len; ++k )
+      col_j[k] /= pivot;
+
+    // Update the trailing columns within the band;
+    for( std::size_t k{ 1 }; k <= len; ++k ) {
+      double * col_k = &coeffs[( j + k ) * stride];
+      for( std::size_t i{ k }; i <= len; ++i )
+        col_k[i - k] -= col_j[i] * col_j[k];
+    }
+  }
+  factored = CHOLESKY;
+  return true;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Overwrite the matrix with its square-root free factorization, L D L^T.
+ * Returns false if a non-positive pivot is found. */
+bool fem::Band_Matrix::factorize_ldlt( )
+{
+  bool pos_def{ false };
+  if( band_width == 1 )
+    pos_def = factor_ldlt_kernel<1>( );
+  else if( band_width == 2 )
+    pos_def = factor_ldlt_kernel<2>( );
+  else
+    pos_def = factor_ldlt_kernel<0>( );
+  if( pos_def )
+    factored = LDLT;
+  return pos_def;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given a set of right-hand sides (one per column), solve the system for all
+ * of them together using the held factor.
+ * PRECONDITION:  The matrix must be factored. */
+Eigen::MatrixXd fem::Band_Matrix::solve( const Eigen::MatrixXd & rhs ) const
+{
+  // The L D L^T recurrences run down each column in place;
+  if( factored == LDLT ) {
+    Eigen::MatrixXd sol = rhs;
+    for( Eigen::Index c{ 0 }; c != sol.cols( ); ++c ) {
+      if( band_width == 1 )
+        solve_ldlt_kernel<1>( sol.col( c ).data( ) );
+      else if( band_width == 2 )
+        solve_ldlt_kernel<2>( sol.col( c ).data( ) );
+      else
+        solve_ldlt_kernel<0>( sol.col( c ).data( ) );
+    }
+    return sol;
+  }
+
+  // Store row-major so that each factor entry is applied to all columns with
+  // unit stride;
+  const std::size_t stride = band_width + 1;
+  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>
+    sol = rhs;
+
+  // Forward substitution, L y = f;
+  for( std::size_t j{ 0 }; j != num_rows; ++j ) {
+    const double * col_j = &coeffs[j * stride];
+    sol.row( j ) /= col_j[0];
+    std::size_t len = std::min( band_width, num_rows - 1 - j );
+    for( std::size_t k{ 1 }; k <= len; ++k )
+      sol.row( j + k ) -= col_j[k] * sol.row( j );
+  }
+
+  // Backward substitution, L^T d = y;
+  for( std::size_t j = num_rows; j-- != 0; ) {
+    const double * col_j = &coeffs[j * stride];
+    std::size_t len = std::min( band_width, num_rows - 1 - j );
+    for( std::size_t k{ 1 }; k <= len; ++k )
+      sol.row( j ) -= col_j[k] * sol.row( j + k );
+    sol.row( j ) /= col_j[0];
+  }
+  return sol;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given a vector, return the product of the (unfactored) matrix with it. */
+Eigen::VectorXd fem::Band_Matrix::multiply( const Eigen::VectorXd & vec ) const
+{
+  const std::size_t stride = band_width + 1;
+  Eigen::VectorXd prod = Eigen::VectorXd::Zero( num_rows );
+
+  // Loop the stored lower band and apply each entry and its transpose;
+  for( std::size_t j{ 0 }; j != num_rows; ++j ) {
+    const double * col_j = &coeffs[j * stride];
+    prod[j] += col_j[0] * vec[j];
+    std::size_t len = std::min( band_width, num_rows - 1 - j );
+    for( std::size_t k{ 1 }; k <= len; ++k ) {
+      prod[j + k] += col_j[k] * vec[j];
+      prod[j] += col_j[k] * vec[j + k];
+    }
+  }
+  return prod;
+}
+
+/* ***********************  PRIVATE MEMBER FUNCTIONS  *********************** */
+
+/* L D L^T factorization for a half-bandwidth of `Width' (zero for the run-time
+ * width).  Returns false if a non-positive pivot is found. */
+template <std::size_t Width>
+bool fem::Band_Matrix::factor_ldlt_kernel( )
+{
+  const std::size_t bw = Width ? Width : band_width;
+  const std::size_t stride = bw + 1;
+
+  for( std::size_t j{ 0 }; j != num_rows; ++j ) {
+    double * col_j = &coeffs[j * stride];
+    double pivot = col_j[0];
+    if( !( pivot > 0.0 ) )
+      return false;
+
+    // Update the trailing columns with the unscaled entries, then scale;
+    std::size_t len = std::min( bw, num_rows - 1 - j );
+    for( std::size_t k{ 1 }; k <= len; ++k ) {
+      double * col_k = &coeffs[( j + k ) * stride];
+      double scaled = col_j[k] / pivot;
+      for( std::size_t i{ k }; i <= len; ++i )
+        col_k[i - k] -= col_j[i] * scaled;
+    }
+    for( std::size_t k{ 1 }; k <= len; ++k )
+      col_j[k] /= pivot;
+  }
+  return true;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given a right-hand side, overwrite it with the solution using the L D L^T
+ * factor of half-bandwidth `Width' (zero for the run-time width). */
+template <std::size_t Width>
+void fem::Band_Matrix::solve_ldlt_kernel( double * sol ) const
+{
+  const std::size_t bw = Width ? Width : band_width;
+  const std::size_t stride = bw + 1;
+
+  // Forward substitution, L y = f;
+  for( std::size_t j{ 0 }; j != num_rows; ++j ) {
+    const double * col_j = &coeffs[j * stride];
+    std::size_t len = std::min( bw, num_rows - 1 - j );
+    for( std::size_t k{ 1 }; k <= len; ++k )
+      sol[j + k] -= col_j[k] * sol[j];
+  }
+
+  // Diagonal and backward substitution, D L^T d = y;
+  for( std::size_t j = num_rows; j-- != 0; ) {
+    const double * col_j = &coeffs[j * stride];
+    std::size_t len = std::min( bw, num_rows - 1 - j );
+    double val = sol[j] / col_j[0];
+    for( std::size_t k{ 1 }; k <= len; ++k )
+      val -= col_j[k] * sol[j + k];
+    sol[j] = val;
+  }
+}
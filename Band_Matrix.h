@@ -0,0 +1,126 @@
+/* ************************************************************************** *
+ *                           Frank Nathan Beckwith                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** */
+
+#ifndef GUARD_BAND_MATRIX_H
+#define GUARD_BAND_MATRIX_H
+
+// Project-specific headers;
+
+// System headers;
+#include <cstddef>
+#include <Eigen/Dense>
+#include <vector>
+
+namespace fem {
+
+/* Symmetric band matrix.  Only the lower band (diagonal plus `band_width'
+ * sub-diagonals) is stored, column by column, so that the storage and the
+ * Cholesky factorization are linear in the number of rows. */
+class Band_Matrix {
+
+public:
+
+  /* ****************************  ENUMERATIONS  **************************** */
+
+  /* Enumeration of the factor currently held in `coeffs.' */
+  enum factor_type { NONE, CHOLESKY, LDLT };
+
+  /* ****************************  COPY CONTROL  **************************** */
+
+  /* Default constructor */
+  Band_Matrix( ) :
+    num_rows{ 0 }, band_width{ 0 }, coeffs{ }, factored{ NONE }
+  { }
+
+  /* Given the number of rows and the half-bandwidth, create a zero matrix. */
+  Band_Matrix( std::size_t n, std::size_t bw ) :
+    num_rows{ n }, band_width{ bw }, coeffs( n * ( bw + 1 ), 0.0 ),
+    factored{ NONE }
+  { }
+
+  /* **********************  PUBLIC MEMBER FUNCTIONS  *********************** */
+
+  /* Given the number of rows and the half-bandwidth, resize and zero the
+   * matrix. */
+  void resize( std::size_t n, std::size_t bw );
+
+  /* Zero the coefficients, keeping the current size. */
+  void set_zero( );
+
+  /* Return the number of rows (and columns) of the matrix. */
+  std::size_t rows( ) const { return num_rows; }
+
+  /* Return the half-bandwidth of the matrix. */
+  std::size_t get_band_width( ) const { return band_width; }
+
+  /* Return true if the matrix holds one of its factors. */
+  bool is_factored( ) const { return factored != NONE; }
+
+  /* Given the row and column, i & j, add `val' to the coefficient.  Entries in
+   * the upper triangle are ignored since they are implied by symmetry.
+   * PRECONDITION:  |i - j| <= band_width. */
+  inline void add( std::size_t i, std::size_t j, double val ) {
+    if( i >= j )
+      coeffs[j * ( band_width + 1 ) + ( i - j )] += val;
+  }
+
+  /* Given the row and column, i & j, return the coefficient.
+   * PRECONDITION:  |i - j| <= band_width. */
+  inline double operator()( std::size_t i, std::size_t j ) const {
+    return ( i >= j ) ? coeffs[j * ( band_width + 1 ) + ( i - j )]
+                      : coeffs[i * ( band_width + 1 ) + ( j - i )];
+  }
+
+  /* Overwrite the matrix with its lower Cholesky factor, L.  Returns false if
+   * a non-positive pivot is found (matrix not positive definite). */
+  bool factorize( );
+
+  /* Overwrite the matrix with its square-root free factorization, L D L^T,
+   * storing D on the diagonal and the unit lower factor below it.  For a
+   * half-bandwidth of one this is the Thomas algorithm and for two the
+   * pentadiagonal (2x2 block) recurrence; both are unrolled at compile time.
+   * Returns false if a non-positive pivot is found. */
+  bool factorize_ldlt( );
+
+  /* Given a set of right-hand sides (one per column), solve the system for
+   * all of them together using the held factor.
+   * PRECONDITION:  The matrix must be factored. */
+  Eigen::MatrixXd solve( const Eigen::MatrixXd & rhs ) const;
+
+  /* Given a vector, return the product of the (unfactored) matrix with it. */
+  Eigen::VectorXd multiply( const Eigen::VectorXd & vec ) const;
+
+private:
+
+  /* ************************  PRIVATE DATA MEMBERS  ************************ */
+
+  std::size_t num_rows;         // Number of rows and columns;
+  std::size_t band_width;       // Number of sub-diagonals stored;
+  std::vector<double> coeffs;   // Lower band stored column by column;
+  factor_type factored;         // Factor held in `coeffs,' if any;
+
+  /* **********************  PRIVATE MEMBER FUNCTIONS  ********************** */
+
+  /* L D L^T kernels for a half-bandwidth of `Width' (zero for any width),
+   * see `factorize_ldlt' and `solve.' */
+  template <std::size_t Width>
+  bool factor_ldlt_kernel( );
+
+  template <std::size_t Width>
+  void solve_ldlt_kernel( double * sol ) const;
+
+};
+
+} // namespace fem;
+
+#endif
@@ -0,0 +1,146 @@
+/* ************************************************************************** *
+ *                           Frank Nathan Beckwith                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** */
+
+#ifndef GUARD_CONDENSATION_H
+#define GUARD_CONDENSATION_H
+
+// Project-specific headers;
+
+// System headers;
+#include <cstddef>
+#include <Eigen/Dense>
+
+namespace fem {
+
+/* Static condensation of the pressure modes of a u-p element.  Given the
+ * dilation coupling, G (N x P), and the (symmetric, negative definite)
+ * pressure constraint, M (P x P), the recovery operator is R = -M^{-1} G^T
+ * and the condensed stiffness is K = K_mu + G R.  The kernels are templated on
+ * the number of pressure modes and invert M in closed form (P = 1 or 2), so no
+ * LU is formed. */
+
+/* *************************  CLOSED-FORM INVERSE  ************************** */
+
+/* Given the number of pressure modes, the closed-form inverse of `len'
+ * symmetric P x P matrices stored column-major at `m,' entry k of matrix e at
+ * m[k * stride + e].  The inverses are written to `inv' in the same layout
+ * with `inv_stride.' */
+template <int P>
+struct Pressure_Inverse;
+
+template <>
+struct Pressure_Inverse<1> {
+  static void apply( const double * m, std::size_t, double * inv,
+      std::size_t, std::size_t len ) {
+    for( std::size_t e{ 0 }; e != len; ++e )
+      inv[e] = 1.0 / m[e];
+  }
+};
+
+template <>
+struct Pressure_Inverse<2> {
+  static void apply( const double * m, std::size_t stride, double * inv,
+      std::size_t inv_stride, std::size_t len ) {
+    const double * m00 = m;
+    const double * m01 = m + stride;
+    const double * m11 = m + 3 * stride;
+    double * inv00 = inv;
+    double * inv01 = inv + inv_stride;
+    double * inv10 = inv + 2 * inv_stride;
+    double * inv11 = inv + 3 * inv_stride;
+    for( std::size_t e{ 0 }; e != len; ++e ) {
+      double inv_det = 1.0 / ( m00[e] * m11[e] - m01[e] * m01[e] );
+      inv00[e] = m11[e] * inv_det;
+      inv01[e] = -m01[e] * inv_det;
+      inv10[e] = -m01[e] * inv_det;
+      inv11[e] = m00[e] * inv_det;
+    }
+  }
+};
+
+/* **************************  PER-ELEMENT KERNEL  ************************** */
+
+/* Given the coupling, G, and the constraint, M, of one element, add the
+ * condensation to the stiffness, K += G R, and store the recovery operator,
+ * R = -M^{-1} G^T. */
+template <int N, int P>
+void condense( const Eigen::Matrix<double, N, P> & div_op,
+    const Eigen::Matrix<double, P, P> & constr_op,
+    Eigen::Matrix<double, N, N> & stiff,
+    Eigen::Matrix<double, P, N> & recover )
+{
+  Eigen::Matrix<double, P, P> inv;
+  Pressure_Inverse<P>::apply( constr_op.data( ), 1, inv.data( ), 1, 1 );
+  recover.noalias( ) = -( inv * div_op.transpose( ) );
+  stiff.noalias( ) += div_op * recover;
+}
+
+/* ****************************  BATCHED KERNEL  **************************** */
+
+/* Given the number of elements and their coupling, constraint and (uncondensed)
+ * stiffness in structure-of-arrays layout (column-major entry k of element e
+ * at [k * count + e]), condense every element in place and write the recovery
+ * operators in the same layout.  The element loop is innermost, so every
+ * operation is a unit-stride sweep that the compiler vectorizes.
+ * Assembly does not call it:  the stiffness cache refills only the dirty
+ * elements, one at a time through the virtual `compute_stiffness,' and at the
+ * baseline SSE2 width the batch gains little over `condense' (about a fifth
+ * for quadratic elements, a loss for linear ones) before the gather and
+ * scatter are even counted.  It serves `bench/alloc_count' and callers that
+ * already hold the element data in this layout. */
+template <int N, int P>
+void condense_batch( std::size_t count, const double * div_op,
+    const double * constr_op, double * stiff, double * recover )
+{
+  // Work in blocks so the inverses stay in a small stack buffer;
+  const std::size_t block = 64;
+  double inv[P * P * block];
+  for( std::size_t begin{ 0 }; begin < count; begin += block ) {
+    const std::size_t len = ( count - begin < block ) ? count - begin : block;
+
+    // Closed-form inverse of every constraint in the block;
+    Pressure_Inverse<P>::apply( constr_op + begin, count, inv, block, len );
+
+    // R( p, b ) = -sum_q Minv( p, q ) G( b, q );
+    for( int b{ 0 }; b != N; ++b ) {
+      for( int p{ 0 }; p != P; ++p ) {
+        double * out = recover + ( b * P + p ) * count + begin;
+        for( std::size_t e{ 0 }; e != len; ++e )
+          out[e] = 0.0;
+        for( int q{ 0 }; q != P; ++q ) {
+          const double * m = inv + ( q * P + p ) * block;
+          const double * g = div_op + ( q * N + b ) * count + begin;
+          for( std::size_t e{ 0 }; e != len; ++e )
+            out[e] -= m[e] * g[e];
+        }
+      }
+    }
+
+    // K( a, b ) += sum_p G( a, p ) R( p, b );
+    for( int b{ 0 }; b != N; ++b ) {
+      for( int a{ 0 }; a != N; ++a ) {
+        double * k = stiff + ( b * N + a ) * count + begin;
+        for( int p{ 0 }; p != P; ++p ) {
+          const double * g = div_op + ( p * N + a ) * count + begin;
+          const double * r = recover + ( b * P + p ) * count + begin;
+          for( std::size_t e{ 0 }; e != len; ++e )
+            k[e] += g[e] * r[e];
+        }
+      }
+    }
+  }
+}
+
+} // namespace fem;
+
+#endif
@@ -0,0 +1,205 @@
+/* ************************************************************************** *
+ *                           Frank Nathan Beckwith                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** *
+ *                                                                            *
+ * Source file for the implementation of the Conjugate_Gradient abstraction.  *
+ * Class definition given in Conjugate_Gradient.h.                            *
+ *                                                                            *
+ * ************************************************************************** */
+
+// Project-specific headers;
+#include "Conjugate_Gradient.h"
+
+// System headers;
+#include <algorithm>
+#include <cmath>
+
+/* ***********************  PUBLIC MEMBER FUNCTIONS  ************************ */
+
+/* Given the matrix and the preconditioner type, store the matrix and build the
+ * preconditioner.  If IC(0) breaks down (non-positive pivot), Jacobi is used
+ * instead and false is returned. */
+bool fem::Conjugate_Gradient::compute( const Eigen::SparseMatrix<double> & mat,
+    precond_type type )
+{
+  matrix = mat;
+  oper = nullptr;
+  grid = nullptr;
+  inv_diag = matrix.diagonal( ).cwiseInverse( );
+  precond = type;
+  if( precond == INCOMPLETE_CHOLESKY && !factor_incomplete( ) ) {
+    precond = JACOBI;
+    factor.resize( 0, 0 );
+    return false;
+  }
+  return true;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given a matrix-free operator, keep a reference to it and use the Jacobi
+ * preconditioner.  The operator must outlive the solves. */
+void fem::Conjugate_Gradient::compute( const Stiffness_Operator & op )
+{
+  matrix.resize( 0, 0 );
+  factor.resize( 0, 0 );
+  oper = &op;
+  grid = nullptr;
+  inv_diag = op.diagonal( ).cwiseInverse( );
+  precond = JACOBI;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given the matrix and a multigrid hierarchy built on it, store the matrix and
+ * use one multigrid cycle as the preconditioner.  The hierarchy must outlive
+ * the solves. */
+void fem::Conjugate_Gradient::compute( const Eigen::SparseMatrix<double> & mat,
+    const Multigrid & mg )
+{
+  matrix = mat;
+  oper = nullptr;
+  grid = &mg;
+  inv_diag.resize( 0 );
+  factor.resize( 0, 0 );
+  precond = MULTIGRID;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given a set of right-hand sides (one per column) and initial guesses of the
+ * same size (or empty to start from zero), iterate every column to the
+ * tolerance and return the solutions.
+ * PRECONDITION:  `compute' must have been called. */
+Eigen::MatrixXd fem::Conjugate_Gradient::solve( const Eigen::MatrixXd & rhs,
+    const Eigen::MatrixXd & guess )
+{
+  const std::size_t max_iter =
+    max_iterations ? max_iterations : 10 * rhs.rows( );
+  Eigen::MatrixXd sol = Eigen::MatrixXd::Zero( rhs.rows( ), rhs.cols( ) );
+  if( guess.rows( ) == rhs.rows( ) && guess.cols( ) == rhs.cols( ) )
+    sol = guess;
+  iterations.assign( rhs.cols( ), 0 );
+  residuals.assign( rhs.cols( ), std::vector<double>( ) );
+  converged = true;
+
+  Eigen::VectorXd res, dir, prod, pre_res;
+  for( Eigen::Index c{ 0 }; c != rhs.cols( ); ++c ) {
+    // A zero load has the zero solution;
+    double norm_f = rhs.col( c ).norm( );
+    if( norm_f == 0.0 ) {
+      sol.col( c ).setZero( );
+      residuals[c].push_back( 0.0 );
+      continue;
+    }
+
+    // Initial residual from the guess;
+    std::vector<double> & history = residuals[c];
+    res = rhs.col( c ) - multiply( sol.col( c ) );
+    history.push_back( res.norm( ) / norm_f );
+    if( history.back( ) <= tolerance )
+      continue;
+
+    // Standard preconditioned conjugate gradient iterations;
+    pre_res = apply_precond( res );
+    dir = pre_res;
+    double rz = res.dot( pre_res );
+    for( std::size_t k{ 0 }; k != max_iter; ++k ) {
+      prod = multiply( dir );
+      double alpha = rz / dir.dot( prod );
+      sol.col( c ) += alpha * dir;
+      res -= alpha * prod;
+      ++iterations[c];
+      history.push_back( res.norm( ) / norm_f );
+      if( history.back( ) <= tolerance )
+        break;
+
+      pre_res = apply_precond( res );
+      double rz_new = res.dot( pre_res );
+      dir = pre_res + ( rz_new / rz ) * dir;
+      rz = rz_new;
+    }
+    converged = converged && history.back( ) <= tolerance;
+  }
+  return sol;
+}
+
+/* ***********************  PRIVATE MEMBER FUNCTIONS  *********************** */
+
+/* Compute the IC(0) factor in place on the lower triangle of `matrix.'
+ * Returns false on a non-positive pivot. */
+bool fem::Conjugate_Gradient::factor_incomplete( )
+{
+  factor = matrix.triangularView<Eigen::Lower>( );
+  factor.makeCompressed( );
+  const auto * outer = factor.outerIndexPtr( );
+  const auto * inner = factor.innerIndexPtr( );
+  double * values = factor.valuePtr( );
+
+  // Right-looking Cholesky that drops every update outside the pattern;
+  for( Eigen::Index k{ 0 }; k != factor.cols( ); ++k ) {
+    auto start = outer[k];
+    auto stop = outer[k + 1];
+    if( start == stop || inner[start] != k || !( values[start] > 0.0 ) )
+      return false;
+    double pivot = std::sqrt( values[start] );
+    values[start] = pivot;
+    for( auto p = start + 1; p != stop; ++p )
+      values[p] /= pivot;
+
+    // Update the trailing columns on the existing pattern only;
+    for( auto p = start + 1; p != stop; ++p ) {
+      auto j = inner[p];
+      for( auto q = p; q != stop; ++q ) {
+        const auto * pos =
+          std::lower_bound( inner + outer[j], inner + outer[j + 1], inner[q] );
+        if( pos != inner + outer[j + 1] && *pos == inner[q] )
+          values[pos - inner] -= values[q] * values[p];
+      }
+    }
+  }
+  return true;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given a vector, return the product with the matrix (or operator). */
+Eigen::VectorXd
+fem::Conjugate_Gradient::multiply( const Eigen::VectorXd & vec ) const
+{
+  if( oper )
+    return oper->apply( vec );
+  return matrix * vec;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given a residual, return the preconditioned residual, z = M^{-1} r. */
+Eigen::VectorXd
+fem::Conjugate_Gradient::apply_precond( const Eigen::VectorXd & res ) const
+{
+  if( precond == JACOBI )
+    return res.cwiseProduct( inv_diag );
+  if( precond == MULTIGRID )
+    return grid->cycle( res );
+
+  // Forward and backward substitution with the IC(0) factor, L L^T z = r;
+  const auto * outer = factor.outerIndexPtr( );
+  const auto * inner = factor.innerIndexPtr( );
+  const double * values = factor.valuePtr( );
+  Eigen::VectorXd pre_res = res;
+  for( Eigen::Index j{ 0 }; j != factor.cols( ); ++j ) {
+    pre_res[j] /= values[outer[j]];
+    for( auto p = outer[j] + 1; p != outer[j + 1]; ++p )
+      pre_res[inner[p]] -= values[p] * pre_res[j];
+  }
+  for( Eigen::Index j = factor.cols( ); j-- != 0; ) {
+    for( auto p = outer[j] + 1; p != outer[j + 1]; ++p )
+      pre_res[j] -= values[p] * pre_res[inner[p]];
+    pre_res[j] /= values[outer[j]];
+  }
+  return pre_res;
+}
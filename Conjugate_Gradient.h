@@ -0,0 +1,134 @@
+/* ************************************************************************** *
+ *                           Frank Nathan Beckwith                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** */
+
+#ifndef GUARD_CONJUGATE_GRADIENT_H
+#define GUARD_CONJUGATE_GRADIENT_H
+
+// Project-specific headers;
+#include "Multigrid.h"
+#include "Stiffness_Operator.h"
+
+// System headers;
+#include <cstddef>
+#include <Eigen/Dense>
+#include <Eigen/Sparse>
+#include <vector>
+
+namespace fem {
+
+/* Preconditioned conjugate gradient solver for a symmetric positive definite
+ * sparse matrix (both triangles stored) or matrix-free stiffness operator.
+ * The preconditioner is either the inverse diagonal (Jacobi) or, for a
+ * matrix, the zero fill-in incomplete Cholesky factor, IC(0), computed on the
+ * lower triangle of the matrix pattern, or one symmetric multigrid cycle (see
+ * `Multigrid').  Every solve records the iteration count and the relative
+ * residual history of each right-hand side. */
+class Conjugate_Gradient {
+
+public:
+
+  /* ****************************  ENUMERATIONS  **************************** */
+
+  /* Enumeration of the available preconditioners. */
+  enum precond_type { JACOBI, INCOMPLETE_CHOLESKY, MULTIGRID };
+
+  /* ****************************  COPY CONTROL  **************************** */
+
+  /* Default constructor */
+  Conjugate_Gradient( ) :
+    matrix{ }, oper{ nullptr }, grid{ nullptr }, precond{ JACOBI },
+    inv_diag{ }, factor{ }, tolerance{ 1e-10 }, max_iterations{ 0 },
+    iterations{ }, residuals{ }, converged{ false }
+  { }
+
+  /* **********************  PUBLIC MEMBER FUNCTIONS  *********************** */
+
+  /* Given the relative residual tolerance, ||r|| <= tol ||f||, and the maximum
+   * number of iterations (zero for ten times the number of rows), set the
+   * stopping criteria. */
+  void set_tolerance( double tol, std::size_t max_iter = 0 ) {
+    tolerance = tol;
+    max_iterations = max_iter;
+  }
+
+  /* Given the matrix and the preconditioner type, store the matrix and build
+   * the preconditioner.  If IC(0) breaks down (non-positive pivot), Jacobi is
+   * used instead and false is returned. */
+  bool compute( const Eigen::SparseMatrix<double> & mat, precond_type type );
+
+  /* Given a matrix-free operator, keep a reference to it and use the Jacobi
+   * preconditioner.  The operator must outlive the solves. */
+  void compute( const Stiffness_Operator & op );
+
+  /* Given the matrix and a multigrid hierarchy built on it, store the matrix
+   * and use one multigrid cycle as the preconditioner.  The hierarchy must
+   * outlive the solves. */
+  void compute( const Eigen::SparseMatrix<double> & mat, const Multigrid & mg );
+
+  /* Given a set of right-hand sides (one per column) and initial guesses of
+   * the same size (or empty to start from zero), iterate every column to the
+   * tolerance and return the solutions.
+   * PRECONDITION:  `compute' must have been called. */
+  Eigen::MatrixXd solve( const Eigen::MatrixXd & rhs,
+      const Eigen::MatrixXd & guess = Eigen::MatrixXd( ) );
+
+  /* Return the preconditioner in use (after any fallback). */
+  precond_type get_preconditioner( ) const { return precond; }
+
+  /* Return true if every column of the last solve reached the tolerance. */
+  bool is_converged( ) const { return converged; }
+
+  /* Return the iteration count of every column of the last solve. */
+  const std::vector<std::size_t> & get_iterations( ) const {
+    return iterations;
+  }
+
+  /* Return the relative residual history, ||r_k|| / ||f||, of every column of
+   * the last solve (starting with the initial residual). */
+  const std::vector<std::vector<double> > & get_residuals( ) const {
+    return residuals;
+  }
+
+private:
+
+  /* ************************  PRIVATE DATA MEMBERS  ************************ */
+
+  Eigen::SparseMatrix<double> matrix;           // System matrix;
+  const Stiffness_Operator * oper;              // Or matrix-free operator;
+  const Multigrid * grid;                       // Multigrid preconditioner;
+  precond_type precond;                         // Preconditioner in use;
+  Eigen::VectorXd inv_diag;                     // Jacobi preconditioner;
+  Eigen::SparseMatrix<double> factor;           // IC(0) lower factor;
+  double tolerance;                             // Relative residual target;
+  std::size_t max_iterations;                   // Zero for ten times the rows;
+  std::vector<std::size_t> iterations;          // Per column of last solve;
+  std::vector<std::vector<double> > residuals;  // Per column of last solve;
+  bool converged;                               // Last solve converged;
+
+  /* **********************  PRIVATE MEMBER FUNCTIONS  ********************** */
+
+  /* Compute the IC(0) factor in place on the lower triangle of `matrix.'
+   * Returns false on a non-positive pivot. */
+  bool factor_incomplete( );
+
+  /* Given a vector, return the product with the matrix (or operator). */
+  Eigen::VectorXd multiply( const Eigen::VectorXd & vec ) const;
+
+  /* Given a residual, return the preconditioned residual, z = M^{-1} r. */
+  Eigen::VectorXd apply_precond( const Eigen::VectorXd & res ) const;
+
+};
+
+} // namespace fem;
+
+#endif
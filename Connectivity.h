@@ -0,0 +1,100 @@
+/* ************************************************************************** *
+ *                           Frank Nathan Beckwith                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** */
+
+#ifndef GUARD_CONNECTIVITY_H
+#define GUARD_CONNECTIVITY_H
+
+// Project-specific headers;
+
+// System headers;
+#include <cstddef>
+#include <vector>
+
+namespace fem {
+
+/* Element connectivity in compressed sparse row form:  the node IDs of every
+ * element are stored back to back in one flat array, and element e owns the
+ * entries [ offsets[e], offsets[e + 1] ).  Elements keep only a pointer to the
+ * table and read their nodes as a view into it, so no element allocates and
+ * element loops read the node IDs sequentially. */
+class Connectivity {
+
+public:
+
+  /* ****************************  COPY CONTROL  **************************** */
+
+  /* Default constructor */
+  Connectivity( ) : offsets{ 0 }, node_ids{ } { }
+
+  /* **********************  PUBLIC MEMBER FUNCTIONS  *********************** */
+
+  /* Given the node IDs of an element, append a row and return its index. */
+  std::size_t add( const std::vector<std::size_t> & nodes ) {
+    node_ids.insert( node_ids.end( ), nodes.begin( ), nodes.end( ) );
+    offsets.push_back( node_ids.size( ) );
+    return offsets.size( ) - 2;
+  }
+
+  /* Given the number of nodes per element and the node IDs of a set of such
+   * elements back to back, append a row for each and return the index of the
+   * first. */
+  std::size_t add_rows( std::size_t row_size,
+      const std::vector<std::size_t> & nodes ) {
+    std::size_t first = size( );
+    std::size_t count = nodes.size( ) / row_size;
+    node_ids.insert( node_ids.end( ), nodes.begin( ),
+        nodes.begin( ) + count * row_size );
+    offsets.reserve( offsets.size( ) + count );
+    for( std::size_t e{ 0 }; e != count; ++e )
+      offsets.push_back( offsets.back( ) + row_size );
+    return first;
+  }
+
+  /* Given the expected number of elements and of node IDs over all of them,
+   * reserve storage for them. */
+  void reserve( std::size_t num_eles, std::size_t num_ids ) {
+    offsets.reserve( num_eles + 1 );
+    node_ids.reserve( num_ids );
+  }
+
+  /* Return the number of elements (rows). */
+  std::size_t size( ) const { return offsets.size( ) - 1; }
+
+  /* Given the element index, return the number of element nodes. */
+  inline std::size_t get_num_nodes( std::size_t e ) const {
+    return offsets[e + 1] - offsets[e];
+  }
+
+  /* Given the element index, return a view of its node IDs (valid until the
+   * next `add'). */
+  inline const std::size_t * get_nodes( std::size_t e ) const {
+    return node_ids.data( ) + offsets[e];
+  }
+
+  /* Given the element index and the local node number, return the node ID. */
+  inline std::size_t get_node( std::size_t e, std::size_t a ) const {
+    return node_ids[offsets[e] + a];
+  }
+
+private:
+
+  /* ************************  PRIVATE DATA MEMBERS  ************************ */
+
+  std::vector<std::size_t> offsets;   // Row e is [ offsets[e], offsets[e+1] );
+  std::vector<std::size_t> node_ids;  // Node IDs of every element;
+
+};
+
+} // namespace fem;
+
+#endif
@@ -33,16 +33,15 @@ Eigen::Vector3d fem::Disp_Ele::interp_stress( double xi ) const
 
 /* ************************  NESTED CLASS FUNCTIONS  ************************ */
 
-double fem::Disp_Ele::K_Func::operator()( double xi ) const
+void fem::Disp_Ele::K_Func::operator()( double xi, double weight )
 {
-  // Get required matrices and info;
+  // Get required matrices and info once for the point;
   Eigen::Matrix2d elastic_mod = parent->material->get_tangent( );
   double radius = parent->interp_coord( xi );
   double rad_deriv = parent->interp_coord_deriv( xi );
-  Eigen::Vector2d B_a = parent->get_gradient_matrix( xi, a );
-  Eigen::Vector2d B_b = parent->get_gradient_matrix( xi, b );
+  Gradient_Matrix B = parent->get_gradient_matrix( xi, radius, rad_deriv );
 
-  // Calculate value;
-  double ret = ( B_a.transpose( ) * elastic_mod * B_b ).value( );
-  return ret * radius * rad_deriv;
+  // Accumulate the outer product over all node pairs;
+  stiff.noalias( ) +=
+    B.transpose( ) * elastic_mod * B * ( radius * rad_deriv * weight );
 }
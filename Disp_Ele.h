@@ -35,18 +35,18 @@ public:
 
   /* ****************************  COPY CONTROL  **************************** */
   /* Default constructor */
-  Disp_Ele( ) : Element( ), material( nullptr ), stiff_eval( this ) { }
+  Disp_Ele( ) : Element( ), material( nullptr ) { }
 
-  Disp_Ele( std::size_t id, std::vector<Node *> nodes, const Material *mat ) :
-    Element( id, nodes ), material( mat->clone( ) ), stiff_eval( this )
+  Disp_Ele( std::size_t id, const Node_Store * store,
+      const Connectivity * conn, const Material *mat ) :
+    Element( id, store, conn ), material( mat )
   { }
 
   Disp_Ele( const Disp_Ele & other ) :
-    Element( other ), material{ other.material->clone( ) },
-    stiff_eval( this ) { }
+    Element( other ), material{ other.material } { }
 
   Disp_Ele( Disp_Ele && other ) :
-    Element( std::move( other ) ), material{ other.material }, stiff_eval( this )
+    Element( std::move( other ) ), material{ other.material }
   {
     other.material = nullptr;
   }
@@ -55,16 +55,18 @@ public:
   Disp_Ele & operator=( const Disp_Ele & ) = delete;
   Disp_Ele && operator=( Disp_Ele && ) = delete;
 
-  virtual ~Disp_Ele( ) { delete material; }
+  virtual ~Disp_Ele( ) { }
 
   /* **********************  PUBLIC MEMBER FUNCTIONS  *********************** */
 
-  /* Returns the stiffness matrix for the given element using the current
-   * consistent tangent. */
-  Eigen::MatrixXd get_stiffness( std::size_t int_order )
+  /* Given the integration order, compute the stiffness matrix using the
+   * current consistent tangent (uncached, see `get_stiffness'). */
+  Element_Matrix compute_stiffness( std::size_t int_order )
   {
-    // Call function from quadrature namespace with `sym = true';
-    return quad::integrate_matrix( stiff_eval, int_order, true );
+    // Accumulate the stiffness in a single pass over the quadrature points;
+    K_Func stiff_eval( this );
+    quad::integrate_points( stiff_eval, int_order );
+    return stiff_eval.stiff;
   }
 
   /* Given the parametric coordinate, xi, interpolate the stresses from the
@@ -76,6 +78,16 @@ public:
    * PRECONDITION:  Element nodes must be updated. */
   void update( ) { ; }
 
+  /* Given a material, share it as the element material (the element does not
+   * own it). */
+  void set_material( const Material * mat ) {
+    material = mat;
+    mark_dirty( );
+  }
+
+  /* Return the element material. */
+  const Material * get_material( ) const { return material; }
+
   /* Given the parametric coordinate, xi, and the local index of the shape
    * function, a, return the value of the shape function. */
   virtual double shape_func( double xi, std::size_t a ) const = 0;
@@ -88,37 +100,31 @@ protected:
 
   /* ***********************  PROTECTED DATA MEMBERS  *********************** */
 
-  Material *material;
+  const Material *material;  // Shared, owned by the domain;
 
 private:
 
   /* ***************************  NESTED CLASSES  *************************** */
 
   /* Function object used in the evaluation of the stiffness matrix.  operator()
-   * overloaded to return the internal energy density at the evaluation point,
-   * xi. */
+   * overloaded to accumulate the internal energy density of every node pair,
+   * B^T D B r J w, at the evaluation point, xi. */
   struct K_Func {
 
     /* Constructor */
-    K_Func( const Disp_Ele * p ) : parent{ p }, a{ 0 }, b{ 0 } { }
+    K_Func( const Disp_Ele * p ) :
+      parent{ p },
+      stiff(
+        Element_Matrix::Zero( p->get_num_nodes( ), p->get_num_nodes( ) ) ) { }
 
-    /* Functions to query the size of the final matrix. */
-    std::size_t get_rows( ) const { return parent->nodes.size( ); }
-    std::size_t get_cols( ) const { return parent->nodes.size( ); }
-
-    /* Given a parametric coordinate, xi, calculate the internal energy density
-     * of the stiffness. */
-    double operator()( double xi ) const;
+    /* Given a parametric coordinate and weight, accumulate the internal energy
+     * density of the stiffness. */
+    void operator()( double xi, double weight );
 
     const Disp_Ele * parent;
-    std::size_t a;
-    std::size_t b;
+    Element_Matrix stiff;
   };
 
-  /* ************************  PRIVATE DATA MEMBERS  ************************ */
-
-  K_Func stiff_eval;
-
 };
 
 } // namespace fem;
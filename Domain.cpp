@@ -14,29 +14,72 @@
 #include "Domain.h"
 
 // System headers;
+#include <algorithm>
 #include <iomanip>
+#include <stdexcept>
+
+/* ************************  PRIVATE MEMBER TEMPLATES  ********************** */
+
+/* Given a function object, call func( e ) for every element, one color at a
+ * time, running the elements of each color concurrently. */
+template <typename Func>
+void fem::Domain::for_each_colored( const Func & func )
+{
+  if( !colors_valid )
+    build_colors( );
+
+  for( std::size_t c{ 0 }; c + 1 < color_offsets.size( ); ++c ) {
+    const std::size_t * color = &color_elements[color_offsets[c]];
+    const std::size_t count = color_offsets[c + 1] - color_offsets[c];
+    auto body = [&]( std::size_t i ) { func( color[i] ); };
+    if( pool )
+      pool->parallel_for( count, body );
+    else
+      for( std::size_t i{ 0 }; i != count; ++i )
+        body( i );
+  }
+}
 
 /* *****************************  COPY CONTROL  ***************************** */
 
 /* Destructor */
 fem::Domain::~Domain( )
 {
-  // Delete the nodes, elements, and materials;
-  for( auto it : nodes )
-    delete it;
-  for( auto it : elements )
-    delete it;
+  // Destroy the elements and materials; the arena frees their memory;
+  for( auto it : elements ) {
+    if( it )
+      it->~Element( );
+  }
   for( auto it : materials )
-    delete it;
+    it->~Material( );
 }
 
 /* ***********************  PUBLIC MEMBER FUNCTIONS  ************************ */
 
+/* Given the expected number of nodes, elements and materials, reserve storage
+ * for them so that building the mesh does not reallocate. */
+void fem::Domain::reserve( std::size_t num_nodes, std::size_t num_elements,
+    std::size_t num_materials )
+{
+  nodes.reserve( num_nodes );
+  connectivity.reserve( num_elements, num_elements * max_ele_nodes );
+  elements.reserve( num_elements );
+  element_mats.reserve( num_elements );
+  materials.reserve( num_materials );
+
+  // Size the arena for the largest element type (plus alignment);
+  using Largest = Lagrange_Ele<2, UP_Ele>;
+  arena.reserve( num_elements * ( sizeof( Largest ) + alignof( Largest ) ) +
+      num_materials * ( sizeof( Material ) + alignof( Material ) ) );
+}
+
+/* -------------------------------------------------------------------------- */
+
 /* Given material properties, Young's modulus and Poisson's ratio, create an
  * elastic material and store in `mats.' */
 void fem::Domain::create_material( double E, double nu )
 {
-  materials.push_back( new Material( E, nu ) );
+  materials.push_back( arena.create<Material>( E, nu ) );
 }
 
 /* -------------------------------------------------------------------------- */
@@ -44,9 +87,9 @@ void fem::Domain::create_material( double E, double nu )
 /* Given a coordinate, create a node and store in `nodes.' */
 void fem::Domain::create_node( double coord )
 {
-  // Use current size of nodes as ID of new node;
-  std::size_t node_ID = nodes.size( );
-  nodes.push_back( new Node( node_ID, coord ) );
+  // The store uses its current size as ID of the new node;
+  nodes.add( coord );
+  invalidate_mesh( );
 }
 
 /* -------------------------------------------------------------------------- */
@@ -54,38 +97,183 @@ void fem::Domain::create_node( double coord )
 /* Given a coordinate, node type, and BC, create a node and store in `nodes.' */
 void fem::Domain::create_node( double coord, Node::node_type type, double bc )
 {
-  // Use current size of nodes as ID of new node;
-  std::size_t node_ID = nodes.size( );
-  nodes.push_back( new Node( node_ID, coord, type, bc ) );
+  // The store uses its current size as ID of the new node;
+  nodes.add( coord, type, bc );
+  invalidate_mesh( );
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given a set of coordinates, create an interior node at each in one call
+ * (node IDs continue from the existing nodes). */
+void fem::Domain::create_nodes( const std::vector<double> & coords )
+{
+  nodes.append( coords );
+  invalidate_mesh( );
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given a node id, a node type, and a BC, overwrite the type and boundary
+ * condition of the node.
+ * PRECONDITION:  Essential boundary nodes must be numbered after every other
+ *                node (the equation number is the node ID). */
+void fem::Domain::set_boundary( std::size_t node_id, Node::node_type type,
+    double bc )
+{
+  nodes.update_type( node_id, type );
+  nodes.update_bc( node_id, bc );
+  invalidate_mesh( );
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given the number of nodes per element (two or three), the node ids of every
+ * element back to back, and a material id, create the elements in one call.
+ * Throws `std::invalid_argument' (creating nothing) if the number of nodes per
+ * element is not two or three or does not divide the connectivity, or if a
+ * node or the material does not exist. */
+void fem::Domain::create_elements( std::size_t nodes_per_ele,
+    const std::vector<std::size_t> & conn, std::size_t mat_id )
+{
+  check_elements( "Domain::create_elements", nodes_per_ele, conn, mat_id );
+
+  const std::size_t num_new = conn.size( ) / nodes_per_ele;
+  const std::size_t first = connectivity.add_rows( nodes_per_ele, conn );
+  elements.reserve( first + num_new );
+  element_mats.resize( first + num_new, mat_id );
+
+  // Construct every element in the arena, choosing the type once;
+  const Material * mat = materials[mat_id];
+  if( nodes_per_ele == 2 ) {
+    using Ele = Lagrange_Ele<1, UP_Ele>;
+    arena.reserve( num_new * ( sizeof( Ele ) + alignof( Ele ) ) );
+    for( std::size_t e{ first }; e != first + num_new; ++e )
+      elements.push_back( arena.create<Ele>( e, &nodes, &connectivity, mat ) );
+  }
+  else {
+    using Ele = Lagrange_Ele<2, UP_Ele>;
+    arena.reserve( num_new * ( sizeof( Ele ) + alignof( Ele ) ) );
+    for( std::size_t e{ first }; e != first + num_new; ++e )
+      elements.push_back( arena.create<Ele>( e, &nodes, &connectivity, mat ) );
+  }
+  invalidate_mesh( );
 }
 
 /* -------------------------------------------------------------------------- */
 
 /* Given the node ids and a material id, create an element and store in
- * `elements.'
- * PRECONDITION:  Nodes `n0' and `n1' and material `mat_id' must be created */
+ * `elements.'  Throws `std::invalid_argument' (creating nothing) unless there
+ * are two or three nodes and the nodes and the material exist. */
 void fem::Domain::create_element(
     std::vector<std::size_t> _nodes,
     std::size_t mat_id
     )
 {
+  check_elements( "Domain::create_element", _nodes.size( ), _nodes, mat_id );
+
   // Use current size of elements as ID of new element;
   std::size_t ele_ID = elements.size( );
 
-  // Get the node pointers from the vector of node IDs passed in;
-  std::vector<Node *> node_ptrs;
-  for( auto id : _nodes )
-    node_ptrs.push_back( nodes[id] );
+  // Store the node IDs as row `ele_ID' of the connectivity;
+  connectivity.add( _nodes );
 
-  // Create the element
+  // Create the element (u-p formulation, order from the number of nodes);
   Element * ele{ nullptr };
-  if( node_ptrs.size( ) == 2 )
-    ele = new Linear_UP( ele_ID, node_ptrs, materials[mat_id] );
-  else if( node_ptrs.size( ) == 3 )
-    ele = new Quadratic_UP( ele_ID, node_ptrs, materials[mat_id] );
+  if( _nodes.size( ) == 2 )
+    ele = arena.create<Lagrange_Ele<1, UP_Ele> >( ele_ID, &nodes,
+        &connectivity, materials[mat_id] );
   else
-    ; // TODO:  Throw an exception;
+    ele = arena.create<Lagrange_Ele<2, UP_Ele> >( ele_ID, &nodes,
+        &connectivity, materials[mat_id] );
   elements.push_back( ele );
+  element_mats.push_back( mat_id );
+  invalidate_mesh( );
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given a material id, Young's modulus and Poisson's ratio, overwrite the
+ * material properties, which the elements using the material share.  The
+ * cached factorization is refactored on the next solve. */
+void fem::Domain::set_material( std::size_t mat_id, double E, double nu )
+{
+  // Overwrite the shared material; its elements only need new stiffnesses;
+  *materials[mat_id] = Material( E, nu );
+  for( std::size_t e{ 0 }; e != elements.size( ); ++e ) {
+    if( element_mats[e] == mat_id )
+      elements[e]->mark_dirty( );
+  }
+  factor_valid = false;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given an element id and a material id, assign the material to the element.
+ * If the stiffness is factored by a direct solver, the change is applied as a
+ * low-rank update of the cached factorization (one factor solve per newly
+ * touched equation, O(n * rank) more per later solve), otherwise the next
+ * solve refactors. */
+void fem::Domain::set_element_material( std::size_t ele_id,
+    std::size_t mat_id )
+{
+  // Element stiffness before and after, at the order of the factorization;
+  Element * elem = elements[ele_id];
+  const bool update = factor_valid && !is_iterative( );
+  Element_Matrix old_stiff;
+  if( update )
+    old_stiff = elem->get_stiffness( factor_order );
+  elem->set_material( materials[mat_id] );
+  element_mats[ele_id] = mat_id;
+  affine_valid = false;
+  if( !update || !add_low_rank_update( ele_id,
+        elem->get_stiffness( factor_order ) - old_stiff ) )
+    factor_valid = false;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given the integration order, size the material state of every integration
+ * point (as many history variables as the widest material) and zero it. */
+void fem::Domain::init_point_state( std::size_t int_order )
+{
+  std::size_t num_state{ 0 };
+  for( auto mat : materials )
+    num_state = std::max( num_state, mat->get_num_state( ) );
+  point_state.resize( elements.size( ), int_order, num_state );
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given a node id and a traction, overwrite the boundary condition of the
+ * (natural boundary) node.  The cached factorization is kept. */
+void fem::Domain::set_traction( std::size_t node_id, double bc )
+{
+  nodes.update_bc( node_id, bc );
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given the number of threads, evaluate the element matrices concurrently
+ * during assembly. */
+void fem::Domain::set_num_threads( std::size_t num_threads )
+{
+  if( num_threads > 1 )
+    pool.reset( new Thread_Pool( num_threads ) );
+  else
+    pool.reset( );
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Select the storage and factorization used by `solve.' */
+void fem::Domain::set_solver( solver_type type )
+{
+  if( type != solver ) {
+    solver = type;
+    analyzed = false;
+    factor_valid = false;
+  }
 }
 
 /* -------------------------------------------------------------------------- */
@@ -97,10 +285,11 @@ std::size_t fem::Domain::get_eqn_count( )
   num_equations = 0;
 
   // Loop over node DOFs and count those not on the EBC;
-  for( auto node : nodes ) {
-    if( node->get_type( ) != Node::EBC )
+  for( std::size_t n{ 0 }; n != nodes.size( ); ++n ) {
+    if( nodes.get_type( n ) != Node::EBC )
       ++num_equations;
   }
+  eqn_valid = true;
   return num_equations;
 }
 
@@ -114,11 +303,10 @@ Eigen::MatrixXd fem::Domain::build_stiffness( std::size_t int_order )
   Eigen::MatrixXd stiff = Eigen::MatrixXd::Zero( num_equations, num_equations );
 
   // Loop over elements, get each stiffness and assemble to global stiffness;
-  for( std::vector<Element *>::const_iterator elem_it = elements.begin( );
-      elem_it != elements.end( ); ++elem_it ) {
-    Element * elem = *elem_it;
+  for_each_colored( [&]( std::size_t e ) {
+    Element * elem = elements[e];
 
-    Eigen::MatrixXd stiff_elem = elem->get_stiffness( int_order );
+    Element_Matrix stiff_elem = elem->get_stiffness( int_order );
     for( std::size_t a{ 0 }; a != elem->get_num_nodes( ); ++a ) {
       for( std::size_t b{ 0 }; b != elem->get_num_nodes( ); ++b ) {
 
@@ -133,6 +321,125 @@ Eigen::MatrixXd fem::Domain::build_stiffness( std::size_t int_order )
         }
       }
     }
+  } );
+  return stiff;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Return the half-bandwidth of the global stiffness from the element
+ * connectivity.
+ * PRECONDITION:  `elements' must be properly initialized. */
+std::size_t fem::Domain::get_band_width( ) const
+{
+  // Loop over elements and find the largest distance between coupled DOFs;
+  std::size_t band_width{ 0 };
+  for( const auto elem : elements ) {
+    for( std::size_t a{ 0 }; a != elem->get_num_nodes( ); ++a ) {
+      if( elem->get_node_type( a ) == Node::EBC )
+        continue;
+      for( std::size_t b{ 0 }; b != elem->get_num_nodes( ); ++b ) {
+        if( elem->get_node_type( b ) == Node::EBC )
+          continue;
+        std::size_t A = elem->location_matrix( a );
+        std::size_t B = elem->location_matrix( b );
+        band_width = std::max( band_width, A > B ? A - B : B - A );
+      }
+    }
+  }
+  return band_width;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Builds the stiffness matrix in band storage by looping elements and
+ * assembling.
+ * PRECONDITION:  `elements' must be properly initialized and num_equations must
+ * be valid. */
+fem::Band_Matrix fem::Domain::build_band_stiffness( std::size_t int_order )
+{
+  // Size the band from the connectivity;
+  Band_Matrix stiff( num_equations, get_band_width( ) );
+
+  // Loop over elements, get each stiffness and assemble the lower band;
+  for_each_colored( [&]( std::size_t e ) {
+    Element * elem = elements[e];
+    Element_Matrix stiff_elem = elem->get_stiffness( int_order );
+    for( std::size_t a{ 0 }; a != elem->get_num_nodes( ); ++a ) {
+      for( std::size_t b{ 0 }; b != elem->get_num_nodes( ); ++b ) {
+
+        // Check if node is free or not;
+        if( elem->get_node_type( a ) != Node::EBC &&
+            elem->get_node_type( b ) != Node::EBC ) {
+
+          // Get the global index numbers and assemble component to global;
+          std::size_t A = elem->location_matrix( a );
+          std::size_t B = elem->location_matrix( b );
+          stiff.add( A, B, stiff_elem( a, b ) );
+        }
+      }
+    }
+  } );
+  return stiff;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Builds the stiffness matrix in compressed sparse storage by looping elements
+ * and scattering into the precomputed sparsity pattern.
+ * PRECONDITION:  `elements' must be properly initialized and num_equations must
+ * be valid. */
+Eigen::SparseMatrix<double>
+fem::Domain::build_sparse_stiffness( std::size_t int_order )
+{
+  // Compute the sparsity pattern once;
+  if( !pattern_valid )
+    build_sparse_pattern( );
+
+  // Copy the pattern and zero the coefficients;
+  Eigen::SparseMatrix<double> stiff = pattern;
+  double * values = stiff.valuePtr( );
+  std::fill( values, values + stiff.nonZeros( ), 0.0 );
+
+  // Loop over elements, get each stiffness and scatter to the value array;
+  for_each_colored( [&]( std::size_t e ) {
+    Element_Matrix stiff_elem = elements[e]->get_stiffness( int_order );
+    const std::ptrdiff_t * map = &scatter_map[scatter_offsets[e]];
+    const std::size_t num_nodes = elements[e]->get_num_nodes( );
+    for( std::size_t b{ 0 }; b != num_nodes; ++b ) {
+      for( std::size_t a{ 0 }; a != num_nodes; ++a ) {
+        std::ptrdiff_t pos = map[b * num_nodes + a];
+        if( pos >= 0 )
+          values[pos] += stiff_elem( a, b );
+      }
+    }
+  } );
+  return stiff;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Builds the stiffness matrix in compressed sparse storage by combining the
+ * stored parameter-independent parts, K = sum_m lambda_m * K_lambda^m + mu_m *
+ * K_mu^m, with the current material constants.
+ * PRECONDITION:  `elements' must be properly initialized and num_equations must
+ * be valid. */
+Eigen::SparseMatrix<double>
+fem::Domain::build_affine_stiffness( std::size_t int_order )
+{
+  // Compute the sparsity pattern and the parts only if out of date;
+  if( !pattern_valid )
+    build_sparse_pattern( );
+  if( !affine_valid || int_order != affine_order )
+    build_affine_parts( int_order );
+
+  // Combine the parts with the current Lamé constants;
+  Eigen::SparseMatrix<double> stiff = pattern;
+  Eigen::Map<Eigen::VectorXd> values( stiff.valuePtr( ), stiff.nonZeros( ) );
+  values.setZero( );
+  for( std::size_t m{ 0 }; m != materials.size( ); ++m ) {
+    values += materials[m]->get_lambda( ) * affine_parts[2 * m];
+    values += materials[m]->get_mu( ) * affine_parts[2 * m + 1];
   }
   return stiff;
 }
@@ -152,7 +459,7 @@ Eigen::VectorXd fem::Domain::build_force( )
       elem_it != elements.end( ); ++elem_it ) {
     Element * elem = *elem_it;
 
-    Eigen::VectorXd force_elem = elem->get_force_ext( );
+    Element_Vector force_elem = elem->get_force_ext( );
     for( std::size_t a{ 0 }; a != elem->get_num_nodes( ); ++a ) {
 
       // Check if node is free or not;
@@ -169,21 +476,154 @@ Eigen::VectorXd fem::Domain::build_force( )
 
 /* -------------------------------------------------------------------------- */
 
+/* Given a set of load cases, builds one force vector per case (column).
+ * `tractions' holds, for every case, the traction at each node (one row per
+ * node, only natural boundary nodes are loaded).  `body' holds, for every case,
+ * the uniform radial body force of each element (one row per element), and may
+ * be empty.
+ * PRECONDITION:  `elements' must be properly initialized and num_equations must
+ * be valid. */
+Eigen::MatrixXd fem::Domain::build_force( const Eigen::MatrixXd & tractions,
+    const Eigen::MatrixXd & body, std::size_t int_order )
+{
+  // Resize the force block;
+  const std::size_t num_cases = tractions.cols( );
+  Eigen::MatrixXd force = Eigen::MatrixXd::Zero( num_equations, num_cases );
+
+  // Loop over the natural boundary nodes and apply the tractions;
+  for( std::size_t i{ 0 }; i != nodes.size( ); ++i ) {
+    if( nodes.get_type( i ) == Node::NBC ) {
+      std::size_t A = nodes.get_eqn_num( i );
+      force.row( A ) += nodes.get_coord( i ) * tractions.row( i );
+    }
+  }
+
+  // Loop over the elements, scale the unit body force of each and assemble;
+  if( body.size( ) != 0 ) {
+    for( std::size_t e{ 0 }; e != elements.size( ); ++e ) {
+      const Element * elem = elements[e];
+      Element_Vector force_elem = elem->get_force_body( int_order );
+      for( std::size_t a{ 0 }; a != elem->get_num_nodes( ); ++a ) {
+
+        // Check if node is free or not;
+        if( elem->get_node_type( a ) != Node::EBC ) {
+          std::size_t A = elem->location_matrix( a );
+          force.row( A ) += force_elem( a ) * body.row( e );
+        }
+      }
+    }
+  }
+  return force;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given a matrix to hold the prolongation, build the next coarser mesh by
+ * merging every pair of consecutive elements and store the interpolation from
+ * the coarse free DOFs to the fine ones.  Returns null if the mesh cannot be
+ * halved. */
+std::unique_ptr<fem::Domain>
+fem::Domain::coarsen( Eigen::SparseMatrix<double> & prolong )
+{
+  // Need an even number of elements of one order, chained pairwise;
+  const std::size_t num_eles = elements.size( );
+  if( num_eles < 2 || num_eles % 2 != 0 )
+    return nullptr;
+  const std::size_t num_ele_nodes = elements.front( )->get_num_nodes( );
+  for( std::size_t e{ 0 }; e != num_eles; e += 2 ) {
+    const Element * left = elements[e];
+    const Element * right = elements[e + 1];
+    if( left->get_num_nodes( ) != num_ele_nodes ||
+        right->get_num_nodes( ) != num_ele_nodes ||
+        left->get_node_id( num_ele_nodes - 1 ) != right->get_node_id( 0 ) )
+      return nullptr;
+  }
+  if( !eqn_valid )
+    get_eqn_count( );
+
+  // Coarse element nodes:  the ends of the pair (and, for quadratics, the
+  // shared node as the midpoint), numbered in fine order so EBCs stay last;
+  std::vector<std::vector<std::size_t> > coarse_conn( num_eles / 2 );
+  std::vector<std::ptrdiff_t> coarse_ids( nodes.size( ), -1 );
+  for( std::size_t e{ 0 }; e != num_eles; e += 2 ) {
+    std::vector<std::size_t> & conn = coarse_conn[e / 2];
+    conn.push_back( elements[e]->get_node_id( 0 ) );
+    if( num_ele_nodes == 3 )
+      conn.push_back( elements[e]->get_node_id( 2 ) );
+    conn.push_back( elements[e + 1]->get_node_id( num_ele_nodes - 1 ) );
+    for( auto id : conn )
+      coarse_ids[id] = 0;
+  }
+
+  // Create the coarse nodes (homogeneous EBCs) and materials;
+  std::unique_ptr<Domain> coarse( new Domain );
+  for( std::size_t n{ 0 }; n != nodes.size( ); ++n ) {
+    if( coarse_ids[n] < 0 )
+      continue;
+    coarse_ids[n] = coarse->nodes.size( );
+    coarse->create_node( nodes.get_coord( n ), nodes.get_type( n ),
+        nodes.get_traction( n ) );
+  }
+  for( auto mat : materials )
+    coarse->materials.push_back( coarse->arena.create<Material>( *mat ) );
+  for( std::size_t e{ 0 }; e != num_eles; e += 2 ) {
+    std::vector<std::size_t> conn;
+    for( auto id : coarse_conn[e / 2] )
+      conn.push_back( coarse_ids[id] );
+    coarse->create_element( conn, element_mats[e] );
+  }
+  coarse->get_eqn_count( );
+
+  // Interpolate every fine free node with the coarse Lagrange polynomials of
+  // the element containing it (EBC DOFs are dropped);
+  std::vector<Eigen::Triplet<double> > triplets;
+  std::vector<bool> done( num_equations, false );
+  for( std::size_t e{ 0 }; e != num_eles; ++e ) {
+    const std::vector<std::size_t> & conn = coarse_conn[e / 2];
+    for( std::size_t a{ 0 }; a != num_ele_nodes; ++a ) {
+      std::size_t fine = elements[e]->location_matrix( a );
+      if( fine >= num_equations || done[fine] )
+        continue;
+      done[fine] = true;
+      double coord = elements[e]->get_node_coord( a );
+      for( std::size_t k{ 0 }; k != conn.size( ); ++k ) {
+        std::size_t col = coarse_ids[conn[k]];
+        if( col >= coarse->num_equations )
+          continue;
+        double weight{ 1.0 };
+        for( std::size_t l{ 0 }; l != conn.size( ); ++l ) {
+          if( l != k )
+            weight *= ( coord - nodes.get_coord( conn[l] ) ) /
+              ( nodes.get_coord( conn[k] ) - nodes.get_coord( conn[l] ) );
+        }
+        if( weight != 0.0 )
+          triplets.push_back( Eigen::Triplet<double>( fine, col, weight ) );
+      }
+    }
+  }
+  prolong.resize( num_equations, coarse->num_equations );
+  prolong.setFromTriplets( triplets.begin( ), triplets.end( ) );
+  return coarse;
+}
+
+/* -------------------------------------------------------------------------- */
+
 /* Given the integration order, builds the system of equations, solves, and
  * returns displacement.
  * PRECONDITION:  `elements' must be properly initialized. */
 Eigen::VectorXd fem::Domain::solve( std::size_t int_order )
 {
-  // Get the number of equations of the system;
-  get_eqn_count( );
+  // Get the number of equations of the system (only if the mesh changed);
+  if( !eqn_valid )
+    get_eqn_count( );
 
-  // Build the stiffness and force vectors;
-  Eigen::MatrixXd stiff = build_stiffness( int_order );
-  Eigen::VectorXd force = build_force( );
+  // Refactor the stiffness only if it is out of date;
+  if( !factor_valid || int_order != factor_order )
+    factor_stiffness( int_order );
 
-  // Solve system;
-  Eigen::VectorXd disp = Eigen::VectorXd::Zero( num_equations );
-  disp = stiff.llt( ).solve( force );
+  // Build the force vector and solve system;
+  Eigen::VectorXd force = build_force( );
+  Eigen::VectorXd disp = back_substitute( force );
 
   // Update the domain;
   update_nodes( disp );
@@ -193,6 +633,27 @@ Eigen::VectorXd fem::Domain::solve( std::size_t int_order )
 
 /* -------------------------------------------------------------------------- */
 
+/* Given a set of load cases (see `build_force'), factor the stiffness once and
+ * solve for all cases together.  Returns one displacement per column; the
+ * nodes are not updated.
+ * PRECONDITION:  `elements' must be properly initialized. */
+Eigen::MatrixXd fem::Domain::solve( const Eigen::MatrixXd & tractions,
+    const Eigen::MatrixXd & body, std::size_t int_order )
+{
+  // Get the number of equations of the system (only if the mesh changed);
+  if( !eqn_valid )
+    get_eqn_count( );
+
+  // Refactor the stiffness only if it is out of date;
+  if( !factor_valid || int_order != factor_order )
+    factor_stiffness( int_order );
+
+  // Build the block of force vectors and back-substitute all columns;
+  return back_substitute( build_force( tractions, body, int_order ) );
+}
+
+/* -------------------------------------------------------------------------- */
+
 /* Given an output stream and the number of displacement points to print for
  * each element, compute the displacement and print to the output. */
 void fem::Domain::print_disp( std::ostream & out, std::size_t num_pts ) const
@@ -249,16 +710,415 @@ void fem::Domain::print_stress( std::ostream & out, std::size_t num_pts ) const
 
 /* ***********************  PRIVATE MEMBER FUNCTIONS  *********************** */
 
+/* Compute the sparsity pattern of the global stiffness from the location matrix
+ * of every element and store the element scatter map.
+ * PRECONDITION:  num_equations must be valid. */
+void fem::Domain::build_sparse_pattern( )
+{
+  // Collect the coupled (free) equation pairs of every element;
+  std::size_t num_coeffs{ 0 };
+  for( const auto elem : elements )
+    num_coeffs += elem->get_num_nodes( ) * elem->get_num_nodes( );
+
+  std::vector<Eigen::Triplet<double> > triplets;
+  triplets.reserve( num_coeffs );
+  for( const auto elem : elements ) {
+    for( std::size_t b{ 0 }; b != elem->get_num_nodes( ); ++b ) {
+      if( elem->get_node_type( b ) == Node::EBC )
+        continue;
+      for( std::size_t a{ 0 }; a != elem->get_num_nodes( ); ++a ) {
+        if( elem->get_node_type( a ) != Node::EBC )
+          triplets.push_back( Eigen::Triplet<double>(
+                elem->location_matrix( a ), elem->location_matrix( b ), 0.0 ) );
+      }
+    }
+  }
+
+  // Build the compressed pattern (duplicates are merged);
+  pattern.resize( num_equations, num_equations );
+  pattern.setFromTriplets( triplets.begin( ), triplets.end( ) );
+  pattern.makeCompressed( );
+  analyzed = false;
+
+  // Locate every element coefficient in the compressed value array;
+  const auto * outer = pattern.outerIndexPtr( );
+  const auto * inner = pattern.innerIndexPtr( );
+  scatter_map.assign( num_coeffs, -1 );
+  scatter_offsets.resize( elements.size( ) );
+  std::size_t offset{ 0 };
+  for( std::size_t e{ 0 }; e != elements.size( ); ++e ) {
+    const Element * elem = elements[e];
+    const std::size_t num_nodes = elem->get_num_nodes( );
+    scatter_offsets[e] = offset;
+    for( std::size_t b{ 0 }; b != num_nodes; ++b ) {
+      for( std::size_t a{ 0 }; a != num_nodes; ++a ) {
+        if( elem->get_node_type( a ) != Node::EBC &&
+            elem->get_node_type( b ) != Node::EBC ) {
+          std::size_t A = elem->location_matrix( a );
+          std::size_t B = elem->location_matrix( b );
+          const auto * pos =
+            std::lower_bound( inner + outer[B], inner + outer[B + 1], A );
+          scatter_map[offset + b * num_nodes + a] = pos - inner;
+        }
+      }
+    }
+    offset += num_nodes * num_nodes;
+  }
+  pattern_valid = true;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given the integration order, build the global stiffness and factor it with
+ * the selected solver.  The symbolic analysis of the sparse solvers is only
+ * repeated if the sparsity pattern changed.
+ * PRECONDITION:  num_equations must be valid. */
+void fem::Domain::factor_stiffness( std::size_t int_order )
+{
+  // Resolve the Thomas solver to the general sparse one for non-chain meshes;
+  factor_solver = solver;
+  if( solver == THOMAS && get_band_width( ) > 2 )
+    factor_solver = SPARSE_LDLT;
+
+  if( factor_solver == BANDED || factor_solver == THOMAS ) {
+    band_factor = use_affine ? to_band( build_affine_stiffness( int_order ) )
+                             : build_band_stiffness( int_order );
+    bool pos_def = ( factor_solver == THOMAS ) ? band_factor.factorize_ldlt( )
+                                               : band_factor.factorize( );
+    if( !pos_def )
+      std::cerr << "WARNING:  Stiffness matrix is not positive definite.\n";
+  }
+  else if( factor_solver == PARTITIONED ) {
+    Band_Matrix stiff = use_affine ?
+      to_band( build_affine_stiffness( int_order ) ) :
+      build_band_stiffness( int_order );
+    if( !part_factor.factorize( stiff, pool.get( ) ) )
+      std::cerr << "WARNING:  Stiffness matrix is not positive definite.\n";
+  }
+  else if( factor_solver == PCG_MATRIX_FREE ) {
+    stiff_oper.build( elements, num_equations, int_order );
+    cg_solver.compute( stiff_oper );
+  }
+  else if( factor_solver == MULTIGRID || factor_solver == PCG_MULTIGRID ) {
+    Eigen::SparseMatrix<double> stiff = use_affine ?
+      build_affine_stiffness( int_order ) : build_sparse_stiffness( int_order );
+    multigrid.build( *this, stiff, int_order );
+    if( factor_solver == PCG_MULTIGRID )
+      cg_solver.compute( stiff, multigrid );
+  }
+  else if( factor_solver == PCG_JACOBI || factor_solver == PCG_IC ) {
+    Eigen::SparseMatrix<double> stiff = use_affine ?
+      build_affine_stiffness( int_order ) : build_sparse_stiffness( int_order );
+    Conjugate_Gradient::precond_type type = ( factor_solver == PCG_IC ) ?
+      Conjugate_Gradient::INCOMPLETE_CHOLESKY : Conjugate_Gradient::JACOBI;
+    if( !cg_solver.compute( stiff, type ) )
+      std::cerr << "WARNING:  Incomplete Cholesky broke down, using Jacobi.\n";
+  }
+  else if( factor_solver == MIXED_PRECISION ) {
+    Eigen::SparseMatrix<double> stiff = use_affine ?
+      build_affine_stiffness( int_order ) : build_sparse_stiffness( int_order );
+    if( !mixed_factor.compute( stiff ) )
+      std::cerr << "WARNING:  Stiffness matrix is not positive definite.\n";
+  }
+  else if( factor_solver == SPARSE_LDLT || factor_solver == SPARSE_LLT ) {
+    // Assemble first, since it (re)builds the pattern if needed;
+    Eigen::SparseMatrix<double> stiff = use_affine ?
+      build_affine_stiffness( int_order ) : build_sparse_stiffness( int_order );
+    if( factor_solver == SPARSE_LDLT ) {
+      if( !analyzed )
+        ldlt_factor.analyzePattern( stiff );
+      ldlt_factor.factorize( stiff );
+    }
+    else {
+      if( !analyzed )
+        llt_factor.analyzePattern( stiff );
+      llt_factor.factorize( stiff );
+    }
+    analyzed = true;
+  }
+  else if( use_affine )
+    dense_factor.compute(
+        Eigen::MatrixXd( build_affine_stiffness( int_order ) ) );
+  else
+    dense_factor.compute( build_stiffness( int_order ) );
+
+  factor_order = int_order;
+  factor_valid = true;
+  clear_low_rank_update( );
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given the integration order, integrate the stiffness per unit Lamé constant
+ * of every element and scatter into the parts of its material.
+ * PRECONDITION:  The sparsity pattern must be valid. */
+void fem::Domain::build_affine_parts( std::size_t int_order )
+{
+  // Two zeroed parts per material in the layout of the pattern;
+  affine_parts.assign( 2 * materials.size( ),
+      Eigen::VectorXd::Zero( pattern.nonZeros( ) ) );
+
+  // Loop over elements, get each part and scatter to its material;
+  for_each_colored( [&]( std::size_t e ) {
+    std::pair<Element_Matrix, Element_Matrix> parts =
+      elements[e]->get_stiffness_parts( int_order );
+    Eigen::VectorXd & part_lambda = affine_parts[2 * element_mats[e]];
+    Eigen::VectorXd & part_mu = affine_parts[2 * element_mats[e] + 1];
+    const std::ptrdiff_t * map = &scatter_map[scatter_offsets[e]];
+    const std::size_t num_nodes = elements[e]->get_num_nodes( );
+    for( std::size_t b{ 0 }; b != num_nodes; ++b ) {
+      for( std::size_t a{ 0 }; a != num_nodes; ++a ) {
+        std::ptrdiff_t pos = map[b * num_nodes + a];
+        if( pos >= 0 ) {
+          part_lambda[pos] += parts.first( a, b );
+          part_mu[pos] += parts.second( a, b );
+        }
+      }
+    }
+  } );
+  affine_order = int_order;
+  affine_valid = true;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given a sparse stiffness, copy its lower band into band storage. */
+fem::Band_Matrix
+fem::Domain::to_band( const Eigen::SparseMatrix<double> & stiff ) const
+{
+  Band_Matrix band( stiff.rows( ), get_band_width( ) );
+  for( int j{ 0 }; j != stiff.outerSize( ); ++j ) {
+    for( Eigen::SparseMatrix<double>::InnerIterator it( stiff, j ); it; ++it )
+      band.add( it.row( ), it.col( ), it.value( ) );
+  }
+  return band;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given a set of force vectors (one per column), solve using the cached
+ * factorization (or iterate, for the PCG solvers).
+ * PRECONDITION:  The stiffness must be factored. */
+Eigen::MatrixXd fem::Domain::back_substitute( const Eigen::MatrixXd & force )
+{
+  // Iterate from the previous solution if requested and keep the result;
+  if( factor_solver == MULTIGRID ) {
+    last_solution = multigrid.solve( force,
+        warm_start ? last_solution : Eigen::MatrixXd( ) );
+    if( !multigrid.is_converged( ) )
+      std::cerr << "WARNING:  Multigrid did not reach the tolerance.\n";
+    return last_solution;
+  }
+  if( is_iterative( ) ) {
+    last_solution = cg_solver.solve( force,
+        warm_start ? last_solution : Eigen::MatrixXd( ) );
+    if( !cg_solver.is_converged( ) )
+      std::cerr << "WARNING:  PCG did not reach the tolerance.\n";
+    return last_solution;
+  }
+
+  // Woodbury correction of the cached solve, x' = x - Z C^{-1} D P^T x;
+  Eigen::MatrixXd disp = factor_solve( force );
+  if( !update_eqns.empty( ) ) {
+    Eigen::MatrixXd gathered( update_eqns.size( ), disp.cols( ) );
+    for( std::size_t i{ 0 }; i != update_eqns.size( ); ++i )
+      gathered.row( i ) = disp.row( update_eqns[i] );
+    disp -= update_basis * update_capacitance.solve( update_delta * gathered );
+  }
+  return disp;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given a set of force vectors (one per column), solve with the cached direct
+ * factorization alone (no low-rank update).
+ * PRECONDITION:  The stiffness must be factored by a direct solver. */
+Eigen::MatrixXd fem::Domain::factor_solve( const Eigen::MatrixXd & force )
+{
+  if( factor_solver == BANDED || factor_solver == THOMAS )
+    return band_factor.solve( force );
+  else if( factor_solver == PARTITIONED )
+    return part_factor.solve( force, pool.get( ) );
+  else if( factor_solver == SPARSE_LDLT )
+    return ldlt_factor.solve( force );
+  else if( factor_solver == SPARSE_LLT )
+    return llt_factor.solve( force );
+  else if( factor_solver == MIXED_PRECISION )
+    return mixed_factor.solve( force );
+  else
+    return dense_factor.solve( force );
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Return true if the stiffness was factored by an iterative solver. */
+bool fem::Domain::is_iterative( ) const
+{
+  return factor_solver == PCG_JACOBI || factor_solver == PCG_IC ||
+    factor_solver == PCG_MATRIX_FREE || factor_solver == PCG_MULTIGRID ||
+    factor_solver == MULTIGRID;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given an element id and the change of its stiffness, add it to the low-rank
+ * update of the cached factorization.  Returns false (and drops the update) if
+ * the rank would exceed the maximum.
+ * PRECONDITION:  The stiffness must be factored by a direct solver. */
+bool fem::Domain::add_low_rank_update( std::size_t ele_id,
+    const Element_Matrix & delta )
+{
+  // Position of every free element equation in the update, appending new ones;
+  const Element * elem = elements[ele_id];
+  const std::size_t num_nodes = elem->get_num_nodes( );
+  const std::size_t old_rank = update_eqns.size( );
+  std::vector<std::ptrdiff_t> cols( num_nodes, -1 );
+  for( std::size_t a{ 0 }; a != num_nodes; ++a ) {
+    if( elem->get_node_type( a ) == Node::EBC )
+      continue;
+    std::size_t eqn = elem->location_matrix( a );
+    auto it = std::find( update_eqns.begin( ), update_eqns.end( ), eqn );
+    cols[a] = it - update_eqns.begin( );
+    if( it == update_eqns.end( ) )
+      update_eqns.push_back( eqn );
+  }
+  const std::size_t rank = update_eqns.size( );
+  if( rank > max_update_rank ) {
+    clear_low_rank_update( );
+    return false;
+  }
+
+  // Extend D with zeros and Z with the solves of the new unit vectors;
+  update_delta.conservativeResize( rank, rank );
+  update_delta.rightCols( rank - old_rank ).setZero( );
+  update_delta.bottomRows( rank - old_rank ).setZero( );
+  if( rank != old_rank ) {
+    Eigen::MatrixXd units =
+      Eigen::MatrixXd::Zero( num_equations, rank - old_rank );
+    for( std::size_t i{ old_rank }; i != rank; ++i )
+      units( update_eqns[i], i - old_rank ) = 1.0;
+    update_basis.conservativeResize( num_equations, rank );
+    update_basis.rightCols( rank - old_rank ) = factor_solve( units );
+  }
+
+  // Accumulate the element change and refactor the capacitance matrix;
+  for( std::size_t b{ 0 }; b != num_nodes; ++b ) {
+    for( std::size_t a{ 0 }; a != num_nodes; ++a ) {
+      if( cols[a] >= 0 && cols[b] >= 0 )
+        update_delta( cols[a], cols[b] ) += delta( a, b );
+    }
+  }
+  Eigen::MatrixXd capacitance = Eigen::MatrixXd::Identity( rank, rank );
+  for( std::size_t i{ 0 }; i != rank; ++i )
+    capacitance += update_delta.col( i ) * update_basis.row( update_eqns[i] );
+  update_capacitance.compute( capacitance );
+  return true;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Drop the low-rank update of the cached factorization. */
+void fem::Domain::clear_low_rank_update( )
+{
+  update_eqns.clear( );
+  update_delta.resize( 0, 0 );
+  update_basis.resize( 0, 0 );
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Color the elements so that no two elements of a color share a node. */
+void fem::Domain::build_colors( )
+{
+  // Greedy coloring:  take the lowest color not yet used at any element node;
+  std::vector<std::vector<std::size_t> > node_colors( nodes.size( ) );
+  std::vector<std::size_t> elem_colors( elements.size( ) );
+  std::size_t num_colors{ 0 };
+  for( std::size_t e{ 0 }; e != elements.size( ); ++e ) {
+    const Element * elem = elements[e];
+    std::size_t color{ 0 };
+    bool taken{ true };
+    while( taken ) {
+      taken = false;
+      for( std::size_t a{ 0 }; a != elem->get_num_nodes( ) && !taken; ++a ) {
+        const std::vector<std::size_t> & used =
+          node_colors[elem->get_node_id( a )];
+        taken = std::find( used.begin( ), used.end( ), color ) != used.end( );
+      }
+      if( taken )
+        ++color;
+    }
+    for( std::size_t a{ 0 }; a != elem->get_num_nodes( ); ++a )
+      node_colors[elem->get_node_id( a )].push_back( color );
+    elem_colors[e] = color;
+    num_colors = std::max( num_colors, color + 1 );
+  }
+
+  // Bucket the elements by color, keeping their order within each color;
+  color_offsets.assign( num_colors + 1, 0 );
+  for( auto color : elem_colors )
+    ++color_offsets[color + 1];
+  for( std::size_t c{ 0 }; c != num_colors; ++c )
+    color_offsets[c + 1] += color_offsets[c];
+  color_elements.resize( elements.size( ) );
+  std::vector<std::size_t> fill( color_offsets.begin( ),
+      color_offsets.end( ) - 1 );
+  for( std::size_t e{ 0 }; e != elements.size( ); ++e )
+    color_elements[fill[elem_colors[e]]++] = e;
+  colors_valid = true;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Mark the equation numbering and everything derived from it as stale. */
+void fem::Domain::invalidate_mesh( )
+{
+  colors_valid = false;
+  eqn_valid = false;
+  pattern_valid = false;
+  affine_valid = false;
+  analyzed = false;
+  factor_valid = false;
+  last_solution.resize( 0, 0 );
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given the caller's name, the number of nodes per element, the node ids of
+ * the new elements back to back, and a material id, throw
+ * `std::invalid_argument' unless the elements can be created. */
+void fem::Domain::check_elements( const std::string & caller,
+    std::size_t nodes_per_ele, const std::vector<std::size_t> & conn,
+    std::size_t mat_id ) const
+{
+  if( nodes_per_ele != 2 && nodes_per_ele != 3 )
+    throw std::invalid_argument( caller +
+        ":  elements need two or three nodes" );
+  if( conn.size( ) % nodes_per_ele != 0 )
+    throw std::invalid_argument( caller +
+        ":  connectivity size is not a multiple of the nodes per element" );
+  if( mat_id >= materials.size( ) )
+    throw std::invalid_argument( caller + ":  material " +
+        std::to_string( mat_id ) + " does not exist" );
+  for( auto id : conn ) {
+    if( id >= nodes.size( ) )
+      throw std::invalid_argument( caller + ":  node " +
+          std::to_string( id ) + " does not exist" );
+  }
+}
+
+/* -------------------------------------------------------------------------- */
+
 /* Given a vector of displacements, update the nodes. */
 void fem::Domain::update_nodes( const Eigen::VectorXd & displacement )
 {
   // Loop over the nodes and update any necessary information;
-  for( auto node : nodes ) {
+  for( std::size_t n{ 0 }; n != nodes.size( ); ++n ) {
     // Check if the node is a DOF of the system;
-    if( node->get_type( ) != Node::EBC ) {
+    if( nodes.get_type( n ) != Node::EBC ) {
       // Grab the global equation number and update the dipslacement;
-      std::size_t A = node->get_eqn_num( );
-      node->update_disp( displacement[A] );
+      std::size_t A = nodes.get_eqn_num( n );
+      nodes.update_disp( n, displacement[A] );
     }
   }
 }
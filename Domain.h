@@ -15,17 +15,30 @@
 #define GUARD_DOMAIN_H
 
 // Project-specific headers;
+#include "Arena.h"
+#include "Band_Matrix.h"
+#include "Conjugate_Gradient.h"
+#include "Lagrange_Ele.h"
 #include "Linear.h"
 #include "Linear_UP.h"
 #include "Material.h"
+#include "Mixed_Precision.h"
+#include "Multigrid.h"
 #include "Node.h"
+#include "Partitioned_Band.h"
+#include "Point_State.h"
 #include "Quadratic.h"
 #include "Quadratic_UP.h"
+#include "Stiffness_Operator.h"
+#include "Thread_Pool.h"
 
 // System headers;
 #include <Eigen/Cholesky>
+#include <Eigen/LU>
+#include <Eigen/Sparse>
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -35,10 +48,46 @@ class Domain {
 
 public:
 
+  /* ****************************  ENUMERATIONS  **************************** */
+
+  /* Enumeration to select the storage and factorization of the global
+   * stiffness used by `solve.'  `THOMAS' detects the half-bandwidth of the
+   * mesh and, for chains (tridiagonal or pentadiagonal stiffness), assembles
+   * the band directly and factors it with the Thomas recurrences in O(n); any
+   * other connectivity falls back to `SPARSE_LDLT.'  `PARTITIONED' splits the
+   * band into one partition per thread (see `set_num_threads') and factors
+   * and solves the partitions concurrently (see `Partitioned_Band').
+   * `PCG_JACOBI' and `PCG_IC' iterate with preconditioned conjugate gradients
+   * (see `Conjugate_Gradient') instead of factoring.  `PCG_MATRIX_FREE'
+   * iterates with Jacobi on the matrix-free `Stiffness_Operator,' so the
+   * global stiffness is never stored.  `MULTIGRID' iterates geometric
+   * multigrid cycles over the meshes obtained by repeatedly merging element
+   * pairs (see `coarsen'), and `PCG_MULTIGRID' uses one cycle as the PCG
+   * preconditioner.  `MIXED_PRECISION' factors the sparse stiffness in single
+   * precision and refines to double precision accuracy, switching to a double
+   * precision factor for ill-conditioned (nearly incompressible) problems
+   * (see `Mixed_Precision'). */
+  enum solver_type { DENSE, BANDED, SPARSE_LDLT, SPARSE_LLT, THOMAS,
+    PARTITIONED, PCG_JACOBI, PCG_IC, PCG_MATRIX_FREE, MULTIGRID,
+    PCG_MULTIGRID, MIXED_PRECISION };
+
   /* ****************************  COPY CONTROL  **************************** */
 
   /* Default constructor */
-  Domain( ) : nodes{ }, elements{ }, materials{ }, num_equations{ 0 }
+  Domain( ) :
+    arena{ }, nodes{ }, connectivity{ }, elements{ }, materials{ },
+    element_mats{ }, point_state{ }, num_equations{ 0 }, solver{ DENSE },
+    eqn_valid{ false },
+    pattern{ }, scatter_map{ }, scatter_offsets{ }, pattern_valid{ false },
+    dense_factor{ }, band_factor{ }, part_factor{ }, ldlt_factor{ },
+    llt_factor{ }, mixed_factor{ }, stiff_oper{ }, cg_solver{ }, multigrid{ },
+    last_solution{ }, warm_start{ true },
+    factor_order{ 0 }, factor_solver{ DENSE }, analyzed{ false },
+    factor_valid{ false }, update_eqns{ }, update_delta{ }, update_basis{ },
+    update_capacitance{ }, max_update_rank{ 8 },
+    affine_parts{ }, affine_order{ 0 }, affine_valid{ false },
+    use_affine{ false }, pool{ }, color_offsets{ }, color_elements{ },
+    colors_valid{ false }
   { }
 
   /* Domain should be unique, disallow copy and assignment operators */
@@ -52,8 +101,14 @@ public:
 
   /* **********************  PUBLIC MEMBER FUNCTIONS  *********************** */
 
+  /* Given the expected number of nodes, elements and materials, reserve
+   * storage for them so that building the mesh does not reallocate. */
+  void reserve( std::size_t num_nodes, std::size_t num_elements,
+      std::size_t num_materials = 1 );
+
   /* Given material properties, Young's modulus and Poisson's ratio, create an
-   * elastic material and store in `mats.' */
+   * elastic material and store in `mats.'  Materials are shared by every
+   * element using them. */
   void create_material( double E, double nu );
 
   /* Given a coordinate, create a node and store in `nodes.' */
@@ -63,11 +118,65 @@ public:
    * `nodes.' */
   void create_node( double coord, Node::node_type type, double bc );
 
+  /* Given a set of coordinates, create an interior node at each in one call
+   * (node IDs continue from the existing nodes). */
+  void create_nodes( const std::vector<double> & coords );
+
+  /* Given a node id, a node type, and a BC, overwrite the type and boundary
+   * condition of the node.
+   * PRECONDITION:  Essential boundary nodes must be numbered after every
+   *                other node (the equation number is the node ID). */
+  void set_boundary( std::size_t node_id, Node::node_type type, double bc );
+
+  /* Given the number of nodes per element (two or three), the node ids of
+   * every element back to back, and a material id, create the elements in one
+   * call.  Throws `std::invalid_argument' (creating nothing) if the number of
+   * nodes per element is not two or three or does not divide the
+   * connectivity, or if a node or the material does not exist. */
+  void create_elements( std::size_t nodes_per_ele,
+      const std::vector<std::size_t> & conn, std::size_t mat_id );
+
   /* Given the node ids and a material id, create an element and store in
-   * `elements.'
-   * PRECONDITION:  Nodes `n0' and `n1' and material `mat_id' must be created */
+   * `elements.'  Throws `std::invalid_argument' (creating nothing) unless
+   * there are two or three nodes and the nodes and the material exist. */
   void create_element( std::vector<std::size_t> _nodes, std::size_t mat_id );
 
+  /* Given a material id, Young's modulus and Poisson's ratio, overwrite the
+   * material properties, which the elements using the material share.
+   * The cached factorization is refactored on the next solve. */
+  void set_material( std::size_t mat_id, double E, double nu );
+
+  /* Given an element id and a material id, assign the material to the
+   * element.  If the stiffness is factored by a direct solver, the change is
+   * applied as a low-rank (Woodbury) update of the cached factorization, so
+   * the next solve neither reassembles nor refactors.  The update is not
+   * free:  every equation it newly touches costs one solve with the
+   * factorization (O(n) for the banded solvers, about a fifth of a refactor),
+   * and every later solve costs O(n * rank) more.  It only pays off for a few
+   * changed elements, so once the equations touched exceed the maximum rank
+   * (see `set_max_update_rank'), the next solve refactors instead. */
+  void set_element_material( std::size_t ele_id, std::size_t mat_id );
+
+  /* Given the number of equations, set the largest low-rank update kept
+   * before refactoring (eight by default, a few elements). */
+  void set_max_update_rank( std::size_t rank ) { max_update_rank = rank; }
+
+  /* Given the integration order, size the material state of every
+   * integration point (as many history variables as the widest material) and
+   * zero it.  Must be called again after elements are added. */
+  void init_point_state( std::size_t int_order );
+
+  /* Given an element id and an integration point, return a view of the
+   * material state at the point.
+   * PRECONDITION:  `init_point_state' must have been called. */
+  double * get_point_state( std::size_t ele_id, std::size_t qp ) {
+    return point_state.get( ele_id, qp );
+  }
+
+  /* Given a node id and a traction, overwrite the boundary condition of the
+   * (natural boundary) node.  The cached factorization is kept. */
+  void set_traction( std::size_t node_id, double bc );
+
   /* Count the number of equations corresponding to free DOFs and store. */
   std::size_t get_eqn_count( );
 
@@ -75,14 +184,111 @@ public:
    * PRECONDITION:  `elements' must be properly initialized. */
   Eigen::MatrixXd build_stiffness( std::size_t int_order = 2 );
 
+  /* Return the half-bandwidth of the global stiffness from the element
+   * connectivity.
+   * PRECONDITION:  `elements' must be properly initialized. */
+  std::size_t get_band_width( ) const;
+
+  /* Builds the stiffness matrix in band storage by looping elements and
+   * assembling.
+   * PRECONDITION:  `elements' must be properly initialized. */
+  Band_Matrix build_band_stiffness( std::size_t int_order = 2 );
+
+  /* Builds the stiffness matrix in compressed sparse storage by looping
+   * elements and scattering into the precomputed sparsity pattern.
+   * PRECONDITION:  `elements' must be properly initialized. */
+  Eigen::SparseMatrix<double>
+    build_sparse_stiffness( std::size_t int_order = 2 );
+
+  /* Builds the stiffness matrix in compressed sparse storage by combining the
+   * stored parameter-independent parts, K = sum_m lambda_m * K_lambda^m +
+   * mu_m * K_mu^m, with the current material constants.  The parts are only
+   * integrated the first time (or after the mesh or integration order
+   * changed), so a material change skips quadrature entirely.
+   * PRECONDITION:  `elements' must be properly initialized. */
+  Eigen::SparseMatrix<double>
+    build_affine_stiffness( std::size_t int_order = 2 );
+
   /* Builds the force vector by looping elements and assembling.
    * PRECONDITION:  `elements' must be properly initialized. */
   Eigen::VectorXd build_force( );
 
-  /* Builds the system of equations and then solves.
+  /* Given a set of load cases, builds one force vector per case (column).
+   * `tractions' holds, for every case, the traction at each node (one row per
+   * node, only natural boundary nodes are loaded).  `body' holds, for every
+   * case, the uniform radial body force of each element (one row per element),
+   * and may be empty.
+   * PRECONDITION:  `elements' must be properly initialized. */
+  Eigen::MatrixXd build_force( const Eigen::MatrixXd & tractions,
+      const Eigen::MatrixXd & body, std::size_t int_order = 2 );
+
+  /* Given a matrix to hold the prolongation, build the next coarser mesh by
+   * merging every pair of consecutive elements and store the interpolation
+   * from the coarse free DOFs to the fine ones.  Coarse nodes keep the fine
+   * order and node types (with homogeneous EBCs) and the materials are
+   * copied.  Returns null unless the mesh has an even number of chained
+   * elements of one order.
+   * PRECONDITION:  `elements' must be properly initialized. */
+  std::unique_ptr<Domain> coarsen( Eigen::SparseMatrix<double> & prolong );
+
+  /* Select the storage and factorization used by `solve.' */
+  void set_solver( solver_type type );
+
+  /* Given the relative residual tolerance and the maximum number of
+   * iterations (zero for ten times the number of equations, or 100 cycles for
+   * multigrid), set the stopping criteria of the iterative solvers. */
+  void set_tolerance( double tol, std::size_t max_iter = 0 ) {
+    cg_solver.set_tolerance( tol, max_iter );
+    multigrid.set_tolerance( tol, max_iter ? max_iter : 100 );
+  }
+
+  /* Select whether the PCG solvers start from the previous solution (if the
+   * number of equations and load cases match) instead of from zero. */
+  void set_warm_start( bool use ) { warm_start = use; }
+
+  /* Return the PCG (or multigrid cycle, or refinement step) iteration count
+   * of every load case of the last solve. */
+  const std::vector<std::size_t> & get_iterations( ) const {
+    if( factor_solver == MULTIGRID )
+      return multigrid.get_iterations( );
+    if( factor_solver == MIXED_PRECISION )
+      return mixed_factor.get_iterations( );
+    return cg_solver.get_iterations( );
+  }
+
+  /* Return the PCG (or multigrid) relative residual history of every load
+   * case of the last solve. */
+  const std::vector<std::vector<double> > & get_residuals( ) const {
+    return factor_solver == MULTIGRID ? multigrid.get_residuals( )
+                                      : cg_solver.get_residuals( );
+  }
+
+  /* Select whether `solve' assembles the stiffness from the stored
+   * parameter-independent parts (see `build_affine_stiffness'). */
+  void set_affine( bool use ) { use_affine = use; }
+
+  /* Given the number of threads, evaluate the element matrices concurrently
+   * during assembly.  Elements are scattered one color at a time (no two
+   * elements of a color share a node), so the assembly is free of races and
+   * the result is bit-identical for any number of threads.  The `PARTITIONED'
+   * solver uses one partition per thread. */
+  void set_num_threads( std::size_t num_threads );
+
+  /* Builds the system of equations and then solves.  The equation numbering,
+   * sparsity pattern, symbolic analysis and factorization are cached; a repeat
+   * solve only refactors if the materials or integration order changed, and
+   * otherwise only back-substitutes the new force vector.
    * PRECONDITION:  `elements' must be properly initialized. */
   Eigen::VectorXd solve( std::size_t int_order = 2 );
 
+  /* Given a set of load cases (see `build_force'), factor the stiffness once
+   * and solve for all cases together.  Returns one displacement per column;
+   * the nodes are not updated.
+   * PRECONDITION:  `elements' must be properly initialized. */
+  Eigen::MatrixXd solve( const Eigen::MatrixXd & tractions,
+      const Eigen::MatrixXd & body = Eigen::MatrixXd( ),
+      std::size_t int_order = 2 );
+
   /* Given an output stream and the number of displacement points to print for
    * each element, compute the displacement and print to the output. */
   void print_disp( std::ostream & out = std::cout,
@@ -160,14 +366,132 @@ private:
 
   /* ************************  PRIVATE DATA MEMBERS  ************************ */
 
-  /* Domain elements */
-  std::vector<Node *> nodes;
+  /* Domain elements.  Elements and materials are constructed in `arena' and
+   * destroyed in bulk with the domain. */
+  Arena arena;
+  Node_Store nodes;                  // Node data, structure of arrays;
+  Connectivity connectivity;         // Node IDs of every element (CSR);
   std::vector<Element *> elements;
-  std::vector<Material *> materials;
+  std::vector<Material *> materials;         // Shared by the elements;
+  std::vector<std::size_t> element_mats;
+  Point_State point_state;                   // Per integration point;
   std::size_t num_equations;
+  solver_type solver;
+  bool eqn_valid;
+
+  /* Sparsity pattern of the global stiffness and, for each element, the
+   * position of every local coefficient in the compressed value array (-1 for
+   * coefficients on the essential boundary). */
+  Eigen::SparseMatrix<double> pattern;
+  std::vector<std::ptrdiff_t> scatter_map;
+  std::vector<std::size_t> scatter_offsets;
+  bool pattern_valid;
+
+  /* Cached factorization of the global stiffness for the selected solver, the
+   * integration order and the solver it was built with (after any fallback),
+   * and its validity markers. */
+  Eigen::LLT<Eigen::MatrixXd> dense_factor;
+  Band_Matrix band_factor;
+  Partitioned_Band part_factor;
+  Eigen::SimplicialLDLT<Eigen::SparseMatrix<double> > ldlt_factor;
+  Eigen::SimplicialLLT<Eigen::SparseMatrix<double> > llt_factor;
+  Mixed_Precision mixed_factor;
+  Stiffness_Operator stiff_oper;
+  Conjugate_Gradient cg_solver;
+  Multigrid multigrid;
+  Eigen::MatrixXd last_solution;
+  bool warm_start;
+  std::size_t factor_order;
+  solver_type factor_solver;
+  bool analyzed;
+  bool factor_valid;
+
+  /* Low-rank update of the cached factorization for the element material
+   * changes made since it was computed, K' = K + P D P^T:  the equations
+   * touched (the columns of P), the accumulated change, D, the solves
+   * Z = K^{-1} P and the factors of the capacitance matrix, I + D P^T Z. */
+  std::vector<std::size_t> update_eqns;
+  Eigen::MatrixXd update_delta;
+  Eigen::MatrixXd update_basis;
+  Eigen::PartialPivLU<Eigen::MatrixXd> update_capacitance;
+  std::size_t max_update_rank;
+
+  /* Parameter-independent parts of the global stiffness in the value layout
+   * of `pattern,' two per material (K_lambda at 2*m and K_mu at 2*m + 1). */
+  std::vector<Eigen::VectorXd> affine_parts;
+  std::size_t affine_order;
+  bool affine_valid;
+  bool use_affine;
+
+  /* Worker threads for the assembly (serial if empty) and the element colors,
+   * stored as the list of elements of each color. */
+  std::unique_ptr<Thread_Pool> pool;
+  std::vector<std::size_t> color_offsets;
+  std::vector<std::size_t> color_elements;
+  bool colors_valid;
 
   /* **********************  PRIVATE MEMBER FUNCTIONS  ********************** */
 
+  /* Compute the sparsity pattern of the global stiffness from the location
+   * matrix of every element and store the element scatter map.
+   * PRECONDITION:  num_equations must be valid. */
+  void build_sparse_pattern( );
+
+  /* Given the integration order, build the global stiffness and factor it with
+   * the selected solver.  The symbolic analysis of the sparse solvers is only
+   * repeated if the sparsity pattern changed.
+   * PRECONDITION:  num_equations must be valid. */
+  void factor_stiffness( std::size_t int_order );
+
+  /* Given the integration order, integrate the stiffness per unit Lamé
+   * constant of every element and scatter into the parts of its material.
+   * PRECONDITION:  The sparsity pattern must be valid. */
+  void build_affine_parts( std::size_t int_order );
+
+  /* Given a sparse stiffness, copy its lower band into band storage. */
+  Band_Matrix to_band( const Eigen::SparseMatrix<double> & stiff ) const;
+
+  /* Given a set of force vectors (one per column), solve using the cached
+   * factorization and its low-rank update (or iterate, for the PCG and
+   * multigrid solvers).
+   * PRECONDITION:  The stiffness must be factored. */
+  Eigen::MatrixXd back_substitute( const Eigen::MatrixXd & force );
+
+  /* Given a set of force vectors (one per column), solve with the cached
+   * direct factorization alone (no low-rank update).
+   * PRECONDITION:  The stiffness must be factored by a direct solver. */
+  Eigen::MatrixXd factor_solve( const Eigen::MatrixXd & force );
+
+  /* Return true if the stiffness was factored by an iterative solver. */
+  bool is_iterative( ) const;
+
+  /* Given an element id and the change of its stiffness, add it to the
+   * low-rank update of the cached factorization.  Returns false (and drops
+   * the update) if the rank would exceed the maximum.
+   * PRECONDITION:  The stiffness must be factored by a direct solver. */
+  bool add_low_rank_update( std::size_t ele_id,
+      const Element_Matrix & delta );
+
+  /* Drop the low-rank update of the cached factorization. */
+  void clear_low_rank_update( );
+
+  /* Color the elements so that no two elements of a color share a node. */
+  void build_colors( );
+
+  /* Given a function object, call func( e ) for every element, one color at a
+   * time, running the elements of each color concurrently. */
+  template <typename Func>
+  void for_each_colored( const Func & func );
+
+  /* Mark the equation numbering and everything derived from it as stale. */
+  void invalidate_mesh( );
+
+  /* Given the caller's name, the number of nodes per element, the node ids of
+   * the new elements back to back, and a material id, throw
+   * `std::invalid_argument' unless the elements can be created. */
+  void check_elements( const std::string & caller, std::size_t nodes_per_ele,
+      const std::vector<std::size_t> & conn, std::size_t mat_id ) const;
+
   /* Given a vector of displacements, update the nodes. */
   void update_nodes( const Eigen::VectorXd & displacement );
 
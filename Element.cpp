@@ -22,24 +22,59 @@
 
 /* ***********************  PUBLIC MEMBER FUNCTIONS  ************************ */
 
+/* Given the integration order, return the stiffness per unit Lamé constant,
+ * K_lambda and K_mu, such that K = lambda * K_lambda + mu * K_mu. */
+std::pair<fem::Element_Matrix, fem::Element_Matrix>
+fem::Element::get_stiffness_parts( std::size_t int_order )
+{
+  // Evaluate the stiffness with unit Lamé constants, then restore material;
+  const Material * saved = get_material( );
+  const bool saved_valid = stiff_valid;
+  Material unit = Material::from_lame( 1.0, 0.0 );
+  set_material( &unit );
+  Element_Matrix stiff_lambda = compute_stiffness( int_order );
+  unit = Material::from_lame( 0.0, 1.0 );   // Shared, so seen by the element;
+  Element_Matrix stiff_mu = compute_stiffness( int_order );
+  set_material( saved );
+
+  // The cache was never touched, so it still matches the saved material;
+  stiff_valid = saved_valid;
+
+  return std::make_pair( stiff_lambda, stiff_mu );
+}
+
+/* -------------------------------------------------------------------------- */
+
 /* Returns the external force acting on the element from tractions and body
  * forces. */
-Eigen::MatrixXd fem::Element::get_force_ext( ) const
+fem::Element_Vector fem::Element::get_force_ext( ) const
 {
-  Eigen::VectorXd force = Eigen::VectorXd::Zero( nodes.size( ) );
+  const std::size_t num_nodes = get_num_nodes( );
+  const std::size_t * ids = conn->get_nodes( ele_ID );
+  Element_Vector force = Element_Vector::Zero( num_nodes );
 
   // Check if node is on the natural boundary (Node::NBC) and calc the force;
-  for( std::vector<Node *>::size_type a{ 0 }; a != nodes.size( ); ++a ) {
-    if( nodes[a]->type == Node::NBC )
-      force[a] = nodes[a]->bound_cond * nodes[a]->coord;
-    else
-      force[a] = 0;
+  for( std::size_t a{ 0 }; a != num_nodes; ++a ) {
+    std::size_t n = ids[a];
+    force[a] = store->get_traction( n ) * store->get_coord( n );
   }
   return force;
 }
 
 /* -------------------------------------------------------------------------- */
 
+/* Given the integration order, returns the external force acting on the
+ * element from a unit, uniform radial body force. */
+fem::Element_Vector
+fem::Element::get_force_body( std::size_t int_order ) const
+{
+  F_Func f_eval( this );
+  quad::integrate_points( f_eval, int_order );
+  return f_eval.force;
+}
+
+/* -------------------------------------------------------------------------- */
+
 /* Returns the internal force acting on the element due to strain energy. */
 Eigen::MatrixXd fem::Element::get_force_int( ) const
 {
@@ -51,8 +86,8 @@ Eigen::MatrixXd fem::Element::get_force_int( ) const
 /* Given an output stream, print the node locations. */
 void fem::Element::print_nodes( std::ostream &out ) const
 {
-  for( std::vector<Node *>::size_type a{ 0 }; a != nodes.size( ); ++a )
-    out << nodes[ a ]->get_coord( ) << '\n';
+  for( std::size_t a{ 0 }; a != get_num_nodes( ); ++a )
+    out << get_node_coord( a ) << '\n';
 }
 
 /* -------------------------------------------------------------------------- */
@@ -63,8 +98,8 @@ double fem::Element::interp_coord( double xi ) const
 {
   // Sum N_a * x_a;
   double coord{0};
-  for( std::vector<Node *>::size_type a{ 0 }; a != nodes.size( ); ++a )
-    coord += shape_func( xi, a ) * nodes[a]->coord;
+  for( std::size_t a{ 0 }; a != get_num_nodes( ); ++a )
+    coord += shape_func( xi, a ) * get_node_coord( a );
   return coord;
 }
 
@@ -92,8 +127,8 @@ double fem::Element::interp_coord_deriv( double xi ) const
 {
   // Sum dN_a * x_a;
   double coord_deriv{0};
-  for( std::vector<Node *>::size_type a{ 0 }; a != nodes.size( ); ++a )
-    coord_deriv += shape_deriv( xi, a ) * nodes[a]->coord;
+  for( std::size_t a{ 0 }; a != get_num_nodes( ); ++a )
+    coord_deriv += shape_deriv( xi, a ) * get_node_coord( a );
   return coord_deriv;
 }
 
@@ -121,8 +156,8 @@ double fem::Element::interp_disp( double xi ) const
 {
   // Sum N_a * d_a;
   double disp{0};
-  for( std::vector<Node *>::size_type a{ 0 }; a != nodes.size( ); ++a )
-    disp += shape_func( xi, a ) * nodes[a]->disp;
+  for( std::size_t a{ 0 }; a != get_num_nodes( ); ++a )
+    disp += shape_func( xi, a ) * get_node_disp( a );
   return disp;
 }
 
@@ -152,8 +187,8 @@ Eigen::Vector2d fem::Element::interp_strain( double xi ) const
 {
   // Calculate the strain components;
   Eigen::Vector2d strain = Eigen::Vector2d::Zero( );
-  for( std::vector<Node *>::size_type a{ 0 }; a != nodes.size( ); ++a )
-    strain += get_gradient_matrix( xi, a ) * nodes[a]->disp;
+  for( std::size_t a{ 0 }; a != get_num_nodes( ); ++a )
+    strain += get_gradient_matrix( xi, a ) * get_node_disp( a );
   return strain;
 }
 
@@ -197,7 +232,7 @@ fem::Element::interp_stress( std::size_t num_pts ) const
 
 /* Given the parametric coordinate, xi, and the local index of the shape
  * function, a, return the value of the gradient matrix, B. */
-Eigen::VectorXd
+Eigen::Vector2d
 fem::Element::get_gradient_matrix( double xi, std::size_t a ) const
 {
   // Calculate coefficients used in gradient matrix;
@@ -207,13 +242,28 @@ fem::Element::get_gradient_matrix( double xi, std::size_t a ) const
   double dN_a = shape_deriv( xi, a );
 
   // Build the gradient matrix;
-  Eigen::VectorXd B_a = Eigen::VectorXd::Zero( 2 );
+  Eigen::Vector2d B_a;
   B_a[0] = dN_a / rad_deriv;
   B_a[1] = N_a / radius;
 
   return B_a;
 }
 
+/* -------------------------------------------------------------------------- */
+
+/* Given the parametric coordinate, xi, and the coordinate and its derivative at
+ * xi, return the gradient matrix of every node, [B_0 B_1 ...]. */
+fem::Gradient_Matrix fem::Element::get_gradient_matrix( double xi,
+    double radius, double rad_deriv ) const
+{
+  Gradient_Matrix B( 2, get_num_nodes( ) );
+  for( std::size_t a{ 0 }; a != get_num_nodes( ); ++a ) {
+    B( 0, a ) = shape_deriv( xi, a ) / rad_deriv;
+    B( 1, a ) = shape_func( xi, a ) / radius;
+  }
+  return B;
+}
+
 /* ***********************  PRIVATE MEMBER FUNCTIONS  *********************** */
 
 /* Given the number of intervals, return a set of equally spaced points over the
@@ -229,3 +279,16 @@ std::vector<double> fem::Element::get_points( std::size_t num_pts )
     xi[i] = -1.0 + i * cell_size;
   return xi;
 }
+
+/* ************************  NESTED CLASS FUNCTIONS  ************************ */
+
+void fem::Element::F_Func::operator()( double xi, double weight )
+{
+  // Get required info once for the point;
+  double radius = parent->interp_coord( xi );
+  double rad_deriv = parent->interp_coord_deriv( xi );
+
+  // Accumulate N_a * r * J * w for every node;
+  for( Eigen::Index a{ 0 }; a != force.size( ); ++a )
+    force[a] += parent->shape_func( xi, a ) * radius * rad_deriv * weight;
+}
@@ -15,6 +15,7 @@
 #define GUARD_ELEMENT_H
 
 // Project-specific headers;
+#include "Connectivity.h"
 #include "Material.h"
 #include "Node.h"
 
@@ -27,6 +28,17 @@
 
 namespace fem {
 
+/* Element matrices and vectors.  The size is set at run time but bounded by the
+ * largest element (three nodes), so the coefficients live on the stack and the
+ * element evaluation never allocates. */
+const int max_ele_nodes = 3;
+using Element_Matrix = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic,
+      Eigen::ColMajor, max_ele_nodes, max_ele_nodes>;
+using Element_Vector = Eigen::Matrix<double, Eigen::Dynamic, 1,
+      Eigen::ColMajor, max_ele_nodes, 1>;
+using Gradient_Matrix = Eigen::Matrix<double, 2, Eigen::Dynamic,
+      Eigen::ColMajor, 2, max_ele_nodes>;
+
 class Element {
 
 public:
@@ -34,28 +46,38 @@ public:
   /* ****************************  COPY CONTROL  **************************** */
   /* Default constructor */
   Element( ) :
-    nodes{ }, length{0.0}, ele_ID{ 0 }
+    store{ nullptr }, conn{ nullptr }, length{0.0}, ele_ID{ 0 },
+    stiff_cache{ }, stiff_order{ 2 }, stiff_valid{ false }
   { }
 
-  Element( std::size_t id, std::vector<Node *> nodes ) :
-    nodes{ nodes }, length{ 0.0 }, ele_ID{ id }
+  /* Given the ID, the node store, and the connectivity, whose row `id' holds
+   * the IDs of the element nodes (at most `max_ele_nodes'). */
+  Element( std::size_t id, const Node_Store * store,
+      const Connectivity * conn ) :
+    store{ store }, conn{ conn }, length{ 0.0 }, ele_ID{ id },
+    stiff_cache{ }, stiff_order{ 2 }, stiff_valid{ false }
   {
-    length = nodes.back( )->get_coord( ) - nodes.front( )->get_coord( );
+    length = get_node_coord( get_num_nodes( ) - 1 ) - get_node_coord( 0 );
   }
 
   /* Copy Constructor */
   Element( const Element & other ) :
-    nodes{ other.nodes }, length{ other.length }, ele_ID{ other.ele_ID }
+    store{ other.store }, conn{ other.conn }, length{ other.length },
+    ele_ID{ other.ele_ID }, stiff_cache{ other.stiff_cache },
+    stiff_order{ other.stiff_order }, stiff_valid{ other.stiff_valid }
   { }
 
   /* Move Constructor */
   Element( Element && other ) :
-    nodes{ std::move( other.nodes ) }, length{ other.length },
-    ele_ID{ other.ele_ID }
+    store{ other.store }, conn{ other.conn }, length{ other.length },
+    ele_ID{ other.ele_ID }, stiff_cache{ other.stiff_cache },
+    stiff_order{ other.stiff_order }, stiff_valid{ other.stiff_valid }
   {
-    other.nodes = { nullptr, nullptr };
+    other.store = nullptr;
+    other.conn = nullptr;
     other.length = 0.0;
     other.ele_ID = 0;
+    other.stiff_valid = false;
   }
 
   /* Assignment operators (Deleted) */
@@ -66,25 +88,76 @@ public:
 
   /* **********************  PUBLIC MEMBER FUNCTIONS  *********************** */
 
-  /* Returns the stiffness matrix for the given element using the current
-   * consistent tangent. */
-  virtual Eigen::MatrixXd get_stiffness( std::size_t int_order ) = 0;
+  /* Given the integration order, return the stiffness matrix using the
+   * current consistent tangent.  The matrix is cached and only recomputed
+   * after the material or the integration order changed (or `mark_dirty'). */
+  const Element_Matrix & get_stiffness( std::size_t int_order ) {
+    if( !stiff_valid || int_order != stiff_order ) {
+      stiff_cache = compute_stiffness( int_order );
+      stiff_order = int_order;
+      stiff_valid = true;
+    }
+    return stiff_cache;
+  }
+
+  /* Return the integration order of the cached stiffness (two before the
+   * first evaluation). */
+  std::size_t get_stiffness_order( ) const { return stiff_order; }
+
+  /* Mark the cached element operators as stale.  Called on every material
+   * change; must be called if the node coordinates change. */
+  void mark_dirty( ) { stiff_valid = false; }
+
+  /* Given the integration order, return the stiffness per unit Lamé constant,
+   * K_lambda and K_mu, such that K = lambda * K_lambda + mu * K_mu.  Valid
+   * since every element integrand (including the condensed pressure block) is
+   * linear in the Lamé constants.  The cached operators are left as they
+   * were, so the next `get_stiffness' or `update' does not recompute them. */
+  virtual std::pair<Element_Matrix, Element_Matrix>
+    get_stiffness_parts( std::size_t int_order );
 
   /* Returns the external force acting on the element from tractions and body
    * forces. */
-  Eigen::MatrixXd get_force_ext( ) const;
+  Element_Vector get_force_ext( ) const;
+
+  /* Given the integration order, returns the external force acting on the
+   * element from a unit, uniform radial body force. */
+  Element_Vector get_force_body( std::size_t int_order ) const;
 
   /* Returns the internal force acting on the element due to strain energy. */
   Eigen::MatrixXd get_force_int( ) const;
 
   /* Return the number of element nodes. */
   std::size_t get_num_nodes( ) const {
-    return nodes.size( );
+    return conn->get_num_nodes( ele_ID );
+  }
+
+  /* Given the local node number, return the node ID (index in the store). */
+  inline std::size_t get_node_id( std::size_t a ) const {
+    return conn->get_node( ele_ID, a );
   }
 
   /* Given the local node number, return the node type. */
   inline Node::node_type get_node_type( std::size_t a ) const {
-    return nodes[a]->get_type( );
+    return store->get_type( get_node_id( a ) );
+  }
+
+  /* Given the local node number, return the node coordinate. */
+  inline double get_node_coord( std::size_t a ) const {
+    return store->get_coord( get_node_id( a ) );
+  }
+
+  /* Given an array of (at least) `get_num_nodes' entries, gather the node
+   * coordinates into it. */
+  void gather_coords( double * coords ) const {
+    const std::size_t * ids = conn->get_nodes( ele_ID );
+    for( std::size_t a{ 0 }; a != get_num_nodes( ); ++a )
+      coords[a] = store->get_coord( ids[a] );
+  }
+
+  /* Given the local node number, return the node displacement. */
+  inline double get_node_disp( std::size_t a ) const {
+    return store->get_disp( get_node_id( a ) );
   }
 
   /* Given an output stream, print the node locations. */
@@ -144,19 +217,40 @@ public:
    * function, a, return the value of the shape function derivative. */
   virtual double shape_deriv( double xi, std::size_t a ) const = 0;
 
+  /* Return the number of (condensed) pressure modes, zero for displacement
+   * elements. */
+  virtual std::size_t get_num_pres( ) const { return 0; }
+
+  /* Given the parametric coordinate, xi, and the local index of the pressure
+   * shape function, a, return the value of the pressure function. */
+  virtual double pressure_func( double, std::size_t ) const { return 0.0; }
+
   /* Update the element info.
    * PRECONDITION:  Element nodes must be updated. */
   virtual void update( ) = 0;
 
+  /* Given a material, share it as the element material.  Materials are
+   * flyweights owned by the domain, so the material must outlive the element
+   * (or be replaced first). */
+  virtual void set_material( const Material * mat ) = 0;
+
+  /* Return the element material. */
+  virtual const Material * get_material( ) const = 0;
+
   /* Given the local node number (and eventually DOF number), return the global
    * equation number using the `LM' array. */
   inline std::size_t location_matrix( std::size_t a ) const {
-    return nodes[a]->node_ID;
+    return store->get_eqn_num( get_node_id( a ) );
   }
 
   /* Given the parametric coordinate, xi, and the local index of the shape
    * function, a, return the value of the gradient matrix, B. */
-  Eigen::VectorXd get_gradient_matrix( double xi, std::size_t a) const;
+  Eigen::Vector2d get_gradient_matrix( double xi, std::size_t a) const;
+
+  /* Given the parametric coordinate, xi, and the coordinate and its derivative
+   * at xi, return the gradient matrix of every node, [B_0 B_1 ...]. */
+  Gradient_Matrix get_gradient_matrix( double xi, double radius,
+      double rad_deriv ) const;
 
   inline std::size_t get_id( ) const { return ele_ID; }
 
@@ -227,14 +321,42 @@ protected:
 
   /* ***********************  PROTECTED DATA MEMBERS  *********************** */
 
-  std::vector<Node *> nodes;
+  const Node_Store * store;    // Node data, owned by the domain;
+  const Connectivity * conn;  // Row `ele_ID' holds the node IDs;
   double length;
 
+  /* *********************  PROTECTED MEMBER FUNCTIONS  ********************* */
+
+  /* Given the integration order, compute the stiffness matrix using the
+   * current consistent tangent (uncached, see `get_stiffness'). */
+  virtual Element_Matrix compute_stiffness( std::size_t int_order ) = 0;
+
 private:
 
   /* ************************  PRIVATE DATA MEMBERS  ************************ */
 
   std::size_t ele_ID;
+  Element_Matrix stiff_cache;  // Stiffness at `stiff_order';
+  std::size_t stiff_order;     // Integration order of the cached stiffness;
+  bool stiff_valid;            // Cache matches the material and nodes;
+
+  /* ***************************  NESTED CLASSES  *************************** */
+
+  /* Function object used in the evaluation of the body force.  operator()
+   * overloaded to accumulate the work of a unit body force at the evaluation
+   * point, xi, with quadrature weight, weight. */
+  struct F_Func {
+
+    /* Constructor */
+    F_Func( const Element * p ) :
+      parent{ p }, force( Element_Vector::Zero( p->get_num_nodes( ) ) ) { }
+
+    /* Given a parametric coordinate and weight, accumulate the work. */
+    void operator()( double xi, double weight );
+
+    const Element * parent;
+    Element_Vector force;
+  };
 
   /* **********************  PRIVATE MEMBER FUNCTIONS  ********************** */
 
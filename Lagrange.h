@@ -0,0 +1,92 @@
+/* ************************************************************************** *
+ *                           Frank Nathan Beckwith                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** */
+
+#ifndef GUARD_LAGRANGE_H
+#define GUARD_LAGRANGE_H
+
+// Project-specific headers;
+
+// System headers;
+#include <cmath>
+#include <cstddef>
+
+namespace fem {
+
+/* Compile-time Lagrange basis of polynomial order `Order' over the parametric
+ * domain [-1, 1], along with the discontinuous pressure basis of the matching
+ * u-p element.  All functions are static and inline so that element kernels
+ * built on them have no virtual dispatch and fixed loop bounds. */
+template <std::size_t Order>
+struct Lagrange_Basis;
+
+/* Linear basis:  two nodes, one (constant) pressure mode. */
+template <>
+struct Lagrange_Basis<1> {
+
+  static const std::size_t num_nodes = 2;
+  static const std::size_t num_pres = 1;
+
+  /* Given the parametric coordinate, xi, and the local index of the shape
+   * function, a, return the value of the shape function. */
+  static double shape_func( double xi, std::size_t a ) {
+    return ( a == 0 ) ? 0.5 * ( 1 - xi ) : 0.5 * ( 1 + xi );
+  }
+
+  /* Given the parametric coordinate, xi, and the local index of the shape
+   * function, a, return the value of the shape function derivative. */
+  static double shape_deriv( double, std::size_t a ) {
+    return ( a == 0 ) ? -0.5 : 0.5;
+  }
+
+  /* Given the parametric coordinate, xi, and the local index of the pressure
+   * shape function, a, return the value of the pressure function. */
+  static double pressure_func( double, std::size_t ) {
+    return 1.0;
+  }
+};
+
+/* Quadratic basis:  three nodes, two (linear) pressure modes. */
+template <>
+struct Lagrange_Basis<2> {
+
+  static const std::size_t num_nodes = 3;
+  static const std::size_t num_pres = 2;
+
+  /* Given the parametric coordinate, xi, and the local index of the shape
+   * function, a, return the value of the shape function. */
+  static double shape_func( double xi, std::size_t a ) {
+    return ( a == 0 ) ? 0.5 * xi * ( xi - 1 ) :
+           ( a == 1 ) ? 1 - xi * xi :
+                        0.5 * xi * ( xi + 1 );
+  }
+
+  /* Given the parametric coordinate, xi, and the local index of the shape
+   * function, a, return the value of the shape function derivative. */
+  static double shape_deriv( double xi, std::size_t a ) {
+    return ( a == 0 ) ? xi - 0.5 :
+           ( a == 1 ) ? -2 * xi :
+                        xi + 0.5;
+  }
+
+  /* Given the parametric coordinate, xi, and the local index of the pressure
+   * shape function, a, return the value of the pressure function. */
+  static double pressure_func( double xi, std::size_t a ) {
+    // Pressure modes interpolate the 2-point Gauss locations, -+1/sqrt(3);
+    double xi_a = ( a == 0 ? -1 : 1 ) / std::sqrt( 3.0 );
+    return 0.5 * ( 1 + 3 * xi_a * xi );
+  }
+};
+
+} // namespace fem;
+
+#endif
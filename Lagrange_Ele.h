@@ -0,0 +1,279 @@
+/* ************************************************************************** *
+ *                           Frank Nathan Beckwith                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** */
+
+#ifndef GUARD_LAGRANGE_ELE_H
+#define GUARD_LAGRANGE_ELE_H
+
+// Project-specific headers;
+#include "Condensation.h"
+#include "Disp_Ele.h"
+#include "gauss_quadrature.h"
+#include "Lagrange.h"
+#include "Material.h"
+#include "Node.h"
+#include "UP_Ele.h"
+
+// System headers;
+#include <cstddef>
+#include <Eigen/LU>
+#include <stdexcept>
+#include <vector>
+
+namespace fem {
+
+/* Given the (gathered) node coordinates and the parametric coordinate, xi,
+ * interpolate the coordinate and its derivative using the compile-time
+ * basis. */
+template <typename Basis>
+inline void interp_geometry( const double * coords, double xi,
+    double & radius, double & rad_deriv )
+{
+  radius = 0.0;
+  rad_deriv = 0.0;
+  for( std::size_t a{ 0 }; a != Basis::num_nodes; ++a ) {
+    radius += Basis::shape_func( xi, a ) * coords[a];
+    rad_deriv += Basis::shape_deriv( xi, a ) * coords[a];
+  }
+}
+
+/* Element family templated on the polynomial order and the formulation
+ * (`Disp_Ele' or `UP_Ele').  The shape functions come from `Lagrange_Basis,'
+ * so the stiffness integrands call them statically and the node loops have
+ * compile-time bounds.  `Lagrange_Ele<1, Disp_Ele>' and
+ * `Lagrange_Ele<2, UP_Ele>' replace `Linear' and `Quadratic_UP,' etc. */
+template <std::size_t Order, typename Formulation>
+class Lagrange_Ele;
+
+/* ************************  DISPLACEMENT FORMULATION  ********************** */
+
+template <std::size_t Order>
+class Lagrange_Ele<Order, Disp_Ele> : public Disp_Ele {
+
+public:
+
+  /* Typedefs */
+  using Basis = Lagrange_Basis<Order>;
+  static const int num_nodes = Basis::num_nodes;
+  using Stiff_Matrix = Eigen::Matrix<double, num_nodes, num_nodes>;
+  using Grad_Matrix = Eigen::Matrix<double, 2, num_nodes>;
+
+  /* ****************************  COPY CONTROL  **************************** */
+
+  /* Default constructor */
+  Lagrange_Ele( ) : Disp_Ele( ) { }
+
+  Lagrange_Ele( std::size_t id, const Node_Store * store,
+      const Connectivity * conn, const Material *mat ) :
+    Disp_Ele( id, store, conn, mat )
+  {
+    if( get_num_nodes( ) != Basis::num_nodes )
+      throw std::invalid_argument(
+          "Lagrange_Ele:  node count does not match the element order" );
+  }
+
+  /* **********************  PUBLIC MEMBER FUNCTIONS  *********************** */
+
+  /* Given the integration order, compute the stiffness matrix using the
+   * current consistent tangent (uncached, see `get_stiffness'). */
+  Element_Matrix compute_stiffness( std::size_t int_order )
+  {
+    // Accumulate the stiffness in a single pass over the quadrature points;
+    K_Func stiff_eval( this );
+    quad::integrate_points( stiff_eval, int_order );
+    return stiff_eval.stiff;
+  }
+
+  /* Given the parametric coordinate, xi, and the local index of the shape
+   * function, a, return the value of the shape function. */
+  double shape_func( double xi, std::size_t a ) const
+  {
+    return Basis::shape_func( xi, a );
+  }
+
+  /* Given the parametric coordinate, xi, and the local index of the shape
+   * function, a, return the value of the shape function derivative. */
+  double shape_deriv( double xi, std::size_t a ) const
+  {
+    return Basis::shape_deriv( xi, a );
+  }
+
+private:
+
+  /* ***************************  NESTED CLASSES  *************************** */
+
+  /* Function object used in the evaluation of the stiffness matrix, with the
+   * shape functions resolved at compile time.  operator() accumulates
+   * B^T D B r J w at the evaluation point, xi. */
+  struct K_Func {
+
+    /* Constructor */
+    K_Func( const Lagrange_Ele * p ) :
+      parent{ p }, stiff( Stiff_Matrix::Zero( ) )
+    {
+      p->gather_coords( coords );
+    }
+
+    /* Given a parametric coordinate and weight, accumulate the internal energy
+     * density of the stiffness. */
+    void operator()( double xi, double weight )
+    {
+      // Get required matrices and info once for the point;
+      double radius, rad_deriv;
+      interp_geometry<Basis>( coords, xi, radius, rad_deriv );
+      Eigen::Matrix2d elastic_mod = parent->material->get_tangent( );
+      Grad_Matrix B;
+      for( int a{ 0 }; a != num_nodes; ++a ) {
+        B( 0, a ) = Basis::shape_deriv( xi, a ) / rad_deriv;
+        B( 1, a ) = Basis::shape_func( xi, a ) / radius;
+      }
+
+      // Accumulate the outer product over all node pairs;
+      stiff.noalias( ) +=
+        B.transpose( ) * elastic_mod * B * ( radius * rad_deriv * weight );
+    }
+
+    const Lagrange_Ele * parent;
+    Stiff_Matrix stiff;
+    double coords[num_nodes];  // Gathered once for every point;
+  };
+
+};
+
+/* ****************************  U-P FORMULATION  *************************** */
+
+template <std::size_t Order>
+class Lagrange_Ele<Order, UP_Ele> : public UP_Ele {
+
+public:
+
+  /* Typedefs */
+  using Basis = Lagrange_Basis<Order>;
+  static const int num_nodes = Basis::num_nodes;
+  static const int num_pres = Basis::num_pres;
+  using Stiff_Matrix = Eigen::Matrix<double, num_nodes, num_nodes>;
+  using Div_Matrix = Eigen::Matrix<double, num_nodes, num_pres>;
+  using Constr_Matrix = Eigen::Matrix<double, num_pres, num_pres>;
+  using Recover_Matrix = Eigen::Matrix<double, num_pres, num_nodes>;
+  using Grad_Matrix = Eigen::Matrix<double, 2, num_nodes>;
+
+  /* ****************************  COPY CONTROL  **************************** */
+
+  /* Default constructor */
+  Lagrange_Ele( ) : UP_Ele( ) { }
+
+  Lagrange_Ele( std::size_t id, const Node_Store * store,
+      const Connectivity * conn, const Material *mat ) :
+    UP_Ele( id, store, conn, Basis::num_pres, mat )
+  {
+    if( get_num_nodes( ) != Basis::num_nodes )
+      throw std::invalid_argument(
+          "Lagrange_Ele:  node count does not match the element order" );
+  }
+
+  /* **********************  PUBLIC MEMBER FUNCTIONS  *********************** */
+
+  /* Given the integration order, compute the stiffness matrix using the
+   * current consistent tangent (uncached, see `get_stiffness'). */
+  Element_Matrix compute_stiffness( std::size_t int_order )
+  {
+    // Calculate the various matrices in a single pass over the points;
+    Stiff_Func stiff_eval( this );
+    quad::integrate_points( stiff_eval, int_order );
+    const Div_Matrix & div_op = stiff_eval.div_op;
+    const Constr_Matrix & constr_op = stiff_eval.constr_op;
+
+    // Condense in closed form and keep the recovery operator, -M^{-1} G^T;
+    Stiff_Matrix stiff = stiff_eval.stiff;
+    Recover_Matrix recover;
+    condense<num_nodes, num_pres>( div_op, constr_op, stiff, recover );
+    press_op = recover;
+    return stiff;
+  }
+
+  /* Given the parametric coordinate, xi, and the local index of the shape
+   * function, a, return the value of the shape function. */
+  double shape_func( double xi, std::size_t a ) const
+  {
+    return Basis::shape_func( xi, a );
+  }
+
+  /* Given the parametric coordinate, xi, and the local index of the shape
+   * function, a, return the value of the shape function derivative. */
+  double shape_deriv( double xi, std::size_t a ) const
+  {
+    return Basis::shape_deriv( xi, a );
+  }
+
+  /* Given the parametric coordinate, xi, and the local index of the pressure
+   * shape function, a, return the value of the pressure function. */
+  double pressure_func( double xi, std::size_t a ) const
+  {
+    return Basis::pressure_func( xi, a );
+  }
+
+private:
+
+  /* ***************************  NESTED CLASSES  *************************** */
+
+  /* Function object used in the evaluation of the stiffness matrix, with the
+   * shape functions resolved at compile time.  operator() accumulates the
+   * deviatoric stiffness, the divergence operator and the penalty constraint
+   * at the evaluation point, xi. */
+  struct Stiff_Func {
+
+    /* Constructor */
+    Stiff_Func( const Lagrange_Ele * p ) :
+      parent{ p }, stiff( Stiff_Matrix::Zero( ) ),
+      div_op( Div_Matrix::Zero( ) ), constr_op( Constr_Matrix::Zero( ) )
+    {
+      p->gather_coords( coords );
+    }
+
+    /* Given a parametric coordinate and weight, accumulate the internal energy
+     * densities. */
+    void operator()( double xi, double weight )
+    {
+      // Get required matrices and info once for the point;
+      double radius, rad_deriv;
+      interp_geometry<Basis>( coords, xi, radius, rad_deriv );
+      double mu = parent->material->get_mu( );
+      double bulk = parent->material->get_lambda( ) + 2.0/3.0 * mu;
+      double scale = radius * rad_deriv * weight;
+      Grad_Matrix B;
+      for( int a{ 0 }; a != num_nodes; ++a ) {
+        B( 0, a ) = Basis::shape_deriv( xi, a ) / rad_deriv;
+        B( 1, a ) = Basis::shape_func( xi, a ) / radius;
+      }
+      Eigen::Matrix<double, num_nodes, 1> bv = B.colwise( ).sum( ).transpose( );
+      Eigen::Matrix<double, num_pres, 1> psi;
+      for( int a{ 0 }; a != num_pres; ++a )
+        psi[a] = Basis::pressure_func( xi, a );
+
+      // Accumulate the outer products;
+      stiff.noalias( ) += B.transpose( ) * B * ( 2*mu * scale );
+      div_op.noalias( ) += bv * psi.transpose( ) * scale;
+      constr_op.noalias( ) -= psi * psi.transpose( ) * ( scale / bulk );
+    }
+
+    const Lagrange_Ele * parent;
+    Stiff_Matrix stiff;
+    Div_Matrix div_op;
+    Constr_Matrix constr_op;
+    double coords[num_nodes];  // Gathered once for every point;
+  };
+
+};
+
+} // namespace fem;
+
+#endif
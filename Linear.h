@@ -35,8 +35,9 @@ public:
   Linear( ) : Disp_Ele( )
   { }
 
-  Linear( std::size_t id, std::vector<Node *> nodes, const Material *mat ) :
-    Disp_Ele( id, nodes, mat )
+  Linear( std::size_t id, const Node_Store * store,
+      const Connectivity * conn, const Material *mat ) :
+    Disp_Ele( id, store, conn, mat )
   {
     if( get_num_nodes( ) != 2 )
       ; // TODO:  Put an actual exception here (not sure which to use);
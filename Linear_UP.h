@@ -35,8 +35,9 @@ public:
   Linear_UP( ) : UP_Ele( )
   { }
 
-  Linear_UP( std::size_t id, std::vector<Node *> nodes, const Material *mat ) :
-    UP_Ele( id, nodes, 1, mat )
+  Linear_UP( std::size_t id, const Node_Store * store,
+      const Connectivity * conn, const Material *mat ) :
+    UP_Ele( id, store, conn, 1, mat )
   {
     if( get_num_nodes( ) != 2 )
       ; // TODO:  Put an actual exception here (not sure which to use);
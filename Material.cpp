@@ -19,6 +19,17 @@
 
 /* ***********************  PUBLIC MEMBER FUNCTIONS  ************************ */
 
+/* Given the Lamé constants, lambda and mu, create a material. */
+fem::Material fem::Material::from_lame( double lambda, double mu )
+{
+  Material mat;
+  mat.lambda = lambda;
+  mat.mu = mu;
+  return mat;
+}
+
+/* -------------------------------------------------------------------------- */
+
 /* Return the tangent elastic modulii tensor for the material. */
 Eigen::Matrix2d fem::Material::get_tangent( ) const
 {
@@ -17,6 +17,7 @@
 // Project-specific headers;
 
 // System headers;
+#include <cstddef>
 #include <Eigen/LU>
 #include <iostream>
 
@@ -39,6 +40,9 @@ public:
 
   Material * clone( ) const { return new Material( *this ); }
 
+  /* Given the Lamé constants, lambda and mu, create a material. */
+  static Material from_lame( double lambda, double mu );
+
   /* Destructor */
 
   /* **********************  PUBLIC MEMBER FUNCTIONS  *********************** */
@@ -52,6 +56,10 @@ public:
   /* Given the strain, return the resulting stress. */
   Eigen::Vector3d get_stress_mu( const Eigen::Vector2d & strain ) const;
 
+  /* Return the number of history variables the material keeps at every
+   * integration point (none for linear elasticity). */
+  std::size_t get_num_state( ) const { return 0; }
+
   /* Return the Lamé constants, lambda or mu. */
   double get_lambda( ) const { return lambda; }
   double get_mu( ) const { return mu; }
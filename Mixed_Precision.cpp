@@ -0,0 +1,107 @@
+/* ************************************************************************** *
+ *                           Frank Nathan Beckwith                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** *
+ *                                                                            *
+ * Source file for the implementation of the Mixed_Precision abstraction.     *
+ * Class definition given in Mixed_Precision.h.                               *
+ *                                                                            *
+ * ************************************************************************** */
+
+// Project-specific headers;
+#include "Mixed_Precision.h"
+
+// System headers;
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+/* ***********************  PUBLIC MEMBER FUNCTIONS  ************************ */
+
+/* Given the matrix (both triangles stored), store it and factor in single
+ * precision, or in double precision if the single precision pivots show the
+ * matrix is too ill-conditioned.  Returns false if the (final) factor is not
+ * positive definite. */
+bool fem::Mixed_Precision::compute( const Eigen::SparseMatrix<double> & mat )
+{
+  matrix = mat;
+  use_double = false;
+  matrix_norm = 0.0;
+  for( Eigen::Index j{ 0 }; j != matrix.outerSize( ); ++j ) {
+    double col_sum{ 0.0 };
+    for( Double_Matrix::InnerIterator it( matrix, j ); it; ++it )
+      col_sum += std::abs( it.value( ) );
+    matrix_norm = std::max( matrix_norm, col_sum );
+  }
+  single_factor.compute( matrix.cast<float>( ) );
+
+  // The pivot spread bounds cond( K ) from below; refinement contracts by
+  // roughly cond( K ) eps_single per step, so demand a safety factor of 100;
+  const double max_spread = 1e-2 / std::numeric_limits<float>::epsilon( );
+  if( single_factor.info( ) != Eigen::Success )
+    return fall_back( );
+  const Eigen::VectorXf pivots = single_factor.vectorD( );
+  if( pivots.size( ) != 0 ) {
+    double min_pivot = pivots.minCoeff( );
+    if( !( min_pivot > 0.0 ) ||
+        pivots.maxCoeff( ) > max_spread * min_pivot )
+      return fall_back( );
+  }
+  return true;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given a set of right-hand sides (one per column), solve and refine every
+ * column until the residual is at the level of a double precision backward
+ * stable solve.  If refinement diverges or runs out of steps, refactor in
+ * double precision and solve directly.
+ * PRECONDITION:  `compute' must have been called. */
+Eigen::MatrixXd fem::Mixed_Precision::solve( const Eigen::MatrixXd & rhs )
+{
+  iterations.assign( rhs.cols( ), 0 );
+  if( use_double )
+    return double_factor.solve( rhs );
+
+  // Stop once ||r|| <= ||x|| ||K|| eps sqrt( n ) (infinity norms);
+  const double res_scale = matrix_norm * std::sqrt( double( rhs.rows( ) ) ) *
+    std::numeric_limits<double>::epsilon( );
+  Eigen::MatrixXd sol( rhs.rows( ), rhs.cols( ) );
+  for( Eigen::Index c{ 0 }; c != rhs.cols( ); ++c ) {
+    // Single precision solve, then refine against the double residual;
+    Eigen::VectorXd x =
+      single_factor.solve( rhs.col( c ).cast<float>( ) ).cast<double>( );
+    Eigen::VectorXd res = rhs.col( c ) - matrix * x;
+    double norm_res = res.lpNorm<Eigen::Infinity>( );
+    while( norm_res > res_scale * x.lpNorm<Eigen::Infinity>( ) ) {
+      // Out of steps or no contraction:  too ill-conditioned for single;
+      if( iterations[c] == max_steps || !std::isfinite( norm_res ) ) {
+        fall_back( );
+        iterations.assign( rhs.cols( ), 0 );
+        return double_factor.solve( rhs );
+      }
+      x += single_factor.solve( res.cast<float>( ) ).cast<double>( );
+      res = rhs.col( c ) - matrix * x;
+      norm_res = res.lpNorm<Eigen::Infinity>( );
+      ++iterations[c];
+    }
+    sol.col( c ) = x;
+  }
+  return sol;
+}
+
+/* ***********************  PRIVATE MEMBER FUNCTIONS  *********************** */
+
+/* Factor `matrix' in double precision and use it for every solve.  Returns
+ * false if the factor is not positive definite. */
+bool fem::Mixed_Precision::fall_back( )
+{
+  double_factor.compute( matrix );
+  use_double = true;
+  if( double_factor.info( ) != Eigen::Success )
+    return false;
+  return double_factor.vectorD( ).size( ) == 0 ||
+    double_factor.vectorD( ).minCoeff( ) > 0.0;
+}
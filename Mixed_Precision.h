@@ -0,0 +1,99 @@
+/* ************************************************************************** *
+ *                           Frank Nathan Beckwith                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** */
+
+#ifndef GUARD_MIXED_PRECISION_H
+#define GUARD_MIXED_PRECISION_H
+
+// Project-specific headers;
+
+// System headers;
+#include <cstddef>
+#include <Eigen/Dense>
+#include <Eigen/Sparse>
+#include <vector>
+
+namespace fem {
+
+/* Sparse LDL^T solver that factors a single precision copy of the matrix
+ * (half the factor memory) and recovers double precision accuracy with
+ * iterative refinement, x += L^{-T} D^{-1} L^{-1} ( f - K x ), where the
+ * residual is formed with the double precision matrix.  Refinement only
+ * converges if cond( K ) is well below 1 / eps_single, so the solver switches
+ * to a double precision factor when the pivots of the single precision factor
+ * spread too far (as for nearly incompressible materials, nu -> 0.5) or when
+ * refinement fails to converge. */
+class Mixed_Precision {
+
+public:
+
+  /* ****************************  COPY CONTROL  **************************** */
+
+  /* Default constructor */
+  Mixed_Precision( ) :
+    matrix{ }, matrix_norm{ 0.0 }, single_factor{ }, double_factor{ },
+    use_double{ false }, max_steps{ 30 }, iterations{ }
+  { }
+
+  /* **********************  PUBLIC MEMBER FUNCTIONS  *********************** */
+
+  /* Given the maximum number of refinement steps per right-hand side, set
+   * when refinement gives up and falls back to double precision. */
+  void set_max_steps( std::size_t max_step ) { max_steps = max_step; }
+
+  /* Given the matrix (both triangles stored), store it and factor in single
+   * precision, or in double precision if the single precision pivots show
+   * the matrix is too ill-conditioned.  Returns false if the (final) factor
+   * is not positive definite. */
+  bool compute( const Eigen::SparseMatrix<double> & mat );
+
+  /* Given a set of right-hand sides (one per column), solve and refine every
+   * column until the residual is at the level of a double precision backward
+   * stable solve.  If refinement diverges or runs out of steps, refactor in
+   * double precision and solve directly.
+   * PRECONDITION:  `compute' must have been called. */
+  Eigen::MatrixXd solve( const Eigen::MatrixXd & rhs );
+
+  /* Return true if the factor in use is the double precision one. */
+  bool is_double( ) const { return use_double; }
+
+  /* Return the refinement step count of every column of the last solve. */
+  const std::vector<std::size_t> & get_iterations( ) const {
+    return iterations;
+  }
+
+private:
+
+  /* ************************  PRIVATE DATA MEMBERS  ************************ */
+
+  using Single_Matrix = Eigen::SparseMatrix<float>;
+  using Double_Matrix = Eigen::SparseMatrix<double>;
+
+  Double_Matrix matrix;                             // For the residuals;
+  double matrix_norm;                               // Infinity norm;
+  Eigen::SimplicialLDLT<Single_Matrix> single_factor;
+  Eigen::SimplicialLDLT<Double_Matrix> double_factor;
+  bool use_double;                                  // Fell back to double;
+  std::size_t max_steps;                            // Refinement steps;
+  std::vector<std::size_t> iterations;              // Per column;
+
+  /* **********************  PRIVATE MEMBER FUNCTIONS  ********************** */
+
+  /* Factor `matrix' in double precision and use it for every solve.  Returns
+   * false if the factor is not positive definite. */
+  bool fall_back( );
+
+};
+
+} // namespace fem;
+
+#endif
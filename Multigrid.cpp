@@ -0,0 +1,163 @@
+/* ************************************************************************** *
+ *                           Frank Nathan Beckwith                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** *
+ *                                                                            *
+ * Source file for the implementation of the Multigrid abstraction.           *
+ * Class definition given in Multigrid.h.                                     *
+ *                                                                            *
+ * ************************************************************************** */
+
+// Project-specific headers;
+#include "Multigrid.h"
+#include "Domain.h"
+
+// System headers;
+
+/* *****************************  COPY CONTROL  ***************************** */
+
+/* Default constructor */
+fem::Multigrid::Multigrid( ) :
+  levels{ }, coarse_factor{ }, cycle_shape{ V_CYCLE }, num_smooth{ 1 },
+  tolerance{ 1e-10 }, max_cycles{ 100 }, iterations{ }, residuals{ },
+  converged{ false }
+{ }
+
+/* -------------------------------------------------------------------------- */
+
+/* Destructor */
+fem::Multigrid::~Multigrid( ) { }
+
+/* ***********************  PUBLIC MEMBER FUNCTIONS  ************************ */
+
+/* Given the fine domain, its assembled stiffness and the integration order,
+ * build the hierarchy down to the coarsest mesh that can still be coarsened
+ * (or `max_levels' levels, if nonzero) and factor the coarsest level. */
+void fem::Multigrid::build( Domain & domain,
+    const Eigen::SparseMatrix<double> & stiff, std::size_t int_order,
+    std::size_t max_levels )
+{
+  levels.clear( );
+  levels.push_back( Level( ) );
+  levels.back( ).stiff = stiff;
+
+  // Coarsen until the mesh cannot be halved (or the level limit is hit);
+  Domain * current = &domain;
+  while( max_levels == 0 || levels.size( ) < max_levels ) {
+    Eigen::SparseMatrix<double> prolong;
+    std::unique_ptr<Domain> coarse = current->coarsen( prolong );
+    if( !coarse )
+      break;
+    levels.back( ).prolong = prolong;
+    levels.push_back( Level( ) );
+    levels.back( ).stiff = coarse->build_sparse_stiffness( int_order );
+    levels.back( ).domain = std::move( coarse );
+    current = levels.back( ).domain.get( );
+  }
+
+  // Direct solve on the coarsest level;
+  coarse_factor.compute( levels.back( ).stiff );
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given a right-hand side on the fine level, return the result of one cycle
+ * from a zero initial guess, i.e. the preconditioned residual. */
+Eigen::VectorXd fem::Multigrid::cycle( const Eigen::VectorXd & rhs ) const
+{
+  return cycle( 0, rhs );
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given a set of right-hand sides (one per column) and initial guesses of the
+ * same size (or empty to start from zero), iterate cycles until every column
+ * reaches the tolerance and return the solutions. */
+Eigen::MatrixXd fem::Multigrid::solve( const Eigen::MatrixXd & rhs,
+    const Eigen::MatrixXd & guess )
+{
+  const Eigen::SparseMatrix<double> & stiff = levels.front( ).stiff;
+  Eigen::MatrixXd sol = Eigen::MatrixXd::Zero( rhs.rows( ), rhs.cols( ) );
+  if( guess.rows( ) == rhs.rows( ) && guess.cols( ) == rhs.cols( ) )
+    sol = guess;
+  iterations.assign( rhs.cols( ), 0 );
+  residuals.assign( rhs.cols( ), std::vector<double>( ) );
+  converged = true;
+
+  for( Eigen::Index c{ 0 }; c != rhs.cols( ); ++c ) {
+    double norm_f = rhs.col( c ).norm( );
+    if( norm_f == 0.0 ) {
+      sol.col( c ).setZero( );
+      residuals[c].push_back( 0.0 );
+      continue;
+    }
+
+    // Correct with one cycle on the residual until converged;
+    std::vector<double> & history = residuals[c];
+    Eigen::VectorXd res = rhs.col( c ) - stiff * sol.col( c );
+    history.push_back( res.norm( ) / norm_f );
+    while( history.back( ) > tolerance && iterations[c] != max_cycles ) {
+      sol.col( c ) += cycle( 0, res );
+      res = rhs.col( c ) - stiff * sol.col( c );
+      history.push_back( res.norm( ) / norm_f );
+      ++iterations[c];
+    }
+    converged = converged && history.back( ) <= tolerance;
+  }
+  return sol;
+}
+
+/* ***********************  PRIVATE MEMBER FUNCTIONS  *********************** */
+
+/* Given the level and a right-hand side, return the result of one cycle from a
+ * zero initial guess. */
+Eigen::VectorXd fem::Multigrid::cycle( std::size_t lev,
+    const Eigen::VectorXd & rhs ) const
+{
+  if( lev + 1 == levels.size( ) )
+    return coarse_factor.solve( rhs );
+
+  // Pre-smooth, restrict the residual, correct on the coarse level(s);
+  const Level & level = levels[lev];
+  Eigen::VectorXd sol = Eigen::VectorXd::Zero( rhs.size( ) );
+  smooth( lev, rhs, sol, false );
+  Eigen::VectorXd res_coarse =
+    level.prolong.transpose( ) * ( rhs - level.stiff * sol );
+  Eigen::VectorXd corr = cycle( lev + 1, res_coarse );
+  if( cycle_shape == W_CYCLE && lev + 2 != levels.size( ) )
+    corr += cycle( lev + 1, res_coarse - levels[lev + 1].stiff * corr );
+  sol += level.prolong * corr;
+
+  // Post-smooth in the reverse order to keep the cycle symmetric;
+  smooth( lev, rhs, sol, true );
+  return sol;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given the level, the right-hand side, and a solution, apply the given number
+ * of Gauss-Seidel sweeps (forward, or backward if `reverse'). */
+void fem::Multigrid::smooth( std::size_t lev, const Eigen::VectorXd & rhs,
+    Eigen::VectorXd & sol, bool reverse ) const
+{
+  // The stiffness is symmetric, so column i holds row i;
+  using Sparse_Matrix = Eigen::SparseMatrix<double>;
+  const Sparse_Matrix & stiff = levels[lev].stiff;
+  const Eigen::Index n = stiff.cols( );
+  for( std::size_t sweep{ 0 }; sweep != num_smooth; ++sweep ) {
+    for( Eigen::Index k{ 0 }; k != n; ++k ) {
+      Eigen::Index i = reverse ? n - 1 - k : k;
+      double sum = rhs[i];
+      double diag{ 0.0 };
+      for( Sparse_Matrix::InnerIterator it( stiff, i ); it; ++it ) {
+        if( it.row( ) == i )
+          diag = it.value( );
+        else
+          sum -= it.value( ) * sol[it.row( )];
+      }
+      sol[i] = sum / diag;
+    }
+  }
+}
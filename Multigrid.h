@@ -0,0 +1,149 @@
+/* ************************************************************************** *
+ *                           Frank Nathan Beckwith                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** */
+
+#ifndef GUARD_MULTIGRID_H
+#define GUARD_MULTIGRID_H
+
+// Project-specific headers;
+
+// System headers;
+#include <cstddef>
+#include <Eigen/Dense>
+#include <Eigen/Sparse>
+#include <memory>
+#include <vector>
+
+namespace fem {
+
+class Domain;
+
+/* Geometric multigrid over a hierarchy of nested radial meshes.  Every coarse
+ * level is a `Domain' built by merging pairs of elements of the level above
+ * (see `Domain::coarsen'), and its stiffness is rediscretized from its own
+ * element operators.  Levels are connected by linear interpolation
+ * (prolongation) and its transpose (restriction), smoothed with symmetric
+ * Gauss-Seidel, and the coarsest level is solved directly.  A cycle is a
+ * symmetric positive definite operator, so it can be iterated on its own
+ * (`solve') or used as a PCG preconditioner (`cycle'). */
+class Multigrid {
+
+public:
+
+  /* ****************************  ENUMERATIONS  **************************** */
+
+  /* Enumeration of the cycle shapes (one or two coarse corrections per
+   * level). */
+  enum cycle_type { V_CYCLE, W_CYCLE };
+
+  /* ****************************  COPY CONTROL  **************************** */
+
+  /* Default constructor */
+  Multigrid( );
+
+  /* Hierarchy should be unique, disallow copy and assignment operators */
+  Multigrid( const Multigrid & other ) = delete;
+  Multigrid & operator=( const Multigrid & rhs ) = delete;
+
+  /* Destructor */
+  ~Multigrid( );
+
+  /* **********************  PUBLIC MEMBER FUNCTIONS  *********************** */
+
+  /* Given the cycle shape and the number of smoothing sweeps before and after
+   * the coarse correction, set the cycle. */
+  void set_cycle( cycle_type type, std::size_t num_sweeps = 1 ) {
+    cycle_shape = type;
+    num_smooth = num_sweeps;
+  }
+
+  /* Given the relative residual tolerance, ||r|| <= tol ||f||, and the maximum
+   * number of cycles, set the stopping criteria of `solve.' */
+  void set_tolerance( double tol, std::size_t max_cyc = 100 ) {
+    tolerance = tol;
+    max_cycles = max_cyc;
+  }
+
+  /* Given the fine domain, its assembled stiffness and the integration order,
+   * build the hierarchy down to the coarsest mesh that can still be
+   * coarsened (or `max_levels' levels, if nonzero) and factor the coarsest
+   * level. */
+  void build( Domain & domain, const Eigen::SparseMatrix<double> & stiff,
+      std::size_t int_order, std::size_t max_levels = 0 );
+
+  /* Return the number of levels (including the fine one). */
+  std::size_t get_num_levels( ) const { return levels.size( ); }
+
+  /* Given a right-hand side on the fine level, return the result of one cycle
+   * from a zero initial guess, i.e. the preconditioned residual. */
+  Eigen::VectorXd cycle( const Eigen::VectorXd & rhs ) const;
+
+  /* Given a set of right-hand sides (one per column) and initial guesses of
+   * the same size (or empty to start from zero), iterate cycles until every
+   * column reaches the tolerance and return the solutions. */
+  Eigen::MatrixXd solve( const Eigen::MatrixXd & rhs,
+      const Eigen::MatrixXd & guess = Eigen::MatrixXd( ) );
+
+  /* Return true if every column of the last solve reached the tolerance. */
+  bool is_converged( ) const { return converged; }
+
+  /* Return the cycle count of every column of the last solve. */
+  const std::vector<std::size_t> & get_iterations( ) const {
+    return iterations;
+  }
+
+  /* Return the relative residual history of every column of the last
+   * solve. */
+  const std::vector<std::vector<double> > & get_residuals( ) const {
+    return residuals;
+  }
+
+private:
+
+  /* ***************************  NESTED CLASSES  *************************** */
+
+  /* One level:  its mesh (null on the fine level, which is not owned), its
+   * stiffness and the prolongation from the next coarser level. */
+  struct Level {
+    std::unique_ptr<Domain> domain;
+    Eigen::SparseMatrix<double> stiff;
+    Eigen::SparseMatrix<double> prolong;
+  };
+
+  /* ************************  PRIVATE DATA MEMBERS  ************************ */
+
+  std::vector<Level> levels;
+  Eigen::SimplicialLDLT<Eigen::SparseMatrix<double> > coarse_factor;
+  cycle_type cycle_shape;
+  std::size_t num_smooth;
+  double tolerance;
+  std::size_t max_cycles;
+  std::vector<std::size_t> iterations;
+  std::vector<std::vector<double> > residuals;
+  bool converged;
+
+  /* **********************  PRIVATE MEMBER FUNCTIONS  ********************** */
+
+  /* Given the level and a right-hand side, return the result of one cycle
+   * from a zero initial guess. */
+  Eigen::VectorXd cycle( std::size_t lev, const Eigen::VectorXd & rhs ) const;
+
+  /* Given the level, the right-hand side, and a solution, apply the given
+   * number of Gauss-Seidel sweeps (forward, or backward if `reverse'). */
+  void smooth( std::size_t lev, const Eigen::VectorXd & rhs,
+      Eigen::VectorXd & sol, bool reverse ) const;
+
+};
+
+} // namespace fem;
+
+#endif
@@ -17,17 +17,15 @@
 // Project-specific headers;
 
 // System headers;
-#include <array>
+#include <cstddef>
 #include <vector>
 
 namespace fem {
 
+/* Node types.  The node data itself lives in a `Node_Store'; this class only
+ * scopes the type enumeration. */
 class Node {
 
-  friend class Element;
-  friend class Disp_Ele;
-  friend class UP_Ele;
-
 public:
 
   /* ****************************  ENUMERATIONS  **************************** */
@@ -36,38 +34,87 @@ public:
    * boundary. */
   enum node_type { INT, EBC, NBC };
 
+};
+
+/* Contiguous, structure-of-arrays storage of every node of a domain.  Each
+ * field is its own array indexed by the node ID, so sweeps over coordinates or
+ * displacements (interpolation, assembly, updates) stream through memory
+ * rather than chasing one heap allocation per node. */
+class Node_Store {
+
+public:
+
   /* ****************************  COPY CONTROL  **************************** */
 
   /* Default constructor */
-  Node( std::size_t id = 0, double coord = 0 ) :
-    coord{ coord }, type{ INT }, disp{ 0 }, bound_cond{ 0 }, node_ID{ id }
-  { }
-
-  Node( std::size_t id, double coord, node_type type, double bc ) :
-    coord{ coord }, type{ type }, disp{ 0 }, bound_cond{ bc }, node_ID{ id }
+  Node_Store( ) :
+    coords{ }, disps{ }, types{ }, bound_conds{ }, eqn_nums{ }
   { }
 
-  /* Destructor */
-
   /* **********************  PUBLIC MEMBER FUNCTIONS  *********************** */
 
-  inline double get_coord( ) { return coord; }
-  inline double get_traction( ) { return ( type == NBC ) ? bound_cond : 0; }
-  inline node_type get_type( ) { return type; }
-  inline std::size_t get_eqn_num( ) { return node_ID; }
-  inline void update_disp( double d ) { disp = d; }
+  /* Given a coordinate, node type, and BC, append a node and return its ID.
+   * The equation number is the node ID. */
+  std::size_t add( double coord, Node::node_type type = Node::INT,
+      double bc = 0.0 ) {
+    std::size_t id = coords.size( );
+    coords.push_back( coord );
+    disps.push_back( 0.0 );
+    types.push_back( type );
+    bound_conds.push_back( bc );
+    eqn_nums.push_back( id );
+    return id;
+  }
+
+  /* Given a set of coordinates, append an interior node at each. */
+  void append( const std::vector<double> & new_coords ) {
+    std::size_t first = coords.size( );
+    std::size_t count = new_coords.size( );
+    coords.insert( coords.end( ), new_coords.begin( ), new_coords.end( ) );
+    disps.resize( first + count, 0.0 );
+    types.resize( first + count, Node::INT );
+    bound_conds.resize( first + count, 0.0 );
+    eqn_nums.resize( first + count );
+    for( std::size_t n{ first }; n != first + count; ++n )
+      eqn_nums[n] = n;
+  }
+
+  /* Given the expected number of nodes, reserve storage for them. */
+  void reserve( std::size_t num_nodes ) {
+    coords.reserve( num_nodes );
+    disps.reserve( num_nodes );
+    types.reserve( num_nodes );
+    bound_conds.reserve( num_nodes );
+    eqn_nums.reserve( num_nodes );
+  }
+
+  /* Return the number of nodes. */
+  std::size_t size( ) const { return coords.size( ); }
+
+  inline double get_coord( std::size_t n ) const { return coords[n]; }
+  inline double get_disp( std::size_t n ) const { return disps[n]; }
+  inline Node::node_type get_type( std::size_t n ) const { return types[n]; }
+  inline double get_traction( std::size_t n ) const {
+    return ( types[n] == Node::NBC ) ? bound_conds[n] : 0;
+  }
+  inline std::size_t get_eqn_num( std::size_t n ) const {
+    return eqn_nums[n];
+  }
+  inline void update_disp( std::size_t n, double d ) { disps[n] = d; }
+  inline void update_bc( std::size_t n, double bc ) { bound_conds[n] = bc; }
+  inline void update_type( std::size_t n, Node::node_type type ) {
+    types[n] = type;
+  }
 
 private:
 
   /* ************************  PRIVATE DATA MEMBERS  ************************ */
 
-  double coord;         // Coordinate of the node;
-  node_type type;       // Marker indicating interior or boundary;
-  double disp;          // Current displacement of the node;
-  double bound_cond;    // Boundary condition if node is not interior;
-  std::size_t node_ID;  // Global equation number of node;
-
-  /* **********************  PRIVATE MEMBER FUNCTIONS  ********************** */
+  std::vector<double> coords;           // Coordinate of each node;
+  std::vector<double> disps;            // Current displacement of each node;
+  std::vector<Node::node_type> types;   // Interior or boundary marker;
+  std::vector<double> bound_conds;      // Boundary condition (if not interior);
+  std::vector<std::size_t> eqn_nums;    // Global equation number;
 
 };
 
@@ -0,0 +1,193 @@
+/* ************************************************************************** *
+ *                           Frank Nathan Beckwith                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** *
+ *                                                                            *
+ * Source file for the implementation of the Partitioned_Band abstraction.    *
+ * Class definition given in Partitioned_Band.h.                              *
+ *                                                                            *
+ * ************************************************************************** */
+
+// Project-specific headers;
+#include "Partitioned_Band.h"
+
+// System headers;
+#include <algorithm>
+
+/* ***********************  PUBLIC MEMBER FUNCTIONS  ************************ */
+
+/* Given an (unfactored) band matrix and the worker threads (serial if null),
+ * partition and factor it.  Returns false if the matrix is not positive
+ * definite. */
+bool fem::Partitioned_Band::factorize( const Band_Matrix & mat,
+    Thread_Pool * pool )
+{
+  num_rows = mat.rows( );
+  band_width = mat.get_band_width( );
+  const std::size_t w = band_width;
+
+  // One partition per thread, each at least twice the bandwidth long;
+  std::size_t num_threads = pool ? pool->size( ) : 1;
+  std::size_t num_parts{ 1 };
+  if( w > 0 )
+    num_parts = std::max<std::size_t>( 1,
+        std::min( num_threads, ( num_rows + w ) / ( 3 * w ) ) );
+
+  // Split the rows into partitions separated by `w' separator rows;
+  std::size_t interior = num_rows - ( num_parts - 1 ) * w;
+  std::size_t size = interior / num_parts;
+  std::size_t extra = interior % num_parts;
+  parts.assign( num_parts, Part( ) );
+  seps.clear( );
+  std::size_t row{ 0 };
+  for( std::size_t k{ 0 }; k != num_parts; ++k ) {
+    parts[k].begin = row;
+    row += size + ( k < extra ? 1 : 0 );
+    parts[k].end = row;
+    if( k + 1 != num_parts ) {
+      seps.push_back( row );
+      row += w;
+    }
+  }
+
+  // Factor the partitions concurrently;
+  std::vector<char> pos_def( num_parts, 1 );
+  auto factor = [&]( std::size_t k ) { pos_def[k] = factor_part( k, mat ); };
+  if( pool )
+    pool->parallel_for( num_parts, factor );
+  else
+    for( std::size_t k{ 0 }; k != num_parts; ++k )
+      factor( k );
+  if( std::find( pos_def.begin( ), pos_def.end( ), 0 ) != pos_def.end( ) )
+    return false;
+
+  // Assemble the Schur complement on the separators and factor it;
+  schur.resize( seps.size( ) * w, w > 0 ? 2 * w - 1 : 0 );
+  for( std::size_t s{ 0 }; s != seps.size( ); ++s ) {
+    for( std::size_t b{ 0 }; b != w; ++b )
+      for( std::size_t a{ b }; a != w; ++a )
+        schur.add( s * w + a, s * w + b, mat( seps[s] + a, seps[s] + b ) );
+  }
+  for( std::size_t k{ 0 }; k != num_parts; ++k ) {
+    // Local index l maps to the left separator first, then the right one;
+    std::size_t num_left = ( k > 0 ) ? w : 0;
+    std::size_t offset = ( k > 0 ) ? ( k - 1 ) * w : 0;
+    for( Eigen::Index j{ 0 }; j != parts[k].schur.cols( ); ++j )
+      for( Eigen::Index i{ j }; i != parts[k].schur.rows( ); ++i ) {
+        std::size_t I = ( static_cast<std::size_t>( i ) < num_left ) ?
+          offset + i : k * w + ( i - num_left );
+        std::size_t J = ( static_cast<std::size_t>( j ) < num_left ) ?
+          offset + j : k * w + ( j - num_left );
+        schur.add( I, J, parts[k].schur( i, j ) );
+      }
+  }
+  return schur.factorize( );
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given a set of right-hand sides (one per column) and the worker threads
+ * (serial if null), solve the system for all of them together.
+ * PRECONDITION:  The matrix must be factored. */
+Eigen::MatrixXd fem::Partitioned_Band::solve( const Eigen::MatrixXd & rhs,
+    Thread_Pool * pool ) const
+{
+  const std::size_t w = band_width;
+  const std::size_t num_parts = parts.size( );
+  auto run_parts = [&]( const std::function<void( std::size_t )> & func ) {
+    if( pool )
+      pool->parallel_for( num_parts, func );
+    else
+      for( std::size_t k{ 0 }; k != num_parts; ++k )
+        func( k );
+  };
+
+  // Solve every partition with the separators held at zero;
+  std::vector<Eigen::MatrixXd> interior( num_parts );
+  run_parts( [&]( std::size_t k ) {
+      const Part & part = parts[k];
+      interior[k] = part.block.solve(
+          rhs.middleRows( part.begin, part.end - part.begin ) );
+      } );
+
+  // Condense the right-hand sides onto the separators and solve there;
+  Eigen::MatrixXd sep_rhs( seps.size( ) * w, rhs.cols( ) );
+  for( std::size_t s{ 0 }; s != seps.size( ); ++s ) {
+    sep_rhs.middleRows( s * w, w ) = rhs.middleRows( seps[s], w ) -
+      parts[s].right.transpose( ) * interior[s].bottomRows( w ) -
+      parts[s + 1].left.transpose( ) * interior[s + 1].topRows( w );
+  }
+  Eigen::MatrixXd sep_sol = seps.empty( ) ? sep_rhs : schur.solve( sep_rhs );
+
+  // Scatter the separators and correct every partition for them;
+  Eigen::MatrixXd sol( num_rows, rhs.cols( ) );
+  for( std::size_t s{ 0 }; s != seps.size( ); ++s )
+    sol.middleRows( seps[s], w ) = sep_sol.middleRows( s * w, w );
+  run_parts( [&]( std::size_t k ) {
+      const Part & part = parts[k];
+      Eigen::MatrixXd part_rhs =
+        rhs.middleRows( part.begin, part.end - part.begin );
+      if( k > 0 )
+        part_rhs.topRows( w ) -=
+          part.left * sep_sol.middleRows( ( k - 1 ) * w, w );
+      if( k + 1 != num_parts )
+        part_rhs.bottomRows( w ) -= part.right * sep_sol.middleRows( k * w, w );
+      sol.middleRows( part.begin, part.end - part.begin ) =
+        part.block.solve( part_rhs );
+      } );
+  return sol;
+}
+
+/* ***********************  PRIVATE MEMBER FUNCTIONS  *********************** */
+
+/* Given the partition index and the full matrix, copy its diagonal block and
+ * couplings, factor the block, and compute its Schur contribution.  Returns
+ * false if the block is not positive definite. */
+bool fem::Partitioned_Band::factor_part( std::size_t k,
+    const Band_Matrix & mat )
+{
+  Part & part = parts[k];
+  const std::size_t w = band_width;
+  const std::size_t m = part.end - part.begin;
+  auto coeff = [&]( std::size_t i, std::size_t j ) {
+    return ( i > j ? i - j : j - i ) <= w ? mat( i, j ) : 0.0;
+  };
+
+  // Copy the diagonal block and the couplings to the separators;
+  part.block.resize( m, w );
+  for( std::size_t j{ 0 }; j != m; ++j )
+    for( std::size_t i{ j }; i != std::min( m, j + w + 1 ); ++i )
+      part.block.add( i, j, mat( part.begin + i, part.begin + j ) );
+  std::size_t num_left = ( k > 0 ) ? w : 0;
+  std::size_t num_right = ( k + 1 != parts.size( ) ) ? w : 0;
+  part.left.resize( w, num_left );
+  part.right.resize( w, num_right );
+  for( std::size_t r{ 0 }; r != w; ++r ) {
+    for( std::size_t c{ 0 }; c != num_left; ++c )
+      part.left( r, c ) = coeff( part.begin + r, seps[k - 1] + c );
+    for( std::size_t c{ 0 }; c != num_right; ++c )
+      part.right( r, c ) = coeff( part.end - w + r, part.end + c );
+  }
+  if( !part.block.factorize_ldlt( ) )
+    return false;
+
+  // Schur contribution, -C^T A^{-1} C, one coupling column at a time;
+  std::size_t num_local = num_left + num_right;
+  part.schur.resize( num_local, num_local );
+  Eigen::MatrixXd col( m, 1 );
+  for( std::size_t j{ 0 }; j != num_local; ++j ) {
+    col.setZero( );
+    if( j < num_left )
+      col.topRows( w ) = part.left.col( j );
+    else
+      col.bottomRows( w ) = part.right.col( j - num_left );
+    Eigen::MatrixXd z = part.block.solve( col );
+    for( std::size_t i{ 0 }; i != num_local; ++i )
+      part.schur( i, j ) = ( i < num_left ) ?
+        -part.left.col( i ).dot( z.col( 0 ).head( w ) ) :
+        -part.right.col( i - num_left ).dot( z.col( 0 ).tail( w ) );
+  }
+  return true;
+}
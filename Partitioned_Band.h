@@ -0,0 +1,97 @@
+/* ************************************************************************** *
+ *                           Frank Nathan Beckwith                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** */
+
+#ifndef GUARD_PARTITIONED_BAND_H
+#define GUARD_PARTITIONED_BAND_H
+
+// Project-specific headers;
+#include "Band_Matrix.h"
+#include "Thread_Pool.h"
+
+// System headers;
+#include <cstddef>
+#include <Eigen/Dense>
+#include <vector>
+
+namespace fem {
+
+/* Partitioned (SPIKE-like) direct solver for symmetric band matrices.  The
+ * rows are split into one partition per thread, separated by `band_width'
+ * separator rows, so that the partitions only couple through the separators.
+ * Every partition is factored and solved independently on its own thread,
+ * which leaves a small block-tridiagonal Schur complement on the separators
+ * that is factored serially. */
+class Partitioned_Band {
+
+public:
+
+  /* ****************************  COPY CONTROL  **************************** */
+
+  /* Default constructor */
+  Partitioned_Band( ) :
+    num_rows{ 0 }, band_width{ 0 }, parts{ }, seps{ }, schur{ }
+  { }
+
+  /* **********************  PUBLIC MEMBER FUNCTIONS  *********************** */
+
+  /* Given an (unfactored) band matrix and the worker threads (serial if null),
+   * partition and factor it.  Returns false if the matrix is not positive
+   * definite. */
+  bool factorize( const Band_Matrix & mat, Thread_Pool * pool );
+
+  /* Given a set of right-hand sides (one per column) and the worker threads
+   * (serial if null), solve the system for all of them together.
+   * PRECONDITION:  The matrix must be factored. */
+  Eigen::MatrixXd solve( const Eigen::MatrixXd & rhs,
+      Thread_Pool * pool ) const;
+
+  /* Return the number of partitions of the last factorization. */
+  std::size_t get_num_parts( ) const { return parts.size( ); }
+
+private:
+
+  /* ***************************  NESTED CLASSES  *************************** */
+
+  /* One partition:  its rows, [begin, end), the L D L^T factor of its
+   * diagonal block, the couplings of its first and last `band_width' rows to
+   * the neighbouring separators, and its contribution to the Schur
+   * complement on those separators. */
+  struct Part {
+    std::size_t begin;
+    std::size_t end;
+    Band_Matrix block;
+    Eigen::MatrixXd left;
+    Eigen::MatrixXd right;
+    Eigen::MatrixXd schur;
+  };
+
+  /* ************************  PRIVATE DATA MEMBERS  ************************ */
+
+  std::size_t num_rows;           // Number of rows of the full matrix;
+  std::size_t band_width;         // Half-bandwidth of the full matrix;
+  std::vector<Part> parts;        // Partitions, in row order;
+  std::vector<std::size_t> seps;  // First row of each separator;
+  Band_Matrix schur;              // Factored Schur complement on separators;
+
+  /* **********************  PRIVATE MEMBER FUNCTIONS  ********************** */
+
+  /* Given the partition index and the full matrix, copy its diagonal block and
+   * couplings, factor the block, and compute its Schur contribution.  Returns
+   * false if the block is not positive definite. */
+  bool factor_part( std::size_t k, const Band_Matrix & mat );
+
+};
+
+} // namespace fem;
+
+#endif
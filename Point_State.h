@@ -0,0 +1,78 @@
+/* ************************************************************************** *
+ *                           Frank Nathan Beckwith                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** */
+
+#ifndef GUARD_POINT_STATE_H
+#define GUARD_POINT_STATE_H
+
+// Project-specific headers;
+
+// System headers;
+#include <cstddef>
+#include <vector>
+
+namespace fem {
+
+/* Material history at the integration points, kept apart from the (shared)
+ * materials.  The state of every point of every element lives in one
+ * contiguous array:  the `num_state' values of point qp of element e start at
+ * ( e * num_points + qp ) * num_state, so an element's points are adjacent and
+ * a sweep over the elements is unit stride. */
+class Point_State {
+
+public:
+
+  /* ****************************  COPY CONTROL  **************************** */
+
+  /* Default constructor */
+  Point_State( ) :
+    num_points{ 0 }, num_state{ 0 }, values{ }
+  { }
+
+  /* **********************  PUBLIC MEMBER FUNCTIONS  *********************** */
+
+  /* Given the number of elements, of integration points per element and of
+   * history variables per point, size the table and zero the state. */
+  void resize( std::size_t num_eles, std::size_t points, std::size_t state ) {
+    num_points = points;
+    num_state = state;
+    values.assign( num_eles * num_points * num_state, 0.0 );
+  }
+
+  /* Return the number of integration points per element. */
+  std::size_t get_num_points( ) const { return num_points; }
+
+  /* Return the number of history variables per integration point. */
+  std::size_t get_num_state( ) const { return num_state; }
+
+  /* Given the element and integration point, return a view of its state
+   * (`get_num_state' values). */
+  inline double * get( std::size_t e, std::size_t qp ) {
+    return values.data( ) + ( e * num_points + qp ) * num_state;
+  }
+  inline const double * get( std::size_t e, std::size_t qp ) const {
+    return values.data( ) + ( e * num_points + qp ) * num_state;
+  }
+
+private:
+
+  /* ************************  PRIVATE DATA MEMBERS  ************************ */
+
+  std::size_t num_points;      // Integration points per element;
+  std::size_t num_state;       // History variables per point;
+  std::vector<double> values;  // Element-major, then point, then variable;
+
+};
+
+} // namespace fem;
+
+#endif
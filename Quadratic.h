@@ -35,8 +35,9 @@ public:
   Quadratic( ) : Disp_Ele( )
   { }
 
-  Quadratic( std::size_t id, std::vector<Node *> nodes, const Material *mat ) :
-    Disp_Ele( id, nodes, mat )
+  Quadratic( std::size_t id, const Node_Store * store,
+      const Connectivity * conn, const Material *mat ) :
+    Disp_Ele( id, store, conn, mat )
   {
     if( get_num_nodes( ) != 3 )
       ; // TODO:  Put an actual exception here (not sure which to use);
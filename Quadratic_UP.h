@@ -35,8 +35,9 @@ public:
   Quadratic_UP( ) : UP_Ele( )
   { }
 
-  Quadratic_UP( std::size_t id, std::vector<Node *> nodes, const Material *mat ) :
-    UP_Ele( id, nodes, 2, mat )
+  Quadratic_UP( std::size_t id, const Node_Store * store,
+      const Connectivity * conn, const Material *mat ) :
+    UP_Ele( id, store, conn, 2, mat )
   {
     if( get_num_nodes( ) != 3 )
       ; // TODO:  Put an actual exception here (not sure which to use);
@@ -0,0 +1,168 @@
+/* ************************************************************************** *
+ *                           Frank Nathan Beckwith                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** *
+ *                                                                            *
+ * Source file for the implementation of the Stiffness_Operator abstraction.  *
+ * Class definition given in Stiffness_Operator.h.                            *
+ *                                                                            *
+ * ************************************************************************** */
+
+// Project-specific headers;
+#include "Stiffness_Operator.h"
+#include "gauss_quadrature.h"
+#include "Material.h"
+#include "UP_Ele.h"
+
+// System headers;
+#include <Eigen/LU>
+
+/* ***********************  PUBLIC MEMBER FUNCTIONS  ************************ */
+
+/* Given the elements, the number of equations and the integration order,
+ * precompute the quadrature-point data of every element.
+ * PRECONDITION:  Equation numbers must be valid. */
+void fem::Stiffness_Operator::build( const std::vector<Element *> & elements,
+    std::size_t num_equations, std::size_t int_order )
+{
+  num_rows = num_equations;
+  ele_data.clear( );
+  eqns.clear( );
+  point_data.clear( );
+  const quad::Span points = quad::gauss_pts( int_order );
+  const quad::Span weights = quad::gauss_wts( int_order );
+
+  for( const auto elem : elements ) {
+    Ele_Data data{ elem, elem->get_num_nodes( ), elem->get_num_pres( ),
+      points.size( ), eqns.size( ), point_data.size( ) };
+
+    // Equation numbers of the element nodes;
+    for( std::size_t a{ 0 }; a != data.num_nodes; ++a )
+      eqns.push_back( elem->get_node_type( a ) == Node::EBC ? -1 :
+          static_cast<std::ptrdiff_t>( elem->location_matrix( a ) ) );
+
+    // Gradient matrix, scaling and pressure functions of every point;
+    Pressure_Matrix press_mass =
+      Pressure_Matrix::Zero( data.num_pres, data.num_pres );
+    for( std::size_t pt{ 0 }; pt != points.size( ); ++pt ) {
+      double xi = points[pt];
+      double radius = elem->interp_coord( xi );
+      double rad_deriv = elem->interp_coord_deriv( xi );
+      double scale = radius * rad_deriv * weights[pt];
+      Gradient_Matrix B = elem->get_gradient_matrix( xi, radius, rad_deriv );
+      point_data.insert( point_data.end( ), B.data( ), B.data( ) + B.size( ) );
+      point_data.push_back( scale );
+      for( std::size_t j{ 0 }; j != data.num_pres; ++j ) {
+        point_data.push_back( elem->pressure_func( xi, j ) );
+        for( std::size_t i{ 0 }; i != data.num_pres; ++i )
+          press_mass( i, j ) +=
+            elem->pressure_func( xi, i ) * elem->pressure_func( xi, j ) * scale;
+      }
+    }
+
+    // Inverse of the geometric pressure mass, sum psi psi^T r J w;
+    if( data.num_pres != 0 ) {
+      Pressure_Matrix inv_mass = press_mass.inverse( );
+      point_data.insert( point_data.end( ), inv_mass.data( ),
+          inv_mass.data( ) + inv_mass.size( ) );
+    }
+    ele_data.push_back( data );
+  }
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given a vector of free DOFs, return the product K u. */
+Eigen::VectorXd
+fem::Stiffness_Operator::apply( const Eigen::VectorXd & disp ) const
+{
+  Eigen::VectorXd prod = Eigen::VectorXd::Zero( num_rows );
+  for( const auto & data : ele_data ) {
+    // Gather, apply the element operator and scatter (EBC DOFs held at zero);
+    const std::ptrdiff_t * ele_eqns = &eqns[data.eqn_offset];
+    Element_Vector disp_ele( data.num_nodes );
+    for( std::size_t a{ 0 }; a != data.num_nodes; ++a )
+      disp_ele[a] = ele_eqns[a] >= 0 ? disp[ele_eqns[a]] : 0.0;
+    Element_Vector prod_ele = apply_element( data, disp_ele );
+    for( std::size_t a{ 0 }; a != data.num_nodes; ++a )
+      if( ele_eqns[a] >= 0 )
+        prod[ele_eqns[a]] += prod_ele[a];
+  }
+  return prod;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Return the diagonal of the operator. */
+Eigen::VectorXd fem::Stiffness_Operator::diagonal( ) const
+{
+  // Apply every element operator to its unit vectors;
+  Eigen::VectorXd diag = Eigen::VectorXd::Zero( num_rows );
+  for( const auto & data : ele_data ) {
+    const std::ptrdiff_t * ele_eqns = &eqns[data.eqn_offset];
+    for( std::size_t a{ 0 }; a != data.num_nodes; ++a ) {
+      if( ele_eqns[a] < 0 )
+        continue;
+      Element_Vector unit = Element_Vector::Zero( data.num_nodes );
+      unit[a] = 1.0;
+      diag[ele_eqns[a]] += apply_element( data, unit )[a];
+    }
+  }
+  return diag;
+}
+
+/* ***********************  PRIVATE MEMBER FUNCTIONS  *********************** */
+
+/* Given the element data and an element displacement, return the element
+ * stiffness times the displacement. */
+fem::Element_Vector fem::Stiffness_Operator::apply_element(
+    const Ele_Data & data, const Element_Vector & disp ) const
+{
+  using Grad_Map = Eigen::Map<const Eigen::Matrix<double, 2, Eigen::Dynamic,
+        Eigen::ColMajor, 2, max_ele_nodes> >;
+  using Pres_Map = Eigen::Map<const Pressure_Vector>;
+  const std::size_t N = data.num_nodes;
+  const std::size_t P = data.num_pres;
+  const std::size_t stride = 2 * N + 1 + P;
+  const double * pt_data = &point_data[data.data_offset];
+  const Material * mat = data.elem->get_material( );
+  Element_Vector prod = Element_Vector::Zero( N );
+
+  // Displacement elements, sum B^T D B u r J w;
+  if( P == 0 ) {
+    Eigen::Matrix2d elastic_mod = mat->get_tangent( );
+    for( std::size_t pt{ 0 }; pt != data.num_pts; ++pt, pt_data += stride ) {
+      Grad_Map B( pt_data, 2, N );
+      Eigen::Vector2d strain = B * disp;
+      prod.noalias( ) +=
+        B.transpose( ) * ( elastic_mod * strain ) * pt_data[2*N];
+    }
+    return prod;
+  }
+
+  // U-p elements, 2 mu sum B^T B u r J w plus the condensed dilation term,
+  // bulk G M^{-1} G^T u, where G = sum b^v psi^T r J w;
+  double mu = mat->get_mu( );
+  double bulk = mat->get_lambda( ) + 2.0/3.0 * mu;
+  Pressure_Vector dilation = Pressure_Vector::Zero( P );
+  for( std::size_t pt{ 0 }; pt != data.num_pts; ++pt ) {
+    const double * block = pt_data + pt * stride;
+    Grad_Map B( block, 2, N );
+    Eigen::Vector2d strain = B * disp;
+    prod.noalias( ) += B.transpose( ) * strain * ( 2*mu * block[2*N] );
+    dilation += Pres_Map( block + 2*N + 1, P ) * ( strain.sum( ) * block[2*N] );
+  }
+  Eigen::Map<const Pressure_Matrix> inv_mass( pt_data + data.num_pts * stride,
+      P, P );
+  Pressure_Vector press = inv_mass * dilation;
+  for( std::size_t pt{ 0 }; pt != data.num_pts; ++pt ) {
+    const double * block = pt_data + pt * stride;
+    Grad_Map B( block, 2, N );
+    double coeff = Pres_Map( block + 2*N + 1, P ).dot( press );
+    prod.noalias( ) += B.colwise( ).sum( ).transpose( ) *
+      ( bulk * coeff * block[2*N] );
+  }
+  return prod;
+}
@@ -0,0 +1,94 @@
+/* ************************************************************************** *
+ *                           Frank Nathan Beckwith                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** */
+
+#ifndef GUARD_STIFFNESS_OPERATOR_H
+#define GUARD_STIFFNESS_OPERATOR_H
+
+// Project-specific headers;
+#include "Element.h"
+
+// System headers;
+#include <cstddef>
+#include <Eigen/Dense>
+#include <vector>
+
+namespace fem {
+
+/* Matrix-free global stiffness.  `build' stores, for every element quadrature
+ * point, the gradient matrix, B, the scaling r J w and the pressure functions,
+ * psi (plus, for u-p elements, the inverse of the geometric pressure mass).
+ * `apply' then forms K u element by element from this data and the current
+ * element materials, so the global matrix is never stored and the memory is
+ * linear in the number of elements.  The data only depends on the geometry,
+ * so material changes need no rebuild. */
+class Stiffness_Operator {
+
+public:
+
+  /* ****************************  COPY CONTROL  **************************** */
+
+  /* Default constructor */
+  Stiffness_Operator( ) :
+    num_rows{ 0 }, ele_data{ }, eqns{ }, point_data{ }
+  { }
+
+  /* **********************  PUBLIC MEMBER FUNCTIONS  *********************** */
+
+  /* Given the elements, the number of equations and the integration order,
+   * precompute the quadrature-point data of every element.
+   * PRECONDITION:  Equation numbers must be valid. */
+  void build( const std::vector<Element *> & elements,
+      std::size_t num_equations, std::size_t int_order );
+
+  /* Return the number of rows (and columns) of the operator. */
+  std::size_t rows( ) const { return num_rows; }
+
+  /* Given a vector of free DOFs, return the product K u. */
+  Eigen::VectorXd apply( const Eigen::VectorXd & disp ) const;
+
+  /* Return the diagonal of the operator. */
+  Eigen::VectorXd diagonal( ) const;
+
+private:
+
+  /* ***************************  NESTED CLASSES  *************************** */
+
+  /* Per element sizes and offsets into `eqns' and `point_data.' */
+  struct Ele_Data {
+    const Element * elem;
+    std::size_t num_nodes;
+    std::size_t num_pres;
+    std::size_t num_pts;
+    std::size_t eqn_offset;
+    std::size_t data_offset;
+  };
+
+  /* ************************  PRIVATE DATA MEMBERS  ************************ */
+
+  std::size_t num_rows;              // Number of free DOFs;
+  std::vector<Ele_Data> ele_data;    // One per element;
+  std::vector<std::ptrdiff_t> eqns;  // Equation of every node (-1 on EBC);
+  std::vector<double> point_data;    // Per point:  B, r J w, psi;
+
+  /* **********************  PRIVATE MEMBER FUNCTIONS  ********************** */
+
+  /* Given the element data and an element displacement, return the element
+   * stiffness times the displacement. */
+  Element_Vector apply_element( const Ele_Data & data,
+      const Element_Vector & disp ) const;
+
+};
+
+} // namespace fem;
+
+#endif
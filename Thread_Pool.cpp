@@ -0,0 +1,90 @@
+/* ************************************************************************** *
+ *                           Frank Nathan Beckwith                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** *
+ *                                                                            *
+ * Source file for the implementation of the Thread_Pool abstraction.         *
+ * Class definition given in Thread_Pool.h.                                   *
+ *                                                                            *
+ * ************************************************************************** */
+
+// Project-specific headers;
+#include "Thread_Pool.h"
+
+// System headers;
+
+/* *****************************  COPY CONTROL  ***************************** */
+
+/* Given the total number of threads (including the caller), start the
+ * workers. */
+fem::Thread_Pool::Thread_Pool( std::size_t num_threads ) :
+  workers{ }, mtx{ }, start_cv{ }, done_cv{ }, task{ nullptr },
+  generation{ 0 }, num_busy{ 0 }, stop{ false }
+{
+  for( std::size_t t{ 1 }; t < num_threads; ++t )
+    workers.push_back( std::thread( &Thread_Pool::work, this, t ) );
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Destructor, joins the workers */
+fem::Thread_Pool::~Thread_Pool( )
+{
+  {
+    std::lock_guard<std::mutex> lock( mtx );
+    stop = true;
+  }
+  start_cv.notify_all( );
+  for( auto & worker : workers )
+    worker.join( );
+}
+
+/* ***********************  PUBLIC MEMBER FUNCTIONS  ************************ */
+
+/* Given a thread task, call it once on every thread with the thread number and
+ * return when all calls are done. */
+void fem::Thread_Pool::run( const std::function<void( std::size_t )> & job )
+{
+  // Publish the job and wake the workers;
+  {
+    std::lock_guard<std::mutex> lock( mtx );
+    task = &job;
+    num_busy = workers.size( );
+    ++generation;
+  }
+  start_cv.notify_all( );
+
+  // Take part as thread zero, then wait for the workers;
+  job( 0 );
+  std::unique_lock<std::mutex> lock( mtx );
+  done_cv.wait( lock, [this]( ) { return num_busy == 0; } );
+  task = nullptr;
+}
+
+/* ***********************  PRIVATE MEMBER FUNCTIONS  *********************** */
+
+/* Given the thread number, wait for jobs and run them until stopped. */
+void fem::Thread_Pool::work( std::size_t thread )
+{
+  std::size_t seen{ 0 };
+  while( true ) {
+    // Wait for a new job (or the stop signal);
+    const std::function<void( std::size_t )> * job{ nullptr };
+    {
+      std::unique_lock<std::mutex> lock( mtx );
+      start_cv.wait( lock, [&]( ) { return stop || generation != seen; } );
+      if( stop )
+        return;
+      seen = generation;
+      job = task;
+    }
+
+    // Run it and report completion;
+    ( *job )( thread );
+    std::lock_guard<std::mutex> lock( mtx );
+    if( --num_busy == 0 )
+      done_cv.notify_one( );
+  }
+}
@@ -0,0 +1,98 @@
+/* ************************************************************************** *
+ *                           Frank Nathan Beckwith                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** */
+
+#ifndef GUARD_THREAD_POOL_H
+#define GUARD_THREAD_POOL_H
+
+// Project-specific headers;
+
+// System headers;
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace fem {
+
+/* Fixed-size pool of worker threads.  The calling thread takes part in every
+ * job, so a pool of size one runs everything inline. */
+class Thread_Pool {
+
+public:
+
+  /* ****************************  COPY CONTROL  **************************** */
+
+  /* Given the total number of threads (including the caller), start the
+   * workers. */
+  explicit Thread_Pool( std::size_t num_threads );
+
+  /* Pool should be unique, disallow copy and assignment operators */
+  Thread_Pool( const Thread_Pool & other ) = delete;
+  Thread_Pool( Thread_Pool && other ) = delete;
+  Thread_Pool & operator=( const Thread_Pool & rhs ) = delete;
+  Thread_Pool && operator=( Thread_Pool && rhs ) = delete;
+
+  /* Destructor, joins the workers */
+  ~Thread_Pool( );
+
+  /* **********************  PUBLIC MEMBER FUNCTIONS  *********************** */
+
+  /* Return the total number of threads (including the caller). */
+  std::size_t size( ) const { return workers.size( ) + 1; }
+
+  /* Given a thread task, call it once on every thread with the thread number
+   * and return when all calls are done. */
+  void run( const std::function<void( std::size_t )> & job );
+
+  /* *********************  TEMPLATE MEMBER FUNCTIONS  ********************** */
+
+  /* Given a range size, n, and a function object, call func( i ) for every i
+   * in [0, n).  The range is split into one contiguous chunk per thread. */
+  template <typename Func>
+  void parallel_for( std::size_t n, const Func & func )
+  {
+    const std::size_t chunk = ( n + size( ) - 1 ) / size( );
+    run( [&]( std::size_t thread ) {
+        std::size_t begin = std::min( n, thread * chunk );
+        std::size_t end = std::min( n, begin + chunk );
+        for( std::size_t i = begin; i != end; ++i )
+          func( i );
+        } );
+  }
+
+private:
+
+  /* ************************  PRIVATE DATA MEMBERS  ************************ */
+
+  std::vector<std::thread> workers;
+  std::mutex mtx;
+  std::condition_variable start_cv;
+  std::condition_variable done_cv;
+  const std::function<void( std::size_t )> * task;  // Current job;
+  std::size_t generation;                           // Job counter;
+  std::size_t num_busy;                             // Workers still running;
+  bool stop;
+
+  /* **********************  PRIVATE MEMBER FUNCTIONS  ********************** */
+
+  /* Given the thread number, wait for jobs and run them until stopped. */
+  void work( std::size_t thread );
+
+};
+
+} // namespace fem;
+
+#endif
@@ -22,22 +22,41 @@
 
 /* ***********************  PUBLIC MEMBER FUNCTIONS  ************************ */
 
-/* Returns the stiffness matrix for the given element using the current
- * consistent tangent. */
-Eigen::MatrixXd fem::UP_Ele::get_stiffness( std::size_t int_order )
+/* Given the integration order, compute the stiffness matrix using the current
+ * consistent tangent (uncached, see `get_stiffness'). */
+fem::Element_Matrix fem::UP_Ele::compute_stiffness( std::size_t int_order )
 {
-  // Calculate the various matrices;
-  Eigen::MatrixXd stiff = quad::integrate_matrix( k_eval, int_order, true );
-  Eigen::MatrixXd div_op = quad::integrate_matrix( g_eval, int_order );
-  Eigen::MatrixXd constr_op = quad::integrate_matrix( m_eval, int_order, true );
-
-  // Perform static condensation and return;
-  stiff -= ( div_op * constr_op.inverse( ) * div_op.transpose( ) );
+  // Calculate the various matrices in a single pass over the points;
+  Stiff_Func stiff_eval( this );
+  quad::integrate_points( stiff_eval, int_order );
+  const Coupling_Matrix & div_op = stiff_eval.div_op;
+  const Pressure_Matrix & constr_op = stiff_eval.constr_op;
+
+  // Keep the pressure recovery operator, -M^{-1} G^T, and condense with it;
+  press_op = -( constr_op.inverse( ) * div_op.transpose( ) );
+  Element_Matrix stiff = stiff_eval.stiff;
+  stiff.noalias( ) += div_op * press_op;
   return stiff;
 }
 
 /* -------------------------------------------------------------------------- */
 
+/* Given the integration order, return the stiffness per unit Lamé constant
+ * (see `Element::get_stiffness_parts'), keeping the pressure recovery operator
+ * of the element material. */
+std::pair<fem::Element_Matrix, fem::Element_Matrix>
+fem::UP_Ele::get_stiffness_parts( std::size_t int_order )
+{
+  // The unit materials overwrite `press_op' through `compute_stiffness';
+  Recovery_Matrix saved_op = press_op;
+  std::pair<Element_Matrix, Element_Matrix> parts =
+    Element::get_stiffness_parts( int_order );
+  press_op = saved_op;
+  return parts;
+}
+
+/* -------------------------------------------------------------------------- */
+
 /* Given the parametric coordinate, xi, return the stresses from the resulting
  * displacement.
  * PRECONDITION:  Nodes must have updated displacements. */
@@ -66,25 +85,22 @@ double fem::UP_Ele::get_divergence_matrix( double xi, std::size_t a ) const
 
 /* -------------------------------------------------------------------------- */
 
-/* Update the element info.
+/* Update the element info:  recover the pressures from the displacements with
+ * the operator cached by the last stiffness evaluation (at its integration
+ * order).
  * PRECONDITION:  Element nodes must be updated. */
 void fem::UP_Ele::update( )
 {
-  // Update the pressures.  Get the G & M matrices;
-  std::size_t int_order{ 2 }; // TODO:  hard-coded for now, remove later;
-  Eigen::MatrixXd G = quad::integrate_matrix( g_eval, int_order );
-  Eigen::MatrixXd M = quad::integrate_matrix( m_eval, int_order );
-
-  // Perform matrix mult to get discrete pressure operator;
-  Eigen::MatrixXd press_op = -( M.inverse( ) * G.transpose( ) );
+  // Refresh the pressure operator (only if the material or nodes changed);
+  get_stiffness( get_stiffness_order( ) );
 
   // Create a displacement vector for the element;
-  Eigen::VectorXd disp = Eigen::VectorXd::Zero( nodes.size( ) );
-  for( std::vector<Node *>::size_type a{ 0 }; a != nodes.size( ); ++a )
-    disp(a) = nodes[a]->disp;
+  Element_Vector disp = Element_Vector::Zero( get_num_nodes( ) );
+  for( std::size_t a{ 0 }; a != get_num_nodes( ); ++a )
+    disp(a) = get_node_disp( a );
 
-  // Calculate the pressures;
-  for( std::vector<double>::size_type a{ 0 }; a != pressure.size( ); ++a )
+  // Calculate the pressures, p = -M^{-1} G^T u;
+  for( Eigen::Index a{ 0 }; a != pressure.size( ); ++a )
     pressure[a] = ( press_op.row( a ) * disp ).value( );
 }
 
@@ -96,7 +112,7 @@ double fem::UP_Ele::interp_pressure( double xi ) const
 {
   // Perform summation over the pressure coefficients and their interpolation;
   double pres{ 0.0 };
-  for( std::vector<double>::size_type a{ 0 }; a != pressure.size( ); ++a )
+  for( Eigen::Index a{ 0 }; a != pressure.size( ); ++a )
     pres += pressure_func( xi, a ) * pressure[a];
   return pres;
 }
@@ -105,45 +121,24 @@ double fem::UP_Ele::interp_pressure( double xi ) const
 
 /* ************************  NESTED CLASS FUNCTIONS  ************************ */
 
-double fem::UP_Ele::K_Func::operator()( double xi ) const
+void fem::UP_Ele::Stiff_Func::operator()( double xi, double weight )
 {
-  // Get required matrices and info;
+  // Get required matrices and info once for the point;
   double mu = parent->material->get_mu( );
+  double bulk = parent->material->get_lambda( ) + 2.0/3.0 * mu;
   double radius = parent->interp_coord( xi );
   double rad_deriv = parent->interp_coord_deriv( xi );
-  Eigen::Vector2d B_a = parent->get_gradient_matrix( xi, a );
-  Eigen::Vector2d B_b = parent->get_gradient_matrix( xi, b );
-
-  // Calculate value and return;
-  return ( B_a.transpose( ) * B_b ).value( ) * (2*mu) * radius * rad_deriv;
-}
-
-/* -------------------------------------------------------------------------- */
-
-double fem::UP_Ele::G_Func::operator()( double xi ) const
-{
-  // Get required matrices and info;
-  double radius = parent->interp_coord( xi );
-  double rad_deriv = parent->interp_coord_deriv( xi );
-  double bv_a = parent->get_divergence_matrix( xi, a );
-  double psi_b = parent->pressure_func( xi, b );
-
-  // Calculate the value and return;
-  return bv_a * psi_b * radius * rad_deriv;
-}
-
-/* -------------------------------------------------------------------------- */
-
-double fem::UP_Ele::M_Func::operator()( double xi ) const
-{
-  // Get required matrices and info;
-  double radius = parent->interp_coord( xi );
-  double rad_deriv = parent->interp_coord_deriv( xi );
-  double psi_a = parent->pressure_func( xi, a );
-  double psi_b = parent->pressure_func( xi, b );
-  double bulk =
-    parent->material->get_lambda( ) + 2.0/3.0 * parent->material->get_mu( );
-
-  // Calculate the value and return;
-  return -psi_a * psi_b * radius * rad_deriv / bulk;
+  double scale = radius * rad_deriv * weight;
+  Gradient_Matrix B = parent->get_gradient_matrix( xi, radius, rad_deriv );
+
+  // Divergence matrix of every node and pressure function of every mode;
+  Element_Vector bv = B.colwise( ).sum( ).transpose( );
+  Pressure_Vector psi( parent->pressure.size( ) );
+  for( Eigen::Index a{ 0 }; a != psi.size( ); ++a )
+    psi[a] = parent->pressure_func( xi, a );
+
+  // Accumulate the outer products;
+  stiff.noalias( ) += B.transpose( ) * B * ( 2*mu * scale );
+  div_op.noalias( ) += bv * psi.transpose( ) * scale;
+  constr_op.noalias( ) -= psi * psi.transpose( ) * ( scale / bulk );
 }
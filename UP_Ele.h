@@ -26,6 +26,18 @@
 
 namespace fem {
 
+/* Pressure matrices, bounded by the largest number of pressure modes (two) so
+ * that they live on the stack. */
+const int max_ele_pres = 2;
+using Pressure_Matrix = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic,
+      Eigen::ColMajor, max_ele_pres, max_ele_pres>;
+using Coupling_Matrix = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic,
+      Eigen::ColMajor, max_ele_nodes, max_ele_pres>;
+using Pressure_Vector = Eigen::Matrix<double, Eigen::Dynamic, 1,
+      Eigen::ColMajor, max_ele_pres, 1>;
+using Recovery_Matrix = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic,
+      Eigen::ColMajor, max_ele_pres, max_ele_nodes>;
+
 class UP_Ele : public fem::Element {
 
 public:
@@ -33,26 +45,24 @@ public:
   /* ****************************  COPY CONTROL  **************************** */
   /* Default constructor */
   UP_Ele( ) :
-    Element( ), pressure( ), material( nullptr ),
-    k_eval( this ), g_eval( this ), m_eval( this )
+    Element( ), pressure( ), press_op( ), material( nullptr )
   { }
 
-  UP_Ele( std::size_t id, std::vector<Node *> nodes,
-          std::size_t num_pres, const Material *mat ) :
-    Element( id, nodes ), pressure( num_pres, 0.0 ), material( mat->clone( ) ),
-    k_eval( this ), g_eval( this ), m_eval( this )
+  UP_Ele( std::size_t id, const Node_Store * store,
+          const Connectivity * conn, std::size_t num_pres,
+          const Material *mat ) :
+    Element( id, store, conn ), pressure( Pressure_Vector::Zero( num_pres ) ),
+    press_op( ), material( mat )
   { }
 
   UP_Ele( const UP_Ele & other ) :
-    Element( other ), pressure{ other.pressure },
-    material{ other.material->clone( ) },
-    k_eval( this ), g_eval( this ), m_eval( this )
+    Element( other ), pressure{ other.pressure }, press_op{ other.press_op },
+    material{ other.material }
   { }
 
   UP_Ele( UP_Ele && other ) :
-    Element( std::move( other ) ), pressure{ std::move( other.pressure ) },
-    material{ other.material },
-    k_eval( this ), g_eval( this ), m_eval( this )
+    Element( std::move( other ) ), pressure{ other.pressure },
+    press_op{ other.press_op }, material{ other.material }
   {
     other.material = nullptr;
   }
@@ -61,13 +71,19 @@ public:
   UP_Ele & operator=( const UP_Ele & ) = delete;
   UP_Ele && operator=( UP_Ele && ) = delete;
 
-  virtual ~UP_Ele( ) { delete material; }
+  virtual ~UP_Ele( ) { }
 
   /* **********************  PUBLIC MEMBER FUNCTIONS  *********************** */
 
-  /* Returns the stiffness matrix for the given element using the current
-   * consistent tangent. */
-  Eigen::MatrixXd get_stiffness( std::size_t int_order );
+  /* Given the integration order, compute the stiffness matrix using the
+   * current consistent tangent (uncached, see `get_stiffness'). */
+  Element_Matrix compute_stiffness( std::size_t int_order );
+
+  /* Given the integration order, return the stiffness per unit Lamé constant
+   * (see `Element::get_stiffness_parts'), keeping the pressure recovery
+   * operator of the element material. */
+  std::pair<Element_Matrix, Element_Matrix>
+    get_stiffness_parts( std::size_t int_order );
 
   /* Given the parametric coordinate, xi, interpolate the stresses from the
    * resulting displacement.
@@ -78,10 +94,22 @@ public:
    * divergence matrix, b^v. */
   double get_divergence_matrix( double xi, std::size_t a ) const;
 
-  /* Update the element info.
+  /* Update the element info:  recover the pressures from the displacements
+   * with the operator cached by the last stiffness evaluation (at its
+   * integration order).
    * PRECONDITION:  Element nodes must be updated. */
   void update( );
 
+  /* Given a material, share it as the element material (the element does not
+   * own it). */
+  void set_material( const Material * mat ) {
+    material = mat;
+    mark_dirty( );
+  }
+
+  /* Return the element material. */
+  const Material * get_material( ) const { return material; }
+
   /* Given the parametrix coordinate, xi, interpolate the pressure.
    * PRECONDITION:  Pressures must be updated after solving. */
   double interp_pressure( double xi ) const;
@@ -94,6 +122,9 @@ public:
    * function, a, return the value of the shape function derivative. */
   virtual double shape_deriv( double xi, std::size_t a ) const = 0;
 
+  /* Return the number of (condensed) pressure modes. */
+  std::size_t get_num_pres( ) const { return pressure.size( ); }
+
   /* Given the parametric coordinate, xi, and the local index of the pressure
    * shape function, a, return the value of the pressure function. */
   virtual double pressure_func( double xi, std::size_t a ) const = 0;
@@ -102,78 +133,42 @@ protected:
 
   /* ***********************  PROTECTED DATA MEMBERS  *********************** */
 
-  std::vector<double> pressure;
-  Material *material;
+  Pressure_Vector pressure;  // Inline, so the element never allocates;
+  Recovery_Matrix press_op;     // Pressure recovery, -M^{-1} G^T;
+  const Material *material;  // Shared, owned by the domain;
 
 private:
 
   /* ***************************  NESTED CLASSES  *************************** */
 
   /* Function object used in the evaluation of the stiffness matrix.  operator()
-   * overloaded to return the internal energy density (from the shear modulus)
-   * at the evaluation point, xi. */
-  struct K_Func {
+   * overloaded to accumulate, at the evaluation point, xi, the internal energy
+   * densities from the shear modulus (stiff), the dilation (div_op) and the
+   * penalty constraint (constr_op), evaluating the geometry and all basis
+   * values once per point. */
+  struct Stiff_Func {
 
     /* Constructor */
-    K_Func( const UP_Ele * p ) : parent{ p }, a{ 0 }, b{ 0 } { }
-
-    /* Functions to query the size of the final matrix. */
-    std::size_t get_rows( ) const { return parent->nodes.size( ); }
-    std::size_t get_cols( ) const { return parent->nodes.size( ); }
-
-    /* Calculate the internal energy density of the stiffness. */
-    double operator()( double xi ) const;
+    Stiff_Func( const UP_Ele * p ) :
+      parent{ p },
+      stiff(
+        Element_Matrix::Zero( p->get_num_nodes( ), p->get_num_nodes( ) ) ),
+      div_op(
+        Coupling_Matrix::Zero( p->get_num_nodes( ), p->pressure.size( ) ) ),
+      constr_op(
+        Pressure_Matrix::Zero( p->pressure.size( ), p->pressure.size( ) ) )
+    { }
+
+    /* Given a parametric coordinate and weight, accumulate the internal energy
+     * densities. */
+    void operator()( double xi, double weight );
 
     const UP_Ele * parent;
-    std::size_t a;
-    std::size_t b;
+    Element_Matrix stiff;
+    Coupling_Matrix div_op;
+    Pressure_Matrix constr_op;
   };
 
-  /* Function object used in the evaluation of the stiffness matrix.  operator()
-   * overloaded to return the internal energy density due to dilation at the
-   * evaluation point, xi. */
-  struct G_Func {
-    /* Constructor */
-    G_Func( const UP_Ele * p ) : parent{ p }, a{ 0 }, b{ 0 } { }
-
-    /* Functions to query the size of the final matrix. */
-    std::size_t get_rows( ) const { return parent->nodes.size( ); }
-    std::size_t get_cols( ) const { return parent->pressure.size( ); }
-
-    /* Calculate the internal energy density of the dilation. */
-    double operator()( double xi ) const;
-
-    const UP_Ele * parent;
-    std::size_t a;
-    std::size_t b;
-  };
-
-  /* Function object used in the evaluation of the stiffness matrix.  operator()
-   * overloaded to return the internal energy density due to the penalty
-   * constraint at the evaluation point, xi. */
-  struct M_Func {
-
-    /* Constructor */
-    M_Func( const UP_Ele * p ) : parent{ p }, a{ 0 }, b{ 0 } { }
-
-    /* Functions to query the size of the final matrix. */
-    std::size_t get_rows( ) const { return parent->pressure.size( ); }
-    std::size_t get_cols( ) const { return parent->pressure.size( ); }
-
-    /* Calculate the internal energy density of the penalty constraint. */
-    double operator()( double xi ) const;
-
-    const UP_Ele * parent;
-    std::size_t a;
-    std::size_t b;
-  };
-
-  /* ************************  PRIVATE DATA MEMBERS  ************************ */
-
-  K_Func k_eval;
-  G_Func g_eval;
-  M_Func m_eval;
-
   /* *********************  PRIVATE MEMBERS FUNCTIONS  ********************** */
 
 };
@@ -0,0 +1,236 @@
+/* ************************************************************************** *
+ *                           Frank Nathan Beckwith                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** *
+ *                                                                            *
+ * Benchmark of the element evaluation path.  Counts the heap allocations     *
+ * made while evaluating element stiffnesses, forces and updates, which must  *
+ * be zero, and reports the time per element.                                 *
+ *                                                                            *
+ * ************************************************************************** */
+
+// Project-specific headers;
+#include "../Lagrange_Ele.h"
+#include "../Linear.h"
+#include "../Linear_UP.h"
+#include "../Material.h"
+#include "../Node.h"
+#include "../Quadratic.h"
+#include "../Quadratic_UP.h"
+
+// System headers;
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <vector>
+
+/* ***************************  ALLOCATION COUNTER  ************************* */
+
+static std::atomic<std::size_t> num_allocs( 0 );
+
+#ifdef __GLIBC__
+
+/* Interpose the C allocator, which catches both `operator new' and Eigen's own
+ * (malloc based) heap storage. */
+extern "C" {
+  void * __libc_malloc( std::size_t size );
+  void * __libc_calloc( std::size_t num, std::size_t size );
+  void * __libc_realloc( void * ptr, std::size_t size );
+
+  void * malloc( std::size_t size )
+  {
+    ++num_allocs;
+    return __libc_malloc( size );
+  }
+
+  void * calloc( std::size_t num, std::size_t size )
+  {
+    ++num_allocs;
+    return __libc_calloc( num, size );
+  }
+
+  void * realloc( void * ptr, std::size_t size )
+  {
+    ++num_allocs;
+    return __libc_realloc( ptr, size );
+  }
+}
+
+#else
+
+/* Without glibc only `operator new' can be counted. */
+void * operator new( std::size_t size )
+{
+  ++num_allocs;
+  if( void * ptr = std::malloc( size ? size : 1 ) )
+    return ptr;
+  throw std::bad_alloc( );
+}
+
+void operator delete( void * ptr ) noexcept { std::free( ptr ); }
+void operator delete( void * ptr, std::size_t ) noexcept { std::free( ptr ); }
+
+#endif
+
+/* ****************************  BEGIN PROGRAM  ***************************** */
+
+/* Given the element, the number of evaluations and the integration order,
+ * evaluate the element repeatedly and return the number of allocations. */
+std::size_t count_allocs( fem::Element & elem, std::size_t num_evals,
+    std::size_t int_order, double & checksum )
+{
+  // Warm up so that one-time tables (Gauss rules) are built;
+  checksum += elem.get_stiffness( int_order ).sum( );
+
+  std::size_t start = num_allocs;
+  for( std::size_t i{ 0 }; i != num_evals; ++i ) {
+    elem.mark_dirty( );
+    checksum += elem.get_stiffness( int_order ).sum( );
+    checksum += elem.get_force_ext( ).sum( );
+    checksum += elem.get_force_body( int_order ).sum( );
+    elem.update( );
+  }
+  return num_allocs - start;
+}
+
+/* Given the number of elements and of repetitions, condense synthetic u-p
+ * element data one element at a time and in batches, report the time per
+ * element of both and return the largest difference between them. */
+template <int N, int P>
+double time_condensation( std::size_t count, std::size_t num_reps,
+    double & checksum )
+{
+  using Stiff = Eigen::Matrix<double, N, N>;
+  using Div = Eigen::Matrix<double, N, P>;
+  using Constr = Eigen::Matrix<double, P, P>;
+  using Recover = Eigen::Matrix<double, P, N>;
+
+  // Synthetic data with a symmetric negative definite constraint;
+  std::vector<Stiff> stiff( count );
+  std::vector<Div> div( count );
+  std::vector<Constr> constr( count );
+  std::vector<Recover> recover( count );
+  std::vector<double> soa_stiff( N * N * count ), soa_div( N * P * count ),
+    soa_constr( P * P * count ), soa_recover( P * N * count );
+  for( std::size_t e{ 0 }; e != count; ++e ) {
+    stiff[e] = Stiff::Random( );
+    stiff[e] = stiff[e] * stiff[e].transpose( );
+    div[e] = Div::Random( );
+    Constr root = Constr::Random( );
+    constr[e] = -( root * root.transpose( ) + Constr::Identity( ) );
+    for( int k{ 0 }; k != N * N; ++k )
+      soa_stiff[k * count + e] = stiff[e].data( )[k];
+    for( int k{ 0 }; k != N * P; ++k )
+      soa_div[k * count + e] = div[e].data( )[k];
+    for( int k{ 0 }; k != P * P; ++k )
+      soa_constr[k * count + e] = constr[e].data( )[k];
+  }
+  std::vector<Stiff> out( count );
+  std::vector<double> soa_out( soa_stiff.size( ) );
+
+  // One element at a time;
+  auto start = std::chrono::steady_clock::now( );
+  for( std::size_t rep{ 0 }; rep != num_reps; ++rep ) {
+    for( std::size_t e{ 0 }; e != count; ++e ) {
+      out[e] = stiff[e];
+      fem::condense<N, P>( div[e], constr[e], out[e], recover[e] );
+    }
+    checksum += out[rep % count]( 0, 0 );
+  }
+  auto stop = std::chrono::steady_clock::now( );
+  double time_single = std::chrono::duration<double>( stop - start ).count( );
+
+  // In batches;
+  start = std::chrono::steady_clock::now( );
+  for( std::size_t rep{ 0 }; rep != num_reps; ++rep ) {
+    soa_out = soa_stiff;
+    fem::condense_batch<N, P>( count, soa_div.data( ), soa_constr.data( ),
+        soa_out.data( ), soa_recover.data( ) );
+    checksum += soa_out[rep % count];
+  }
+  stop = std::chrono::steady_clock::now( );
+  double time_batch = std::chrono::duration<double>( stop - start ).count( );
+
+  double max_diff{ 0.0 };
+  for( std::size_t e{ 0 }; e != count; ++e ) {
+    for( int k{ 0 }; k != N * N; ++k )
+      max_diff = std::max( max_diff,
+          std::abs( out[e].data( )[k] - soa_out[k * count + e] ) );
+  }
+  std::cout << "Condensation, " << N << " nodes, " << P << " modes:  "
+    << 1e9 * time_single / ( num_reps * count ) << " ns per element, "
+    << 1e9 * time_batch / ( num_reps * count ) << " ns batched\n";
+  return max_diff;
+}
+
+int main( int argc, char *argv[] )
+{
+  std::size_t num_evals = ( argc > 1 ) ? std::atoi( argv[1] ) : 100000;
+
+  // Build one element of each type;
+  fem::Material mat( 1000.0, 0.3 );
+  fem::Node_Store nodes;
+  nodes.add( 6.0, fem::Node::NBC, 10.0 );
+  nodes.add( 6.5 );
+  nodes.add( 7.0 );
+  // Row e holds the nodes of element e (alternating linear and quadratic);
+  fem::Connectivity conn;
+  for( std::size_t e{ 0 }; e != 8; ++e ) {
+    if( e % 2 == 0 )
+      conn.add( std::vector<std::size_t>{ 0, 2 } );
+    else
+      conn.add( std::vector<std::size_t>{ 0, 1, 2 } );
+  }
+
+  fem::Linear linear( 0, &nodes, &conn, &mat );
+  fem::Quadratic quadratic( 1, &nodes, &conn, &mat );
+  fem::Linear_UP linear_up( 2, &nodes, &conn, &mat );
+  fem::Quadratic_UP quadratic_up( 3, &nodes, &conn, &mat );
+  fem::Lagrange_Ele<1, fem::Disp_Ele> lagrange_1( 4, &nodes, &conn, &mat );
+  fem::Lagrange_Ele<2, fem::Disp_Ele> lagrange_2( 5, &nodes, &conn, &mat );
+  fem::Lagrange_Ele<1, fem::UP_Ele> lagrange_1_up( 6, &nodes, &conn, &mat );
+  fem::Lagrange_Ele<2, fem::UP_Ele> lagrange_2_up( 7, &nodes, &conn, &mat );
+
+  struct Case { const char * name; fem::Element * elem; std::size_t order; };
+  Case cases[] = { { "Linear", &linear, 2 }, { "Quadratic", &quadratic, 3 },
+    { "Linear_UP", &linear_up, 2 }, { "Quadratic_UP", &quadratic_up, 3 },
+    { "Lagrange_Ele<1, Disp_Ele>", &lagrange_1, 2 },
+    { "Lagrange_Ele<2, Disp_Ele>", &lagrange_2, 3 },
+    { "Lagrange_Ele<1, UP_Ele>", &lagrange_1_up, 2 },
+    { "Lagrange_Ele<2, UP_Ele>", &lagrange_2_up, 3 } };
+
+  // Count the allocations and time each element type;
+  double checksum{ 0.0 };
+  std::size_t total{ 0 };
+  for( const auto & c : cases ) {
+    auto start = std::chrono::steady_clock::now( );
+    std::size_t allocs = count_allocs( *c.elem, num_evals, c.order, checksum );
+    auto stop = std::chrono::steady_clock::now( );
+    double time = std::chrono::duration<double>( stop - start ).count( );
+    std::cout << c.name << ":  " << allocs << " allocations, "
+      << 1e9 * time / num_evals << " ns per element\n";
+    total += allocs;
+  }
+  // Compare the per-element and batched condensation kernels;
+  double cond_diff = std::max( time_condensation<2, 1>( 4096, 200, checksum ),
+      time_condensation<3, 2>( 4096, 200, checksum ) );
+  std::cout << "Checksum:  " << checksum << '\n';
+
+  if( cond_diff > 1e-10 ) {
+    std::cerr << "ERROR:  Batched condensation differs by " << cond_diff
+      << ".\n";
+    return 1;
+  }
+
+  if( total != 0 ) {
+    std::cerr << "ERROR:  Element evaluation allocated memory.\n";
+    return 1;
+  }
+  return 0;
+}
@@ -16,2417 +16,4349 @@
 #include <iostream>
 #include <cmath>
 
-/* Given the order of integration, return the gauss point locations. */
-std::vector<double> quad::get_gauss_pts( int order )
+namespace {
+
+/* Gauss-Legendre rules of orders 1 through quad::max_order stored back to back,
+ * so the rule of order n starts at n(n-1)/2.  Points and weights provided by:
+ * http://pomax.github.io/bezierinfo/legendre-gauss.html */
+constexpr double point_table[] = {
+  // Order 1;
+   0.0,
+  // Order 2;
+  -0.57735026918962576450914878050195745564760175127012687601860232648397767,
+   0.57735026918962576450914878050195745564760175127012687601860232648397767,
+  // Order 3;
+  -0.77459666924148337703585307995647992216658434105831816531751475322269662,
+   0,
+   0.77459666924148337703585307995647992216658434105831816531751475322269662,
+  // Order 4;
+  -0.86113631159405257522394648889280950509572537962971763761572192090652947,
+  -0.33998104358485626480266575910324468720057586977091435259295397682102003,
+   0.33998104358485626480266575910324468720057586977091435259295397682102003,
+   0.86113631159405257522394648889280950509572537962971763761572192090652947,
+  // Order 5;
+  -0.90617984593866399279762687829939296512565191076253086287376228654377079,
+  -0.53846931010568309103631442070020880496728660690555995620223162705947119,
+   0,
+   0.53846931010568309103631442070020880496728660690555995620223162705947119,
+   0.90617984593866399279762687829939296512565191076253086287376228654377079,
+  // Order 6;
+   0.66120938646626451366139959501990534700644856439517007081452670585218350,
+  -0.66120938646626451366139959501990534700644856439517007081452670585218350,
+  -0.23861918608319690863050172168071193541861063014002135018139516457427493,
+   0.23861918608319690863050172168071193541861063014002135018139516457427493,
+  -0.93246951420315202781230155449399460913476573771228982487254961652661350,
+   0.93246951420315202781230155449399460913476573771228982487254961652661350,
+  // Order 7;
+   0,
+   0.40584515137739716690660641207696146334738201409937012638704325179466381,
+  -0.40584515137739716690660641207696146334738201409937012638704325179466381,
+  -0.74153118559939443986386477328078840707414764714139026011995535196742987,
+   0.74153118559939443986386477328078840707414764714139026011995535196742987,
+  -0.94910791234275852452618968404785126240077093767061778354876910391306333,
+   0.94910791234275852452618968404785126240077093767061778354876910391306333,
+  // Order 8;
+  -0.96028985649753623168356086856947299042823523430145203827163977737242490,
+  -0.79666647741362673959155393647583043683717173161596483207017029503921731,
+  -0.52553240991632898581773904918924634904196424312039285775085709927245482,
+  -0.18343464249564980493947614236018398066675781291297378231718847369920447,
+   0.18343464249564980493947614236018398066675781291297378231718847369920447,
+   0.52553240991632898581773904918924634904196424312039285775085709927245482,
+   0.79666647741362673959155393647583043683717173161596483207017029503921731,
+   0.96028985649753623168356086856947299042823523430145203827163977737242490,
+  // Order 9;
+   0,
+  -0.83603110732663579429942978806973487654410671812467599610437197963945501,
+   0.83603110732663579429942978806973487654410671812467599610437197963945501,
+  -0.96816023950762608983557620290367287004940480049192532955002331184908037,
+   0.96816023950762608983557620290367287004940480049192532955002331184908037,
+  -0.32425342340380892903853801464333660857195626073697308882704747684218658,
+   0.32425342340380892903853801464333660857195626073697308882704747684218658,
+  -0.61337143270059039730870203934147418478572060494056469287281294228126735,
+   0.61337143270059039730870203934147418478572060494056469287281294228126735,
+  // Order 10;
+  -0.14887433898163121088482600112971998461756485942069169570798925351590362,
+   0.14887433898163121088482600112971998461756485942069169570798925351590362,
+  -0.43339539412924719079926594316578416220007183765624649650270151314376699,
+   0.43339539412924719079926594316578416220007183765624649650270151314376699,
+  -0.67940956829902440623432736511487357576929471183480946766481718895255858,
+   0.67940956829902440623432736511487357576929471183480946766481718895255858,
+  -0.86506336668898451073209668842349304852754301496533045252195973184537476,
+   0.86506336668898451073209668842349304852754301496533045252195973184537476,
+  -0.97390652851717172007796401208445205342826994669238211923121206669659520,
+   0.97390652851717172007796401208445205342826994669238211923121206669659520,
+  // Order 11;
+   0,
+  -0.26954315595234497233153198540086152467962186243905228162392563188005707,
+   0.26954315595234497233153198540086152467962186243905228162392563188005707,
+  -0.51909612920681181592572566945860955448022711511992848902092261148669593,
+   0.51909612920681181592572566945860955448022711511992848902092261148669593,
+  -0.73015200557404932409341625203115345804964306202613031197837833968701325,
+   0.73015200557404932409341625203115345804964306202613031197837833968701325,
+  -0.88706259976809529907515776930392726663167575122531438496741105553761131,
+   0.88706259976809529907515776930392726663167575122531438496741105553761131,
+  -0.97822865814605699280393800112285739077142240891978441542580106598366380,
+   0.97822865814605699280393800112285739077142240891978441542580106598366380,
+  // Order 12;
+  -0.12523340851146891547244136946385312998339691630544427321292175474846206,
+   0.12523340851146891547244136946385312998339691630544427321292175474846206,
+  -0.36783149899818019375269153664371756125636014133540962131179987950408993,
+   0.36783149899818019375269153664371756125636014133540962131179987950408993,
+  -0.58731795428661744729670241894053428036909851404805248151027087966734070,
+   0.58731795428661744729670241894053428036909851404805248151027087966734070,
+  -0.76990267419430468703689383321281807598492575001893163766441906424911654,
+   0.76990267419430468703689383321281807598492575001893163766441906424911654,
+  -0.90411725637047485667846586611909619253759670921329754655407576068123480,
+   0.90411725637047485667846586611909619253759670921329754655407576068123480,
+  -0.98156063424671925069054909014928082296015519981373151046268212180779324,
+   0.98156063424671925069054909014928082296015519981373151046268212180779324,
+  // Order 13;
+   0,
+  -0.23045831595513479406552812109798883521154237588353116346926149783716208,
+   0.23045831595513479406552812109798883521154237588353116346926149783716208,
+  -0.44849275103644685287791285212763986780192166744175787895828294745824409,
+   0.44849275103644685287791285212763986780192166744175787895828294745824409,
+  -0.64234933944034022064398460699551565007169739826157685738914240791864355,
+   0.64234933944034022064398460699551565007169739826157685738914240791864355,
+  -0.80157809073330991279420648958285989030561572479050002989738471385922212,
+   0.80157809073330991279420648958285989030561572479050002989738471385922212,
+  -0.91759839922297796520654783650071951239047479011168329589528534565965921,
+   0.91759839922297796520654783650071951239047479011168329589528534565965921,
+  -0.98418305471858814947282944880710961106499056192587490869400732042859524,
+   0.98418305471858814947282944880710961106499056192587490869400732042859524,
+  // Order 14;
+  -0.10805494870734366206624465021983474761195160547423755704082106130801353,
+   0.10805494870734366206624465021983474761195160547423755704082106130801353,
+  -0.31911236892788976043567182416847546683426120353384395659665018725733344,
+   0.31911236892788976043567182416847546683426120353384395659665018725733344,
+  -0.51524863635815409196529071855118866230888528256930603695150476909278495,
+   0.51524863635815409196529071855118866230888528256930603695150476909278495,
+  -0.68729290481168547014801980301933413753840121274717067561926648862818490,
+   0.68729290481168547014801980301933413753840121274717067561926648862818490,
+  -0.82720131506976499318979474265039496103970110147508118156070905424147983,
+   0.82720131506976499318979474265039496103970110147508118156070905424147983,
+  -0.92843488366357351733639113937787426447703921040983761871796244748213109,
+   0.92843488366357351733639113937787426447703921040983761871796244748213109,
+  -0.98628380869681233884159726670405280167609140723922588164407081177774955,
+   0.98628380869681233884159726670405280167609140723922588164407081177774955,
+  // Order 15;
+   0,
+  -0.20119409399743452230062830339459620781283645446263767961594972460994824,
+   0.20119409399743452230062830339459620781283645446263767961594972460994824,
+  -0.39415134707756336989720737098104546836275277615869825503116534395160896,
+   0.39415134707756336989720737098104546836275277615869825503116534395160896,
+  -0.57097217260853884753722673725391064123838639628274960485326541705419538,
+   0.57097217260853884753722673725391064123838639628274960485326541705419538,
+  -0.72441773136017004741618605461393800963089929458410256355142342070412378,
+   0.72441773136017004741618605461393800963089929458410256355142342070412378,
+  -0.84820658341042721620064832077421685136625617473699263409572755876067508,
+   0.84820658341042721620064832077421685136625617473699263409572755876067508,
+  -0.93727339240070590430775894771020947124399627351530445790136307635020297,
+   0.93727339240070590430775894771020947124399627351530445790136307635020297,
+  -0.98799251802048542848956571858661258114697281712376148999999751558738844,
+   0.98799251802048542848956571858661258114697281712376148999999751558738844,
+  // Order 16;
+  -0.09501250983763744018531933542495806313035305568906545669721981722512530,
+   0.09501250983763744018531933542495806313035305568906545669721981722512530,
+  -0.28160355077925891323046050146049610648606949077059980054883473395592518,
+   0.28160355077925891323046050146049610648606949077059980054883473395592518,
+  -0.45801677765722738634241944298357757354003161303552349090115475094775917,
+   0.45801677765722738634241944298357757354003161303552349090115475094775917,
+  -0.61787624440264374844667176404879101899188221776565779410379735554173332,
+   0.61787624440264374844667176404879101899188221776565779410379735554173332,
+  -0.75540440835500303389510119484744226835381365645750300978175717692229686,
+   0.75540440835500303389510119484744226835381365645750300978175717692229686,
+  -0.86563120238783174388046789771239313238733538484752670810351142556776040,
+   0.86563120238783174388046789771239313238733538484752670810351142556776040,
+  -0.94457502307323257607798841553460834509113927259107260092555365206660979,
+   0.94457502307323257607798841553460834509113927259107260092555365206660979,
+  -0.98940093499164993259615417345033262742627407165764513005122390473132414,
+   0.98940093499164993259615417345033262742627407165764513005122390473132414,
+  // Order 17;
+   0,
+  -0.17848418149584785585067749365406555747541933269152564356295181427069755,
+   0.17848418149584785585067749365406555747541933269152564356295181427069755,
+  -0.35123176345387631529718551709534600504053975157567502331916101954779426,
+   0.35123176345387631529718551709534600504053975157567502331916101954779426,
+  -0.51269053708647696788624656862955187458292372241117290591273149896428492,
+   0.51269053708647696788624656862955187458292372241117290591273149896428492,
+  -0.65767115921669076585030221664300233514780589147597324380523169550732430,
+   0.65767115921669076585030221664300233514780589147597324380523169550732430,
+  -0.78151400389680140692523005552047605022397247274056851251331453551257762,
+   0.78151400389680140692523005552047605022397247274056851251331453551257762,
+  -0.88023915372698590212295569448815569262341681793442790035191015932402713,
+   0.88023915372698590212295569448815569262341681793442790035191015932402713,
+  -0.95067552176876776122271695789580302144338504655910870766996921241211537,
+   0.95067552176876776122271695789580302144338504655910870766996921241211537,
+  -0.99057547531441733567543401994066527650778985045956430278390878674234386,
+   0.99057547531441733567543401994066527650778985045956430278390878674234386,
+  // Order 18;
+  -0.08477501304173530124226185293578381173331738690608992004336451762549979,
+   0.08477501304173530124226185293578381173331738690608992004336451762549979,
+  -0.25188622569150550958897285487791123016286176565964045802027103173678449,
+   0.25188622569150550958897285487791123016286176565964045802027103173678449,
+  -0.41175116146284264603593179383305163707898968212002551128114886779038967,
+   0.41175116146284264603593179383305163707898968212002551128114886779038967,
+  -0.55977083107394753460787154852532913692762648577070941663998694406218453,
+   0.55977083107394753460787154852532913692762648577070941663998694406218453,
+  -0.69168704306035320787489108128884838945227057281750775890216265683719737,
+   0.69168704306035320787489108128884838945227057281750775890216265683719737,
+  -0.80370495897252311568241745501459079710329892161192248175042806419538811,
+   0.80370495897252311568241745501459079710329892161192248175042806419538811,
+  -0.89260246649755573920606059112714551540789527135229821418746631490724058,
+   0.89260246649755573920606059112714551540789527135229821418746631490724058,
+  -0.95582394957139775518119589292977630997284413481130647884538762969089807,
+   0.95582394957139775518119589292977630997284413481130647884538762969089807,
+  -0.99156516842093094673001600470615077025257893684543969291967563023985709,
+   0.99156516842093094673001600470615077025257893684543969291967563023985709,
+  // Order 19;
+   0,
+  -0.16035864564022537586809611574074354950487350047087537887464345160632061,
+   0.16035864564022537586809611574074354950487350047087537887464345160632061,
+  -0.31656409996362983199011732884984491789228521913288724515572898679789289,
+   0.31656409996362983199011732884984491789228521913288724515572898679789289,
+  -0.46457074137596094571726714810410236797628571462413659698430887757568412,
+   0.46457074137596094571726714810410236797628571462413659698430887757568412,
+  -0.60054530466168102346963816494623927986832208273229256758658672566838491,
+   0.60054530466168102346963816494623927986832208273229256758658672566838491,
+  -0.72096617733522937861709586082378162965714183290866677493859047138661456,
+   0.72096617733522937861709586082378162965714183290866677493859047138661456,
+  -0.82271465653714282497892248671271390177453848620683004136986388860550034,
+   0.82271465653714282497892248671271390177453848620683004136986388860550034,
+  -0.90315590361481790164266092853231248780939393405735581769503242476163580,
+   0.90315590361481790164266092853231248780939393405735581769503242476163580,
+  -0.96020815213483003085277884068765152661509150327413810591781633443220075,
+   0.96020815213483003085277884068765152661509150327413810591781633443220075,
+  -0.99240684384358440318901767025326049358931640140321078667967943909123190,
+   0.99240684384358440318901767025326049358931640140321078667967943909123190,
+  // Order 20;
+  -0.99312859918509492478612238847132027822264713090165589614818413121798472,
+  -0.96397192727791379126766613119727722191206032780618885606353759389204158,
+  -0.91223442825132590586775244120329811304918479742369177479588221915807089,
+  -0.83911697182221882339452906170152068532962936506563737325249272553286109,
+  -0.74633190646015079261430507035564159031073067956917644413954590606853536,
+  -0.63605368072651502545283669622628593674338911679936846393944662254654126,
+  -0.51086700195082709800436405095525099842549132920242683347234861989473497,
+  -0.37370608871541956067254817702492723739574632170568271182794861351564576,
+  -0.22778585114164507808049619536857462474308893768292747231463573920717134,
+  -0.07652652113349733375464040939883821100479626681349750080479524438425634,
+   0.07652652113349733375464040939883821100479626681349750080479524438425634,
+   0.22778585114164507808049619536857462474308893768292747231463573920717134,
+   0.37370608871541956067254817702492723739574632170568271182794861351564576,
+   0.51086700195082709800436405095525099842549132920242683347234861989473497,
+   0.63605368072651502545283669622628593674338911679936846393944662254654126,
+   0.74633190646015079261430507035564159031073067956917644413954590606853536,
+   0.83911697182221882339452906170152068532962936506563737325249272553286109,
+   0.91223442825132590586775244120329811304918479742369177479588221915807089,
+   0.96397192727791379126766613119727722191206032780618885606353759389204158,
+   0.99312859918509492478612238847132027822264713090165589614818413121798472,
+  // Order 21;
+   0,
+  -0.14556185416089509093703098233868633011632602443793775742148838998554728,
+   0.14556185416089509093703098233868633011632602443793775742148838998554728,
+  -0.28802131680240109660079251606460031990901826364603322875428152474924494,
+   0.28802131680240109660079251606460031990901826364603322875428152474924494,
+  -0.42434212020743878357366888854378805209644523183963458422425823589648688,
+   0.42434212020743878357366888854378805209644523183963458422425823589648688,
+  -0.55161883588721980705901879672431328662206022423067966500430583949960478,
+   0.55161883588721980705901879672431328662206022423067966500430583949960478,
+  -0.66713880419741231930596666999033916259702934331140284247546708234719419,
+   0.66713880419741231930596666999033916259702934331140284247546708234719419,
+  -0.76843996347567790861587785130622803482097670577136955086872666503001874,
+   0.76843996347567790861587785130622803482097670577136955086872666503001874,
+  -0.85336336458331728364725063858756767027610580317934397074299162939424291,
+   0.85336336458331728364725063858756767027610580317934397074299162939424291,
+  -0.92009933415040082879018713371496889415914760964822169717613548709098156,
+   0.92009933415040082879018713371496889415914760964822169717613548709098156,
+  -0.96722683856630629431662221490769516142469368732984684995297112808512096,
+   0.96722683856630629431662221490769516142469368732984684995297112808512096,
+  -0.99375217062038950026024203593794092919333845478232918558087385471309611,
+   0.99375217062038950026024203593794092919333845478232918558087385471309611,
+  // Order 22;
+  -0.06973927331972222121384179611862808182229629948023147470668194651160937,
+   0.06973927331972222121384179611862808182229629948023147470668194651160937,
+  -0.20786042668822128547884653391954573421567510909793364966865330436820084,
+   0.20786042668822128547884653391954573421567510909793364966865330436820084,
+  -0.34193582089208422515814742042737961955917329917068734399686238368901344,
+   0.34193582089208422515814742042737961955917329917068734399686238368901344,
+  -0.46935583798675702640633071096640634609534379113073654779610002969357701,
+   0.46935583798675702640633071096640634609534379113073654779610002969357701,
+  -0.58764040350691159295887692763864734887761560357371783977003382137246838,
+   0.58764040350691159295887692763864734887761560357371783977003382137246838,
+  -0.69448726318668278005068983576225677126734228997743516112173377539228594,
+   0.69448726318668278005068983576225677126734228997743516112173377539228594,
+  -0.78781680597920816200427795540835152138817867133156315812169339771113228,
+   0.78781680597920816200427795540835152138817867133156315812169339771113228,
+  -0.86581257772030013653642563701937872908479675558844615612709336926271689,
+   0.86581257772030013653642563701937872908479675558844615612709336926271689,
+  -0.92695677218717400052069293925905319663532965337205198204457319152713612,
+   0.92695677218717400052069293925905319663532965337205198204457319152713612,
+  -0.97006049783542872712395098676526871080596892313780296955973821233637426,
+   0.97006049783542872712395098676526871080596892313780296955973821233637426,
+  -0.99429458548239929207303142116129898039305419839603153497702292496665650,
+   0.99429458548239929207303142116129898039305419839603153497702292496665650,
+  // Order 23;
+   0,
+  -0.13325682429846611093174268224176613701040527625338215651094537718704789,
+   0.13325682429846611093174268224176613701040527625338215651094537718704789,
+  -0.26413568097034493053386953828330960297901325019413960486907887705232885,
+   0.26413568097034493053386953828330960297901325019413960486907887705232885,
+  -0.39030103803029083142148887288060545857805085069250348121920526331671262,
+   0.39030103803029083142148887288060545857805085069250348121920526331671262,
+  -0.50950147784600754968979304786684643054484276918485762322718938082127501,
+   0.50950147784600754968979304786684643054484276918485762322718938082127501,
+  -0.61960987576364615638509731164959565338718065880709229570086558560911981,
+   0.61960987576364615638509731164959565338718065880709229570086558560911981,
+  -0.71866136313195019446162448374861884832992974513129279575478128821405113,
+   0.71866136313195019446162448374861884832992974513129279575478128821405113,
+  -0.80488840161883989215111840699677855794143013973030802258543243567170676,
+   0.80488840161883989215111840699677855794143013973030802258543243567170676,
+  -0.87675235827044166737815688593414567163892902996065063490940111576055164,
+   0.87675235827044166737815688593414567163892902996065063490940111576055164,
+  -0.93297108682601610234919698903842297823570182015139077069290125460197783,
+   0.93297108682601610234919698903842297823570182015139077069290125460197783,
+  -0.97254247121811523195602407682077737518161379535397394249125615873579704,
+   0.97254247121811523195602407682077737518161379535397394249125615873579704,
+  -0.99476933499755212352392571544557436057362737245887042092679388416707408,
+   0.99476933499755212352392571544557436057362737245887042092679388416707408,
+  // Order 24;
+  -0.06405689286260562608504308262474503859099919542074739342435108178973928,
+   0.06405689286260562608504308262474503859099919542074739342435108178973928,
+  -0.19111886747361630915863982075706963184040510331475335614891857658808595,
+   0.19111886747361630915863982075706963184040510331475335614891857658808595,
+  -0.31504267969616337438679329131981024078647826082481726875423012952988216,
+   0.31504267969616337438679329131981024078647826082481726875423012952988216,
+  -0.43379350762604513848708423191334971245242151092796880808080128465676441,
+   0.43379350762604513848708423191334971245242151092796880808080128465676441,
+  -0.54542147138883953565837561721837237001078399258761817543361438983056484,
+   0.54542147138883953565837561721837237001078399258761817543361438983056484,
+  -0.64809365193697556925249578691074762666965829861895678029893366502444832,
+   0.64809365193697556925249578691074762666965829861895678029893366502444832,
+  -0.74012419157855436424382810309997842552329248701418545686638236827190034,
+   0.74012419157855436424382810309997842552329248701418545686638236827190034,
+  -0.82000198597390292195394987266974520807612647766785558724398102600138298,
+   0.82000198597390292195394987266974520807612647766785558724398102600138298,
+  -0.88641552700440103421315434198219675508733304330892004037103791677567483,
+   0.88641552700440103421315434198219675508733304330892004037103791677567483,
+  -0.93827455200273275852364900170872144965481965807745134663502717590958950,
+   0.93827455200273275852364900170872144965481965807745134663502717590958950,
+  -0.97472855597130949819839199300816906174118305304017871981159356510718112,
+   0.97472855597130949819839199300816906174118305304017871981159356510718112,
+  -0.99518721999702136017999740970073681187459769259600287744160054511428383,
+   0.99518721999702136017999740970073681187459769259600287744160054511428383,
+  // Order 25;
+   0,
+  -0.12286469261071039638735981880803680553220534604978373842389353789270883,
+   0.12286469261071039638735981880803680553220534604978373842389353789270883,
+  -0.24386688372098843204519036279745158640563315632598447642113565325038747,
+   0.24386688372098843204519036279745158640563315632598447642113565325038747,
+  -0.36117230580938783773582173012764066742207834704337506979457877784674538,
+   0.36117230580938783773582173012764066742207834704337506979457877784674538,
+  -0.47300273144571496052218211500919204133181773846162729090723082769560328,
+   0.47300273144571496052218211500919204133181773846162729090723082769560328,
+  -0.57766293024122296772368984161265406739573503929151825664548350776102301,
+   0.57766293024122296772368984161265406739573503929151825664548350776102301,
+  -0.67356636847346836448512063324762217588341672807274931705965696177828774,
+   0.67356636847346836448512063324762217588341672807274931705965696177828774,
+  -0.75925926303735763057728286520436097638752201889833412091838973544501863,
+   0.75925926303735763057728286520436097638752201889833412091838973544501863,
+  -0.83344262876083400142102110869356956946096411382352078602086471546171813,
+   0.83344262876083400142102110869356956946096411382352078602086471546171813,
+  -0.89499199787827536885104200678280495417455484975358390306170168295917151,
+   0.89499199787827536885104200678280495417455484975358390306170168295917151,
+  -0.94297457122897433941401116965847053190520157060899014192745249713729532,
+   0.94297457122897433941401116965847053190520157060899014192745249713729532,
+  -0.97666392145951751149831538647959406774537055531440674467098742731616387,
+   0.97666392145951751149831538647959406774537055531440674467098742731616387,
+  -0.99555696979049809790878494689390161725756264940480817121080493113293348,
+   0.99555696979049809790878494689390161725756264940480817121080493113293348,
+  // Order 26;
+  -0.05923009342931320709371857519840336079023473538903558215427229168438704,
+   0.05923009342931320709371857519840336079023473538903558215427229168438704,
+  -0.17685882035689018396905774841834474997738376380126426148034769978404528,
+   0.17685882035689018396905774841834474997738376380126426148034769978404528,
+  -0.29200483948595689514283538207783029688471938696299037821234419190370162,
+   0.29200483948595689514283538207783029688471938696299037821234419190370162,
+  -0.40305175512348630648107737709888310365993740969931618258914113354818422,
+   0.40305175512348630648107737709888310365993740969931618258914113354818422,
+  -0.50844071482450571769570306472556917537630675418575081372110046960392739,
+   0.50844071482450571769570306472556917537630675418575081372110046960392739,
+  -0.60669229301761806323197874691688705443526457226590989037864331251992813,
+   0.60669229301761806323197874691688705443526457226590989037864331251992813,
+  -0.69642726041995726486381391372942469786075331779081915170455745383836055,
+   0.69642726041995726486381391372942469786075331779081915170455745383836055,
+  -0.77638594882067885619296724724228386697621825625519487216316842162703293,
+   0.77638594882067885619296724724228386697621825625519487216316842162703293,
+  -0.84544594278849801879750706146783816157207510209132956943017647291161691,
+   0.84544594278849801879750706146783816157207510209132956943017647291161691,
+  -0.90263786198430707421766559923121025134112400537290537255516565477946580,
+   0.90263786198430707421766559923121025134112400537290537255516565477946580,
+  -0.94715906666171425013591528351803675452071033768431527001826777960985764,
+   0.94715906666171425013591528351803675452071033768431527001826777960985764,
+  -0.97838544595647099110058035431192630544691656374731850248541486131650515,
+   0.97838544595647099110058035431192630544691656374731850248541486131650515,
+  -0.99588570114561692900321695932290602595685785511955966739652780940556630,
+   0.99588570114561692900321695932290602595685785511955966739652780940556630,
+  // Order 27;
+   0,
+  -0.11397258560952996693289498386997662717328053397814099476575390976636549,
+   0.11397258560952996693289498386997662717328053397814099476575390976636549,
+  -0.22645936543953685885723910736023017117944673292820367664662899718377713,
+   0.22645936543953685885723910736023017117944673292820367664662899718377713,
+  -0.33599390363850889973031903420728454179002001890759419072498670709500932,
+   0.33599390363850889973031903420728454179002001890759419072498670709500932,
+  -0.44114825175002688058597415568928145244768459516309938814538721340320070,
+   0.44114825175002688058597415568928145244768459516309938814538721340320070,
+  -0.54055156457945689490030094155998282095918044898718169037433775003594090,
+   0.54055156457945689490030094155998282095918044898718169037433775003594090,
+  -0.63290797194649514092773463763448861210307601756933669729511189902340069,
+   0.63290797194649514092773463763448861210307601756933669729511189902340069,
+  -0.71701347373942369929481621164233954975067205209856314265121620633569483,
+   0.71701347373942369929481621164233954975067205209856314265121620633569483,
+  -0.79177163907050822714439734410727073291940106574786351240728061204682048,
+   0.79177163907050822714439734410727073291940106574786351240728061204682048,
+  -0.85620790801829449030273722270684279776428699860350582697718965412880332,
+   0.85620790801829449030273722270684279776428699860350582697718965412880332,
+  -0.90948232067749110430064501820968925494804433559496095911322755247205627,
+   0.90948232067749110430064501820968925494804433559496095911322755247205627,
+  -0.95090055781470500685190803064388289309258993348441765093381739078738667,
+   0.95090055781470500685190803064388289309258993348441765093381739078738667,
+  -0.97992347596150122285587335566104718456764222138995076323885989305238258,
+   0.97992347596150122285587335566104718456764222138995076323885989305238258,
+  -0.99617926288898856693888720838122999026068805556587118770163649678821775,
+   0.99617926288898856693888720838122999026068805556587118770163649678821775,
+  // Order 28;
+  -0.05507928988403427042651652734187997785079599106083368374533858725889454,
+   0.05507928988403427042651652734187997785079599106083368374533858725889454,
+  -0.16456928213338077128147177789116545714572541560116817649428562669533185,
+   0.16456928213338077128147177789116545714572541560116817649428562669533185,
+  -0.27206162763517807767682635612576973482476129669352295249967592650244234,
+   0.27206162763517807767682635612576973482476129669352295249967592650244234,
+  -0.37625151608907871022135720955608698287169397704322291034435272039383172,
+   0.37625151608907871022135720955608698287169397704322291034435272039383172,
+  -0.47587422495511826103441184766743404262721614537865595140911269294327237,
+   0.47587422495511826103441184766743404262721614537865595140911269294327237,
+  -0.56972047181140171930800328335643093312471268565664722782002967766221475,
+   0.56972047181140171930800328335643093312471268565664722782002967766221475,
+  -0.65665109403886496121989817650674282156960169024992996183170349749585030,
+   0.65665109403886496121989817650674282156960169024992996183170349749585030,
+  -0.73561087801363177202814451029253436801606101999304189322852777633581126,
+   0.73561087801363177202814451029253436801606101999304189322852777633581126,
+  -0.80564137091717917144788595542527765867170141480831166821068716178038954,
+   0.80564137091717917144788595542527765867170141480831166821068716178038954,
+  -0.86589252257439504894225456737968680434186283078422633697754673301669441,
+   0.86589252257439504894225456737968680434186283078422633697754673301669441,
+  -0.91563302639213207386968942332992714635249679520912150866150024460300818,
+   0.91563302639213207386968942332992714635249679520912150866150024460300818,
+  -0.95425928062893819725410183970521558900340387408795167541471444862383064,
+   0.95425928062893819725410183970521558900340387408795167541471444862383064,
+  -0.98130316537087275369455994580783027644415495325313830967602568145872845,
+   0.98130316537087275369455994580783027644415495325313830967602568145872845,
+  -0.99644249757395444995043639048331099175013043209642590458567232949048422,
+   0.99644249757395444995043639048331099175013043209642590458567232949048422,
+  // Order 29;
+   0,
+  -0.10627823013267923017098239243037698091719543929560713628577527402216534,
+   0.10627823013267923017098239243037698091719543929560713628577527402216534,
+  -0.21135228616600107450637572890293749905665081771209514803840084532205891,
+   0.21135228616600107450637572890293749905665081771209514803840084532205891,
+  -0.31403163786763993494819592319104744825844881909082748129675893089444670,
+   0.31403163786763993494819592319104744825844881909082748129675893089444670,
+  -0.41315288817400866389070658603161682332343851873631391977838466525428335,
+   0.41315288817400866389070658603161682332343851873631391977838466525428335,
+  -0.50759295512422764210262791962752015335122384038458416418506430709821437,
+   0.50759295512422764210262791962752015335122384038458416418506430709821437,
+  -0.59628179713822782037958621118898978007818681038557763847346239323034283,
+   0.59628179713822782037958621118898978007818681038557763847346239323034283,
+  -0.67821453760268651515618500539198592638826293001464516272380985894936650,
+   0.67821453760268651515618500539198592638826293001464516272380985894936650,
+  -0.75246285173447713391261007721213819021259196822898660841199799152469213,
+   0.75246285173447713391261007721213819021259196822898660841199799152469213,
+  -0.81818548761525244498957221457878497563002156188229377113703427229531653,
+   0.81818548761525244498957221457878497563002156188229377113703427229531653,
+  -0.87463780492010279041779342125657854691061686311904137072722082871474184,
+   0.87463780492010279041779342125657854691061686311904137072722082871474184,
+  -0.92118023295305878509375343608310642540883934331229359846899146380595001,
+   0.92118023295305878509375343608310642540883934331229359846899146380595001,
+  -0.95728559577808772579820803698082356373755955395409707056352963615334160,
+   0.95728559577808772579820803698082356373755955395409707056352963615334160,
+  -0.98254550526141317487092601578637695610678194890643155902512009144667259,
+   0.98254550526141317487092601578637695610678194890643155902512009144667259,
+  -0.99667944226059658616319153254935388565177345325088000219815732375678559,
+   0.99667944226059658616319153254935388565177345325088000219815732375678559,
+  // Order 30;
+  -0.05147184255531769583302521316672257374914145366656956425516084398796476,
+   0.05147184255531769583302521316672257374914145366656956425516084398796476,
+  -0.15386991360858354696379467274325592041855197124433846171896298291578715,
+   0.15386991360858354696379467274325592041855197124433846171896298291578715,
+  -0.25463692616788984643980512981780510788278930330251842616428597508896353,
+   0.25463692616788984643980512981780510788278930330251842616428597508896353,
+  -0.35270472553087811347103720708937386065363100802142562659418446890026942,
+   0.35270472553087811347103720708937386065363100802142562659418446890026942,
+  -0.44703376953808917678060990032285400016240759386142440975447738172761535,
+   0.44703376953808917678060990032285400016240759386142440975447738172761535,
+  -0.53662414814201989926416979331107279416417800693029710545274348291201491,
+   0.53662414814201989926416979331107279416417800693029710545274348291201491,
+  -0.62052618298924286114047755643118929920736469282952813259505117012433531,
+   0.62052618298924286114047755643118929920736469282952813259505117012433531,
+  -0.69785049479331579693229238802664006838235380065395465637972284673997672,
+   0.69785049479331579693229238802664006838235380065395465637972284673997672,
+  -0.76777743210482619491797734097450313169488361723290845320649438736515857,
+   0.76777743210482619491797734097450313169488361723290845320649438736515857,
+  -0.82956576238276839744289811973250191643906869617034167880695298345365651,
+   0.82956576238276839744289811973250191643906869617034167880695298345365651,
+  -0.88256053579205268154311646253022559005668914714648423206832605312161626,
+   0.88256053579205268154311646253022559005668914714648423206832605312161626,
+  -0.92620004742927432587932427708047400408647453682532906091103713367942300,
+   0.92620004742927432587932427708047400408647453682532906091103713367942300,
+  -0.96002186496830751221687102558179766293035921740392339948566167242493996,
+   0.96002186496830751221687102558179766293035921740392339948566167242493996,
+  -0.98366812327974720997003258160566280194031785470971136351718001015114430,
+   0.98366812327974720997003258160566280194031785470971136351718001015114430,
+  -0.99689348407464954027163005091869528334088203811775079010809429780238770,
+   0.99689348407464954027163005091869528334088203811775079010809429780238770,
+  // Order 31;
+   0,
+  -0.09955531215234152032517479011894073383899535877752730606022709097726988,
+   0.09955531215234152032517479011894073383899535877752730606022709097726988,
+  -0.19812119933557062877241299603283393777479481216155487998680225425600521,
+   0.19812119933557062877241299603283393777479481216155487998680225425600521,
+  -0.29471806998170161661790389767170433875285518527835855693629588223606957,
+   0.29471806998170161661790389767170433875285518527835855693629588223606957,
+  -0.38838590160823294306135146128752010198510626789354403575781287847167807,
+   0.38838590160823294306135146128752010198510626789354403575781287847167807,
+  -0.47819378204490248044059403935648574843952337149742312483816105099913688,
+   0.47819378204490248044059403935648574843952337149742312483816105099913688,
+  -0.56324916140714926272094492359516142794860227316688703098576878368745538,
+   0.56324916140714926272094492359516142794860227316688703098576878368745538,
+  -0.64270672292426034618441820323250145399169068333620675650930459647613341,
+   0.64270672292426034618441820323250145399169068333620675650930459647613341,
+  -0.71577678458685328390597086536648595589019347616958843262810824560508627,
+   0.71577678458685328390597086536648595589019347616958843262810824560508627,
+  -0.78173314841662494040636002019468449109541037201339888006487506270355750,
+   0.78173314841662494040636002019468449109541037201339888006487506270355750,
+  -0.83992032014626734008690453594017835605473730107474952283136061389494683,
+   0.83992032014626734008690453594017835605473730107474952283136061389494683,
+  -0.88976002994827104337419200898215926154359741186519094976313205592617100,
+   0.88976002994827104337419200898215926154359741186519094976313205592617100,
+  -0.93075699789664816495694575972926351281339768725808203645533637519068294,
+   0.93075699789664816495694575972926351281339768725808203645533637519068294,
+  -0.96250392509294966178905240410585830189721948515255837677335135702997198,
+   0.96250392509294966178905240410585830189721948515255837677335135702997198,
+  -0.98468590966515248400246516673468471093851826951464367094572865939545995,
+   0.98468590966515248400246516673468471093851826951464367094572865939545995,
+  -0.99708748181947707405562655422310250825144533411706963079212371892665654,
+   0.99708748181947707405562655422310250825144533411706963079212371892665654,
+  // Order 32;
+  -0.04830766568773831623481257044050216369084725173084889716779373454636859,
+   0.04830766568773831623481257044050216369084725173084889716779373454636859,
+  -0.14447196158279649348518637359881065220384599131563555213795289382421844,
+   0.14447196158279649348518637359881065220384599131563555213795289382421844,
+  -0.23928736225213707454460320916550152060885542196025301554709609955970291,
+   0.23928736225213707454460320916550152060885542196025301554709609955970291,
+  -0.33186860228212764977991680573018799619577513680505983601822963062853768,
+   0.33186860228212764977991680573018799619577513680505983601822963062853768,
+  -0.42135127613063534536411943617242647833587728863244333054166134045571905,
+   0.42135127613063534536411943617242647833587728863244333054166134045571905,
+  -0.50689990893222939002374747437782123018028369959943546397436628097077126,
+   0.50689990893222939002374747437782123018028369959943546397436628097077126,
+  -0.58771575724076232904074547640182685845094011545442057270317884731292286,
+   0.58771575724076232904074547640182685845094011545442057270317884731292286,
+  -0.66304426693021520097511516866323836897702228596050530101708349649244617,
+   0.66304426693021520097511516866323836897702228596050530101708349649244617,
+  -0.73218211874028968038742666509126714663027048350662910082113957327038525,
+   0.73218211874028968038742666509126714663027048350662910082113957327038525,
+  -0.79448379596794240696309729897042890209547940163883545325075824497205939,
+   0.79448379596794240696309729897042890209547940163883545325075824497205939,
+  -0.84936761373256997013369300496774253895488679304975923310021959861372466,
+   0.84936761373256997013369300496774253895488679304975923310021959861372466,
+  -0.89632115576605212396530724371921226847899649679575957656361541296502498,
+   0.89632115576605212396530724371921226847899649679575957656361541296502498,
+  -0.93490607593773968917091913483540932552867143228283721845840373981181619,
+   0.93490607593773968917091913483540932552867143228283721845840373981181619,
+  -0.96476225558750643077381192811827496038889522044301871932201132183709953,
+   0.96476225558750643077381192811827496038889522044301871932201132183709953,
+  -0.98561151154526833540017504463090197863239571433580631821078217058203058,
+   0.98561151154526833540017504463090197863239571433580631821078217058203058,
+  -0.99726386184948156354498112866504072713853766372946115930111854578623591,
+   0.99726386184948156354498112866504072713853766372946115930111854578623591,
+  // Order 33;
+   0,
+  -0.09363106585473338567074292412253772132150577815263688128202519579289400,
+   0.09363106585473338567074292412253772132150577815263688128202519579289400,
+  -0.18643929882799157233579875921882398783734430282316534160934583605100170,
+   0.18643929882799157233579875921882398783734430282316534160934583605100170,
+  -0.27760909715249702940324806729832100575475832927824321891534808932413341,
+   0.27760909715249702940324806729832100575475832927824321891534808932413341,
+  -0.36633925774807334107022062325387111129693468110014017163820556536695725,
+   0.36633925774807334107022062325387111129693468110014017163820556536695725,
+  -0.45185001727245069572599327724076705379877173439053117742637848022022140,
+   0.45185001727245069572599327724076705379877173439053117742637848022022140,
+  -0.53338990478634764354889426499549212545266509222442246935653308972425933,
+   0.53338990478634764354889426499549212545266509222442246935653308972425933,
+  -0.61024234583637902730728751353809743140634293088803394908953142094842796,
+   0.61024234583637902730728751353809743140634293088803394908953142094842796,
+  -0.68173195996974278626821594691932813466893518071429402892273851702882452,
+   0.68173195996974278626821594691932813466893518071429402892273851702882452,
+  -0.74723049644956215785905512489794826885428808646382447861307854286194721,
+   0.74723049644956215785905512489794826885428808646382447861307854286194721,
+  -0.80616235627416658979620087078277717569771061813544611234712513698656798,
+   0.80616235627416658979620087078277717569771061813544611234712513698656798,
+  -0.85800965267650406464306148014606847332735106889672006579713641870185989,
+   0.85800965267650406464306148014606847332735106889672006579713641870185989,
+  -0.90231676774343358304053133151876160747520555819091811495655129076537019,
+   0.90231676774343358304053133151876160747520555819091811495655129076537019,
+  -0.93869437261116835035583512436355371261443448409654682589660978541603909,
+   0.93869437261116835035583512436355371261443448409654682589660978541603909,
+  -0.96682290968999276892837770667859224521831433657998659964673162582856129,
+   0.96682290968999276892837770667859224521831433657998659964673162582856129,
+  -0.98645572623064248811037569826462592158917111421565109972305565823615253,
+   0.98645572623064248811037569826462592158917111421565109972305565823615253,
+  -0.99742469424645521726616801758040416107822901088136192071704013308544482,
+   0.99742469424645521726616801758040416107822901088136192071704013308544482,
+  // Order 34;
+  -0.04550982195310254274907567085193016383108415018720540202442509486836049,
+   0.04550982195310254274907567085193016383108415018720540202442509486836049,
+  -0.13615235725918297589442882433111783149728061776453628210580740238670902,
+   0.13615235725918297589442882433111783149728061776453628210580740238670902,
+  -0.22566669161644948386864118093434724435218972104798055299535325641700514,
+   0.22566669161644948386864118093434724435218972104798055299535325641700514,
+  -0.31331108133946324745831676565097799477122986558449294057150606632249500,
+   0.31331108133946324745831676565097799477122986558449294057150606632249500,
+  -0.39835927775864594063149475293235152934246212965564821464728079079255310,
+   0.39835927775864594063149475293235152934246212965564821464728079079255310,
+  -0.48010654519032703419410268050739710858735494890390578413410926306850867,
+   0.48010654519032703419410268050739710858735494890390578413410926306850867,
+  -0.55787550066974664273645988621627458133744137804535389547701762836302057,
+   0.55787550066974664273645988621627458133744137804535389547701762836302057,
+  -0.63102172708052854531777575551900827781089725407344353104519544500069339,
+   0.63102172708052854531777575551900827781089725407344353104519544500069339,
+  -0.69893911321626290793300010657577718263776403145575631042344540842848842,
+   0.69893911321626290793300010657577718263776403145575631042344540842848842,
+  -0.76106487662987301418740896897873683360449936672619692168001610040361333,
+   0.76106487662987301418740896897873683360449936672619692168001610040361333,
+  -0.81688422790093366459157890658697325839314991097425390211936409194174079,
+   0.81688422790093366459157890658697325839314991097425390211936409194174079,
+  -0.86593463833456446926357209067129984469663530173678306865959420774588425,
+   0.86593463833456446926357209067129984469663530173678306865959420774588425,
+  -0.90780967771832446880089988901928746016239757280315209404146319753338523,
+   0.90780967771832446880089988901928746016239757280315209404146319753338523,
+  -0.94216239740510709163167602546057290300620569233711755821350240169761824,
+   0.94216239740510709163167602546057290300620569233711755821350240169761824,
+  -0.96870826253334428176464657305599351096780874535347333599206692316486694,
+   0.96870826253334428176464657305599351096780874535347333599206692316486694,
+  -0.98722781640630948504975043109968497294877014866013221923440890065749020,
+   0.98722781640630948504975043109968497294877014866013221923440890065749020,
+  -0.99757175379084191924337243745462923140050988268492977293994429655257213,
+   0.99757175379084191924337243745462923140050988268492977293994429655257213,
+  // Order 35;
+   0,
+  -0.08837134327565926360092943349754880342411743476509814139725086668186612,
+   0.08837134327565926360092943349754880342411743476509814139725086668186612,
+  -0.17605106116598956997430365644505992967542971232975704741088801268954288,
+   0.17605106116598956997430365644505992967542971232975704741088801268954288,
+  -0.26235294120929605797089520045558051348630439864578128365820622160315956,
+   0.26235294120929605797089520045558051348630439864578128365820622160315956,
+  -0.34660155443081394587697983493023823180840876937729210872687988554085497,
+   0.34660155443081394587697983493023823180840876937729210872687988554085497,
+  -0.42813754151781425418762061300147985878471844648853384395397197681584829,
+   0.42813754151781425418762061300147985878471844648853384395397197681584829,
+  -0.50632277324148861502429755583732737658608793863636924753107281751191386,
+   0.50632277324148861502429755583732737658608793863636924753107281751191386,
+  -0.58054534474976450993450200818969007093207020356433243389225780721009714,
+   0.58054534474976450993450200818969007093207020356433243389225780721009714,
+  -0.65022436466589038867579280898455926336976232592837400126498692372829521,
+   0.65022436466589038867579280898455926336976232592837400126498692372829521,
+  -0.71481450155662878326440863122444674696204396852173051192539184344641780,
+   0.71481450155662878326440863122444674696204396852173051192539184344641780,
+  -0.77381025228691255526742300920988748101181007297154592634339916728344613,
+   0.77381025228691255526742300920988748101181007297154592634339916728344613,
+  -0.82674989909222540683405061274855757904689061798230734135296924639283503,
+   0.82674989909222540683405061274855757904689061798230734135296924639283503,
+  -0.87321912502522233152328234914138526664433890227937494663482945132374508,
+   0.87321912502522233152328234914138526664433890227937494663482945132374508,
+  -0.91285426135931761446493706355576423048806101362555800492979203053090113,
+   0.91285426135931761446493706355576423048806101362555800492979203053090113,
+  -0.94534514820782732953872598552997464486281125124787315411193699309778400,
+   0.94534514820782732953872598552997464486281125124787315411193699309778400,
+  -0.97043761603922983321507048258477014252488123931237660742063722005049632,
+   0.97043761603922983321507048258477014252488123931237660742063722005049632,
+  -0.98793576444385149803511708918548598531300829571417435475611395754771419,
+   0.98793576444385149803511708918548598531300829571417435475611395754771419,
+  -0.99770656909960029726016313931209472519327463717101331659229771374251911,
+   0.99770656909960029726016313931209472519327463717101331659229771374251911,
+  // Order 36;
+  -0.04301819847370860722696897822836343455429479480600918976840018055882080,
+   0.04301819847370860722696897822836343455429479480600918976840018055882080,
+  -0.12873610380938478865199338800515230117728972459937313360590289103530612,
+   0.12873610380938478865199338800515230117728972459937313360590289103530612,
+  -0.21350089231686557894322622890271391675846173127276819455010391037208566,
+   0.21350089231686557894322622890271391675846173127276819455010391037208566,
+  -0.29668499534402827050323904774517045270024182295982532670161445277305354,
+   0.29668499534402827050323904774517045270024182295982532670161445277305354,
+  -0.37767254711968921632273638966990762216617280488528786620739067011126464,
+   0.37767254711968921632273638966990762216617280488528786620739067011126464,
+  -0.45586394443342026720721766932744092595784238829685747265617950947825943,
+   0.45586394443342026720721766932744092595784238829685747265617950947825943,
+  -0.53068028592624516164070908012156981766122287264682207647587856084579465,
+   0.53068028592624516164070908012156981766122287264682207647587856084579465,
+  -0.60156765813598053507994497507359475174295415598675190997523759202647799,
+   0.60156765813598053507994497507359475174295415598675190997523759202647799,
+  -0.66800123658552106209719134434091763916470249021263765340159586476396946,
+   0.66800123658552106209719134434091763916470249021263765340159586476396946,
+  -0.72948917159355658209026047900610898556584304690519700410583108042219796,
+   0.72948917159355658209026047900610898556584304690519700410583108042219796,
+  -0.78557623013220651282776896508029260330233050583960136064813263719755623,
+   0.78557623013220651282776896508029260330233050583960136064813263719755623,
+  -0.83584716699247530641882087249860065334677937939232514421886425954884739,
+   0.83584716699247530641882087249860065334677937939232514421886425954884739,
+  -0.87992980089039713198242733746583558877329284208075692776787359843381671,
+   0.87992980089039713198242733746583558877329284208075692776787359843381671,
+  -0.91749777451565906607586722302615639993690946781365485585199310667193136,
+   0.91749777451565906607586722302615639993690946781365485585199310667193136,
+  -0.94827298439950754520247411494522784628937652533367363255021103692942064,
+   0.94827298439950754520247411494522784628937652533367363255021103692942064,
+  -0.97202769104969794933560504843110832761604639626595174057281228388387443,
+   0.97202769104969794933560504843110832761604639626595174057281228388387443,
+  -0.98858647890221223807339510787710744660716252006528705578819152713454141,
+   0.98858647890221223807339510787710744660716252006528705578819152713454141,
+  -0.99783046248408583619882834558075023864981646239663131259054116779973136,
+   0.99783046248408583619882834558075023864981646239663131259054116779973136,
+  // Order 37;
+   0,
+  -0.08367040895476990194304833173639917756352163203515229361529331764554141,
+   0.08367040895476990194304833173639917756352163203515229361529331764554141,
+  -0.16675393023985197696867173041182443746664839603127634900410799882912685,
+   0.16675393023985197696867173041182443746664839603127634900410799882912685,
+  -0.24866779279136575880556775148771621853167765168294515767851682697071531,
+   0.24866779279136575880556775148771621853167765168294515767851682697071531,
+  -0.32883742988370699949847180133994048368002257529230803802293551800389282,
+   0.32883742988370699949847180133994048368002257529230803802293551800389282,
+  -0.40670050931832611010093159161396660852247127935055889959630397048489653,
+   0.40670050931832611010093159161396660852247127935055889959630397048489653,
+  -0.48171087780320555414719286888263917198952243434735039595510893699442599,
+   0.48171087780320555414719286888263917198952243434735039595510893699442599,
+  -0.55334239186158178123509835822926447347228655224098232397199961173386928,
+   0.55334239186158178123509835822926447347228655224098232397199961173386928,
+  -0.62109260840892448314815259159505731004172640060413515922390186643614757,
+   0.62109260840892448314815259159505731004172640060413515922390186643614757,
+  -0.68448630913095935744552321243115370804434381097007768743284097760206610,
+   0.68448630913095935744552321243115370804434381097007768743284097760206610,
+  -0.74307883398196526254704741747381287908990185326301260235214708346322831,
+   0.74307883398196526254704741747381287908990185326301260235214708346322831,
+  -0.79645920050990229339304633550032452348563115894052160758188377804224538,
+   0.79645920050990229339304633550032452348563115894052160758188377804224538,
+  -0.84425298734055596798745627617486023169063449589762218411906551980678089,
+   0.84425298734055596798745627617486023169063449589762218411906551980678089,
+  -0.88612496215548607894614950901688644010681323482689630769855031804283394,
+   0.88612496215548607894614950901688644010681323482689630769855031804283394,
+  -0.92178143741246374266814368670071348878159526716232966114141050837926465,
+   0.92178143741246374266814368670071348878159526716232966114141050837926465,
+  -0.95097234326209482132857609681632593399754857980457738551756067210927540,
+   0.95097234326209482132857609681632593399754857980457738551756067210927540,
+  -0.97349303005648574432889047566575934481538461670860826835950340942525497,
+   0.97349303005648574432889047566575934481538461670860826835950340942525497,
+  -0.98918596321431918668409906058427230896245291758067398047602164555467738,
+   0.98918596321431918668409906058427230896245291758067398047602164555467738,
+  -0.99794458247791364894080307431736328366900784948672915406882677468633248,
+   0.99794458247791364894080307431736328366900784948672915406882677468633248,
+  // Order 38;
+  -0.04078514790457823991331643232978492078477364268365481169359747782594000,
+   0.04078514790457823991331643232978492078477364268365481169359747782594000,
+  -0.12208402533786741986961238132940711656811814149930000880377455109963712,
+   0.12208402533786741986961238132940711656811814149930000880377455109963712,
+  -0.20257045389211670320397778151460705737165508575370351724766672234903390,
+   0.20257045389211670320397778151460705737165508575370351724766672234903390,
+  -0.28170880979016526136011407141870007676967050878361133180017628607438288,
+   0.28170880979016526136011407141870007676967050878361133180017628607438288,
+  -0.35897244047943501325671762145653429179606294921136807378820965052268564,
+   0.35897244047943501325671762145653429179606294921136807378820965052268564,
+  -0.43384716943237648437325616251784220400592380040683912370241895496554475,
+   0.43384716943237648437325616251784220400592380040683912370241895496554475,
+  -0.50583471792793110324053371646765200279384655063718764501622005899210663,
+   0.50583471792793110324053371646765200279384655063718764501622005899210663,
+  -0.57445602104780708113292750092447251021019959785379876460707767610621709,
+   0.57445602104780708113292750092447251021019959785379876460707767610621709,
+  -0.63925441582968170718034486950026027170117039540966142889623559323424441,
+   0.63925441582968170718034486950026027170117039540966142889623559323424441,
+  -0.69979868037918435591282584062741587563820701530059043773071895245523690,
+   0.69979868037918435591282584062741587563820701530059043773071895245523690,
+  -0.75568590375397068073773809677938741350383757074670392730168635916117741,
+   0.75568590375397068073773809677938741350383757074670392730168635916117741,
+  -0.80654416760531681555156537597969832573177298132931962120550838811954502,
+   0.80654416760531681555156537597969832573177298132931962120550838811954502,
+  -0.85203502193236218885964971124727628044038503732763096888155711243838041,
+   0.85203502193236218885964971124727628044038503732763096888155711243838041,
+  -0.89185573900463221679493703197391751157989905323451536096208890105840178,
+   0.89185573900463221679493703197391751157989905323451536096208890105840178,
+  -0.92574133204858439682510956221305091148091787648110552072113666084360604,
+   0.92574133204858439682510956221305091148091787648110552072113666084360604,
+  -0.95346633093352959567054215311744121738577897072292870974403278599865997,
+   0.95346633093352959567054215311744121738577897072292870974403278599865997,
+  -0.97484632859015350764088554094638864259197535876607351599155357952136154,
+   0.97484632859015350764088554094638864259197535876607351599155357952136154,
+  -0.98973945426638557194442589110567934732438124690802220638383149907385890,
+   0.98973945426638557194442589110567934732438124690802220638383149907385890,
+  -0.99804993053568761981284707655158099749046537027458809016074439401393486,
+   0.99804993053568761981284707655158099749046537027458809016074439401393486,
+  // Order 39;
+   0,
+  -0.07944380460875547758191708319264064688500316510674193325522939167469064,
+   0.07944380460875547758191708319264064688500316510674193325522939167469064,
+  -0.15838533999783779992270106136139938446682623686514314046635275971942828,
+   0.15838533999783779992270106136139938446682623686514314046635275971942828,
+  -0.23632551246183576733600632733265044806571922479405759593034932012974608,
+   0.23632551246183576733600632733265044806571922479405759593034932012974608,
+  -0.31277155924818592253599691178562873960190560997753935026481762464100209,
+   0.31277155924818592253599691178562873960190560997753935026481762464100209,
+  -0.38724016397156145585388196563696269601257617271682661588014750519569093,
+   0.38724016397156145585388196563696269601257617271682661588014750519569093,
+  -0.45926051230913604866324663310957236293874915369601723787608993884857901,
+   0.45926051230913604866324663310957236293874915369601723787608993884857901,
+  -0.52837726866043747389634363580822250534071765348542477598529062836050265,
+   0.52837726866043747389634363580822250534071765348542477598529062836050265,
+  -0.59415345495727798869289007461910606816559154467812653537082647115657417,
+   0.59415345495727798869289007461910606816559154467812653537082647115657417,
+  -0.65617321343201091073442593497625618488010761157697043054180554677722745,
+   0.65617321343201091073442593497625618488010761157697043054180554677722745,
+  -0.71404443589453467913386703615183078966434528189369821519767544776761602,
+   0.71404443589453467913386703615183078966434528189369821519767544776761602,
+  -0.76740124293106349983227240422834294547283411345901066174765116605532532,
+   0.76740124293106349983227240422834294547283411345901066174765116605532532,
+  -0.81590629743014310435323267840962982772781406052092385735904434373004359,
+   0.81590629743014310435323267840962982772781406052092385735904434373004359,
+  -0.85925293799990615391379743912604237053508444531982206052615424053113580,
+   0.85925293799990615391379743912604237053508444531982206052615424053113580,
+  -0.89716711929299288784829109086081365106569207797562300249825142878351892,
+   0.89716711929299288784829109086081365106569207797562300249825142878351892,
+  -0.92940914848673822969781696435773456184410280950770352688827288274141616,
+   0.92940914848673822969781696435773456184410280950770352688827288274141616,
+  -0.95577521232465227711089189719108220300177179063887613583055850459824684,
+   0.95577521232465227711089189719108220300177179063887613583055850459824684,
+  -0.97609870933347105384485031988951849429074741268010170277760373863111165,
+   0.97609870933347105384485031988951849429074741268010170277760373863111165,
+  -0.99025153685468598363977511724707820470969382104019179625882941958347224,
+   0.99025153685468598363977511724707820470969382104019179625882941958347224,
+  -0.99814738306643290600547230285182044183200974004966421176121791796500921,
+   0.99814738306643290600547230285182044183200974004966421176121791796500921,
+  // Order 40;
+  -0.03877241750605082193319344402462329467936463438314159916863718143800658,
+   0.03877241750605082193319344402462329467936463438314159916863718143800658,
+  -0.11608407067525520848345128440802411376872853085421594903029743216157916,
+   0.11608407067525520848345128440802411376872853085421594903029743216157916,
+  -0.19269758070137109971551685206514989481409202110520887488546759223650272,
+   0.19269758070137109971551685206514989481409202110520887488546759223650272,
+  -0.26815218500725368114118434480859618342480437323624698145725997487382119,
+   0.26815218500725368114118434480859618342480437323624698145725997487382119,
+  -0.34199409082575847300749248117919431006695362002732579646340958409814371,
+   0.34199409082575847300749248117919431006695362002732579646340958409814371,
+  -0.41377920437160500152487974580371368297409962405291823829440225106864266,
+   0.41377920437160500152487974580371368297409962405291823829440225106864266,
+  -0.48307580168617871290856657424482300459902239553311410078933524322594344,
+   0.48307580168617871290856657424482300459902239553311410078933524322594344,
+  -0.54946712509512820207593130552951797023397510159565146490256547172185575,
+   0.54946712509512820207593130552951797023397510159565146490256547172185575,
+  -0.61255388966798023795261245023069487738012378168314961113534756253019097,
+   0.61255388966798023795261245023069487738012378168314961113534756253019097,
+  -0.67195668461417954837935451496149410997032598138385115007109296898666248,
+   0.67195668461417954837935451496149410997032598138385115007109296898666248,
+  -0.72731825518992710328099645175493054855737867353332813754755124418592911,
+   0.72731825518992710328099645175493054855737867353332813754755124418592911,
+  -0.77830565142651938769497154550649484802069131612689179424534206062931194,
+   0.77830565142651938769497154550649484802069131612689179424534206062931194,
+  -0.82461223083331166319632023066609877390724038424298779969179096315280717,
+   0.82461223083331166319632023066609877390724038424298779969179096315280717,
+  -0.86595950321225950382078180835461996357054655301110164945994025480668208,
+   0.86595950321225950382078180835461996357054655301110164945994025480668208,
+  -0.90209880696887429672825333086849310358448808105766946772526011154037018,
+   0.90209880696887429672825333086849310358448808105766946772526011154037018,
+  -0.93281280827867653336085216684520571643475357528269244922934301541564052,
+   0.93281280827867653336085216684520571643475357528269244922934301541564052,
+  -0.95791681921379165580454099945275928509488349060274703156905384358175836,
+   0.95791681921379165580454099945275928509488349060274703156905384358175836,
+  -0.97725994998377426266337028371290380697866793203798609642926201601106321,
+   0.97725994998377426266337028371290380697866793203798609642926201601106321,
+  -0.99072623869945700645305435222137215496222208135108653788307624430407890,
+   0.99072623869945700645305435222137215496222208135108653788307624430407890,
+  -0.99823770971055920034962270242058649233577038159504590660333611709683886,
+   0.99823770971055920034962270242058649233577038159504590660333611709683886,
+  // Order 41;
+   0,
+  -0.07562325898916299692376619365120026748105063560665694875010381709435917,
+   0.07562325898916299692376619365120026748105063560665694875010381709435917,
+  -0.15081335486399216357437796788458237577563094532949783096516944199044666,
+   0.15081335486399216357437796788458237577563094532949783096516944199044666,
+  -0.22513960563342277560578625665547233029991242064424322235018785452701158,
+   0.22513960563342277560578625665547233029991242064424322235018785452701158,
+  -0.29817627734182486592298288047892430413995586844614852607454574122271292,
+   0.29817627734182486592298288047892430413995586844614852607454574122271292,
+  -0.36950502264048144142836691329993520562408697133187607875120488833778700,
+   0.36950502264048144142836691329993520562408697133187607875120488833778700,
+  -0.43871727705140708851711985672803924842178575875946864336157142760703434,
+   0.43871727705140708851711985672803924842178575875946864336157142760703434,
+  -0.50541659919940603270833607020269476495107554601518024566832409004937945,
+   0.50541659919940603270833607020269476495107554601518024566832409004937945,
+  -0.56922094161021586965474721528298025161045692397954524383551704532390614,
+   0.56922094161021586965474721528298025161045692397954524383551704532390614,
+  -0.62976483907219632048864909169510350107851478073947087387656754625553774,
+   0.62976483907219632048864909169510350107851478073947087387656754625553774,
+  -0.68670150203495128958460385652913481206643846014967312878694426923738308,
+   0.68670150203495128958460385652913481206643846014967312878694426923738308,
+  -0.73970480306992618106016874446855900039525443905256896547644635833029852,
+   0.73970480306992618106016874446855900039525443905256896547644635833029852,
+  -0.78847114504740937273622178146677028899471207909872721037768646205490123,
+   0.78847114504740937273622178146677028899471207909872721037768646205490123,
+  -0.83272120040136133124427277904854379997697599297858213330417557092070266,
+   0.83272120040136133124427277904854379997697599297858213330417557092070266,
+  -0.87220151169244140883367057423432946028204265553953300184752167181835431,
+   0.87220151169244140883367057423432946028204265553953300184752167181835431,
+  -0.90668594475810117295834041323072297335430718532228485441741783380695945,
+   0.90668594475810117295834041323072297335430718532228485441741783380695945,
+  -0.93597698749785382568231827528476626627123711808734477455719430008316238,
+   0.93597698749785382568231827528476626627123711808734477455719430008316238,
+  -0.95990689173034622609944169606868658206695109082946635065727417463081850,
+   0.95990689173034622609944169606868658206695109082946635065727417463081850,
+  -0.97833867356108338446917070667396719837563678191865428239086385191199790,
+   0.97833867356108338446917070667396719837563678191865428239086385191199790,
+  -0.99116710969901630825015889457316965769275601357000304731392337587529847,
+   0.99116710969901630825015889457316965769275601357000304731392337587529847,
+  -0.99832158857477144151918850808837756793150435151367016643051899950824353,
+   0.99832158857477144151918850808837756793150435151367016643051899950824353,
+  // Order 42;
+  -0.03694894316535177581309598003755942664170845224922253134964501060652417,
+   0.03694894316535177581309598003755942664170845224922253134964501060652417,
+  -0.11064502720851986834912254500264100486734402448363080740347614488006331,
+   0.11064502720851986834912254500264100486734402448363080740347614488006331,
+  -0.18373680656485455085275563938074294093332396162251510035441157135321197,
+   0.18373680656485455085275563938074294093332396162251510035441157135321197,
+  -0.25582507934287908396641479101870844876876645646540095466069816670764798,
+   0.25582507934287908396641479101870844876876645646540095466069816670764798,
+  -0.32651612446541151219715658937546566905841147049858452393819663381343621,
+   0.32651612446541151219715658937546566905841147049858452393819663381343621,
+  -0.39542385204297505767709395459437198079917857648635348826197551043823348,
+   0.39542385204297505767709395459437198079917857648635348826197551043823348,
+  -0.46217191207042192975907502993063598510966490847360863109283036213975414,
+   0.46217191207042192975907502993063598510966490847360863109283036213975414,
+  -0.52639574993119228759286755879190146143573976492990992892843235117865284,
+   0.52639574993119228759286755879190146143573976492990992892843235117865284,
+  -0.58774459748510932284071134547399571990543130482800164589825627022186979,
+   0.58774459748510932284071134547399571990543130482800164589825627022186979,
+  -0.64588338886924783395749630371841170116908654384014386468472621835418654,
+   0.64588338886924783395749630371841170116908654384014386468472621835418654,
+  -0.70049459055617121374156992905546553430017594180009318112756928038264573,
+   0.70049459055617121374156992905546553430017594180009318112756928038264573,
+  -0.75127993568948048956847217591465865550256451982954092485393123073617913,
+   0.75127993568948048956847217591465865550256451982954092485393123073617913,
+  -0.79796205325548741323270595254637666013237551129065413405809993851641496,
+   0.79796205325548741323270595254637666013237551129065413405809993851641496,
+  -0.84028598326181690092543999508609981782339857519356835680510727772958176,
+   0.84028598326181690092543999508609981782339857519356835680510727772958176,
+  -0.87802056981217274271198510347862353406281971624391859875586127032350420,
+   0.87802056981217274271198510347862353406281971624391859875586127032350420,
+  -0.91095972490412745258384787920850654231890035133945560387844813369315012,
+   0.91095972490412745258384787920850654231890035133945560387844813369315012,
+  -0.93892355735498817853317343362559197025138781845017187084180342147483647,
+   0.93892355735498817853317343362559197025138781845017187084180342147483647,
+  -0.96175936533820448874692715785332268117172128891403199897862970601663056,
+   0.96175936533820448874692715785332268117172128891403199897862970601663056,
+  -0.97934250806374819370898256654285609558647498012906292861550926997550439,
+   0.97934250806374819370898256654285609558647498012906292861550926997550439,
+  -0.99157728834086091979236125328086883345269326473710401757687904813164473,
+   0.99157728834086091979236125328086883345269326473710401757687904813164473,
+  -0.99839961899006241502286812684705027617787608352278125176485550254510169,
+   0.99839961899006241502286812684705027617787608352278125176485550254510169,
+  // Order 43;
+   0,
+  -0.07215299087458623542232725095556109485765527666061430552447044315502569,
+   0.07215299087458623542232725095556109485765527666061430552447044315502569,
+  -0.14392980951071331077029993761074468868278888347134264823300773825365490,
+   0.14392980951071331077029993761074468868278888347134264823300773825365490,
+  -0.21495624486051820901487838147367495373722428638545304444245128162805362,
+   0.21495624486051820901487838147367495373722428638545304444245128162805362,
+  -0.28486199803291362710572289483833793178587981775426116955275308523350303,
+   0.28486199803291362710572289483833793178587981775426116955275308523350303,
+  -0.35328261286430380664547636414346787178044503014256554223927414565852913,
+   0.35328261286430380664547636414346787178044503014256554223927414565852913,
+  -0.41986137602926925248727939456056802607498890771457094808735294343140156,
+   0.41986137602926925248727939456056802607498890771457094808735294343140156,
+  -0.48425117678573472406963343474851377799357708187172329632200571815533073,
+   0.48425117678573472406963343474851377799357708187172329632200571815533073,
+  -0.54611631666008471914040504717966083665485422412475580262460279172606607,
+   0.54611631666008471914040504717966083665485422412475580262460279172606607,
+  -0.60513425963960093572508307112395522143836980789452728929679328226778762,
+   0.60513425963960093572508307112395522143836980789452728929679328226778762,
+  -0.66099731375149813316513476374134539411315681253421329349475931924539702,
+   0.66099731375149813316513476374134539411315681253421329349475931924539702,
+  -0.71341423526895705485192087799090410264252916711363611639604966302635880,
+   0.71341423526895705485192087799090410264252916711363611639604966302635880,
+  -0.76211174719495512146032846302904618780759525868595775625125375455635849,
+   0.76211174719495512146032846302904618780759525868595775625125375455635849,
+  -0.80683596413693863527907474087751212606088624348175259663307053216470437,
+   0.80683596413693863527907474087751212606088624348175259663307053216470437,
+  -0.84735371620931504899908608582179251751259654747723988373417318954255611,
+   0.84735371620931504899908608582179251751259654747723988373417318954255611,
+  -0.88345376521861686333767801164216741786216669424245159853029774638990486,
+   0.88345376521861686333767801164216741786216669424245159853029774638990486,
+  -0.91494790720613872945610287079928561674578010310842305699980049137411923,
+   0.91494790720613872945610287079928561674578010310842305699980049137411923,
+  -0.94167195684763786181847739039793827146647608981382775781879496341258439,
+   0.94167195684763786181847739039793827146647608981382775781879496341258439,
+  -0.96348661301407999341019496357424393986761891227871254633533837760719033,
+   0.96348661301407999341019496357424393986761891227871254633533837760719033,
+  -0.98027822098025533150552938218113639018086759651957348417248932791119963,
+   0.98027822098025533150552938218113639018086759651957348417248932791119963,
+  -0.99195955759324414642071834132961801638705322595895272821468220018605638,
+   0.99195955759324414642071834132961801638705322595895272821468220018605638,
+  -0.99847233224250771351763618731839241196205071784760914329308343678338033,
+   0.99847233224250771351763618731839241196205071784760914329308343678338033,
+  // Order 44;
+  -0.03528923696413535905819670463141635588500219758952707677713880500267083,
+   0.03528923696413535905819670463141635588500219758952707677713880500267083,
+  -0.10569190170865324711730584891512175238338599885959761378240149643180111,
+   0.10569190170865324711730584891512175238338599885959761378240149643180111,
+  -0.17556801477551678574650774938097659064737450672451331540702457232926460,
+   0.17556801477551678574650774938097659064737450672451331540702457232926460,
+  -0.24456945692820125150730243474051862053048725928004960367008981648345378,
+   0.24456945692820125150730243474051862053048725928004960367008981648345378,
+  -0.31235246650278581223654516357297853551926362175328863642636121991506618,
+   0.31235246650278581223654516357297853551926362175328863642636121991506618,
+  -0.37857935201470713251176467277219785674282084849567037328983819758898320,
+   0.37857935201470713251176467277219785674282084849567037328983819758898320,
+  -0.44292017452541148383482659364731354953847846030811794924025392402827487,
+   0.44292017452541148383482659364731354953847846030811794924025392402827487,
+  -0.50505439138820231798279835229117723861207329550534861327376929657740431,
+   0.50505439138820231798279835229117723861207329550534861327376929657740431,
+  -0.56467245318547076842463681938207521949074547960426611523556812366792569,
+   0.56467245318547076842463681938207521949074547960426611523556812366792569,
+  -0.62147734590357584780242469912176674714440588001716355915647232282111746,
+   0.62147734590357584780242469912176674714440588001716355915647232282111746,
+  -0.67518607066612236533369903856389992332825540112377087530227717318290560,
+   0.67518607066612236533369903856389992332825540112377087530227717318290560,
+  -0.72553105366071700260696493671995361101246580020809525993302287893869785,
+   0.72553105366071700260696493671995361101246580020809525993302287893869785,
+  -0.77226147924875589901775854923198801372809643956544710976307387942754814,
+   0.77226147924875589901775854923198801372809643956544710976307387942754814,
+  -0.81514453964513501048743763575194055029940057450859424356879422167552265,
+   0.81514453964513501048743763575194055029940057450859424356879422167552265,
+  -0.85396659500471037872830224129268389036116906202906844974800624640506369,
+   0.85396659500471037872830224129268389036116906202906844974800624640506369,
+  -0.88853423828604320233836791019032232475833245820942590006778968355953305,
+   0.88853423828604320233836791019032232475833245820942590006778968355953305,
+  -0.91867525998417577432300108669425204893798526304505300597341221431601374,
+   0.91867525998417577432300108669425204893798526304505300597341221431601374,
+  -0.94423950911819409920325465302698925107245493475992297534389329674063998,
+   0.94423950911819409920325465302698925107245493475992297534389329674063998,
+  -0.96509965042249313939439805058023497471687713858988509277535163451716677,
+   0.96509965042249313939439805058023497471687713858988509277535163451716677,
+  -0.98115183307791396666274900535048782880567555553965773952915523381741693,
+   0.98115183307791396666274900535048782880567555553965773952915523381741693,
+  -0.99231639213851580848333800361353856881189778435221007745825647573239822,
+   0.99231639213851580848333800361353856881189778435221007745825647573239822,
+  -0.99854020063677422493605672060665034905603003317541459799884816568241355,
+   0.99854020063677422493605672060665034905603003317541459799884816568241355,
+  // Order 45;
+   0,
+  -0.06898698016314417249041461410381172969392066693096968266540925528852889,
+   0.06898698016314417249041461410381172969392066693096968266540925528852889,
+  -0.13764520598325302875659004142306555310676555654152505961789002992717676,
+   0.13764520598325302875659004142306555310676555654152505961789002992717676,
+  -0.20564748978326374571978722547154393070323638569942983104123381367910746,
+   0.20564748978326374571978722547154393070323638569942983104123381367910746,
+  -0.27266976975237756060876539161564518189821175427664206012150716917639794,
+   0.27266976975237756060876539161564518189821175427664206012150716917639794,
+  -0.33839265425060216164340410003187298953234144313742269794759298348773545,
+   0.33839265425060216164340410003187298953234144313742269794759298348773545,
+  -0.40250294385854191407797450854834645597029935756939643883585768013407520,
+   0.40250294385854191407797450854834645597029935756939643883585768013407520,
+  -0.46469512391963509857960150230974851083981266723719088284724638002550644,
+   0.46469512391963509857960150230974851083981266723719088284724638002550644,
+  -0.52467282046291606709113410046016240260710827080028258689085546576831746,
+   0.52467282046291606709113410046016240260710827080028258689085546576831746,
+  -0.58215021256935318668096733444417713100008882598322714602358602776591446,
+   0.58215021256935318668096733444417713100008882598322714602358602776591446,
+  -0.63685339445322335927122384590338315069203124346567644054284862876198286,
+   0.63685339445322335927122384590338315069203124346567644054284862876198286,
+  -0.68852168077120052523201982588043823595523300561852778072094711167345704,
+   0.68852168077120052523201982588043823595523300561852778072094711167345704,
+  -0.73690884894549035262373884859489201987960568083761708092734339893476057,
+   0.73690884894549035262373884859489201987960568083761708092734339893476057,
+  -0.78178431259390629131236318809860281766027351683906152303928839827665344,
+   0.78178431259390629131236318809860281766027351683906152303928839827665344,
+  -0.82293422050208633703577526002650202999341525805627043354404173117169483,
+   0.82293422050208633703577526002650202999341525805627043354404173117169483,
+  -0.86016247596066422533907887056713438778341442357702210107859349253890176,
+   0.86016247596066422533907887056713438778341442357702210107859349253890176,
+  -0.89329167175324173846464905149305734636540124041379268616271110945467320,
+   0.89329167175324173846464905149305734636540124041379268616271110945467320,
+  -0.92216393671900038809746736096052731926536287725066116835082658949266017,
+   0.92216393671900038809746736096052731926536287725066116835082658949266017,
+  -0.94664169099562906178472059695383707845046834416713505079785560311373070,
+   0.94664169099562906178472059695383707845046834416713505079785560311373070,
+  -0.96660831039689460473642516089247809711667903060941541386797488517235618,
+   0.96660831039689460473642516089247809711667903060941541386797488517235618,
+  -0.98196871503454056823931847363434148153836524922046180798689215000297248,
+   0.98196871503454056823931847363434148153836524922046180798689215000297248,
+  -0.99264999844720374174861712059773534497500164330363935061698792830082420,
+   0.99264999844720374174861712059773534497500164330363935061698792830082420,
+  -0.99860364518193663815654767690082054809228852721447541688895639813678472,
+   0.99860364518193663815654767690082054809228852721447541688895639813678472,
+  // Order 46;
+  -0.03377219001605204151955783189143976381591611599620192068210517772826250,
+   0.03377219001605204151955783189143976381591611599620192068210517772826250,
+  -0.10116247530558423951585965700864939088187136050149373961951596045442290,
+   0.10116247530558423951585965700864939088187136050149373961951596045442290,
+  -0.16809117946710352860679673742770212744748928183646939673198254433038120,
+   0.16809117946710352860679673742770212744748928183646939673198254433038120,
+  -0.23425292220626976862605611557379249257408882199049802562252863514570747,
+   0.23425292220626976862605611557379249257408882199049802562252863514570747,
+  -0.29934582270187001548343925657790392935609231755423834922366658784363328,
+   0.29934582270187001548343925657790392935609231755423834922366658784363328,
+  -0.36307287702099571012370697851465168984738884285764247149798374968446198,
+   0.36307287702099571012370697851465168984738884285764247149798374968446198,
+  -0.42514331328282839732214686342856741916933776910793469168205628329840029,
+   0.42514331328282839732214686342856741916933776910793469168205628329840029,
+  -0.48527391838816466277232019370845480831966755928303870354450244890485852,
+   0.48527391838816466277232019370845480831966755928303870354450244890485852,
+  -0.54319033026180263527096269102887683603397847038491608539084024130646786,
+   0.54319033026180263527096269102887683603397847038491608539084024130646786,
+  -0.59862828971271515317717253360016731014846633456462994782216839947628379,
+   0.59862828971271515317717253360016731014846633456462994782216839947628379,
+  -0.65133484620199771510647715581685936722760405731847593944921216035593463,
+   0.65133484620199771510647715581685936722760405731847593944921216035593463,
+  -0.70106951202040569751212208942650045024957598314993864646843729900930116,
+   0.70106951202040569751212208942650045024957598314993864646843729900930116,
+  -0.74760535961566605400033650526800286890572218000254649496931338717575366,
+   0.74760535961566605400033650526800286890572218000254649496931338717575366,
+  -0.79073005707527425518914414742030241114796951308471110986900787968474710,
+   0.79073005707527425518914414742030241114796951308471110986900787968474710,
+  -0.83024683706606605303238530479080611799580625397038060803024487939995120,
+   0.83024683706606605303238530479080611799580625397038060803024487939995120,
+  -0.86597539486685806291588877681659843868730474433790448403030130548263464,
+   0.86597539486685806291588877681659843868730474433790448403030130548263464,
+  -0.89775271153394196570131995131978128945462964530135108998141999815817093,
+   0.89775271153394196570131995131978128945462964530135108998141999815817093,
+  -0.92543379880675395097749135769912425888234375643895584760120362665384903,
+   0.92543379880675395097749135769912425888234375643895584760120362665384903,
+  -0.94889236344608979562221353943691413952577138329324533278109356594892332,
+   0.94889236344608979562221353943691413952577138329324533278109356594892332,
+  -0.96802139185399194273774806637181550852231182635363010071532017388889577,
+   0.96802139185399194273774806637181550852231182635363010071532017388889577,
+  -0.98273366980416686347797957965918872021956337029842880064581916682988875,
+   0.98273366980416686347797957965918872021956337029842880064581916682988875,
+  -0.99296234890617436407309544466619340912110283090838402519884761742266411,
+   0.99296234890617436407309544466619340912110283090838402519884761742266411,
+  -0.99866304213381798112826841739088877458415560743463172609110554500267766,
+   0.99866304213381798112826841739088877458415560743463172609110554500267766,
+  // Order 47;
+   0,
+  -0.06608692391635567516047377747413370859227627393622040887227555558397271,
+   0.06608692391635567516047377747413370859227627393622040887227555558397271,
+  -0.13188486655451489705382353072412724136333515343848891295025522392877564,
+   0.13188486655451489705382353072412724136333515343848891295025522392877564,
+  -0.19710611027911180796149135837050461755486287042233966535428938111997185,
+   0.19710611027911180796149135837050461755486287042233966535428938111997185,
+  -0.26146545921497457030698296620517097423332273379687972532139888141187354,
+   0.26146545921497457030698296620517097423332273379687972532139888141187354,
+  -0.32468148633773590221076129917999683639962891600706232588210965677499731,
+   0.32468148633773590221076129917999683639962891600706232588210965677499731,
+  -0.38647776408466713958330238760602327020183760801483001493792485184565682,
+   0.38647776408466713958330238760602327020183760801483001493792485184565682,
+  -0.44658407310485570272518214234940795939341700519872109942992623149021448,
+   0.44658407310485570272518214234940795939341700519872109942992623149021448,
+  -0.50473758386357791977428902535130109027320311922460252932268272788996791,
+   0.50473758386357791977428902535130109027320311922460252932268272788996791,
+  -0.56068400593466419448305831741826879114352345459113743949822323534432675,
+   0.56068400593466419448305831741826879114352345459113743949822323534432675,
+  -0.61417869995637360859546254260425368624817994509020474970208722733890797,
+   0.61417869995637360859546254260425368624817994509020474970208722733890797,
+  -0.66498774739033272913670264857208906143051481453327092576017378147655576,
+   0.66498774739033272913670264857208906143051481453327092576017378147655576,
+  -0.71288897340906430166187932777101881170425024575591714308665542120126268,
+   0.71288897340906430166187932777101881170425024575591714308665542120126268,
+  -0.75767291844543863357399652356968220121341991043365343290431317936901627,
+   0.75767291844543863357399652356968220121341991043365343290431317936901627,
+  -0.79914375416774194291556206920359301204052085619873494319995073489970764,
+   0.79914375416774194291556206920359301204052085619873494319995073489970764,
+  -0.83712013989990212127759894856635236418186894946344259363611542180458186,
+   0.83712013989990212127759894856635236418186894946344259363611542180458186,
+  -0.87143601579689631694098546455560617105192652611577960926759529303147308,
+   0.87143601579689631694098546455560617105192652611577960926759529303147308,
+  -0.90194132943852535686717130197743563963863448643228478025959372055178984,
+   0.90194132943852535686717130197743563963863448643228478025959372055178984,
+  -0.92850269301236064819718492461132098137541878694303398972579294674466930,
+   0.92850269301236064819718492461132098137541878694303398972579294674466930,
+  -0.95100396925770844258980292385144242265360151538737902896871183470512443,
+   0.95100396925770844258980292385144242265360151538737902896871183470512443,
+  -0.96934678732656449714574427756027080533830294697950413648687850552327501,
+   0.96934678732656449714574427756027080533830294697950413648687850552327501,
+  -0.98345100307162370876490103403616985193165421910809377438025512180639463,
+   0.98345100307162370876490103403616985193165421910809377438025512180639463,
+  -0.99325521098776863469218968463246360814571208411063073453930968096452882,
+   0.99325521098776863469218968463246360814571208411063073453930968096452882,
+  -0.99871872858421210918394771478710849162709065123149080921596816254857877,
+   0.99871872858421210918394771478710849162709065123149080921596816254857877,
+  // Order 48;
+  -0.03238017096286936203332224315213444204596280236151809242500322001737782,
+   0.03238017096286936203332224315213444204596280236151809242500322001737782,
+  -0.09700469920946269893005395585362452015273622930093698643058076594480404,
+   0.09700469920946269893005395585362452015273622930093698643058076594480404,
+  -0.16122235606889171805643739078349769477437437974189511770324263755651634,
+   0.16122235606889171805643739078349769477437437974189511770324263755651634,
+  -0.22476379039468906122486544017469227743856180404165480616474264104518194,
+   0.22476379039468906122486544017469227743856180404165480616474264104518194,
+  -0.28736248735545557673588646131679768785155830580103977890850003216899984,
+   0.28736248735545557673588646131679768785155830580103977890850003216899984,
+  -0.34875588629216073815981793727040791613430964996839257603212296778128159,
+   0.34875588629216073815981793727040791613430964996839257603212296778128159,
+  -0.40868648199071672991622549581463328645992284299488806477115098332562054,
+   0.40868648199071672991622549581463328645992284299488806477115098332562054,
+  -0.46690290475095840454492886165079850923681210425851694418186919513479439,
+   0.46690290475095840454492886165079850923681210425851694418186919513479439,
+  -0.52316097472223303367822586913750852628918762181188410758022954721941445,
+   0.52316097472223303367822586913750852628918762181188410758022954721941445,
+  -0.57722472608397270381780923854047877285399728614019552805239739942773700,
+   0.57722472608397270381780923854047877285399728614019552805239739942773700,
+  -0.62886739677651362399516493306999465202490899979016177098173299451953191,
+   0.62886739677651362399516493306999465202490899979016177098173299451953191,
+  -0.67787237963266390521185128067590905884995467902604861307104064297549465,
+   0.67787237963266390521185128067590905884995467902604861307104064297549465,
+  -0.72403413092381465467448223349366524658509281228072236272936630257335146,
+   0.72403413092381465467448223349366524658509281228072236272936630257335146,
+  -0.76715903251574033925385543752296905362264233084820737223512858866405084,
+   0.76715903251574033925385543752296905362264233084820737223512858866405084,
+  -0.80706620402944262708255304302453844597301302946041538657586294181218215,
+   0.80706620402944262708255304302453844597301302946041538657586294181218215,
+  -0.84358826162439353071108984451965604987088701173755240151491319989884105,
+   0.84358826162439353071108984451965604987088701173755240151491319989884105,
+  -0.87657202027424788590569355480509675456164853372996199274787575187467271,
+   0.87657202027424788590569355480509675456164853372996199274787575187467271,
+  -0.90587913671556967282207483567101178831226219982741084535248542547101682,
+   0.90587913671556967282207483567101178831226219982741084535248542547101682,
+  -0.93138669070655433311417438010160126771999708561895042987060486425307304,
+   0.93138669070655433311417438010160126771999708561895042987060486425307304,
+  -0.95298770316043086072296066602571834320854133182391873686394760349394587,
+   0.95298770316043086072296066602571834320854133182391873686394760349394587,
+  -0.97059159254624725046141198380066005730243391163088370602837235216532331,
+   0.97059159254624725046141198380066005730243391163088370602837235216532331,
+  -0.98412458372282685774458360002659883058923922341738472995765016798552978,
+   0.98412458372282685774458360002659883058923922341738472995765016798552978,
+  -0.99353017226635075754792875084907411835661474959467192961715183809875462,
+   0.99353017226635075754792875084907411835661474959467192961715183809875462,
+  -0.99877100725242611860054149156311364008893765027672103861294048137545884,
+   0.99877100725242611860054149156311364008893765027672103861294048137545884,
+  // Order 49;
+   0,
+  -0.06342068498268678602883482087848497315278687277888038749020913836880464,
+   0.06342068498268678602883482087848497315278687277888038749020913836880464,
+  -0.12658599726967205106798528857553619032448712106686671351096825791623843,
+   0.12658599726967205106798528857553619032448712106686671351096825791623843,
+  -0.18924159246181358648531017385998651117967887767881908934443735410392376,
+   0.18924159246181358648531017385998651117967887767881908934443735410392376,
+  -0.25113517861257727350715594282461127458298417457366425129402655420487586,
+   0.25113517861257727350715594282461127458298417457366425129402655420487586,
+  -0.31201753211974876220786067650641626509683340799438724958339733686198987,
+   0.31201753211974876220786067650641626509683340799438724958339733686198987,
+  -0.37164350126228488886373454094696052761474478673392697674986833659903723,
+   0.37164350126228488886373454094696052761474478673392697674986833659903723,
+  -0.42977299334157652465858414180742303306341789787807200984370710437603330,
+   0.42977299334157652465858414180742303306341789787807200984370710437603330,
+  -0.48617194145249204217697609605857506207511519433493660528059769391875029,
+   0.48617194145249204217697609605857506207511519433493660528059769391875029,
+  -0.54061324699172606655822546722943591692410134623836584659794799056320852,
+   0.54061324699172606655822546722943591692410134623836584659794799056320852,
+  -0.59287769410890071245586433679262853463300101531884759045351079311284616,
+   0.59287769410890071245586433679262853463300101531884759045351079311284616,
+  -0.64275483241923766405685694858390010954033547225327753254148242796004168,
+   0.64275483241923766405685694858390010954033547225327753254148242796004168,
+  -0.69004382442513211350475180727494192763350512618903575099154861639628938,
+   0.69004382442513211350475180727494192763350512618903575099154861639628938,
+  -0.73455425423740269621367421285852488465283545332370183443947098622113965,
+   0.73455425423740269621367421285852488465283545332370183443947098622113965,
+  -0.77610689434544663501814281224845607126445046182918186527103430254079467,
+   0.77610689434544663501814281224845607126445046182918186527103430254079467,
+  -0.81453442735985543153950078776477704449467213582275335173676688287103466,
+   0.81453442735985543153950078776477704449467213582275335173676688287103466,
+  -0.84968211984416570103488187224297933332660433246471624874358696445901776,
+   0.84968211984416570103488187224297933332660433246471624874358696445901776,
+  -0.88140844557300891003703153581700492615924003726239133961752918309943320,
+   0.88140844557300891003703153581700492615924003726239133961752918309943320,
+  -0.90958565582807328521301964035580007104277123111671803910684472038382475,
+   0.90958565582807328521301964035580007104277123111671803910684472038382475,
+  -0.93410029475581014905898246063654490246042295281019199440770187329793242,
+   0.93410029475581014905898246063654490246042295281019199440770187329793242,
+  -0.95485365867413723355524367966818441905469445190027379192298617405390942,
+   0.95485365867413723355524367966818441905469445190027379192298617405390942,
+  -0.97176220090155538013997242150477413349786254718090569331922741800279930,
+   0.97176220090155538013997242150477413349786254718090569331922741800279930,
+  -0.98475789591421300435929899536857471035330746214525295321721635763595906,
+   0.98475789591421300435929899536857471035330746214525295321721635763595906,
+  -0.99378866194416779076011385925795361884130739493865016760460278652463011,
+   0.99378866194416779076011385925795361884130739493865016760460278652463011,
+  -0.99882015060663537936183127270411065512368099786450196411294917730284114,
+   0.99882015060663537936183127270411065512368099786450196411294917730284114,
+  // Order 50;
+  -0.03109833832718887611232898966594919424729622295999804297479623566203052,
+   0.03109833832718887611232898966594919424729622295999804297479623566203052,
+  -0.09317470156008614085445037763960034788567138392213861468288915564618025,
+   0.09317470156008614085445037763960034788567138392213861468288915564618025,
+  -0.15489058999814590207162862094110950120185022005493763239673032635355782,
+   0.15489058999814590207162862094110950120185022005493763239673032635355782,
+  -0.21600723687604175684728453261710133370575597251013327270362112636199019,
+   0.21600723687604175684728453261710133370575597251013327270362112636199019,
+  -0.27628819377953199032764527852113018571480158713199615061350557943837692,
+   0.27628819377953199032764527852113018571480158713199615061350557943837692,
+  -0.33550024541943735683698825729107169784121859303679576190043053971098619,
+   0.33550024541943735683698825729107169784121859303679576190043053971098619,
+  -0.39341431189756512739422925382381727024613946867265600307903662085649773,
+   0.39341431189756512739422925382381727024613946867265600307903662085649773,
+  -0.44980633497403878914713146777837581731506451346517366594148066988597085,
+   0.44980633497403878914713146777837581731506451346517366594148066988597085,
+  -0.50445814490746420165145913184914119263537867827067923818273921096822638,
+   0.50445814490746420165145913184914119263537867827067923818273921096822638,
+  -0.55715830451465005431552290962580160781589838223775026131646148676048945,
+   0.55715830451465005431552290962580160781589838223775026131646148676048945,
+  -0.60770292718495023918038179639183289360420502067599435571213118893968565,
+   0.60770292718495023918038179639183289360420502067599435571213118893968565,
+  -0.65589646568543936078162486400367981904141052838233182653093459139210848,
+   0.65589646568543936078162486400367981904141052838233182653093459139210848,
+  -0.70155246870682225108954625788365572814971922848469564274092437903329225,
+   0.70155246870682225108954625788365572814971922848469564274092437903329225,
+  -0.74449430222606853826053625268219424287018793132958457852477914793292979,
+   0.74449430222606853826053625268219424287018793132958457852477914793292979,
+  -0.78455583290039926390530519634099120084731627255644435273885912189313102,
+   0.78455583290039926390530519634099120084731627255644435273885912189313102,
+  -0.82158207085933594835625411087393953776074138334348574852337446061546867,
+   0.82158207085933594835625411087393953776074138334348574852337446061546867,
+  -0.85542976942994608461136264393475746765483303948690596343832992034131863,
+   0.85542976942994608461136264393475746765483303948690596343832992034131863,
+  -0.88596797952361304863754098246675363419429031075580836244655713965488733,
+   0.88596797952361304863754098246675363419429031075580836244655713965488733,
+  -0.91307855665579189308973564277165709478418819169778238962272655320085243,
+   0.91307855665579189308973564277165709478418819169778238962272655320085243,
+  -0.93665661894487793378087494727249660215373159809520292237505427380935613,
+   0.93665661894487793378087494727249660215373159809520292237505427380935613,
+  -0.95661095524280794299774564415662209405143412462604654285597908297305531,
+   0.95661095524280794299774564415662209405143412462604654285597908297305531,
+  -0.97286438510669207371334410460625205366917340704995420174509627522567672,
+   0.97286438510669207371334410460625205366917340704995420174509627522567672,
+  -0.98535408404800588230900962563248940401559263094540580871780922100853508,
+   0.98535408404800588230900962563248940401559263094540580871780922100853508,
+  -0.99403196943209071258510820042069472815747797106832359033652478911593331,
+   0.99403196943209071258510820042069472815747797106832359033652478911593331,
+  -0.99886640442007105018545944497421850599624351290407852517703861765753911,
+   0.99886640442007105018545944497421850599624351290407852517703861765753911,
+  // Order 51;
+   0,
+  -0.06096110015057872473419470684320540469703046426951978443297042345580046,
+   0.06096110015057872473419470684320540469703046426951978443297042345580046,
+  -0.12169542101888876696382042096318110874530328748446984437471113710749125,
+   0.12169542101888876696382042096318110874530328748446984437471113710749125,
+  -0.18197702695707754532399870116921444992392011653400331319041496966556364,
+   0.18197702695707754532399870116921444992392011653400331319041496966556364,
+  -0.24158166644779870384673311486926242373879324647241357779819372577537397,
+   0.24158166644779870384673311486926242373879324647241357779819372577537397,
+  -0.30028760633533193953024564964442033333133838051304991601719274909232021,
+   0.30028760633533193953024564964442033333133838051304991601719274909232021,
+  -0.35787645668840950977520108851966635689638392209596833403915550346458296,
+   0.35787645668840950977520108851966635689638392209596833403915550346458296,
+  -0.41413398322630387793687180974465790792397717046939456279732719318881239,
+   0.41413398322630387793687180974465790792397717046939456279732719318881239,
+  -0.46885090428604106361045725881162246880672263543008757950256232424972866,
+   0.46885090428604106361045725881162246880672263543008757950256232424972866,
+  -0.52182366936618584251408778482681802456935024586935804909812692911575777,
+   0.52182366936618584251408778482681802456935024586935804909812692911575777,
+  -0.57285521635130383652239470259019090742094312072379945707362533571859775,
+   0.57285521635130383652239470259019090742094312072379945707362533571859775,
+  -0.62175570460072327375504274540331595005438756687016283567661620690047238,
+   0.62175570460072327375504274540331595005438756687016283567661620690047238,
+  -0.66834322117537008686446041940398887592960851177337599584788165286407587,
+   0.66834322117537008686446041940398887592960851177337599584788165286407587,
+  -0.71244445757703664458052485540014564303694479021724814681615199499309624,
+   0.71244445757703664458052485540014564303694479021724814681615199499309624,
+  -0.75389535448537552576396002545247398763063736381467651456572079500976757,
+   0.75389535448537552576396002545247398763063736381467651456572079500976757,
+  -0.79254171209938120523441087837587573015732246374836771370424761764543915,
+   0.79254171209938120523441087837587573015732246374836771370424761764543915,
+  -0.82823976382306483285481842401656236426238778158632526009844607494524058,
+   0.82823976382306483285481842401656236426238778158632526009844607494524058,
+  -0.86085671118229237147349574371611132357734492551096262820622622385192387,
+   0.86085671118229237147349574371611132357734492551096262820622622385192387,
+  -0.89027121802952730327779537073672689355779979887058883136465987901125116,
+   0.89027121802952730327779537073672689355779979887058883136465987901125116,
+  -0.91637386230978023082357129425147587936604267173137565290400106438550214,
+   0.91637386230978023082357129425147587936604267173137565290400106438550214,
+  -0.93906754400296238343536780639090514416516382215016844060256520521437299,
+   0.93906754400296238343536780639090514416516382215016844060256520521437299,
+  -0.95826784861390819455770703831632372761244401855586884712030945705531431,
+   0.95826784861390819455770703831632372761244401855586884712030945705531431,
+  -0.97390336801932386723175548639418663901310650631571286670207449098126271,
+   0.97390336801932386723175548639418663901310650631571286670207449098126271,
+  -0.98591599173590299658388570755830963265211577808719691674680068120016714,
+   0.98591599173590299658388570755830963265211577808719691674680068120016714,
+  -0.99426126043675257462108489794926312823178439027901499730058325651029110,
+   0.99426126043675257462108489794926312823178439027901499730058325651029110,
+  -0.99890999084890349516899587727338563708424992188818878966860320740571805,
+   0.99890999084890349516899587727338563708424992188818878966860320740571805,
+  // Order 52;
+  -0.02991410979733876604368077607079992681884360824994698161985753939115171,
+   0.02991410979733876604368077607079992681884360824994698161985753939115171,
+  -0.08963524464890056548885469112239930316985128719019842048410262943072103,
+   0.08963524464890056548885469112239930316985128719019842048410262943072103,
+  -0.14903550860694918048863404001811357032226976188823353243557086554385416,
+   0.14903550860694918048863404001811357032226976188823353243557086554385416,
+  -0.20790226415636605968646612812234551827266281082820464693541281779460801,
+   0.20790226415636605968646612812234551827266281082820464693541281779460801,
+  -0.26602478360500182747297173059883988445592437496218466846713725720852138,
+   0.26602478360500182747297173059883988445592437496218466846713725720852138,
+  -0.32319500343480782550109906660144717905404753380657945793933873227826156,
+   0.32319500343480782550109906660144717905404753380657945793933873227826156,
+  -0.37920826911609366924668176693944888046212159135119660933601231010352733,
+   0.37920826911609366924668176693944888046212159135119660933601231010352733,
+  -0.43386406771876167030908656820978026074374585241840338581909725560659495,
+   0.43386406771876167030908656820978026074374585241840338581909725560659495,
+  -0.48696674569809607778245824134646555685045503971902368774263448042842110,
+   0.48696674569809607778245824134646555685045503971902368774263448042842110,
+  -0.53832620928582743837595116797535676382349014140308097340985563359376996,
+   0.53832620928582743837595116797535676382349014140308097340985563359376996,
+  -0.58775860497957906990202578155720422388122016653804348995978496117036885,
+   0.58775860497957906990202578155720422388122016653804348995978496117036885,
+  -0.63508697769524592429812457928880965359359898895498966320348379664820657,
+   0.63508697769524592429812457928880965359359898895498966320348379664820657,
+  -0.68014190422716770209223877973664100790099671016577591556545298876012070,
+   0.68014190422716770209223877973664100790099671016577591556545298876012070,
+  -0.72276209974998319367681667607193595478399390521472001992348926892971390,
+   0.72276209974998319367681667607193595478399390521472001992348926892971390,
+  -0.76279499519374496027921116308905084079183057450762154671864775467541722,
+   0.76279499519374496027921116308905084079183057450762154671864775467541722,
+  -0.80009728343046832433475875422580765119764185860770158058730849438319268,
+   0.80009728343046832433475875422580765119764185860770158058730849438319268,
+  -0.83453543232673453496172638962123868524593631266922605323167539537529356,
+   0.83453543232673453496172638962123868524593631266922605323167539537529356,
+  -0.86598616284606758524435851762420694089833895262429082393533454501374966,
+   0.86598616284606758524435851762420694089833895262429082393533454501374966,
+  -0.89433689053449532252084408826352755534558099556237649319269886222377916,
+   0.89433689053449532252084408826352755534558099556237649319269886222377916,
+  -0.91948612891642453989359637654188158502952027270247205718622286062730702,
+   0.91948612891642453989359637654188158502952027270247205718622286062730702,
+  -0.94134385364135905684357918385056700582876554543631919967003187189560693,
+   0.94134385364135905684357918385056700582876554543631919967003187189560693,
+  -0.95983182693308655253202515342506544278784747603767741541499397324362806,
+   0.95983182693308655253202515342506544278784747603767741541499397324362806,
+  -0.97488388422174450314070647039964555445992366394593839782844335056242980,
+   0.97488388422174450314070647039964555445992366394593839782844335056242980,
+  -0.98644619565154984064532285911839736802273903582732623279715297831659114,
+   0.98644619565154984064532285911839736802273903582732623279715297831659114,
+  -0.99447759092921602924504327179957170663191177609788217145885629655824967,
+   0.99447759092921602924504327179957170663191177609788217145885629655824967,
+  -0.99895111110395027809096144071659256127801326111535756167992484050043891,
+   0.99895111110395027809096144071659256127801326111535756167992484050043891,
+  // Order 53;
+   0,
+  -0.05868505430025946502271194583323153773559128390264423825777818037745764,
+   0.05868505430025946502271194583323153773559128390264423825777818037745764,
+  -0.11716780907195515014025680877932376792332105234443187896258959131377205,
+   0.11716780907195515014025680877932376792332105234443187896258959131377205,
+  -0.17524666215532575072979100913289524582891614994218911453001860494182021,
+   0.17524666215532575072979100913289524582891614994218911453001860494182021,
+  -0.23272140372427259364336364219991621852620931152163832906394926864819422,
+   0.23272140372427259364336364219991621852620931152163832906394926864819422,
+  -0.28939390645162620642654700659401276779605740146645023144978686634336776,
+   0.28939390645162620642654700659401276779605740146645023144978686634336776,
+  -0.34506880849572235669431064606950091485609334583293545091078365484720973,
+   0.34506880849572235669431064606950091485609334583293545091078365484720973,
+  -0.39955418695395297739256313623839757189451165670694625718850750405958123,
+   0.39955418695395297739256313623839757189451165670694625718850750405958123,
+  -0.45266221946184579138314476075331588362047958849937256072537946966493444,
+   0.45266221946184579138314476075331588362047958849937256072537946966493444,
+  -0.50420983165713343703911697288795803339546222770377472583322402874260261,
+   0.50420983165713343703911697288795803339546222770377472583322402874260261,
+  -0.55401932827706788101473499081004928725576083782432159396607149347476846,
+   0.55401932827706788101473499081004928725576083782432159396607149347476846,
+  -0.60191900571376932746429437196462361309295336573174637544393409660689331,
+   0.60191900571376932746429437196462361309295336573174637544393409660689331,
+  -0.64774374391651006875110618993863342181356004483640224168769729790876565,
+   0.64774374391651006875110618993863342181356004483640224168769729790876565,
+  -0.69133557560136672354074882313894456541549537640418395072470914090911235,
+   0.69133557560136672354074882313894456541549537640418395072470914090911235,
+  -0.73254423080751025378213558672175023156563327376066931012816995632769297,
+   0.73254423080751025378213558672175023156563327376066931012816995632769297,
+  -0.77122765492553230786603587562603974126135441361994677164888418774395253,
+   0.77122765492553230786603587562603974126135441361994677164888418774395253,
+  -0.80725249841689547822048563802590721017763256065553022596622460407688419,
+   0.80725249841689547822048563802590721017763256065553022596622460407688419,
+  -0.84049457654580137543012750982994679689996249373509816854952296140589106,
+   0.84049457654580137543012750982994679689996249373509816854952296140589106,
+  -0.87083929755824135160170008688859408982128016798117404109286788786004683,
+   0.87083929755824135160170008688859408982128016798117404109286788786004683,
+  -0.89818205787542662592552002997308119556704573900175068168250397197464531,
+   0.89818205787542662592552002997308119556704573900175068168250397197464531,
+  -0.92242860304281212826781910008251655134994254241231470748404579474721345,
+   0.92242860304281212826781910008251655134994254241231470748404579474721345,
+  -0.94349535346444187902107066769619277568185750014801566477233905185472876,
+   0.94349535346444187902107066769619277568185750014801566477233905185472876,
+  -0.96130969462313633236985819368263974705042267197213800039570635707149809,
+   0.96130969462313633236985819368263974705042267197213800039570635707149809,
+  -0.97581023371498458163298385810636209351279800357391189685087374023462618,
+   0.97581023371498458163298385810636209351279800357391189685087374023462618,
+  -0.98694703502337152172037308131057818841219951017929625780632237985763824,
+   0.98694703502337152172037308131057818841219951017929625780632237985763824,
+  -0.99468191930800707863603589348399390418282659438797516083073443164266075,
+   0.99468191930800707863603589348399390418282659438797516083073443164266075,
+  -0.99898994777632822712105426703219952258730951565173254434831749312725736,
+   0.99898994777632822712105426703219952258730951565173254434831749312725736,
+  // Order 54;
+  -0.02881674819934177765623584750022705298945454217790784837149523901296524,
+   0.02881674819934177765623584750022705298945454217790784837149523901296524,
+  -0.08635451826324821528544317776874963636940153748706358794802999224787391,
+   0.08635451826324821528544317776874963636940153748706358794802999224787391,
+  -0.14360542731625615394708976289878916129470501626006774123452526011764351,
+   0.14360542731625615394708976289878916129470501626006774123452526011764351,
+  -0.20037929360621356977860246282929803045414318609155091875356675888445940,
+   0.20037929360621356977860246282929803045414318609155091875356675888445940,
+  -0.25648752006999730007741121445300830272692187309077415248794252317599904,
+   0.25648752006999730007741121445300830272692187309077415248794252317599904,
+  -0.31174372083446822888255039015212377139294849711018201701917317847600692,
+   0.31174372083446822888255039015212377139294849711018201701917317847600692,
+  -0.36596434037219118198433210816548740612203738970364159961656413188625944,
+   0.36596434037219118198433210816548740612203738970364159961656413188625944,
+  -0.41896926325520452803610269746251000520079018342504758273098915755700927,
+   0.41896926325520452803610269746251000520079018342504758273098915755700927,
+  -0.47058241248138228368321213632774260243144663981442004391572802607538496,
+   0.47058241248138228368321213632774260243144663981442004391572802607538496,
+  -0.52063233438593307332701713874976411887936685525087922045304627749936218,
+   0.52063233438593307332701713874976411887936685525087922045304627749936218,
+  -0.56895276819520942973162483417715394277384143717421161867057268595955712,
+   0.56895276819520942973162483417715394277384143717421161867057268595955712,
+  -0.61538319833112737072993782016172830059597269412949862219050964993977254,
+   0.61538319833112737072993782016172830059597269412949862219050964993977254,
+  -0.65976938763198312469228982285622047478895824859497504866744572773815938,
+   0.65976938763198312469228982285622047478895824859497504866744572773815938,
+  -0.70196388971917291938557097696967060126881111048967943907893437817686328,
+   0.70196388971917291938557097696967060126881111048967943907893437817686328,
+  -0.74182653880918431628576626875357800093972914498281560304073802798105868,
+   0.74182653880918431628576626875357800093972914498281560304073802798105868,
+  -0.77922491534625402153594861484053265574888909482905025910836799557327403,
+   0.77922491534625402153594861484053265574888909482905025910836799557327403,
+  -0.81403478591356783546963830407519894482759018323361397549375530880017134,
+   0.81403478591356783546963830407519894482759018323361397549375530880017134,
+  -0.84614051597077294942588751087284250039663238021414165739520134839875799,
+   0.84614051597077294942588751087284250039663238021414165739520134839875799,
+  -0.87543545406556893941790933572261082248654748480701617204036691082027094,
+   0.87543545406556893941790933572261082248654748480701617204036691082027094,
+  -0.90182228628470158075746723138842796436392840478891847428003603651335607,
+   0.90182228628470158075746723138842796436392840478891847428003603651335607,
+  -0.92521335986665148625627606047979138685558419356683424406807100893076970,
+   0.92521335986665148625627606047979138685558419356683424406807100893076970,
+  -0.94553097516499585376383702290618041256343658850098640676221745890213266,
+   0.94553097516499585376383702290618041256343658850098640676221745890213266,
+  -0.96270764578592358325699392690538994353691817470203757036254645475725827,
+   0.96270764578592358325699392690538994353691817470203757036254645475725827,
+  -0.97668632885790323720001007198830685746780597324000341202437202932315781,
+   0.97668632885790323720001007198830685746780597324000341202437202932315781,
+  -0.98742063739734355855214572040354626153403629083923858775114103816713087,
+   0.98742063739734355855214572040354626153403629083923858775114103816713087,
+  -0.99487511701833888491888999594870265948412675888699982861615668185014480,
+   0.99487511701833888491888999594870265948412675888699982861615668185014480,
+  -0.99902666686734098385107110698395849319804278579696033168165021475409064,
+   0.99902666686734098385107110698395849319804278579696033168165021475409064,
+  // Order 55;
+   0,
+  -0.05657275381833677632733761089310843416267574245231218366319446792587767,
+   0.05657275381833677632733761089310843416267574245231218366319446792587767,
+  -0.11296428805932926658843792388871218401203889300933300714882753426208209,
+   0.11296428805932926658843792388871218401203889300933300714882753426208209,
+  -0.16899396364687320828284249351170222934589352957387611076497583891531703,
+   0.16899396364687320828284249351170222934589352957387611076497583891531703,
+  -0.22448230064784548340018906240292645440811700470895206033766419252733561,
+   0.22448230064784548340018906240292645440811700470895206033766419252733561,
+  -0.27925155320080653854986245117567102555818594628297263460754544013910250,
+   0.27925155320080653854986245117567102555818594628297263460754544013910250,
+  -0.33312627889002388518947149023296196304739826192271287443619991128011840,
+   0.33312627889002388518947149023296196304739826192271287443619991128011840,
+  -0.38593390074097942975584854391258997545040708651574305567102667221395891,
+   0.38593390074097942975584854391258997545040708651574305567102667221395891,
+  -0.43750526003717459180848102429746658424251628922059254465859417014954993,
+   0.43750526003717459180848102429746658424251628922059254465859417014954993,
+  -0.48767515818747409720826367353935561150755401956934886424625183542085728,
+   0.48767515818747409720826367353935561150755401956934886424625183542085728,
+  -0.53628288590834329672059957284359755353827560883874391501459076023558292,
+   0.53628288590834329672059957284359755353827560883874391501459076023558292,
+  -0.58317273802603210297430481558768648622186113625478567390508218002596038,
+   0.58317273802603210297430481558768648622186113625478567390508218002596038,
+  -0.62819451224992814009063621503297543291101030900675796842423359565602657,
+   0.62819451224992814009063621503297543291101030900675796842423359565602657,
+  -0.67120399031982639579632672800601560057392727743661060691426406577182052,
+   0.67120399031982639579632672800601560057392727743661060691426406577182052,
+  -0.71206339998663783890935019212116751517265372314517351367372163423973441,
+   0.71206339998663783890935019212116751517265372314517351367372163423973441,
+  -0.75064185634802190867498768270731091792206346446225753536923534550514572,
+   0.75064185634802190867498768270731091792206346446225753536923534550514572,
+  -0.78681578112762236589763625093804138350909114627225052948856446958751040,
+   0.78681578112762236589763625093804138350909114627225052948856446958751040,
+  -0.82046929855932091245424128503472236539296748010513060622931702238491168,
+   0.82046929855932091245424128503472236539296748010513060622931702238491168,
+  -0.85149460661715447146024532096700702781646398940273240154448964704937930,
+   0.85149460661715447146024532096700702781646398940273240154448964704937930,
+  -0.87979232241989550606759090682408639529991362162573447659997225300922779,
+   0.87979232241989550606759090682408639529991362162573447659997225300922779,
+  -0.90527180074400002578191142462962439222760858847029059313551795827534993,
+   0.90527180074400002578191142462962439222760858847029059313551795827534993,
+  -0.92785142472079169681627126923258637919449928056960118396670993693793556,
+   0.92785142472079169681627126923258637919449928056960118396670993693793556,
+  -0.94745886804121074185997984764529183717518632629724078716372608551518166,
+   0.94745886804121074185997984764529183717518632629724078716372608551518166,
+  -0.96403132859313519877853663137736922263748967416412665607029527219191934,
+   0.96403132859313519877853663137736922263748967416412665607029527219191934,
+  -0.97751573550398920885921660634073021154213546275556980088769188940036535,
+   0.97751573550398920885921660634073021154213546275556980088769188940036535,
+  -0.98786894119888919852238568447347353064860155505648642992582879630755758,
+   0.98786894119888919852238568447347353064860155505648642992582879630755758,
+  -0.99505797784741187504318911650620237159410074640539224998635006041353798,
+   0.99505797784741187504318911650620237159410074640539224998635006041353798,
+  -0.99906141956481854147943183951938442315554127892942015733240168471097251,
+   0.99906141956481854147943183951938442315554127892942015733240168471097251,
+  // Order 56;
+  -0.02779703528727543709406119677492052188837660314677448776124915586667213,
+   0.02779703528727543709406119677492052188837660314677448776124915586667213,
+  -0.08330518682243537444028735544066244818398741418903054589108857420037993,
+   0.08330518682243537444028735544066244818398741418903054589108857420037993,
+  -0.13855584681037624201288658043849059535149050846252855148336845878939329,
+   0.13855584681037624201288658043849059535149050846252855148336845878939329,
+  -0.19337823863527525824018472301268416181616739276380125903615827249640048,
+   0.19337823863527525824018472301268416181616739276380125903615827249640048,
+  -0.24760290943433720397296655497052697287966324314276700609019023227977405,
+   0.24760290943433720397296655497052697287966324314276700609019023227977405,
+  -0.30106225386722066905309423312523434392507184612438347069683556609248244,
+   0.30106225386722066905309423312523434392507184612438347069683556609248244,
+  -0.35359103217495452096970732703323240563467879438117197646841981557826470,
+   0.35359103217495452096970732703323240563467879438117197646841981557826470,
+  -0.40502688092709127811886696260292289465537138236829072574300605309236042,
+   0.40502688092709127811886696260292289465537138236829072574300605309236042,
+  -0.45521081487845957894883158132460955990722690550390787980196315701691882,
+   0.45521081487845957894883158132460955990722690550390787980196315701691882,
+  -0.50398771838438171419522440121863813770930594935401750244127567401152313,
+   0.50398771838438171419522440121863813770930594935401750244127567401152313,
+  -0.55120682485553461875436351457631660252566257835249024338823238969463470,
+   0.55120682485553461875436351457631660252566257835249024338823238969463470,
+  -0.59672218277066332010413521713840838322050086924194436473325885312971493,
+   0.59672218277066332010413521713840838322050086924194436473325885312971493,
+  -0.64039310680700689426793859606281307892380657294780583081699708702652977,
+   0.64039310680700689426793859606281307892380657294780583081699708702652977,
+  -0.68208461269447045550156147796983633310510936746121019421272085639246341,
+   0.68208461269447045550156147796983633310510936746121019421272085639246341,
+  -0.72166783445018808352259378704755345734404851928573825435554528203894892,
+   0.72166783445018808352259378704755345734404851928573825435554528203894892,
+  -0.75902042270512890220241329444589386736483724927364946933028416658675582,
+   0.75902042270512890220241329444589386736483724927364946933028416658675582,
+  -0.79402692289386649803000830848600047765720330168324204548776927855885186,
+   0.79402692289386649803000830848600047765720330168324204548776927855885186,
+  -0.82657913214288165167212697445685032334304217596386008639720720486182035,
+   0.82657913214288165167212697445685032334304217596386008639720720486182035,
+  -0.85657643376274863540299138676687060407367417470986428066235169682116728,
+   0.85657643376274863540299138676687060407367417470986428066235169682116728,
+  -0.88392610832782754078901228580928672750598141023208925190752050655414911,
+   0.88392610832782754078901228580928672750598141023208925190752050655414911,
+  -0.90854362042065549084610728995724177953221106880958691573184614768242304,
+   0.90854362042065549084610728995724177953221106880958691573184614768242304,
+  -0.93035288024749630054727272329160085302681430599689502674060169763402285,
+   0.93035288024749630054727272329160085302681430599689502674060169763402285,
+  -0.94928647956196263564673760279492806688956352258814452214687015427613606,
+   0.94928647956196263564673760279492806688956352258814452214687015427613606,
+  -0.96528590190549018362619497605509569821755121865766342811133265254243872,
+   0.96528590190549018362619497605509569821755121865766342811133265254243872,
+  -0.97830170914025638337699055153818813122701389775022842384047636964219364,
+   0.97830170914025638337699055153818813122701389775022842384047636964219364,
+  -0.98829371554016151108992516352348621676454114322461616495743099123436593,
+   0.98829371554016151108992516352348621676454114322461616495743099123436593,
+  -0.99523122608106974721630876009894094554853845523399037453385423272546717,
+   0.99523122608106974721630876009894094554853845523399037453385423272546717,
+  -0.99909434380146558435315382509090426217601897845975636977215725847455595,
+   0.99909434380146558435315382509090426217601897845975636977215725847455595,
+  // Order 57;
+   0,
+  -0.05460715100164682421983055973733244541044233435972078077180998462866740,
+   0.05460715100164682421983055973733244541044233435972078077180998462866740,
+  -0.10905133280878780097852652131097904945504513750167102688908488517270809,
+   0.10905133280878780097852652131097904945504513750167102688908488517270809,
+  -0.16317006259126425104328037832151206218590998930310571377923693379584590,
+   0.16317006259126425104328037832151206218590998930310571377923693379584590,
+  -0.21680182879612403641361397597955927425658329550447243835011318059739956,
+   0.21680182879612403641361397597955927425658329550447243835011318059739956,
+  -0.26978657316183876576334560979964334429905799435147475947102787460152630,
+   0.26978657316183876576334560979964334429905799435147475947102787460152630,
+  -0.32196616839537864059020791580539723937273946766280631593531453363650807,
+   0.32196616839537864059020791580539723937273946766280631593531453363650807,
+  -0.37318489008659445855213439614488901055646014609263353376625040015836868,
+   0.37318489008659445855213439614488901055646014609263353376625040015836868,
+  -0.42328988145156395096002435347152437901405095213458828985146966650271359,
+   0.42328988145156395096002435347152437901405095213458828985146966650271359,
+  -0.47213160951797570958806008204923474982223792569932668549061903620346910,
+   0.47213160951797570958806008204923474982223792569932668549061903620346910,
+  -0.51956431139118760631515381980621435108063110826951180647850185382151574,
+   0.51956431139118760631515381980621435108063110826951180647850185382151574,
+  -0.56544642926923675901898555280524042937002207422157972944323832995387957,
+   0.56544642926923675901898555280524042937002207422157972944323832995387957,
+  -0.60964103290871536542384890192474062432400057292396461352572253954300682,
+   0.60964103290871536542384890192474062432400057292396461352572253954300682,
+  -0.65201622828097689124936184079570828367066055697215481037719761090427934,
+   0.65201622828097689124936184079570828367066055697215481037719761090427934,
+  -0.69244555119951773904048368844401044565667663461414289000398318361175230,
+   0.69244555119951773904048368844401044565667663461414289000398318361175230,
+  -0.73080834474452332282734467073677831626312211950961220324761585831727488,
+   0.73080834474452332282734467073677831626312211950961220324761585831727488,
+  -0.76699011935945019549171614401813235523664841582239824251664784090273808,
+   0.76699011935945019549171614401813235523664841582239824251664784090273808,
+  -0.80088289454721824207600871879494856770180362015542160244357413526631894,
+   0.80088289454721824207600871879494856770180362015542160244357413526631894,
+  -0.83238552115043912082901089586520321825226565009663945477343547944357900,
+   0.83238552115043912082901089586520321825226565009663945477343547944357900,
+  -0.86140398326204694472224188180521475422193300561323961829160148517285788,
+   0.86140398326204694472224188180521475422193300561323961829160148517285788,
+  -0.88785167888222132951300014764186171613427578726703528227609120649091695,
+   0.88785167888222132951300014764186171613427578726703528227609120649091695,
+  -0.91164967852139121272843056161967031091824841039741330229704711198015509,
+   0.91164967852139121272843056161967031091824841039741330229704711198015509,
+  -0.93272696106710169610075415429735663806748863511663484923738465908695793,
+   0.93272696106710169610075415429735663806748863511663484923738465908695793,
+  -0.95102062644787674191190411060519032863779933966269042809816168512956238,
+   0.95102062644787674191190411060519032863779933966269042809816168512956238,
+  -0.96647608517188667911485858394233318896849009450238562033620253627617610,
+   0.96647608517188667911485858394233318896849009450238562033620253627617610,
+  -0.97904722670946871379882087536650775736093122376778068469678718910130078,
+   0.97904722670946871379882087536650775736093122376778068469678718910130078,
+  -0.98869657765022204884975839838385543851008408669894400588603165816685088,
+   0.98869657765022204884975839838385543851008408669894400588603165816685088,
+  -0.99539552367843031113512502736241900597506886891341396400349175650223998,
+   0.99539552367843031113512502736241900597506886891341396400349175650223998,
+  -0.99912556562526285057200984955424988499912758600701357536605252428746353,
+   0.99912556562526285057200984955424988499912758600701357536605252428746353,
+  // Order 58;
+  -0.02684701236594235580333868951737998584342117663189360997782882456435164,
+   0.02684701236594235580333868951737998584342117663189360997782882456435164,
+  -0.08046363021414272930984779238050319488933489683186480992118177513695097,
+   0.08046363021414272930984779238050319488933489683186480992118177513695097,
+  -0.13384825059546685702237684787454091195295752427056041957107994476021781,
+   0.13384825059546685702237684787454091195295752427056041957107994476021781,
+  -0.18684695183576132137438388146402240606154788844121703472114989815194892,
+   0.18684695183576132137438388146402240606154788844121703472114989815194892,
+  -0.23930692496615345442894850908533478770052882803533030660399510215707305,
+   0.23930692496615345442894850908533478770052882803533030660399510215707305,
+  -0.29107691431110918953302526831430330218951710085754934768899662153167309,
+   0.29107691431110918953302526831430330218951710085754934768899662153167309,
+  -0.34200765359799526124836826748399695087767282162928728905069200868387540,
+   0.34200765359799526124836826748399695087767282162928728905069200868387540,
+  -0.39195229633075315037121694121301070218501762442300421544387505889820922,
+   0.39195229633075315037121694121301070218501762442300421544387505889820922,
+  -0.44076683918683956519370306221430441412241480190817639721346641741605662,
+   0.44076683918683956519370306221430441412241480190817639721346641741605662,
+  -0.48831053721671846361555257273678542089422872080245127934358141448101952,
+   0.48831053721671846361555257273678542089422872080245127934358141448101952,
+  -0.53444630964884758639980241742520435578876328735633708412088364355761369,
+   0.53444630964884758639980241742520435578876328735633708412088364355761369,
+  -0.57904113513022503048997711713608340382017681668396034116565748121599479,
+   0.57904113513022503048997711713608340382017681668396034116565748121599479,
+  -0.62196643526307911103398405874549112023223525384925508500485779709311754,
+   0.62196643526307911103398405874549112023223525384925508500485779709311754,
+  -0.66309844533212526643301629975356569196064362430412199148686545633124825,
+   0.66309844533212526643301629975356569196064362430412199148686545633124825,
+  -0.70231857115390811347975730145820138366068581664760688899940040644718389,
+   0.70231857115390811347975730145820138366068581664760688899940040644718389,
+  -0.73951373102004226784661723485103279097065744804820352989813696350038390,
+   0.73951373102004226784661723485103279097065744804820352989813696350038390,
+  -0.77457668174965274526614004649682666564897000062728078698321702127962560,
+   0.77457668174965274526614004649682666564897000062728078698321702127962560,
+  -0.80740632791308814104899715220739522798328342401013054235580824950741979,
+   0.80740632791308814104899715220739522798328342401013054235580824950741979,
+  -0.83790801333937331635209792062162436128686730569794239385414661600017801,
+   0.83790801333937331635209792062162436128686730569794239385414661600017801,
+  -0.86599379407480747927507123251208765769427414860556106290842012027624977,
+   0.86599379407480747927507123251208765769427414860556106290842012027624977,
+  -0.89158269202203017639988282081279754648255184994103064947349764349574843,
+   0.89158269202203017639988282081279754648255184994103064947349764349574843,
+  -0.91460092856435254068650564989752182049561509542540611471705610821976712,
+   0.91460092856435254068650564989752182049561509542540611471705610821976712,
+  -0.93498213758825934848084323476624749540914742274456394350805107772760688,
+   0.93498213758825934848084323476624749540914742274456394350805107772760688,
+  -0.95266755751886909144284551002293033370558762897549122618990301189094356,
+   0.95266755751886909144284551002293033370558762897549122618990301189094356,
+  -0.96760620250292409015330078462120619491287277499442596029127840212506408,
+   0.96760620250292409015330078462120619491287277499442596029127840212506408,
+  -0.97975501469435030910781633439259803486987594569128913875488397517376694,
+   0.97975501469435030910781633439259803486987594569128913875488397517376694,
+  -0.98907900824844263649991025527544205688320536550132150533901249264013417,
+   0.98907900824844263649991025527544205688320536550132150533901249264013417,
+  -0.99555147659729090260277152617994614127696728024297488086595191404168555,
+   0.99555147659729090260277152617994614127696728024297488086595191404168555,
+  -0.99915520040738660644273704418460576104581358587271563071181861120815186,
+   0.99915520040738660644273704418460576104581358587271563071181861120815186,
+  // Order 59;
+   0,
+  -0.05277348408831000395168032860333853782470076950917810531402242600484623,
+   0.05277348408831000395168032860333853782470076950917810531402242600484623,
+  -0.10539987901634414383691438776186928705392541093682229170346197180707444,
+   0.10539987901634414383691438776186928705392541093682229170346197180707444,
+  -0.15773250558785796811521785627155430412417462420270318836895230218733952,
+   0.15773250558785796811521785627155430412417462420270318836895230218733952,
+  -0.20962550339203654492336679063149109633205047431449317463114303915943527,
+   0.20962550339203654492336679063149109633205047431449317463114303915943527,
+  -0.26093423734281171161061626741427838000354448343313036164401445506841760,
+   0.26093423734281171161061626741427838000354448343313036164401445506841760,
+  -0.31151570080301370031836014910574975012565923760298034192656503395147593,
+   0.31151570080301370031836014910574975012565923760298034192656503395147593,
+  -0.36122891416979480999231245233404895795341396017483940421597055235592427,
+   0.36122891416979480999231245233404895795341396017483940421597055235592427,
+  -0.40993531781041896672282369375587912101472146267823341721410421591667653,
+   0.40993531781041896672282369375587912101472146267823341721410421591667653,
+  -0.45749915825326669022621526043496150817642577591233421790258669715484443,
+   0.45749915825326669022621526043496150817642577591233421790258669715484443,
+  -0.50378786655771797876808728045730889215098064889787585886397892397269686,
+   0.50378786655771797876808728045730889215098064889787585886397892397269686,
+  -0.54867242780839638437225630038700585744067331832400930164463123410650424,
+   0.54867242780839638437225630038700585744067331832400930164463123410650424,
+  -0.59202774070403014446417615975653433980424816968069367591655332988010578,
+   0.59202774070403014446417615975653433980424816968069367591655332988010578,
+  -0.63373296623885009751258093017500791255189837643896226290002703802918060,
+   0.63373296623885009751258093017500791255189837643896226290002703802918060,
+  -0.67367186450493722702402721275525368441506427511554588645758193136912576,
+   0.67367186450493722702402721275525368441506427511554588645758193136912576,
+  -0.71173311867719773159591572196590935391076245280231223404591653671354685,
+   0.71173311867719773159591572196590935391076245280231223404591653671354685,
+  -0.74781064527864023188925757901321238792089493398551449101294474531843849,
+   0.74781064527864023188925757901321238792089493398551449101294474531843849,
+  -0.78180388986236090563267881276748262802966695695039443066991025823597405,
+   0.78180388986236090563267881276748262802966695695039443066991025823597405,
+  -0.81361810728821157143508977382120044741070406508964745370342391678308701,
+   0.81361810728821157143508977382120044741070406508964745370342391678308701,
+  -0.84316462581687220147035095397223663847022596081723219257729891523807161,
+   0.84316462581687220147035095397223663847022596081723219257729891523807161,
+  -0.87036109429288226096342623310414520128418694739618765771511710420070657,
+   0.87036109429288226096342623310414520128418694739618765771511710420070657,
+  -0.89513171174347208536429682946245927502953713940999927656753936042698828,
+   0.89513171174347208536429682946245927502953713940999927656753936042698828,
+  -0.91740743878815528135254148521524582687314349000380399347839368114293972,
+   0.91740743878815528135254148521524582687314349000380399347839368114293972,
+  -0.93712619035345385940513847104328988491060212647114705992669222427885221,
+   0.93712619035345385940513847104328988491060212647114705992669222427885221,
+  -0.95423300937695105586323311218564993707390813827454712563123155665016366,
+   0.95423300937695105586323311218564993707390813827454712563123155665016366,
+  -0.96868022168178153135363333967256205766488944332981848563431229183027392,
+   0.96868022168178153135363333967256205766488944332981848563431229183027392,
+  -0.98042757395671568844960798140326777546255785113970301059584553273597224,
+   0.98042757395671568844960798140326777546255785113970301059584553273597224,
+  -0.98944236513373093178218393502270579347325528002329934256944009136321882,
+   0.98944236513373093178218393502270579347325528002329934256944009136321882,
+  -0.99569964038324596468720182343344830766185577690859122700798419998589485,
+   0.99569964038324596468720182343344830766185577690859122700798419998589485,
+  -0.99918335390929468375642401950467818497422597033002270855107230127165519,
+   0.99918335390929468375642401950467818497422597033002270855107230127165519,
+  // Order 60;
+  -0.02595977230124779858917038540034482566031476071727522549261664083083447,
+   0.02595977230124779858917038540034482566031476071727522549261664083083447,
+  -0.07780933394953656941928550708222528757759478289772395501421876123249594,
+   0.07780933394953656941928550708222528757759478289772395501421876123249594,
+  -0.12944913539694500314644416464957577475987352436647214341541575913812178,
+   0.12944913539694500314644416464957577475987352436647214341541575913812178,
+  -0.18073996487342541724087694126185263123177216863904549273045410396132498,
+   0.18073996487342541724087694126185263123177216863904549273045410396132498,
+  -0.23154355137602933801034463134675544074353905193958573194603141402493913,
+   0.23154355137602933801034463134675544074353905193958573194603141402493913,
+  -0.28172293742326169169069486033944159830826306079537742435534234691911549,
+   0.28172293742326169169069486033944159830826306079537742435534234691911549,
+  -0.33114284826844819425235296535055270480012149637631120289541190496669949,
+   0.33114284826844819425235296535055270480012149637631120289541190496669949,
+  -0.37967005657679797715495267052188770405637443316238986606386316304310027,
+   0.37967005657679797715495267052188770405637443316238986606386316304310027,
+  -0.42717374158307838930745285353031192335344213618423209020824420553405994,
+   0.42717374158307838930745285353031192335344213618423209020824420553405994,
+  -0.47352584176170711110816305375279463800786800509983688974970579944608986,
+   0.47352584176170711110816305375279463800786800509983688974970579944608986,
+  -0.51860140005856974741788934848472130132984667628868557269080527683149102,
+   0.51860140005856974741788934848472130132984667628868557269080527683149102,
+  -0.56227890075394453917827258748599872906318823765939539959758707905681163,
+   0.56227890075394453917827258748599872906318823765939539959758707905681163,
+  -0.60444059704851036344420877631120172065042105359105983804959276292861023,
+   0.60444059704851036344420877631120172065042105359105983804959276292861023,
+  -0.64497282848947706781344789642044471716519001934666099624465517485878927,
+   0.64497282848947706781344789642044471716519001934666099624465517485878927,
+  -0.68376632738135543722293023922429715908759460433887497987905815214823772,
+   0.68376632738135543722293023922429715908759460433887497987905815214823772,
+  -0.72071651335573039943602106101352107776477399473323904319016138834459438,
+   0.72071651335573039943602106101352107776477399473323904319016138834459438,
+  -0.75572377530658568686884206660237310592890019956470772482289378263724741,
+   0.75572377530658568686884206660237310592890019956470772482289378263724741,
+  -0.78869373993226405456994479977721573524633292787922761963527585617280421,
+   0.78869373993226405456994479977721573524633292787922761963527585617280421,
+  -0.81953752616214575936851810851972357189949051896959250957509466821226937,
+   0.81953752616214575936851810851972357189949051896959250957509466821226937,
+  -0.84817198478592963249051549499437560129752871650677819695098879074915256,
+   0.84817198478592963249051549499437560129752871650677819695098879074915256,
+  -0.87451992264689831512930809991243580515918229443578207585720422776504067,
+   0.87451992264689831512930809991243580515918229443578207585720422776504067,
+  -0.89851031081004594193778932957262833016445844274707382454373400447195217,
+   0.89851031081004594193778932957262833016445844274707382454373400447195217,
+  -0.92007847617762755285665686251989682878376887601370603992322936497236376,
+   0.92007847617762755285665686251989682878376887601370603992322936497236376,
+  -0.93916627611642324949541901160970509641940342040119803154831649371477749,
+   0.93916627611642324949541901160970509641940342040119803154831649371477749,
+  -0.95572225583999610739723184582969950248009374476661421963609490605769058,
+   0.95572225583999610739723184582969950248009374476661421963609490605769058,
+  -0.96970178876505273372154409891379427254093434486824707208632751667730305,
+   0.96970178876505273372154409891379427254093434486824707208632751667730305,
+  -0.98106720175259818561857679982677003388053857922189174349637328911307522,
+   0.98106720175259818561857679982677003388053857922189174349637328911307522,
+  -0.98978789522222171736727898701609604257739315378693904081957256319454428,
+   0.98978789522222171736727898701609604257739315378693904081957256319454428,
+  -0.99584052511883817387674671337744065277489029497713910190748324131308084,
+   0.99584052511883817387674671337744065277489029497713910190748324131308084,
+  -0.99921012322743602203422958579764926639879897871132567069202288908270495,
+   0.99921012322743602203422958579764926639879897871132567069202288908270495,
+  // Order 61;
+   0,
+  -0.05105890670797434936688750061890079807018425404125653846839174151781703,
+   0.05105890670797434936688750061890079807018425404125653846839174151781703,
+  -0.10198460656227406895720840476436564197678981705575171044068979586391127,
+   0.10198460656227406895720840476436564197678981705575171044068979586391127,
+  -0.15264424023081530052950676177347741688353897661745930142311807731896352,
+   0.15264424023081530052950676177347741688353897661745930142311807731896352,
+  -0.20290564251805849922694720334305705450143905185836343340962549950047507,
+   0.20290564251805849922694720334305705450143905185836343340962549950047507,
+  -0.25263768716905349583369086333440510622751074756005922208492381818600550,
+   0.25263768716905349583369086333440510622751074756005922208492381818600550,
+  -0.30171062896303071260448652545697712524119763287003732754562632071771687,
+   0.30171062896303071260448652545697712524119763287003732754562632071771687,
+  -0.34999644220406683453343447706209384978750461740488398299245484657712093,
+   0.34999644220406683453343447706209384978750461740488398299245484657712093,
+  -0.39736915472575660917829184736858922181287289269372192014992301061781050,
+   0.39736915472575660917829184736858922181287289269372192014992301061781050,
+  -0.44370517653853160199558930106582255938232463747223832403155674644506182,
+   0.44370517653853160199558930106582255938232463747223832403155674644506182,
+  -0.48888362226225211882069851142582959751653092472499616825177085297872762,
+   0.48888362226225211882069851142582959751653092472499616825177085297872762,
+  -0.53278662650292526563848171637307164032481991094547415386276764631664982,
+   0.53278662650292526563848171637307164032481991094547415386276764631664982,
+  -0.57529965135083061860036998194497287899733192533772913458968916781141362,
+   0.57529965135083061860036998194497287899733192533772913458968916781141362,
+  -0.61631178519792172470961685932859103589567168396123272499725192869020808,
+   0.61631178519792172470961685932859103589567168396123272499725192869020808,
+  -0.65571603209507087169918577783630688700084734644168225850664155308566058,
+   0.65571603209507087169918577783630688700084734644168225850664155308566058,
+  -0.69340959089449115549918436396023173728437756854618545989961199759752808,
+   0.69340959089449115549918436396023173728437756854618545989961199759752808,
+  -0.72929412344946510968895669013553179857637101453817734882212278490922616,
+   0.72929412344946510968895669013553179857637101453817734882212278490922616,
+  -0.76327601117231219714591466849435037104451915109862147348582296876826055,
+   0.76327601117231219714591466849435037104451915109862147348582296876826055,
+  -0.79526659928235964915204880275254626487323687020583117925272640717605629,
+   0.79526659928235964915204880275254626487323687020583117925272640717605629,
+  -0.82518242810865995066428189245084752700639465995958312633826529643126808,
+   0.82518242810865995066428189245084752700639465995958312633826529643126808,
+  -0.85294545084766344556484690467417053833995325998446013231578818563572590,
+   0.85294545084766344556484690467417053833995325998446013231578818563572590,
+  -0.87848323721488103247894751389335263145955452028041794615608376469759371,
+   0.87848323721488103247894751389335263145955452028041794615608376469759371,
+  -0.90172916247400117064204004268351116465311752108726357703149621423389954,
+   0.90172916247400117064204004268351116465311752108726357703149621423389954,
+  -0.92262258138295526125755150055584544545063516129871751244050735688221085,
+   0.92262258138295526125755150055584544545063516129871751244050735688221085,
+  -0.94110898668136114747754386097778900828047471105845942211915981527564994,
+   0.94110898668136114747754386097778900828047471105845942211915981527564994,
+  -0.95714015191298409137208028742121526110444034092702351027681629194699741,
+   0.95714015191298409137208028742121526110444034092702351027681629194699741,
+  -0.97067425883318290824740845354791027256833637675753031967845577977875939,
+   0.97067425883318290824740845354791027256833637675753031967845577977875939,
+  -0.98167601128403707968517254075131942216007406209492654557703609344387199,
+   0.98167601128403707968517254075131942216007406209492654557703609344387199,
+  -0.99011674523251705096553168569991650162875678117649731349622432737914590,
+   0.99011674523251705096553168569991650162875678117649731349622432737914590,
+  -0.99597459981512023426801276071228827628684886478913172543562886755521645,
+   0.99597459981512023426801276071228827628684886478913172543562886755521645,
+  -0.99923559763136347173186225956913086285344204850300083138763718025741131,
+   0.99923559763136347173186225956913086285344204850300083138763718025741131,
+  // Order 62;
+  -0.02512929142182061472708827599914696231450491802481494897912027110322304,
+   0.02512929142182061472708827599914696231450491802481494897912027110322304,
+  -0.07532439549623433276382693911787087757684581231442079983724598775989517,
+   0.07532439549623433276382693911787087757684581231442079983724598775989517,
+  -0.12532922361589680861964899949972625779675540078947580463455089046824509,
+   0.12532922361589680861964899949972625779675540078947580463455089046824509,
+  -0.17501745924901562855568742390423603170050770944644703966654343695794503,
+   0.17501745924901562855568742390423603170050770944644703966654343695794503,
+  -0.22426358560416553166899139334488270060896525671749469265480555772714357,
+   0.22426358560416553166899139334488270060896525671749469265480555772714357,
+  -0.27294320269672634318868362797348098085486162034350993616834598677716929,
+   0.27294320269672634318868362797348098085486162034350993616834598677716929,
+  -0.32093334159419400407410160100345638508585870215936296478986948250902417,
+   0.32093334159419400407410160100345638508585870215936296478986948250902417,
+  -0.36811277504656452966302183095250792201723545553516474466075939693795924,
+   0.36811277504656452966302183095250792201723545553516474466075939693795924,
+  -0.41436232371712604812958875065761134513588929957184224763670322460173238,
+   0.41436232371712604812958875065761134513588929957184224763670322460173238,
+  -0.45956515724011339520714397807575265141860208701364659752653127841452745,
+   0.45956515724011339520714397807575265141860208701364659752653127841452745,
+  -0.50360708934475595591702080593161627696584196729605374421070685941997099,
+   0.50360708934475595591702080593161627696584196729605374421070685941997099,
+  -0.54637686630025109581610038452363370723217109157838567542878762097026738,
+   0.54637686630025109581610038452363370723217109157838567542878762097026738,
+  -0.58776644795308733800214955012198776385819749684764301758987435967807676,
+   0.58776644795308733800214955012198776385819749684764301758987435967807676,
+  -0.62767128064688518072695476491616278858720843830369250261820679540297983,
+   0.62767128064688518072695476491616278858720843830369250261820679540297983,
+  -0.66599056133547944699754603408238807993320858447569586843446674967342574,
+   0.66599056133547944699754603408238807993320858447569586843446674967342574,
+  -0.70262749222229705512097276505998672314403128528957965494480596351982702,
+   0.70262749222229705512097276505998672314403128528957965494480596351982702,
+  -0.73748952528315674986078427650143946028010343563118008573513418261088288,
+   0.73748952528315674986078427650143946028010343563118008573513418261088288,
+  -0.77048859605541931899094469499504818845380926550542398615054446579200069,
+   0.77048859605541931899094469499504818845380926550542398615054446579200069,
+  -0.80154134610397637153850551449538634730618948310785039391755648750537440,
+   0.80154134610397637153850551449538634730618948310785039391755648750537440,
+  -0.83056933360400485134593110947720822291981123949520651563299132731949770,
+   0.83056933360400485134593110947720822291981123949520651563299132731949770,
+  -0.85749923151207092281840332054467550689150893751162174641809427706595302,
+   0.85749923151207092281840332054467550689150893751162174641809427706595302,
+  -0.88226301283189736307268662435582975601712579191938623991913074558369480,
+   0.88226301283189736307268662435582975601712579191938623991913074558369480,
+  -0.90479812252109346575848560242837562439844989261032305174824658538600693,
+   0.90479812252109346575848560242837562439844989261032305174824658538600693,
+  -0.92504763563620375522730013075704861944863052404265812459719856088185091,
+   0.92504763563620375522730013075704861944863052404265812459719856088185091,
+  -0.94296040139232850382636481162335158724141815874021217488810983961296196,
+   0.94296040139232850382636481162335158724141815874021217488810983961296196,
+  -0.95849117297392709202956047516597094331710664778284721115812577475703514,
+   0.95849117297392709202956047516597094331710664778284721115812577475703514,
+  -0.97160072337165180644717948254030583515416055392926467745800193891593339,
+   0.97160072337165180644717948254030583515416055392926467745800193891593339,
+  -0.98225594909723664949110312800979247156300120305395084501598221709033339,
+   0.98225594909723664949110312800979247156300120305395084501598221709033339,
+  -0.99042997118929035242807106186068064500231531367714058003215861671366151,
+   0.99042997118929035242807106186068064500231531367714058003215861671366151,
+  -0.99610229631626713288514843047617149263214021727984195773426915709055681,
+   0.99610229631626713288514843047617149263214021727984195773426915709055681,
+  -0.99925985930877702969840846503579893801963446051022185306139551423418719,
+   0.99925985930877702969840846503579893801963446051022185306139551423418719,
+  // Order 63;
+   0,
+  -0.04945218711615962723423381805180760989775545689991594606316301200337425,
+   0.04945218711615962723423381805180760989775545689991594606316301200337425,
+  -0.09878335644694527952970366945392210343955860117894321729223309883236469,
+   0.09878335644694527952970366945392210343955860117894321729223309883236469,
+  -0.14787278635787196856983909655297294344146366408396302911734900665663934,
+   0.14787278635787196856983909655297294344146366408396302911734900665663934,
+  -0.19660034679150668455762745706571769792078300580349275988855047201860717,
+   0.19660034679150668455762745706571769792078300580349275988855047201860717,
+  -0.24484679324595336274840459392482937014834217535821483279903376694643348,
+   0.24484679324595336274840459392482937014834217535821483279903376694643348,
+  -0.29249405858625144003615715555066692368934587193884236970604552487129801,
+   0.29249405858625144003615715555066692368934587193884236970604552487129801,
+  -0.33942554197458440246883443159431508504391804671870448527148420145391405,
+   0.33942554197458440246883443159431508504391804671870448527148420145391405,
+  -0.38552639421224789247761502227439815027504570543713342740705917954278406,
+   0.38552639421224789247761502227439815027504570543713342740705917954278406,
+  -0.43068379879511160066208893391862998206648141720003732528477945292317312,
+   0.43068379879511160066208893391862998206648141720003732528477945292317312,
+  -0.47478724799480439992221230985149474928601795896973316966711836225115911,
+   0.47478724799480439992221230985149474928601795896973316966711836225115911,
+  -0.51772881329003324812447758452631553557737395502174835046316174601568355,
+   0.51772881329003324812447758452631553557737395502174835046316174601568355,
+  -0.55940340948628501326769780007005469654052841560665752733698746575880395,
+   0.55940340948628501326769780007005469654052841560665752733698746575880395,
+  -0.59970905187762523573900892686879986107116952399752914562710897100462168,
+   0.59970905187762523573900892686879986107116952399752914562710897100462168,
+  -0.63854710582136538500030695387337648123329492461318163956158286516017699,
+   0.63854710582136538500030695387337648123329492461318163956158286516017699,
+  -0.67582252811498609013110331596954450877981125472379970647423639886614819,
+   0.67582252811498609013110331596954450877981125472379970647423639886614819,
+  -0.71144409958484580785143153770401487912828251178701249195340107778139063,
+   0.71144409958484580785143153770401487912828251178701249195340107778139063,
+  -0.74532464831784741782932166103758763231460294726194072573502963183661618,
+   0.74532464831784741782932166103758763231460294726194072573502963183661618,
+  -0.77738126299037233556333018991104275575979914204810200254119695026049538,
+   0.77738126299037233556333018991104275575979914204810200254119695026049538,
+  -0.80753549577345676005146598636324313459419236077749630005732100696017067,
+   0.80753549577345676005146598636324313459419236077749630005732100696017067,
+  -0.83571355431950284347180776961570545282361447758388598140006592985930021,
+   0.83571355431950284347180776961570545282361447758388598140006592985930021,
+  -0.86184648236412371953961183943105995399653622521626831383589266763794010,
+   0.86184648236412371953961183943105995399653622521626831383589266763794010,
+  -0.88587032850785342629029845731336987514986846948785371656042312456841470,
+   0.88587032850785342629029845731336987514986846948785371656042312456841470,
+  -0.90772630277853155803695313291595322554779392827565820821769425337851092,
+   0.90772630277853155803695313291595322554779392827565820821769425337851092,
+  -0.92736092062184320544703138132512156945605436106860191751711002600831308,
+   0.92736092062184320544703138132512156945605436106860191751711002600831308,
+  -0.94472613404100980296637531962750066374458068895776698179936366138705419,
+   0.94472613404100980296637531962750066374458068895776698179936366138705419,
+  -0.95977944975894192707035416625898896916541650316165542691431002097238381,
+   0.95977944975894192707035416625898896916541650316165542691431002097238381,
+  -0.97248403469757002280196067857681094816497654120309783825229426366042670,
+   0.97248403469757002280196067857681094816497654120309783825229426366042670,
+  -0.98280881059372723486251140569161173920259916195620734199530573384062428,
+   0.98280881059372723486251140569161173920259916195620734199530573384062428,
+  -0.99072854689218946681089466720470345305426226535032777976683156639717251,
+   0.99072854689218946681089466720470345305426226535032777976683156639717251,
+  -0.99622401277797010860219336114631135329307697185752329787632166639161707,
+   0.99622401277797010860219336114631135329307697185752329787632166639161707,
+  -0.99928298402912378037893614092894446107279671818624281315175615271126840,
+   0.99928298402912378037893614092894446107279671818624281315175615271126840,
+  // Order 64;
+  -0.02435029266342443250895584285371566142688710931497580916345316639605670,
+   0.02435029266342443250895584285371566142688710931497580916345316639605670,
+  -0.07299312178779903944954294194033749324412618166877885335631633233773952,
+   0.07299312178779903944954294194033749324412618166877885335631633233773952,
+  -0.12146281929612055447037646349224787821868363833719129404234958260069318,
+   0.12146281929612055447037646349224787821868363833719129404234958260069318,
+  -0.16964442042399281803731362974826984419999026673437785058941787468843424,
+   0.16964442042399281803731362974826984419999026673437785058941787468843424,
+  -0.21742364374000708414964874898882261757848583114122234863038040188568963,
+   0.21742364374000708414964874898882261757848583114122234863038040188568963,
+  -0.26468716220876741637396417251002011798041313629509324395598954481262064,
+   0.26468716220876741637396417251002011798041313629509324395598954481262064,
+  -0.31132287199021095615751269856015688355771535786805012699545717098581691,
+   0.31132287199021095615751269856015688355771535786805012699545717098581691,
+  -0.35722015833766811595044261504620253162626446464090911202123701934009918,
+   0.35722015833766811595044261504620253162626446464090911202123701934009918,
+  -0.40227015796399160369576677126015884871326520561502080827604318431290872,
+   0.40227015796399160369576677126015884871326520561502080827604318431290872,
+  -0.44636601725346408798494771475891518920675075782625017630826068202129376,
+   0.44636601725346408798494771475891518920675075782625017630826068202129376,
+  -0.48940314570705295747852630702192139084937329746373983733165407932403156,
+   0.48940314570705295747852630702192139084937329746373983733165407932403156,
+  -0.53127946401989454565801390354445524740852558873418023805326804716604178,
+   0.53127946401989454565801390354445524740852558873418023805326804716604178,
+  -0.57189564620263403428387811665918864318319100609125099322732847194189122,
+   0.57189564620263403428387811665918864318319100609125099322732847194189122,
+  -0.61115535517239325024885297101854891869612455930797184433679766669330884,
+   0.61115535517239325024885297101854891869612455930797184433679766669330884,
+  -0.64896547125465733985776123199340488552969043347320117287925026243660576,
+   0.64896547125465733985776123199340488552969043347320117287925026243660576,
+  -0.68523631305423324256355837103137630193564107853967186813240427499136120,
+   0.68523631305423324256355837103137630193564107853967186813240427499136120,
+  -0.71988185017161082684894021783194724475813800331490195262204731511844686,
+   0.71988185017161082684894021783194724475813800331490195262204731511844686,
+  -0.75281990726053189661186377488569398555171427132208719324619877611677226,
+   0.75281990726053189661186377488569398555171427132208719324619877611677226,
+  -0.78397235894334140761022052521376828405641412498982593341327596174768166,
+   0.78397235894334140761022052521376828405641412498982593341327596174768166,
+  -0.81326531512279755974192333808630334069814182256559721669564851493565863,
+   0.81326531512279755974192333808630334069814182256559721669564851493565863,
+  -0.84062929625258036275169154469587330298248982380175535392820268307559347,
+   0.84062929625258036275169154469587330298248982380175535392820268307559347,
+  -0.86599939815409281976078338507015750241250191875824964256642795118083567,
+   0.86599939815409281976078338507015750241250191875824964256642795118083567,
+  -0.88931544599511410585340403827285162242919446151045218931947445660848111,
+   0.88931544599511410585340403827285162242919446151045218931947445660848111,
+  -0.91052213707850280575638066800832986101348808488836402925317237144671022,
+   0.91052213707850280575638066800832986101348808488836402925317237144671022,
+  -0.92956917213193957582149015455922560734742701442971549759281168336124310,
+   0.92956917213193957582149015455922560734742701442971549759281168336124310,
+  -0.94641137485840281606248149134726479527939497179523319023177897129736644,
+   0.94641137485840281606248149134726479527939497179523319023177897129736644,
+  -0.96100879965205371891861412189715720676211461103784594944615861586239199,
+   0.96100879965205371891861412189715720676211461103784594944615861586239199,
+  -0.97332682778991096374185350735227266802614529445517417588191397819781523,
+   0.97332682778991096374185350735227266802614529445517417588191397819781523,
+  -0.98333625388462595693129930215683111694524750662374038374648721312334261,
+   0.98333625388462595693129930215683111694524750662374038374648721312334261,
+  -0.99101337147674432073938238344330311364134944539079048522254274593781317,
+   0.99101337147674432073938238344330311364134944539079048522254274593781317,
+  -0.99634011677195527934692450067639912320985750634022661213525221995070306,
+   0.99634011677195527934692450067639912320985750634022661213525221995070306,
+  -0.99930504173577213945690562434563631196971219167560877606280729546176465,
+   0.99930504173577213945690562434563631196971219167560877606280729546176465
+};
+
+constexpr double weight_table[] = {
+  // Order 1;
+   2.00000000000000000000000000000000000000000000000000000000000000000000000,
+  // Order 2;
+   1.00000000000000000000000000000000000000000000000000000000000000000000000,
+   1.00000000000000000000000000000000000000000000000000000000000000000000000,
+  // Order 3;
+   0.55555555555555555555555555555555555555555555555555555555555555555555556,
+   0.88888888888888888888888888888888888888888888888888888888888888888888889,
+   0.55555555555555555555555555555555555555555555555555555555555555555555556,
+  // Order 4;
+   0.34785484513745385737306394922199940723534869583389354049252931951875187,
+   0.65214515486254614262693605077800059276465130416610645950747068048124813,
+   0.65214515486254614262693605077800059276465130416610645950747068048124813,
+   0.34785484513745385737306394922199940723534869583389354049252931951875187,
+  // Order 5;
+   0.23692688505618908751426404071991736264326000221241401558282788822171729,
+   0.47862867049936646804129151483563819291229555334314153997272766733383827,
+   0.56888888888888888888888888888888888888888888888888888888888888888888889,
+   0.47862867049936646804129151483563819291229555334314153997272766733383827,
+   0.23692688505618908751426404071991736264326000221241401558282788822171729,
+  // Order 6;
+   0.36076157304813860756983351383771611166152189274674548228973924023714004,
+   0.36076157304813860756983351383771611166152189274674548228973924023714004,
+   0.46791393457269104738987034398955099481165560576921053531162531996391420,
+   0.46791393457269104738987034398955099481165560576921053531162531996391420,
+   0.17132449237917034504029614217273289352682250148404398239863543979894576,
+   0.17132449237917034504029614217273289352682250148404398239863543979894576,
+  // Order 7;
+   0.41795918367346938775510204081632653061224489795918367346938775510204082,
+   0.38183005050511894495036977548897513387836508353386273475108345103070555,
+   0.38183005050511894495036977548897513387836508353386273475108345103070555,
+   0.27970539148927666790146777142377958248692506522659876453701403269361881,
+   0.27970539148927666790146777142377958248692506522659876453701403269361881,
+   0.12948496616886969327061143267908201832858740225994666397720863872465523,
+   0.12948496616886969327061143267908201832858740225994666397720863872465523,
+  // Order 8;
+   0.10122853629037625915253135430996219011539409105168495705900369806474018,
+   0.22238103445337447054435599442624088443013087005124956472590928929361681,
+   0.31370664587788728733796220198660131326032899900273493769026394507495627,
+   0.36268378337836198296515044927719561219414603989433054052482306756668673,
+   0.36268378337836198296515044927719561219414603989433054052482306756668673,
+   0.31370664587788728733796220198660131326032899900273493769026394507495627,
+   0.22238103445337447054435599442624088443013087005124956472590928929361681,
+   0.10122853629037625915253135430996219011539409105168495705900369806474018,
+  // Order 9;
+   0.33023935500125976316452506928697404887881078357268833459309649785840262,
+   0.18064816069485740405847203124291280951433782173204048449833590647135729,
+   0.18064816069485740405847203124291280951433782173204048449833590647135729,
+   0.08127438836157441197189215811052365067566172078241075071110767688068669,
+   0.08127438836157441197189215811052365067566172078241075071110767688068669,
+   0.31234707704000284006863040658444366559875486126190464555401116559914390,
+   0.31234707704000284006863040658444366559875486126190464555401116559914390,
+   0.26061069640293546231874286941863284977184020443729995193999700211961082,
+   0.26061069640293546231874286941863284977184020443729995193999700211961082,
+  // Order 10;
+   0.29552422471475287017389299465133832942104671702685360135430802975599594,
+   0.29552422471475287017389299465133832942104671702685360135430802975599594,
+   0.26926671930999635509122692156946935285975993846088379580056327624215343,
+   0.26926671930999635509122692156946935285975993846088379580056327624215343,
+   0.21908636251598204399553493422816319245877187052267708988095654363519991,
+   0.21908636251598204399553493422816319245877187052267708988095654363519991,
+   0.14945134915058059314577633965769733240255663966942736783547726875323865,
+   0.14945134915058059314577633965769733240255663966942736783547726875323865,
+   0.06667134430868813759356880989333179285786483432015814512869488161341206,
+   0.06667134430868813759356880989333179285786483432015814512869488161341206,
+  // Order 11;
+   0.27292508677790063071448352833634218915604196989478374759760041145322531,
+   0.26280454451024666218068886989050919537276467760314455638005537148551280,
+   0.26280454451024666218068886989050919537276467760314455638005537148551280,
+   0.23319376459199047991852370484317513943179817231695850902731972212193221,
+   0.23319376459199047991852370484317513943179817231695850902731972212193221,
+   0.18629021092773425142609764143165589169128474804020341178150640417387235,
+   0.18629021092773425142609764143165589169128474804020341178150640417387235,
+   0.12558036946490462463469429922394010019761579139540350066393401081791458,
+   0.12558036946490462463469429922394010019761579139540350066393401081791458,
+   0.05566856711617366648275372044254857872851562569689814834838428567415541,
+   0.05566856711617366648275372044254857872851562569689814834838428567415541,
+  // Order 12;
+   0.24914704581340278500056243604295121083046090256961883139535100311627943,
+   0.24914704581340278500056243604295121083046090256961883139535100311627943,
+   0.23349253653835480876084989892487805625940997219975487473052349782149200,
+   0.23349253653835480876084989892487805625940997219975487473052349782149200,
+   0.20316742672306592174906445580979837650651814727459014639859456579764563,
+   0.20316742672306592174906445580979837650651814727459014639859456579764563,
+   0.16007832854334622633465252954335907187201173049086417790989954415795423,
+   0.16007832854334622633465252954335907187201173049086417790989954415795423,
+   0.10693932599531843096025471819399622421457017347032488000512604210281899,
+   0.10693932599531843096025471819399622421457017347032488000512604210281899,
+   0.04717533638651182719461596148501706031702907399484708956050534700380972,
+   0.04717533638651182719461596148501706031702907399484708956050534700380972,
+  // Order 13;
+   0.23255155323087391019458951526883594815662747730679798611866543934476002,
+   0.22628318026289723841209018603977661843475773761555701986496854877157566,
+   0.22628318026289723841209018603977661843475773761555701986496854877157566,
+   0.20781604753688850231252321930605276338658260919950354921911111991653854,
+   0.20781604753688850231252321930605276338658260919950354921911111991653854,
+   0.17814598076194573828004669199609799551281265066101650298679444028914507,
+   0.17814598076194573828004669199609799551281265066101650298679444028914507,
+   0.13887351021978723846360177686887146762186271826329822764635501650577252,
+   0.13887351021978723846360177686887146762186271826329822764635501650577252,
+   0.09212149983772844791442177595379712092368399986223683908839154733959373,
+   0.09212149983772844791442177595379712092368399986223683908839154733959373,
+   0.04048400476531587952002159220098606004198654574498886813504660750499446,
+   0.04048400476531587952002159220098606004198654574498886813504660750499446,
+  // Order 14;
+   0.21526385346315779019587644331626003527499755805412880021977639254361879,
+   0.21526385346315779019587644331626003527499755805412880021977639254361879,
+   0.20519846372129560396592406566121805571033906130941945171689729028336714,
+   0.20519846372129560396592406566121805571033906130941945171689729028336714,
+   0.18553839747793781374171659012515703624892260293733165902003492506909835,
+   0.18553839747793781374171659012515703624892260293733165902003492506909835,
+   0.15720316715819353456960193862384215660566803733732337496931704387476818,
+   0.15720316715819353456960193862384215660566803733732337496931704387476818,
+   0.12151857068790318468941480907247662595666934569007467229107539254315974,
+   0.12151857068790318468941480907247662595666934569007467229107539254315974,
+   0.08015808715976020980563327706285430958369778539459476520139906548957147,
+   0.08015808715976020980563327706285430958369778539459476520139906548957147,
+   0.03511946033175186303183287613819178061970560927712727658149989019641632,
+   0.03511946033175186303183287613819178061970560927712727658149989019641632,
+  // Order 15;
+   0.20257824192556127288062019996751931483866215800947735679670411605143540,
+   0.19843148532711157645611832644383932481869255995754199348473792792912480,
+   0.19843148532711157645611832644383932481869255995754199348473792792912480,
+   0.18616100001556221102680056186642282450622601227792840281549572731001326,
+   0.18616100001556221102680056186642282450622601227792840281549572731001326,
+   0.16626920581699393355320086048120881113090018009841290732186519056355356,
+   0.16626920581699393355320086048120881113090018009841290732186519056355356,
+   0.13957067792615431444780479451102832252085027531551124320239112863108844,
+   0.13957067792615431444780479451102832252085027531551124320239112863108844,
+   0.10715922046717193501186954668586930341554371575810198068702238912187799,
+   0.10715922046717193501186954668586930341554371575810198068702238912187799,
+   0.07036604748810812470926741645066733846670803275433071982590729291438706,
+   0.07036604748810812470926741645066733846670803275433071982590729291438706,
+   0.03075324199611726835462839357720441772174814483343407426422828550423719,
+   0.03075324199611726835462839357720441772174814483343407426422828550423719,
+  // Order 16;
+   0.18945061045506849628539672320828310514690898839590297503751324520002289,
+   0.18945061045506849628539672320828310514690898839590297503751324520002289,
+   0.18260341504492358886676366796921993938355622365464928241849514437943046,
+   0.18260341504492358886676366796921993938355622365464928241849514437943046,
+   0.16915651939500253818931207903035996221163947341602828174508293568080366,
+   0.16915651939500253818931207903035996221163947341602828174508293568080366,
+   0.14959598881657673208150173054747854897049106820783646680542196218736040,
+   0.14959598881657673208150173054747854897049106820783646680542196218736040,
+   0.12462897125553387205247628219201642014488685922220267994475059042941096,
+   0.12462897125553387205247628219201642014488685922220267994475059042941096,
+   0.09515851168249278480992510760224622635526350318371265815682228722963176,
+   0.09515851168249278480992510760224622635526350318371265815682228722963176,
+   0.06225352393864789286284383699437769427498650835290685790130351581953574,
+   0.06225352393864789286284383699437769427498650835290685790130351581953574,
+   0.02715245941175409485178057245601810351226737556676079799061031907380411,
+   0.02715245941175409485178057245601810351226737556676079799061031907380411,
+  // Order 17;
+   0.17944647035620652545826564426188562144878031989766852366766869795559675,
+   0.17656270536699264632527099011319723915092441800074811804314440691320904,
+   0.17656270536699264632527099011319723915092441800074811804314440691320904,
+   0.16800410215645004450997066378832315502119812896507401426995585134032311,
+   0.16800410215645004450997066378832315502119812896507401426995585134032311,
+   0.15404576107681028808143159480195861194048305847101793438526471135144674,
+   0.15404576107681028808143159480195861194048305847101793438526471135144674,
+   0.13513636846852547328631998170235019737212585323448902037799461068886724,
+   0.13513636846852547328631998170235019737212585323448902037799461068886724,
+   0.11188384719340397109478838562635592673584342426307705001848648244909568,
+   0.11188384719340397109478838562635592673584342426307705001848648244909568,
+   0.08503614831717918088353537019106207385049138921850547576641036073878399,
+   0.08503614831717918088353537019106207385049138921850547576641036073878399,
+   0.05545952937398720112944016535824466051284625195322884699372407871025743,
+   0.05545952937398720112944016535824466051284625195322884699372407871025743,
+   0.02414830286854793196011002628756532469169731594502527831118514883021840,
+   0.02414830286854793196011002628756532469169731594502527831118514883021840,
+  // Order 18;
+   0.16914238296314359184065647013498661033410581937034388026987519154905944,
+   0.16914238296314359184065647013498661033410581937034388026987519154905944,
+   0.16427648374583272298605377646592759041233895399735295324449697091164842,
+   0.16427648374583272298605377646592759041233895399735295324449697091164842,
+   0.15468467512626524492541800383637477219321839626735417266664191472778287,
+   0.15468467512626524492541800383637477219321839626735417266664191472778287,
+   0.14064291467065065120473130375194722809550241033097255988345619526046559,
+   0.14064291467065065120473130375194722809550241033097255988345619526046559,
+   0.12255520671147846018451912680020155522816389733343909716725351365405744,
+   0.12255520671147846018451912680020155522816389733343909716725351365405744,
+   0.10094204410628716556281398492483460706280113888767890161037453665565080,
+   0.10094204410628716556281398492483460706280113888767890161037453665565080,
+   0.07642573025488905652912967761663652560531790620835828744952137923441001,
+   0.07642573025488905652912967761663652560531790620835828744952137923441001,
+   0.04971454889496979645333494620263864168086624612891020224630430786557234,
+   0.04971454889496979645333494620263864168086624612891020224630430786557234,
+   0.02161601352648331031334271026645246938768523147558994546207599014135309,
+   0.02161601352648331031334271026645246938768523147558994546207599014135309,
+  // Order 19;
+   0.16105444984878369597916362532091673503990255857851690212832315273577105,
+   0.15896884339395434764995643946504720167878015819512609575117491532474098,
+   0.15896884339395434764995643946504720167878015819512609575117491532474098,
+   0.15276604206585966677885540089766299846100826723642862352310155307481104,
+   0.15276604206585966677885540089766299846100826723642862352310155307481104,
+   0.14260670217360661177574610944190297247566834482447386092657165590645825,
+   0.14260670217360661177574610944190297247566834482447386092657165590645825,
+   0.12875396253933622767551578485687711705583957709346303454710438462230360,
+   0.12875396253933622767551578485687711705583957709346303454710438462230360,
+   0.11156664554733399471602390168176599748133185383989377552146114287645898,
+   0.11156664554733399471602390168176599748133185383989377552146114287645898,
+   0.09149002162244999946446209412383965266091165129659878466498934490206222,
+   0.09149002162244999946446209412383965266091165129659878466498934490206222,
+   0.06904454273764122658070825800601304496184803168761313112290042769603497,
+   0.06904454273764122658070825800601304496184803168761313112290042769603497,
+   0.04481422676569960033283815740199421195175422746785760208585452676764299,
+   0.04481422676569960033283815740199421195175422746785760208585452676764299,
+   0.01946178822972647703631204146443843575290660906928664079268047246160144,
+   0.01946178822972647703631204146443843575290660906928664079268047246160144,
+  // Order 20;
+   0.01761400713915211831186196235185281636214310554333673252434932667734842,
+   0.04060142980038694133103995227493210987909063998995153681760685456183230,
+   0.06267204833410906356950653518704160635160107657843636409958434543797481,
+   0.08327674157670474872475814322204620610017782858316329074488206078569308,
+   0.10193011981724043503675013548034987616669165602339255626197161619685232,
+   0.11819453196151841731237737771138228700504121954896877544688995202017475,
+   0.13168863844917662689849449974816313491611051114698352699643649370885436,
+   0.14209610931838205132929832506716493303451541339202030333736708298382809,
+   0.14917298647260374678782873700196943669267990408136831649621121780984442,
+   0.15275338713072585069808433195509759349194864511237859727470104981759745,
+   0.15275338713072585069808433195509759349194864511237859727470104981759745,
+   0.14917298647260374678782873700196943669267990408136831649621121780984442,
+   0.14209610931838205132929832506716493303451541339202030333736708298382809,
+   0.13168863844917662689849449974816313491611051114698352699643649370885436,
+   0.11819453196151841731237737771138228700504121954896877544688995202017475,
+   0.10193011981724043503675013548034987616669165602339255626197161619685232,
+   0.08327674157670474872475814322204620610017782858316329074488206078569308,
+   0.06267204833410906356950653518704160635160107657843636409958434543797481,
+   0.04060142980038694133103995227493210987909063998995153681760685456183230,
+   0.01761400713915211831186196235185281636214310554333673252434932667734842,
+  // Order 21;
+   0.14608113364969042719198514768337118824480957694196544410732258751543859,
+   0.14452440398997005906382716655375254360994996219709983475247298888609731,
+   0.14452440398997005906382716655375254360994996219709983475247298888609731,
+   0.13988739479107315472213342386758311089279316095491960437373132632424326,
+   0.13988739479107315472213342386758311089279316095491960437373132632424326,
+   0.13226893863333746178105257449677560432901154014315682321835032315178260,
+   0.13226893863333746178105257449677560432901154014315682321835032315178260,
+   0.12183141605372853419536717712573359835633762556153745024298380784275890,
+   0.12183141605372853419536717712573359835633762556153745024298380784275890,
+   0.10879729916714837766347457807010564203369959579385633055278208716897364,
+   0.10879729916714837766347457807010564203369959579385633055278208716897364,
+   0.09344442345603386155328974111393208848352664736159284486669527163257790,
+   0.09344442345603386155328974111393208848352664736159284486669527163257790,
+   0.07610011362837930201705165330018317922615435242396602852146848581645352,
+   0.07610011362837930201705165330018317922615435242396602852146848581645352,
+   0.05713442542685720828363582647244795749128759682625604144250732342704906,
+   0.05713442542685720828363582647244795749128759682625604144250732342704906,
+   0.03695378977085249379995066829932966618894430814872983742716918187878575,
+   0.03695378977085249379995066829932966618894430814872983742716918187878575,
+   0.01601722825777433332422461685847101526589042211790248254817791011355877,
+   0.01601722825777433332422461685847101526589042211790248254817791011355877,
+  // Order 22;
+   0.13925187285563199337541024834180995787392021745742585812619787707303771,
+   0.13925187285563199337541024834180995787392021745742585812619787707303771,
+   0.13654149834601517135257383123151739658636765298868616810946973493820756,
+   0.13654149834601517135257383123151739658636765298868616810946973493820756,
+   0.13117350478706237073296499253030744587574189418803065312537970342454461,
+   0.13117350478706237073296499253030744587574189418803065312537970342454461,
+   0.12325237681051242428556098615481447195944499900496797242842197188513550,
+   0.12325237681051242428556098615481447195944499900496797242842197188513550,
+   0.11293229608053921839340060742178431911426333212099470427259754624861313,
+   0.11293229608053921839340060742178431911426333212099470427259754624861313,
+   0.10041414444288096493207883783053628235081108876769962578496091434045310,
+   0.10041414444288096493207883783053628235081108876769962578496091434045310,
+   0.08594160621706772741444368137270286618914440534907978328657001104824602,
+   0.08594160621706772741444368137270286618914440534907978328657001104824602,
+   0.06979646842452048809496141893021765739877505295508052738631137176394640,
+   0.06979646842452048809496141893021765739877505295508052738631137176394640,
+   0.05229333515268328594031205127321125611215009356923631612271008329767634,
+   0.05229333515268328594031205127321125611215009356923631612271008329767634,
+   0.03377490158481415479330224686591290134916931447447466043288319455995151,
+   0.03377490158481415479330224686591290134916931447447466043288319455995151,
+   0.01462799529827220068499109804718544519021194912432373092449759142018811,
+   0.01462799529827220068499109804718544519021194912432373092449759142018811,
+  // Order 23;
+   0.13365457218610617535145711054584433858315280763688331748193597799144098,
+   0.13246203940469661737164246470331692580503566947422352432251226803848601,
+   0.13246203940469661737164246470331692580503566947422352432251226803848601,
+   0.12890572218808214997859533939979365325971549719178349244434043171798946,
+   0.12890572218808214997859533939979365325971549719178349244434043171798946,
+   0.12304908430672953046757840067200965481585281254647057443567033290169047,
+   0.12304908430672953046757840067200965481585281254647057443567033290169047,
+   0.11499664022241136494164351293396130149141052292958560660907570340279959,
+   0.11499664022241136494164351293396130149141052292958560660907570340279959,
+   0.10489209146454141007408618501474385485847158319397500550282519233877938,
+   0.10489209146454141007408618501474385485847158319397500550282519233877938,
+   0.09291576606003514747701861736976464860346007174312989373265950461193728,
+   0.09291576606003514747701861736976464860346007174312989373265950461193728,
+   0.07928141177671895492289252474204322691371199193840650255563454033204300,
+   0.07928141177671895492289252474204322691371199193840650255563454033204300,
+   0.06423242140852585212716961515891099803915827575480683049534668205291755,
+   0.06423242140852585212716961515891099803915827575480683049534668205291755,
+   0.04803767173108466857164107163203399656121630830351161133368366686985809,
+   0.04803767173108466857164107163203399656121630830351161133368366686985809,
+   0.03098800585697944431069421964188450538377252899992806643488780659861778,
+   0.03098800585697944431069421964188450538377252899992806643488780659861778,
+   0.01341185948714177208130949345861506497661833410573723339239588213916089,
+   0.01341185948714177208130949345861506497661833410573723339239588213916089,
+  // Order 24;
+   0.12793819534675215697405616522469537185171123954166788242129957637234759,
+   0.12793819534675215697405616522469537185171123954166788242129957637234759,
+   0.12583745634682829612137538251118368872640332558134540417809151688139387,
+   0.12583745634682829612137538251118368872640332558134540417809151688139387,
+   0.12167047292780339120446315347626242560702955920380577877747175451262539,
+   0.12167047292780339120446315347626242560702955920380577877747175451262539,
+   0.11550566805372560135334448390678355986227031137649647058444936008867025,
+   0.11550566805372560135334448390678355986227031137649647058444936008867025,
+   0.10744427011596563478257734244660622279462869013422002176654164088682187,
+   0.10744427011596563478257734244660622279462869013422002176654164088682187,
+   0.09761865210411388826988066446424715442791896885368594408331061002295434,
+   0.09761865210411388826988066446424715442791896885368594408331061002295434,
+   0.08619016153195327591718520298374266718508058823793300558840714386128688,
+   0.08619016153195327591718520298374266718508058823793300558840714386128688,
+   0.07334648141108030573403361525311651811933650984849947140270249066004139,
+   0.07334648141108030573403361525311651811933650984849947140270249066004139,
+   0.05929858491543678074636775850010858454120012656521349103737655129409830,
+   0.05929858491543678074636775850010858454120012656521349103737655129409830,
+   0.04427743881741980616860274821133822885931284183385789674139722972102438,
+   0.04427743881741980616860274821133822885931284183385789674139722972102438,
+   0.02853138862893366318130781595187828644919779793190811660166480475764401,
+   0.02853138862893366318130781595187828644919779793190811660166480475764401,
+   0.01234122979998719954680566707003729157591004089136651681728732094109173,
+   0.01234122979998719954680566707003729157591004089136651681728732094109173,
+  // Order 25;
+   0.12317605372671545120390287307905014243823362751815166539135219731691201,
+   0.12224244299031004168895951894585150583505924756305904090758008223203897,
+   0.12224244299031004168895951894585150583505924756305904090758008223203897,
+   0.11945576353578477222817812651290104739017670141372642551958788133518409,
+   0.11945576353578477222817812651290104739017670141372642551958788133518409,
+   0.11485825914571164833932554586955580864093619166818014959151499003148280,
+   0.11485825914571164833932554586955580864093619166818014959151499003148280,
+   0.10851962447426365311609395705011661934007758798672201615649430734883929,
+   0.10851962447426365311609395705011661934007758798672201615649430734883929,
+   0.10053594906705064420220689039268582698846609452814190706986904199941295,
+   0.10053594906705064420220689039268582698846609452814190706986904199941295,
+   0.09102826198296364981149722070289165338099255895933431097048376896701738,
+   0.09102826198296364981149722070289165338099255895933431097048376896701738,
+   0.08014070033500101801323495966911130229022573285367589371620146297361283,
+   0.08014070033500101801323495966911130229022573285367589371620146297361283,
+   0.06803833381235691720718718565670796855470949435463656261507122147483647,
+   0.06803833381235691720718718565670796855470949435463656261507122147483647,
+   0.05490469597583519192593689154047332416010998555311134904850849824459377,
+   0.05490469597583519192593689154047332416010998555311134904850849824459377,
+   0.04093915670130631265562348771164595366084578336410434650469841489929743,
+   0.04093915670130631265562348771164595366084578336410434650469841489929743,
+   0.02635498661503213726190181529529914493596328170332246875536616578387093,
+   0.02635498661503213726190181529529914493596328170332246875536616578387093,
+   0.01139379850102628794790296411323477360332052629290969644894806111618989,
+   0.01139379850102628794790296411323477360332052629290969644894806111618989,
+  // Order 26;
+   0.11832141527926227651637108570046868464989027082890531809432019937962069,
+   0.11832141527926227651637108570046868464989027082890531809432019937962069,
+   0.11666044348529658204466250754036221363196488122192421646016269721126567,
+   0.11666044348529658204466250754036221363196488122192421646016269721126567,
+   0.11336181654631966654944071844259814524595036292501521398828792988748911,
+   0.11336181654631966654944071844259814524595036292501521398828792988748911,
+   0.10847184052857659065657942672799758228943820342130664452960570860946140,
+   0.10847184052857659065657942672799758228943820342130664452960570860946140,
+   0.10205916109442542323841407025343079232720881135424201033187381940865267,
+   0.10205916109442542323841407025343079232720881135424201033187381940865267,
+   0.09421380035591414846366488306730319854916574591420727986331490236803450,
+   0.09421380035591414846366488306730319854916574591420727986331490236803450,
+   0.08504589431348523921044776507998169658392031677667827618605618141998779,
+   0.08504589431348523921044776507998169658392031677667827618605618141998779,
+   0.07468414976565974588707579610284833863874716188104068077903084174281963,
+   0.07468414976565974588707579610284833863874716188104068077903084174281963,
+   0.06327404632957483553945368990704509572222284201269451066609588660798839,
+   0.06327404632957483553945368990704509572222284201269451066609588660798839,
+   0.05097582529714781199831990072407337952587931854297193482383768599941731,
+   0.05097582529714781199831990072407337952587931854297193482383768599941731,
+   0.03796238329436276395030314124885049469077042174404895767531182465280790,
+   0.03796238329436276395030314124885049469077042174404895767531182465280790,
+   0.02441785109263190878961582751978840024049592619727034205204689507569172,
+   0.02441785109263190878961582751978840024049592619727034205204689507569172,
+   0.01055137261734300715565118768525197790434573717969461455005542763676322,
+   0.01055137261734300715565118768525197790434573717969461455005542763676322,
+  // Order 27;
+   0.11422086737895698904504573690183524868072144335016533032174771657919413,
+   0.11347634610896514862036994809209925792052451881047202589641654957702234,
+   0.11347634610896514862036994809209925792052451881047202589641654957702234,
+   0.11125248835684519267216309604284867483292038008508326709640350969793208,
+   0.11125248835684519267216309604284867483292038008508326709640350969793208,
+   0.10757828578853318721216298442665740481896609906376466551235890651519449,
+   0.10757828578853318721216298442665740481896609906376466551235890651519449,
+   0.10250163781774579867124771153266380932440989491471732986978183238298748,
+   0.10250163781774579867124771153266380932440989491471732986978183238298748,
+   0.09608872737002850756565264655810585916021162953702933442813111353401513,
+   0.09608872737002850756565264655810585916021162953702933442813111353401513,
+   0.08842315854375695019432280285374911105653675005109910980587113709659270,
+   0.08842315854375695019432280285374911105653675005109910980587113709659270,
+   0.07960486777305777126307495900984240297614667298700295141340876380275273,
+   0.07960486777305777126307495900984240297614667298700295141340876380275273,
+   0.06974882376624559298432288835666727613282469325695200037741878162105936,
+   0.06974882376624559298432288835666727613282469325695200037741878162105936,
+   0.05898353685983359911030083371953163316524059070641216254021521491382113,
+   0.05898353685983359911030083371953163316524059070641216254021521491382113,
+   0.04744941252061506270409671011418471822472562016618472851731001266917821,
+   0.04744941252061506270409671011418471822472562016618472851731001266917821,
+   0.03529705375741971102257828930471164113613888952294181158222778509490883,
+   0.03529705375741971102257828930471164113613888952294181158222778509490883,
+   0.02268623159618062319603420644676148881276772028816635563144213023907583,
+   0.02268623159618062319603420644676148881276772028816635563144213023907583,
+   0.00979899605129436026115005509125909809822581893509159216814040456586263,
+   0.00979899605129436026115005509125909809822581893509159216814040456586263,
+  // Order 28;
+   0.11004701301647519628237626560181761395662552949123163327866810122961241,
+   0.11004701301647519628237626560181761395662552949123163327866810122961241,
+   0.10871119225829413525357151930367336787527845466604396765712117047731333,
+   0.10871119225829413525357151930367336787527845466604396765712117047731333,
+   0.10605576592284641791041643699681082878992296268515951683062029628592251,
+   0.10605576592284641791041643699681082878992296268515951683062029628592251,
+   0.10211296757806076981421663850571213504658000235792054093397545220284640,
+   0.10211296757806076981421663850571213504658000235792054093397545220284640,
+   0.09693065799792991585048900609544060176503312335646160495687628181436939,
+   0.09693065799792991585048900609544060176503312335646160495687628181436939,
+   0.09057174439303284094218603133678412982285748545448487237586853385445672,
+   0.09057174439303284094218603133678412982285748545448487237586853385445672,
+   0.08311341722890121839039649824433247986113441344385133299635567173254245,
+   0.08311341722890121839039649824433247986113441344385133299635567173254245,
+   0.07464621423456877902393188717302203802163586120633344743932005621496384,
+   0.07464621423456877902393188717302203802163586120633344743932005621496384,
+   0.06527292396699959579339756677550463635363543116260702633548481815207689,
+   0.06527292396699959579339756677550463635363543116260702633548481815207689,
+   0.05510734567571674543148291822694559121905796422566538840689275397294262,
+   0.05510734567571674543148291822694559121905796422566538840689275397294262,
+   0.04427293475900422783958787765320739061499411270856684371514706188422418,
+   0.04427293475900422783958787765320739061499411270856684371514706188422418,
+   0.03290142778230437997763081917053204598153081742009718785926162060376464,
+   0.03290142778230437997763081917053204598153081742009718785926162060376464,
+   0.02113211259277125975150038099326543445136935072328563779766849025106516,
+   0.02113211259277125975150038099326543445136935072328563779766849025106516,
+   0.00912428259309451773881615392295170624034449109829099941673969132389946,
+   0.00912428259309451773881615392295170624034449109829099941673969132389946,
+  // Order 29;
+   0.10647938171831424424651112690967756833018503161299597975297290106788132,
+   0.10587615509732094140659132785218789307483131374227803982815534552502264,
+   0.10587615509732094140659132785218789307483131374227803982815534552502264,
+   0.10407331007772937391332847128512006891065222067546769164369405414788030,
+   0.10407331007772937391332847128512006891065222067546769164369405414788030,
+   0.10109127375991496612182054690749736364756727885252519912283202330577702,
+   0.10109127375991496612182054690749736364756727885252519912283202330577702,
+   0.09696383409440860630190007488268875917635627792180356426049546674623288,
+   0.09696383409440860630190007488268875917635627792180356426049546674623288,
+   0.09173775713925876334796641107711080689822902098195457127582987469869372,
+   0.09173775713925876334796641107711080689822902098195457127582987469869372,
+   0.08547225736617252754534484929720807138169825661359339532189074338243199,
+   0.08547225736617252754534484929720807138169825661359339532189074338243199,
+   0.07823832713576378382814488865968033136687907695966970946757519532476054,
+   0.07823832713576378382814488865968033136687907695966970946757519532476054,
+   0.07011793325505127856958148694887917310239488867477358191480742147483647,
+   0.07011793325505127856958148694887917310239488867477358191480742147483647,
+   0.06120309065707913854210984802390704492406453977913020831787741211199444,
+   0.06120309065707913854210984802390704492406453977913020831787741211199444,
+   0.05159482690249792391259438117954259791962211064614206768186283132730412,
+   0.05159482690249792391259438117954259791962211064614206768186283132730412,
+   0.04140206251868283610483001011407692153349078038857439725792487943479244,
+   0.04140206251868283610483001011407692153349078038857439725792487943479244,
+   0.03074049220209362264440852537461674974711626096870951032208435936635163,
+   0.03074049220209362264440852537461674974711626096870951032208435936635163,
+   0.01973208505612270598385980164039563114960656819036158765605384467534436,
+   0.01973208505612270598385980164039563114960656819036158765605384467534436,
+   0.00851690387874640965426381330224980300239888979851848605243009455946529,
+   0.00851690387874640965426381330224980300239888979851848605243009455946529,
+  // Order 30;
+   0.10285265289355884034128563670541504386837555706492822258631898667601624,
+   0.10285265289355884034128563670541504386837555706492822258631898667601624,
+   0.10176238974840550459642895216855404463270628948712684086426094541964251,
+   0.10176238974840550459642895216855404463270628948712684086426094541964251,
+   0.09959342058679526706278028210356947652986926366670427722136514618394666,
+   0.09959342058679526706278028210356947652986926366670427722136514618394666,
+   0.09636873717464425963946862635180986509640646143016024591299427573283753,
+   0.09636873717464425963946862635180986509640646143016024591299427573283753,
+   0.09212252223778612871763270708761876719691323441823410752767504700197305,
+   0.09212252223778612871763270708761876719691323441823410752767504700197305,
+   0.08689978720108297980238753071512570257675332874354534401222212988215358,
+   0.08689978720108297980238753071512570257675332874354534401222212988215358,
+   0.08075589522942021535469493846052973087589280370843929989025859370605118,
+   0.08075589522942021535469493846052973087589280370843929989025859370605118,
+   0.07375597473770520626824385002219073415377052603704943894126918237459940,
+   0.07375597473770520626824385002219073415377052603704943894126918237459940,
+   0.06597422988218049512812851511596236123744295365666037896703151604214367,
+   0.06597422988218049512812851511596236123744295365666037896703151604214367,
+   0.05749315621761906648172168940205612879712067072176313454871579900323215,
+   0.05749315621761906648172168940205612879712067072176313454871579900323215,
+   0.04840267283059405290293814042280751781527180919737273634519193679180543,
+   0.04840267283059405290293814042280751781527180919737273634519193679180543,
+   0.03879919256962704959680193644634769203320097676639535210773278970594697,
+   0.03879919256962704959680193644634769203320097676639535210773278970594697,
+   0.02878470788332336934971917961129204363958889454628749647418012260814599,
+   0.02878470788332336934971917961129204363958889454628749647418012260814599,
+   0.01846646831109095914230213191204726909620653396818140337129836551458560,
+   0.01846646831109095914230213191204726909620653396818140337129836551458560,
+   0.00796819249616660561546588347467362245048069658715172122948516335692004,
+   0.00796819249616660561546588347467362245048069658715172122948516335692004,
+  // Order 31;
+   0.09972054479342645142753383373434943964325341150020435148561457956409281,
+   0.09922501122667230787487551442861501401754321995556306978120314251546907,
+   0.09922501122667230787487551442861501401754321995556306978120314251546907,
+   0.09774333538632872509347401097899670383572878867609511450951464450145246,
+   0.09774333538632872509347401097899670383572878867609511450951464450145246,
+   0.09529024291231951280720419748759668454132473824695902271144946592846881,
+   0.09529024291231951280720419748759668454132473824695902271144946592846881,
+   0.09189011389364147821536287160715012549731082537915780417848561650424870,
+   0.09189011389364147821536287160715012549731082537915780417848561650424870,
+   0.08757674060847787612619806969533309222925815977120425150354121196912542,
+   0.08757674060847787612619806969533309222925815977120425150354121196912542,
+   0.08239299176158926390382336743196177061576826655664627781038392425063087,
+   0.08239299176158926390382336743196177061576826655664627781038392425063087,
+   0.07639038659877661642635767490133064492575691369420865409219008164640825,
+   0.07639038659877661642635767490133064492575691369420865409219008164640825,
+   0.06962858323541036616775612625512571051508570739734339371107271703674269,
+   0.06962858323541036616775612625512571051508570739734339371107271703674269,
+   0.06217478656102842691034354368669666715872879936465131528150750533149109,
+   0.06217478656102842691034354368669666715872879936465131528150750533149109,
+   0.05410308242491685371166625908662004272038946259621180769400782105129990,
+   0.05410308242491685371166625908662004272038946259621180769400782105129990,
+   0.04549370752720110290231585789462967726355271931002896489351663612152439,
+   0.04549370752720110290231585789462967726355271931002896489351663612152439,
+   0.03643227391238546402439201046780344232714533204766768590141903939633341,
+   0.03643227391238546402439201046780344232714533204766768590141903939633341,
+   0.02700901918497942180060870809193215614235664600211664585687474984727009,
+   0.02700901918497942180060870809193215614235664600211664585687474984727009,
+   0.01731862079031058246315799608682114136627286276799577663275518378881015,
+   0.01731862079031058246315799608682114136627286276799577663275518378881015,
+   0.00747083157924877585869687503221240702215085248404803969927097032867827,
+   0.00747083157924877585869687503221240702215085248404803969927097032867827,
+  // Order 32;
+   0.09654008851472780056676483006357579473686063123557006873231820995774978,
+   0.09654008851472780056676483006357579473686063123557006873231820995774978,
+   0.09563872007927485941908200220413110059489050816200555095298985094370674,
+   0.09563872007927485941908200220413110059489050816200555095298985094370674,
+   0.09384439908080456563918023766811726003610007574623645005062756963556951,
+   0.09384439908080456563918023766811726003610007574623645005062756963556951,
+   0.09117387869576388471286857711163706254486141327539000532312787397770315,
+   0.09117387869576388471286857711163706254486141327539000532312787397770315,
+   0.08765209300440381114277146275180228754844972170175722231922280347470612,
+   0.08765209300440381114277146275180228754844972170175722231922280347470612,
+   0.08331192422694675522219907460434861153874688394283445984018640472875941,
+   0.08331192422694675522219907460434861153874688394283445984018640472875941,
+   0.07819389578707030647174091882830667103978679848215919030748155386949370,
+   0.07819389578707030647174091882830667103978679848215919030748155386949370,
+   0.07234579410884850622539935647848779160433698330182487073976328235117653,
+   0.07234579410884850622539935647848779160433698330182487073976328235117653,
+   0.06582222277636184683765006370693877287753644737324651537109166968524124,
+   0.06582222277636184683765006370693877287753644737324651537109166968524124,
+   0.05868409347853554714528363730017088675012046745754675871500327861328775,
+   0.05868409347853554714528363730017088675012046745754675871500327861328775,
+   0.05099805926237617619616324468952169526018477673976284370690712365250305,
+   0.05099805926237617619616324468952169526018477673976284370690712365250305,
+   0.04283589802222668065687864660612552849281085759894073956202194089110439,
+   0.04283589802222668065687864660612552849281085759894073956202194089110439,
+   0.03427386291302143310268773225237270699484020291162743378140574541923105,
+   0.03427386291302143310268773225237270699484020291162743378140574541923105,
+   0.02539206530926205945575258978922402928755404754694872093625128221921548,
+   0.02539206530926205945575258978922402928755404754694872093625128221921548,
+   0.01627439473090567060517056220638661817954296379520956642959317496133697,
+   0.01627439473090567060517056220638661817954296379520956642959317496133697,
+   0.00701861000947009660040706373885318251337722072893960323200823561921512,
+   0.00701861000947009660040706373885318251337722072893960323200823561921512,
+  // Order 33;
+   0.09376844616020999656730454154634878438447336398182668128674869556807258,
+   0.09335642606559611616099912627427546495200398608863080496621924773900846,
+   0.09335642606559611616099912627427546495200398608863080496621924773900846,
+   0.09212398664331684621324097771736306072147100320398172055990358696877164,
+   0.09212398664331684621324097771736306072147100320398172055990358696877164,
+   0.09008195866063857723974370550022362118737068207949148498896103099561882,
+   0.09008195866063857723974370550022362118737068207949148498896103099561882,
+   0.08724828761884433760728167094544645656669607129390228839164452049037836,
+   0.08724828761884433760728167094544645656669607129390228839164452049037836,
+   0.08364787606703870761392801451766059742032768654582601651883280481778315,
+   0.08364787606703870761392801451766059742032768654582601651883280481778315,
+   0.07931236479488673836390838494199758808868802939229864270837630672162333,
+   0.07931236479488673836390838494199758808868802939229864270837630672162333,
+   0.07427985484395414934247217591847204671009839319625532346496716686053092,
+   0.07427985484395414934247217591847204671009839319625532346496716686053092,
+   0.06859457281865671280595507301495865248736109294038869769707091534231261,
+   0.06859457281865671280595507301495865248736109294038869769707091534231261,
+   0.06230648253031748003162772577089761142176842757931310682597253128880078,
+   0.06230648253031748003162772577089761142176842757931310682597253128880078,
+   0.05547084663166356128494449543925911042050840715022044034425696822554649,
+   0.05547084663166356128494449543925911042050840715022044034425696822554649,
+   0.04814774281871169567014688013811964974175114867696906133826921907330759,
+   0.04814774281871169567014688013811964974175114867696906133826921907330759,
+   0.04040154133166959156340979052739849616686278838265391694601391861203622,
+   0.04040154133166959156340979052739849616686278838265391694601391861203622,
+   0.03230035863232895328156144724943128806825272305067292722953161704350005,
+   0.03230035863232895328156144724943128806825272305067292722953161704350005,
+   0.02391554810174948035053325752918624206600836114451491924556293127226971,
+   0.02391554810174948035053325752918624206600836114451491924556293127226971,
+   0.01532170151293467612794576853366186675753535478075623678151001071722549,
+   0.01532170151293467612794576853366186675753535478075623678151001071722549,
+   0.00660622784758737805864923520847385503105916250321107134953287604725008,
+   0.00660622784758737805864923520847385503105916250321107134953287604725008,
+  // Order 34;
+   0.09095674033025987361533760394857795992460561626025944011561256806984403,
+   0.09095674033025987361533760394857795992460561626025944011561256806984403,
+   0.09020304437064072957394224201749392884102950005063063569498612276182111,
+   0.09020304437064072957394224201749392884102950005063063569498612276182111,
+   0.08870189783569386928707645736488071274428300670380413096632052504020247,
+   0.08870189783569386928707645736488071274428300670380413096632052504020247,
+   0.08646573974703574978424685628074758031407069090181757249502276495180684,
+   0.08646573974703574978424685628074758031407069090181757249502276495180684,
+   0.08351309969984565518702022804614939058071559385754669160122886214739868,
+   0.08351309969984565518702022804614939058071559385754669160122886214739868,
+   0.07986844433977184473881883280643799355055587197219429959490047041705660,
+   0.07986844433977184473881883280643799355055587197219429959490047041705660,
+   0.07556197466003193127083397422843572405881926948134146252829336707442046,
+   0.07556197466003193127083397422843572405881926948134146252829336707442046,
+   0.07062937581425572499903879656768535500116272049090596511848655436056393,
+   0.07062937581425572499903879656768535500116272049090596511848655436056393,
+   0.06511152155407641137854443006489377358363724607281319188475173513664116,
+   0.06511152155407641137854443006489377358363724607281319188475173513664116,
+   0.05905413582752449319396097235052619082848618234650448303311109894008261,
+   0.05905413582752449319396097235052619082848618234650448303311109894008261,
+   0.05250741457267810616824597484246759965871968094696986592482249882766579,
+   0.05250741457267810616824597484246759965871968094696986592482249882766579,
+   0.04552561152335327245382256339527060299823841899631538209462227884038903,
+   0.04552561152335327245382256339527060299823841899631538209462227884038903,
+   0.03816659379638751632176592028997655882394700612666735161337668559040374,
+   0.03816659379638751632176592028997655882394700612666735161337668559040374,
+   0.03049138063844613180944238768131759103062684538958078747991213977662820,
+   0.03049138063844613180944238768131759103062684538958078747991213977662820,
+   0.02256372198549497008409408871495426124903458838818783377146845580087790,
+   0.02256372198549497008409408871495426124903458838818783377146845580087790,
+   0.01445016274859503541520221032874699068754043358465606014173403388756892,
+   0.01445016274859503541520221032874699068754043358465606014173403388756892,
+   0.00622914055590868471860646107143778612452732842980484594134983837662854,
+   0.00622914055590868471860646107143778612452732842980484594134983837662854,
+  // Order 35;
+   0.08848679490710429063820738777761566918240915001060542332039305475648319,
+   0.08814053043027546297073880759309664142545431727449083717057178460222917,
+   0.08814053043027546297073880759309664142545431727449083717057178460222917,
+   0.08710444699718353424332203160554093668505671509385493140445383422179679,
+   0.08710444699718353424332203160554093668505671509385493140445383422179679,
+   0.08538665339209912522594398739111756764119098828375075112053146186876541,
+   0.08538665339209912522594398739111756764119098828375075112053146186876541,
+   0.08300059372885658837992652821617700348517450381345111995528884968722505,
+   0.08300059372885658837992652821617700348517450381345111995528884968722505,
+   0.07996494224232426293266208098504575632883549943008884738043654410797917,
+   0.07996494224232426293266208098504575632883549943008884738043654410797917,
+   0.07630345715544205353865853788422622552708008189563653436772884519687454,
+   0.07630345715544205353865853788422622552708008189563653436772884519687454,
+   0.07204479477256006466546190978527775614726739302742726056329682156206093,
+   0.07204479477256006466546190978527775614726739302742726056329682156206093,
+   0.06722228526908690396430550874814855854709311914960480846055927495170417,
+   0.06722228526908690396430550874814855854709311914960480846055927495170417,
+   0.06187367196608018888701413878868865226537122580409643507340429175296949,
+   0.06187367196608018888701413878868865226537122580409643507340429175296949,
+   0.05604081621237012857832774716510096444034853490455634554970528511503582,
+   0.05604081621237012857832774716510096444034853490455634554970528511503582,
+   0.04976937040135352980519967608499495859449495319457316369573066436191541,
+   0.04976937040135352980519967608499495859449495319457316369573066436191541,
+   0.04310842232617021878230645937490820342280658716399020871006291908060782,
+   0.04310842232617021878230645937490820342280658716399020871006291908060782,
+   0.03611011586346338053271696964754993830853577896998694316678639524243321,
+   0.03611011586346338053271696964754993830853577896998694316678639524243321,
+   0.02882926010889425404871603971448491626152772662959499974747374084211657,
+   0.02882926010889425404871603971448491626152772662959499974747374084211657,
+   0.02132297991148358088343798396620507832380964471993620726489845562559719,
+   0.02132297991148358088343798396620507832380964471993620726489845562559719,
+   0.01365082834836149226640400292051638397399403784142492099719009988256449,
+   0.01365082834836149226640400292051638397399403784142492099719009988256449,
+   0.00588343342044308497575389624011262403075431779823297371168420451988319,
+   0.00588343342044308497575389624011262403075431779823297371168420451988319,
+  // Order 36;
+   0.08598327567039474749008517479052655416005491560349585229075207013342692,
+   0.08598327567039474749008517479052655416005491560349585229075207013342692,
+   0.08534668573933862749185054307648977099878658549729129412848497090336996,
+   0.08534668573933862749185054307648977099878658549729129412848497090336996,
+   0.08407821897966193493345762429159582120393591395760604550398237147861195,
+   0.08407821897966193493345762429159582120393591395760604550398237147861195,
+   0.08218726670433970951722347354494230286496307293462212098080902841424394,
+   0.08218726670433970951722347354494230286496307293462212098080902841424394,
+   0.07968782891207160190872466550186390732753415751472602018755167051098262,
+   0.07968782891207160190872466550186390732753415751472602018755167051098262,
+   0.07659841064587067452875773372150164172792755683199183378203784650532939,
+   0.07659841064587067452875773372150164172792755683199183378203784650532939,
+   0.07294188500565306135387337694127421828694695261699054440281241495508419,
+   0.07294188500565306135387337694127421828694695261699054440281241495508419,
+   0.06874532383573644261368963936361320834173076464213849122955072618565618,
+   0.06874532383573644261368963936361320834173076464213849122955072618565618,
+   0.06403979735501548955638479862585633974602147055084072492743474315731960,
+   0.06403979735501548955638479862585633974602147055084072492743474315731960,
+   0.05886014424532481730967539981892003594275409578255928924565305144275785,
+   0.05886014424532481730967539981892003594275409578255928924565305144275785,
+   0.05324471397775991909202562828621964968892961105894292068727376767106987,
+   0.05324471397775991909202562828621964968892961105894292068727376767106987,
+   0.04723508349026597841661682961667483207315178743436963026401837934791768,
+   0.04723508349026597841661682961667483207315178743436963026401837934791768,
+   0.04087575092364489547411454514326319154793706111907814620784329388909819,
+   0.04087575092364489547411454514326319154793706111907814620784329388909819,
+   0.03421381077030722992124506156271455407009691132677648352974384584449831,
+   0.03421381077030722992124506156271455407009691132677648352974384584449831,
+   0.02729862149856877909441718086798335799045682814205085535541414495848519,
+   0.02729862149856877909441718086798335799045682814205085535541414495848519,
+   0.02018151529773547153209892895822112741958651024086156525054936917401231,
+   0.02018151529773547153209892895822112741958651024086156525054936917401231,
+   0.01291594728406557440450341149779164919196121285147967185003039204362092,
+   0.01291594728406557440450341149779164919196121285147967185003039204362092,
+   0.00556571966424504536125598439054783741722459189417851017605791338451490,
+   0.00556571966424504536125598439054783741722459189417851017605791338451490,
+  // Order 37;
+   0.08376836099313890479701736636945939171687528006847671922807114606603521,
+   0.08347457362586278725225300948451869902043531020302605005984610975699199,
+   0.08347457362586278725225300948451869902043531020302605005984610975699199,
+   0.08259527223643725089123030115283847077330645260203976818432580899354220,
+   0.08259527223643725089123030115283847077330645260203976818432580899354220,
+   0.08113662450846503050987760179979226356646004497462493854939450587276089,
+   0.08113662450846503050987760179979226356646004497462493854939450587276089,
+   0.07910886183752938076721218739664523851600693506418236602175058639946006,
+   0.07910886183752938076721218739664523851600693506418236602175058639946006,
+   0.07652620757052923788588799120662251549536331553154405161251461988320280,
+   0.07652620757052923788588799120662251549536331553154405161251461988320280,
+   0.07340677724848817272462663151979546498346994219764821463322177661030138,
+   0.07340677724848817272462663151979546498346994219764821463322177661030138,
+   0.06977245155570034488508135679301929118602367869775608738004010270708184,
+   0.06977245155570034488508135679301929118602367869775608738004010270708184,
+   0.06564872287275124948402376629797121819667732114972492649740086096873613,
+   0.06564872287275124948402376629797121819667732114972492649740086096873613,
+   0.06106451652322598613098810450049658567799400906236310487461042242097297,
+   0.06106451652322598613098810450049658567799400906236310487461042242097297,
+   0.05605198799827491780853923966425266642675385528776707882883525912558897,
+   0.05605198799827491780853923966425266642675385528776707882883525912558897,
+   0.05064629765482460160387586308671634405270576294535410972861539845575235,
+   0.05064629765482460160387586308671634405270576294535410972861539845575235,
+   0.04488536466243716665741030411019636019472330651441393295679996302426600,
+   0.04488536466243716665741030411019636019472330651441393295679996302426600,
+   0.03880960250193454448896237032847601996738918927368540082289450246165791,
+   0.03880960250193454448896237032847601996738918927368540082289450246165791,
+   0.03246163984752148106723425350145872879909455912252466641255207993778621,
+   0.03246163984752148106723425350145872879909455912252466641255207993778621,
+   0.02588603699055893352275948136248729802948418257510327043311049725166497,
+   0.02588603699055893352275948136248729802948418257510327043311049725166497,
+   0.01912904448908396604350194794010617413029523574621032565224674679017081,
+   0.01912904448908396604350194794010617413029523574621032565224674679017081,
+   0.01223878010030755652630485243634657594229095311126608230404168902988928,
+   0.01223878010030755652630485243634657594229095311126608230404168902988928,
+   0.00527305727949793935172205423353038918308830590652726543376349727715563,
+   0.00527305727949793935172205423353038918308830590652726543376349727715563,
+  // Order 38;
+   0.08152502928038578669921876988583005560164265147049679843810259698106137,
+   0.08152502928038578669921876988583005560164265147049679843810259698106137,
+   0.08098249377059710062326946994905814193651516978408875414156602856749565,
+   0.08098249377059710062326946994905814193651516978408875414156602856749565,
+   0.07990103324352782158602768392518569655030123958968157898060370265306479,
+   0.07990103324352782158602768392518569655030123958968157898060370265306479,
+   0.07828784465821094807537540333573626256490374485784182557475124683143960,
+   0.07828784465821094807537540333573626256490374485784182557475124683143960,
+   0.07615366354844639606599354110447252799634521883255451879248372140752606,
+   0.07615366354844639606599354110447252799634521883255451879248372140752606,
+   0.07351269258474345714520644484833647857663719509243175535650230474100372,
+   0.07351269258474345714520644484833647857663719509243175535650230474100372,
+   0.07038250706689895473928296759365884083926170176246120645937901625116529,
+   0.07038250706689895473928296759365884083926170176246120645937901625116529,
+   0.06678393797914041193504615152901925995595215603527924173047658748758730,
+   0.06678393797914041193504615152901925995595215603527924173047658748758730,
+   0.06274093339213305405296967152513706432090388899690875834113004503362330,
+   0.06274093339213305405296967152513706432090388899690875834113004503362330,
+   0.05828039914699720602230586825814005591512770215855598650196942014192493,
+   0.05828039914699720602230586825814005591512770215855598650196942014192493,
+   0.05343201991033231997375699063124875607691531033875608561570336243418609,
+   0.05343201991033231997375699063124875607691531033875608561570336243418609,
+   0.04822806186075868337435217991142022418936100278527613228996817107144976,
+   0.04822806186075868337435217991142022418936100278527613228996817107144976,
+   0.04270315850467443423587843435880770867841748456815214424375531708254665,
+   0.04270315850467443423587843435880770867841748456815214424375531708254665,
+   0.03689408159402473816494016233681495034735611724058348996596961210968987,
+   0.03689408159402473816494016233681495034735611724058348996596961210968987,
+   0.03083950054517505465873108631330868892041189549719851884752109831461726,
+   0.03083950054517505465873108631330868892041189549719851884752109831461726,
+   0.02457973973823237589520120544670628744595916222720204669603507633942322,
+   0.02457973973823237589520120544670628744595916222720204669603507633942322,
+   0.01815657770961323689887612575478220226291233903979712242503785378863930,
+   0.01815657770961323689887612575478220226291233903979712242503785378863930,
+   0.01161344471646867417766830120043742735723674786011232968501070110995284,
+   0.01161344471646867417766830120043742735723674786011232968501070110995284,
+   0.00500288074963934567589954209189937046383927186262170591403413765360298,
+   0.00500288074963934567589954209189937046383927186262170591403413765360298,
+  // Order 39;
+   0.07952762213944285241741819660585099384560677476586481430988476983521029,
+   0.07927622256836847101015577175450793052380414867826642470020418734083409,
+   0.07927622256836847101015577175450793052380414867826642470020418734083409,
+   0.07852361328737117672506330098552347152258147640924886094658145130790723,
+   0.07852361328737117672506330098552347152258147640924886094658145130790723,
+   0.07727455254468201672851163673311729912049525148879115093682908402332931,
+   0.07727455254468201672851163673311729912049525148879115093682908402332931,
+   0.07553693732283605770478444699080939909418797859002184433882858884203957,
+   0.07553693732283605770478444699080939909418797859002184433882858884203957,
+   0.07332175341426861738115393286504830644789342425097513077964204018007254,
+   0.07332175341426861738115393286504830644789342425097513077964204018007254,
+   0.07064300597060876077011493152813113646742968415902816927059838771359352,
+   0.07064300597060876077011493152813113646742968415902816927059838771359352,
+   0.06751763096623126536302132804644859377515270808347703580825568588593987,
+   0.06751763096623126536302132804644859377515270808347703580825568588593987,
+   0.06396538813868238898670640441006364485577691688997987973016570051693605,
+   0.06396538813868238898670640441006364485577691688997987973016570051693605,
+   0.06000873608859614957494177354881949973667822709184630434136608158175697,
+   0.06000873608859614957494177354881949973667822709184630434136608158175697,
+   0.05567269034091629990739113978968148270696094807358006843429227657495119,
+   0.05567269034091629990739113978968148270696094807358006843429227657495119,
+   0.05098466529212940521402103367658133501761308388128490529512758169200995,
+   0.05098466529212940521402103367658133501761308388128490529512758169200995,
+   0.04597430110891663188417663939923278059886169303399946391659734220538604,
+   0.04597430110891663188417663939923278059886169303399946391659734220538604,
+   0.04067327684793384393905655608226140368757243599606290477644928249830311,
+   0.04067327684793384393905655608226140368757243599606290477644928249830311,
+   0.03511511149813133076106518529723281636666148761972668562635370812961968,
+   0.03511511149813133076106518529723281636666148761972668562635370812961968,
+   0.02933495598390337859215598635625142561141146710160456530919271000521666,
+   0.02933495598390337859215598635625142561141146710160456530919271000521666,
+   0.02336938483217816459471234444292469889119755546375666589435319100349092,
+   0.02336938483217816459471234444292469889119755546375666589435319100349092,
+   0.01725622909372491904080547118335504721371590189046231536119328911844040,
+   0.01725622909372491904080547118335504721371590189046231536119328911844040,
+   0.01103478893916459424267680545217728945350713937311815593936799764960656,
+   0.01103478893916459424267680545217728945350713937311815593936799764960656,
+   0.00475294469163510137077621315490694198569508454183706143965902881296120,
+   0.00475294469163510137077621315490694198569508454183706143965902881296120,
+  // Order 40;
+   0.07750594797842481126372396295832632696366865278810643573295427385407213,
+   0.07750594797842481126372396295832632696366865278810643573295427385407213,
+   0.07703981816424796558830753428381024852443975416394041548918089243254164,
+   0.07703981816424796558830753428381024852443975416394041548918089243254164,
+   0.07611036190062624237155807592249482301255955384507110705418245902929924,
+   0.07611036190062624237155807592249482301255955384507110705418245902929924,
+   0.07472316905796826420018933626132467319120293442035982173134089141765340,
+   0.07472316905796826420018933626132467319120293442035982173134089141765340,
+   0.07288658239580405906051068344251783585755908098579863047625481683299056,
+   0.07288658239580405906051068344251783585755908098579863047625481683299056,
+   0.07061164739128677969548363085528683235955910399558609731068426896266370,
+   0.07061164739128677969548363085528683235955910399558609731068426896266370,
+   0.06791204581523390382569010823192398598419723837928595471789620359304078,
+   0.06791204581523390382569010823192398598419723837928595471789620359304078,
+   0.06480401345660103807455452956675273003269296420848890636319524427128397,
+   0.06480401345660103807455452956675273003269296420848890636319524427128397,
+   0.06130624249292893916653799640839859590259376351117432198689763868686816,
+   0.06130624249292893916653799640839859590259376351117432198689763868686816,
+   0.05743976909939155136661773091042598560010483585445362650668126692554836,
+   0.05743976909939155136661773091042598560010483585445362650668126692554836,
+   0.05322784698393682435499647977226050455532117182200645076436088052652082,
+   0.05322784698393682435499647977226050455532117182200645076436088052652082,
+   0.04869580763507223206143416044814638806784302737711977514064605127517843,
+   0.04869580763507223206143416044814638806784302737711977514064605127517843,
+   0.04387090818567327199167468604171549581100683717023688975852590864980179,
+   0.04387090818567327199167468604171549581100683717023688975852590864980179,
+   0.03878216797447201763997203129044616225345921123202585783726688891953873,
+   0.03878216797447201763997203129044616225345921123202585783726688891953873,
+   0.03346019528254784739267818308641084897724178665376435041319117669905240,
+   0.03346019528254784739267818308641084897724178665376435041319117669905240,
+   0.02793700698002340109848915750772107730255086205076639844808591645037490,
+   0.02793700698002340109848915750772107730255086205076639844808591645037490,
+   0.02224584919416695726150432418420857320703319667935442788073424000569131,
+   0.02224584919416695726150432418420857320703319667935442788073424000569131,
+   0.01642105838190788871286348488236392729234229334695776197190391551359044,
+   0.01642105838190788871286348488236392729234229334695776197190391551359044,
+   0.01049828453115281361474217106727965237679262131579677971567512361162530,
+   0.01049828453115281361474217106727965237679262131579677971567512361162530,
+   0.00452127709853319125847173287818533272783111019970599070034194234266395,
+   0.00452127709853319125847173287818533272783111019970599070034194234266395,
+  // Order 41;
+   0.07569553564729837231877996107636025589111888139523123313254945373964097,
+   0.07547874709271582402724706267461674907360636090306277622973473798794224,
+   0.07547874709271582402724706267461674907360636090306277622973473798794224,
+   0.07482962317622155189130507263350532294568306737803071757806924416758782,
+   0.07482962317622155189130507263350532294568306737803071757806924416758782,
+   0.07375188202722346993928081832484867947791628042833964273801417984402688,
+   0.07375188202722346993928081832484867947791628042833964273801417984402688,
+   0.07225169686102307339634639834878735488529477052487254889842838027176476,
+   0.07225169686102307339634639834878735488529477052487254889842838027176476,
+   0.07033766062081749748165898996988145600123338016781027972433402304191554,
+   0.07033766062081749748165898996988145600123338016781027972433402304191554,
+   0.06802073676087676673553323972624892825669912013859416544939224714973294,
+   0.06802073676087676673553323972624892825669912013859416544939224714973294,
+   0.06531419645352741043616371265379634041985923672106812634137161043887827,
+   0.06531419645352741043616371265379634041985923672106812634137161043887827,
+   0.06223354258096631647157341708334648543015986994494342937317276510694374,
+   0.06223354258096631647157341708334648543015986994494342937317276510694374,
+   0.05879642094987194499118585338073427400088123860272694086523171272306998,
+   0.05879642094987194499118585338073427400088123860272694086523171272306998,
+   0.05502251924257874188014681017142226997377533660536959050205790787740028,
+   0.05502251924257874188014681017142226997377533660536959050205790787740028,
+   0.05093345429461749478117035711568863142080344678687032877581547425250855,
+   0.05093345429461749478117035711568863142080344678687032877581547425250855,
+   0.04655264836901434206075658686461142313099019858059018502054911073676186,
+   0.04655264836901434206075658686461142313099019858059018502054911073676186,
+   0.04190519519590968942934027431104883793626637743202238325255031708089979,
+   0.04190519519590968942934027431104883793626637743202238325255031708089979,
+   0.03701771670350798843526125158016066860627154632186754277922743555190648,
+   0.03701771670350798843526125158016066860627154632186754277922743555190648,
+   0.03191821173169928178706694685714554370118775329751101256557527610068154,
+   0.03191821173169928178706694685714554370118775329751101256557527610068154,
+   0.02663589920711044546754857525871327704469049200524813802906015007591532,
+   0.02663589920711044546754857525871327704469049200524813802906015007591532,
+   0.02120106336877955307569703349337662657171705432735830818583652084483505,
+   0.02120106336877955307569703349337662657171705432735830818583652084483505,
+   0.01564493840781858853082684447953367744081788936964635635197204297247322,
+   0.01564493840781858853082684447953367744081788936964635635197204297247322,
+   0.00999993877390594533849629662969883955022493577115020595166121219105502,
+   0.00999993877390594533849629662969883955022493577115020595166121219105502,
+   0.00430614035816488768400447790465448618636220399530170482167092471388021,
+   0.00430614035816488768400447790465448618636220399530170482167092471388021,
+  // Order 42;
+   0.07386423423217287999638556114979141312847052050207090807397170278873049,
+   0.07386423423217287999638556114979141312847052050207090807397170278873049,
+   0.07346081345346752826402825705430393873365578345040523936275210130068436,
+   0.07346081345346752826402825705430393873365578345040523936275210130068436,
+   0.07265617524380410488790576149253303127678368396842722999573047387551125,
+   0.07265617524380410488790576149253303127678368396842722999573047387551125,
+   0.07145471426517098292181044411746215502258986387750371863264046414803710,
+   0.07145471426517098292181044411746215502258986387750371863264046414803710,
+   0.06986299249259415976615478638148220444392731304743209370753105712777818,
+   0.06986299249259415976615478638148220444392731304743209370753105712777818,
+   0.06788970337652194485536340221376630726613473465859319786989871232618132,
+   0.06788970337652194485536340221376630726613473465859319786989871232618132,
+   0.06554562436490897892700510785179442560978229408579308233164828946689449,
+   0.06554562436490897892700510785179442560978229408579308233164828946689449,
+   0.06284355804500257640931825132377988915279704392188973871878697143795195,
+   0.06284355804500257640931825132377988915279704392188973871878697143795195,
+   0.05979826222758665431283154575353485150985341869594390945323300836553634,
+   0.05979826222758665431283154575353485150985341869594390945323300836553634,
+   0.05642636935801838164642685513969568939887315857628850742288088345478246,
+   0.05642636935801838164642685513969568939887315857628850742288088345478246,
+   0.05274629569917407034394253904409747703156598782718611962174047259984234,
+   0.05274629569917407034394253904409747703156598782718611962174047259984234,
+   0.04877814079280324502744936312840272392111769693422690303101223652526448,
+   0.04877814079280324502744936312840272392111769693422690303101223652526448,
+   0.04454357777196587787431636598523424131859546603712758124526016367570478,
+   0.04454357777196587787431636598523424131859546603712758124526016367570478,
+   0.04006573518069226176059612483003693455373370186574561509922719978202689,
+   0.04006573518069226176059612483003693455373370186574561509922719978202689,
+   0.03536907109759211083266218112650754190574852178064145007283220372013970,
+   0.03536907109759211083266218112650754190574852178064145007283220372013970,
+   0.03047924069960346836290473352339239779176965424440089482364391641498459,
+   0.03047924069960346836290473352339239779176965424440089482364391641498459,
+   0.02542295952611304788674244290943086438613541037397895486118189690745360,
+   0.02542295952611304788674244290943086438613541037397895486118189690745360,
+   0.02022786956905264475705571907935418508267142655242209621165358092674144,
+   0.02022786956905264475705571907935418508267142655242209621165358092674144,
+   0.01492244369735749414467767810586576762009274749010789659465733447011190,
+   0.01492244369735749414467767810586576762009274749010789659465733447011190,
+   0.00953622030174850241182010029269799818868479873501257251186520364280319,
+   0.00953622030174850241182010029269799818868479873501257251186520364280319,
+   0.00410599860464908461060277949683596265701677337480229035785212704283915,
+   0.00410599860464908461060277949683596265701677337480229035785212704283915,
+  // Order 43;
+   0.07221575169379898797746233171373688014707069052525034897015534688844060,
+   0.07202750197142197434530755167085708775350424594741470164484497387259599,
+   0.07202750197142197434530755167085708775350424594741470164484497387259599,
+   0.07146373425251414129758111770291024858090001936779567323931861212031975,
+   0.07146373425251414129758111770291024858090001936779567323931861212031975,
+   0.07052738776508502812628635547794074318373616678496415006778588216945921,
+   0.07052738776508502812628635547794074318373616678496415006778588216945921,
+   0.06922334419365668428229947912263514780930498957092782381957157848661869,
+   0.06922334419365668428229947912263514780930498957092782381957157848661869,
+   0.06755840222936516919240790475626559214294629258572960827354579253449867,
+   0.06755840222936516919240790475626559214294629258572960827354579253449867,
+   0.06554124212632279749123376424920783022496253377845482632252950681319924,
+   0.06554124212632279749123376424920783022496253377845482632252950681319924,
+   0.06318238044939611232562981777340826425669623463946884668037323809631300,
+   0.06318238044939611232562981777340826425669623463946884668037323809631300,
+   0.06049411524999129451967874199136279335850887987042858743121812453829042,
+   0.06049411524999129451967874199136279335850887987042858743121812453829042,
+   0.05749046195691051942760891684441651192786886819456543268923113959603172,
+   0.05749046195691051942760891684441651192786886819456543268923113959603172,
+   0.05418708031888178686337317832626541358839055267071128470353816551726490,
+   0.05418708031888178686337317832626541358839055267071128470353816551726490,
+   0.05060119278439015652385039895301474574989800909801219097384428437740183,
+   0.05060119278439015652385039895301474574989800909801219097384428437740183,
+   0.04675149475434658001064676633710293393286309593566385684419173805218697,
+   0.04675149475434658001064676633710293393286309593566385684419173805218697,
+   0.04265805719798208376380720533851389410494709123676725067333932903369501,
+   0.04265805719798208376380720533851389410494709123676725067333932903369501,
+   0.03834222219413265757212842466284911488007256286839717552085984890685832,
+   0.03834222219413265757212842466284911488007256286839717552085984890685832,
+   0.03382649208686029234496847575380209105330161064713236692120216893114583,
+   0.03382649208686029234496847575380209105330161064713236692120216893114583,
+   0.02913441326149849491594042482578119378755056984019203195997054141962823,
+   0.02913441326149849491594042482578119378755056984019203195997054141962823,
+   0.02429045661383881590201832425424924845523703933581213749868522167959554,
+   0.02429045661383881590201832425424924845523703933581213749868522167959554,
+   0.01931990142368390039612461089207135231702355908825696855523372443515824,
+   0.01931990142368390039612461089207135231702355908825696855523372443515824,
+   0.01424875643157648610854160172200419357207399314416233527423287907996924,
+   0.01424875643157648610854160172200419357207399314416233527423287907996924,
+   0.00910399663740140331886860829589672381301797555982670407706283368224966,
+   0.00910399663740140331886860829589672381301797555982670407706283368224966,
+   0.00391949025384412728296716519257643543366036457269087234434274321329924,
+   0.00391949025384412728296716519257643543366036457269087234434274321329924,
+  // Order 44;
+   0.07054915778935406881133828748029988499106342550892364479074143262602088,
+   0.07054915778935406881133828748029988499106342550892364479074143262602088,
+   0.07019768547355821258714204194439938766882668621562845793333283870825390,
+   0.07019768547355821258714204194439938766882668621562845793333283870825390,
+   0.06949649186157257803708409092501125678209347538117422736004197705577861,
+   0.06949649186157257803708409092501125678209347538117422736004197705577861,
+   0.06844907026936666098545866070434987244515554363590004089829438754294689,
+   0.06844907026936666098545866070434987244515554363590004089829438754294689,
+   0.06706063890629365239570491935171935078071301307276156795675110186196903,
+   0.06706063890629365239570491935171935078071301307276156795675110186196903,
+   0.06533811487918143498424089484562218949601080112967692858353400960418482,
+   0.06533811487918143498424089484562218949601080112967692858353400960418482,
+   0.06329007973320385495013887101971493063802428824409418544374398504192041,
+   0.06329007973320385495013887101971493063802428824409418544374398504192041,
+   0.06092673670156196803855783687437410067257248948165011222929579423587486,
+   0.06092673670156196803855783687437410067257248948165011222929579423587486,
+   0.05825985987759549533421068984427716800475616910335356735469657387338029,
+   0.05825985987759549533421068984427716800475616910335356735469657387338029,
+   0.05530273556372805254874663264315299147153484641761776010149357199983233,
+   0.05530273556372805254874663264315299147153484641761776010149357199983233,
+   0.05207009609170446188123180299319875105626417474111692655863906810455175,
+   0.05207009609170446188123180299319875105626417474111692655863906810455175,
+   0.04857804644835203752763943669129273761505139910682467592574384978788409,
+   0.04857804644835203752763943669129273761505139910682467592574384978788409,
+   0.04484398408197003144624318640305110718096302165573399969031007896976075,
+   0.04484398408197003144624318640305110718096302165573399969031007896976075,
+   0.04088651231034621890844716928306848685407928902670259604243284296206535,
+   0.04088651231034621890844716928306848685407928902670259604243284296206535,
+   0.03672534781380887364290929234870179971070878799974687289110922507468071,
+   0.03672534781380887364290929234870179971070878799974687289110922507468071,
+   0.03238122281206982088084693954011160114694805178002942050692477366761675,
+   0.03238122281206982088084693954011160114694805178002942050692477366761675,
+   0.02787578282128101008111429177938706432205883989299034864474913459283563,
+   0.02787578282128101008111429177938706432205883989299034864474913459283563,
+   0.02323148190201921062895826293873141748822190203565799718221613623938914,
+   0.02323148190201921062895826293873141748822190203565799718221613623938914,
+   0.01847148173681474917204222374339984411552073831390187733490476456489099,
+   0.01847148173681474917204222374339984411552073831390187733490476456489099,
+   0.01361958675557998552020506639006137887326671975487072331107636510578370,
+   0.01361958675557998552020506639006137887326671975487072331107636510578370,
+   0.00870048136752484412256562342431314020846842115836189609337444898274293,
+   0.00870048136752484412256562342431314020846842115836189609337444898274293,
+   0.00374540480311277751517377883176153847769791634328217316659363939763619,
+   0.00374540480311277751517377883176153847769791634328217316659363939763619,
+  // Order 45;
+   0.06904182482923202011079855515940474072332289227500477807714605016099802,
+   0.06887731697766132288200284829805578888452413011064854515874106838508300,
+   0.06887731697766132288200284829805578888452413011064854515874106838508300,
+   0.06838457737866967453169209933431609707348491305464494638088944561495321,
+   0.06838457737866967453169209933431609707348491305464494638088944561495321,
+   0.06756595416360753627091022387364863097947258092394646199345358731424360,
+   0.06756595416360753627091022387364863097947258092394646199345358731424360,
+   0.06642534844984252808291471563910373761317454675067481595603892552331090,
+   0.06642534844984252808291471563910373761317454675067481595603892552331090,
+   0.06496819575072343085382657035907569508384972548758327305202375499135275,
+   0.06496819575072343085382657035907569508384972548758327305202375499135275,
+   0.06320144007381993774996373029066688186630023727582281702085863359414505,
+   0.06320144007381993774996373029066688186630023727582281702085863359414505,
+   0.06113350083106652250188637053632557326012423426524212007350864262577336,
+   0.06113350083106652250188637053632557326012423426524212007350864262577336,
+   0.05877423271884173857436151763183142253126572546098020811657592611954254,
+   0.05877423271884173857436151763183142253126572546098020811657592611954254,
+   0.05613487875978647664392394037486976324148018494616301580044509125307116,
+   0.05613487875978647664392394037486976324148018494616301580044509125307116,
+   0.05322801673126895194590404401931040379848221694017551596604825362168980,
+   0.05322801673126895194590404401931040379848221694017551596604825362168980,
+   0.05006749923795202979913210247487431739149869293514643723048218857431636,
+   0.05006749923795202979913210247487431739149869293514643723048218857431636,
+   0.04666838771837336526776847574165410120498614148785358251276678547986296,
+   0.04666838771837336526776847574165410120498614148785358251276678547986296,
+   0.04304688070916497115169111308116694178831923616319132015431680713677642,
+   0.04304688070916497115169111308116694178831923616319132015431680713677642,
+   0.03922023672930244756418718534392933821813012459630666980722787151688068,
+   0.03922023672930244756418718534392933821813012459630666980722787151688068,
+   0.03520669220160901624769979826157509081008807471271464134077435327527104,
+   0.03520669220160901624769979826157509081008807471271464134077435327527104,
+   0.03102537493451546716250793889376806388592115212397480044185417175054066,
+   0.03102537493451546716250793889376806388592115212397480044185417175054066,
+   0.02669621396757766480567477879310752778782491056589152356853644981431207,
+   0.02669621396757766480567477879310752778782491056589152356853644981431207,
+   0.02223984755057873239395075855216899334487570870129997071960988624487377,
+   0.02223984755057873239395075855216899334487570870129997071960988624487377,
+   0.01767753525793759061709254666957708852065127812646578801736417339579142,
+   0.01767753525793759061709254666957708852065127812646578801736417339579142,
+   0.01303110499158278432063108246968692602714117158263899114091066650151719,
+   0.01303110499158278432063108246968692602714117158263899114091066650151719,
+   0.00832318929621824164573585312223385375615793129294822189495647921585574,
+   0.00832318929621824164573585312223385375615793129294822189495647921585574,
+   0.00358266315528355893114302865935139257058563635818394461404381297033728,
+   0.00358266315528355893114302865935139257058563635818394461404381297033728,
+  // Order 46;
+   0.06751868584903645882021418916430108021214826953981825514516993548710416,
+   0.06751868584903645882021418916430108021214826953981825514516993548710416,
+   0.06721061360067817586237415482709759617653968116564520215977612294592253,
+   0.06721061360067817586237415482709759617653968116564520215977612294592253,
+   0.06659587476845488737576196642273370194436370880099210926975104209929120,
+   0.06659587476845488737576196642273370194436370880099210926975104209929120,
+   0.06567727426778120737875756568555576762171613977381171548143142168437550,
+   0.06567727426778120737875756568555576762171613977381171548143142168437550,
+   0.06445900346713906958827943910825506392379564504501849249747919895739187,
+   0.06445900346713906958827943910825506392379564504501849249747919895739187,
+   0.06294662106439450817895195224711093123324616503178622087107980536943922,
+   0.06294662106439450817895195224711093123324616503178622087107980536943922,
+   0.06114702772465048101535660790419103777278163285785360762773974364720188,
+   0.06114702772465048101535660790419103777278163285785360762773974364720188,
+   0.05906843459554631480755072263690773709821694849223029677199640494868415,
+   0.05906843459554631480755072263690773709821694849223029677199640494868415,
+   0.05672032584399123581687440360328671458642702260911475474112192488846714,
+   0.05672032584399123581687440360328671458642702260911475474112192488846714,
+   0.05411341538585675449163764325922307525989746904113506623787225204015913,
+   0.05411341538585675449163764325922307525989746904113506623787225204015913,
+   0.05125959800714302133536529937144803346418150162653053249563800282758403,
+   0.05125959800714302133536529937144803346418150162653053249563800282758403,
+   0.04817189510171220053046886322322093668197549236746216916742177807882374,
+   0.04817189510171220053046886322322093668197549236746216916742177807882374,
+   0.04486439527731812676709461356277485644228670051842517837723850911023577,
+   0.04486439527731812676709461356277485644228670051842517837723850911023577,
+   0.04135219010967872970422017587023147842420622411377262615230355615738415,
+   0.04135219010967872970422017587023147842420622411377262615230355615738415,
+   0.03765130535738607132766079922845911702695511945426067196254619570465670,
+   0.03765130535738607132766079922845911702695511945426067196254619570465670,
+   0.03377862799910689652060389388114532872779948047520031100216741307296773,
+   0.03377862799910689652060389388114532872779948047520031100216741307296773,
+   0.02975182955220275579905172923572293709302875381894886748899444344708495,
+   0.02975182955220275579905172923572293709302875381894886748899444344708495,
+   0.02558928639713001063469951220034402810287956073861699395379774315363457,
+   0.02558928639713001063469951220034402810287956073861699395379774315363457,
+   0.02130999875413650105447936107087840182884377652052401639497607872415278,
+   0.02130999875413650105447936107087840182884377652052401639497607872415278,
+   0.01693351400783623804623071367176043133372644382569415108576281432292440,
+   0.01693351400783623804623071367176043133372644382569415108576281432292440,
+   0.01247988377098868420673457175098337517752254738535089049100929689966282,
+   0.01247988377098868420673457175098337517752254738535089049100929689966282,
+   0.00796989822972462245161303892632496542628877099259653938039749999797563,
+   0.00796989822972462245161303892632496542628877099259653938039749999797563,
+   0.00343030086810704828601878314804340444117294580521133124432881643487595,
+   0.00343030086810704828601878314804340444117294580521133124432881643487595,
+  // Order 47;
+   0.06613512962365547965344035433105497119536045271793124056642871984638833,
+   0.06599053358881047453357065533049825957735827762650299788915344028102368,
+   0.06599053358881047453357065533049825957735827762650299788915344028102368,
+   0.06555737776654974025114300232607591228199989080873359789579123902971592,
+   0.06555737776654974025114300232607591228199989080873359789579123902971592,
+   0.06483755623894572670260393911080601888499475260182831880342450596300125,
+   0.06483755623894572670260393911080601888499475260182831880342450596300125,
+   0.06383421660571703063129377985581353348233634369068597255588050322806703,
+   0.06383421660571703063129377985581353348233634369068597255588050322806703,
+   0.06255174622092166264056438144995353675341584345846042531837212695154761,
+   0.06255174622092166264056438144995353675341584345846042531837212695154761,
+   0.06099575300873964533071057813343752118109320430201587679892184540974463,
+   0.06099575300873964533071057813343752118109320430201587679892184540974463,
+   0.05917304094233887597615455638574129246383235149307405047070878600757854,
+   0.05917304094233887597615455638574129246383235149307405047070878600757854,
+   0.05709158029323154022201660530838277291032942596524699678941695340613384,
+   0.05709158029323154022201660530838277291032942596524699678941695340613384,
+   0.05476047278153022595712517688850480590379536634850721295827930604882259,
+   0.05476047278153022595712517688850480590379536634850721295827930604882259,
+   0.05218991178005714487221194170967607772173497996203217667008315714483520,
+   0.05218991178005714487221194170967607772173497996203217667008315714483520,
+   0.04939113774736116960457048586200492311999402379049431699982593392768124,
+   0.04939113774736116960457048586200492311999402379049431699982593392768124,
+   0.04637638908650591120440184824274509254869604526289591051847374824003012,
+   0.04637638908650591120440184824274509254869604526289591051847374824003012,
+   0.04315884864847953826830179344650313954771937778244714170333993345855227,
+   0.04315884864847953826830179344650313954771937778244714170333993345855227,
+   0.03975258612253100378090138014196101659164946881568305925953844571623373,
+   0.03975258612253100378090138014196101659164946881568305925953844571623373,
+   0.03617249658417495161345992976631124867344528220138057243663375572397796,
+   0.03617249658417495161345992976631124867344528220138057243663375572397796,
+   0.03243423551518475676761746317417015869308868087328658991804612443930359,
+   0.03243423551518475676761746317417015869308868087328658991804612443930359,
+   0.02855415070064338650473992462581108160687521783269186835774632624401929,
+   0.02855415070064338650473992462581108160687521783269186835774632624401929,
+   0.02454921165965881853783415715250576713766315216483130989338686699617436,
+   0.02454921165965881853783415715250576713766315216483130989338686699617436,
+   0.02043693814766842764203476068625538642723104902415690370321229082323509,
+   0.02043693814766842764203476068625538642723104902415690370321229082323509,
+   0.01623533314643305967072568740789862101589291904397500672547888233888681,
+   0.01623533314643305967072568740789862101589291904397500672547888233888681,
+   0.01196284846431232096394345484994851252339290836246802253233640356129955,
+   0.01196284846431232096394345484994851252339290836246802253233640356129955,
+   0.00763861629584883361410435677113165550442058982256510535804317064617837,
+   0.00763861629584883361410435677113165550442058982256510535804317064617837,
+   0.00328745384252801488324996420833617985136062240707094616069189449076317,
+   0.00328745384252801488324996420833617985136062240707094616069189449076317,
+  // Order 48;
+   0.06473769681268392250302493873659155355208191894663651001456309552308308,
+   0.06473769681268392250302493873659155355208191894663651001456309552308308,
+   0.06446616443595008220650419365770506572569192445553030876055845653739235,
+   0.06446616443595008220650419365770506572569192445553030876055845653739235,
+   0.06392423858464818662390620182551540891897408498264299989087420749955378,
+   0.06392423858464818662390620182551540891897408498264299989087420749955378,
+   0.06311419228625402565712602275023331812741364337110079121114724790803812,
+   0.06311419228625402565712602275023331812741364337110079121114724790803812,
+   0.06203942315989266390419778413759851830638339966509146156903781450273904,
+   0.06203942315989266390419778413759851830638339966509146156903781450273904,
+   0.06070443916589388005296923202782047788526086425647775511151144466063789,
+   0.06070443916589388005296923202782047788526086425647775511151144466063789,
+   0.05911483969839563574647481743351991065965560255705499855629113348583514,
+   0.05911483969839563574647481743351991065965560255705499855629113348583514,
+   0.05727729210040321570515023468470057624152712300411207753884993747681745,
+   0.05727729210040321570515023468470057624152712300411207753884993747681745,
+   0.05519950369998416286820349519163543900445092560756100054805625793058524,
+   0.05519950369998416286820349519163543900445092560756100054805625793058524,
+   0.05289018948519366709550505626469891466172648563310918638649123384829276,
+   0.05289018948519366709550505626469891466172648563310918638649123384829276,
+   0.05035903555385447495780761908786560603299409302590633069379205724693441,
+   0.05035903555385447495780761908786560603299409302590633069379205724693441,
+   0.04761665849249047482590662347892983015799806674344968539676989627880989,
+   0.04761665849249047482590662347892983015799806674344968539676989627880989,
+   0.04467456085669428041944858712585039498846278686250200843292144633919149,
+   0.04467456085669428041944858712585039498846278686250200843292144633919149,
+   0.04154508294346474921405882236106479775347282603403806308273482122272583,
+   0.04154508294346474921405882236106479775347282603403806308273482122272583,
+   0.03824135106583070631721725652371561786382396835498228892925819103405054,
+   0.03824135106583070631721725652371561786382396835498228892925819103405054,
+   0.03477722256477043889254858596380241059728139690706809871800663617967672,
+   0.03477722256477043889254858596380241059728139690706809871800663617967672,
+   0.03116722783279808890206575684635441945428534148356953550954371886143141,
+   0.03116722783279808890206575684635441945428534148356953550954371886143141,
+   0.02742650970835694820007383626250582045118415516165097599728093749937650,
+   0.02742650970835694820007383626250582045118415516165097599728093749937650,
+   0.02357076083932437914051930137844923022172973852218859873423906486456506,
+   0.02357076083932437914051930137844923022172973852218859873423906486456506,
+   0.01961616045735552781446071965221270969581303773413223918112083050740925,
+   0.01961616045735552781446071965221270969581303773413223918112083050740925,
+   0.01557931572294384872817695583446031397637626899155246951309343105269243,
+   0.01557931572294384872817695583446031397637626899155246951309343105269243,
+   0.01147723457923453948959266760909162808642050630874764065376681674103504,
+   0.01147723457923453948959266760909162808642050630874764065376681674103504,
+   0.00732755390127626210238397962178655005870790255920135327488182954880698,
+   0.00732755390127626210238397962178655005870790255920135327488182954880698,
+   0.00315334605230583863267731154389148757828393883169362229520949325031959,
+   0.00315334605230583863267731154389148757828393883169362229520949325031959,
+  // Order 49;
+   0.06346328140479059771825346787952963499962952230825221918577749709540971,
+   0.06333550929649174859083692740009052014797141656482582044731117607574844,
+   0.06333550929649174859083692740009052014797141656482582044731117607574844,
+   0.06295270746519569947439955578289100636372542776957004137230575183762572,
+   0.06295270746519569947439955578289100636372542776957004137230575183762572,
+   0.06231641732005726740107682521594970422413353622132083384423851912547607,
+   0.06231641732005726740107682521594970422413353622132083384423851912547607,
+   0.06142920097919293629682664614030107494319000919209793372105041005294553,
+   0.06142920097919293629682664614030107494319000919209793372105041005294553,
+   0.06029463095315201730310611687554159049777650891972548781495204583168153,
+   0.06029463095315201730310611687554159049777650891972548781495204583168153,
+   0.05891727576002726602452765074249251626249611385947945979416544168624078,
+   0.05891727576002726602452765074249251626249611385947945979416544168624078,
+   0.05730268153018747548516459235081653635058043880311968159066044315620183,
+   0.05730268153018747548516459235081653635058043880311968159066044315620183,
+   0.05545734967480358869043158148269806720425152407379438375832397303490421,
+   0.05545734967480358869043158148269806720425152407379438375832397303490421,
+   0.05338871070825896852794293373017620616558606944822720942216824895397361,
+   0.05338871070825896852794293373017620616558606944822720942216824895397361,
+   0.05110509433014459067462280604931856138961244932974338891455793740664447,
+   0.05110509433014459067462280604931856138961244932974338891455793740664447,
+   0.04861569588782824027765119728786853088136892861859307263924063514609524,
+   0.04861569588782824027765119728786853088136892861859307263924063514609524,
+   0.04593053935559585354249961997212767100882432235462340867676276848035008,
+   0.04593053935559585354249961997212767100882432235462340867676276848035008,
+   0.04306043698125959798834548400103849580671358123982176010434847450816205,
+   0.04306043698125959798834548400103849580671358123982176010434847450816205,
+   0.04001694576637302136860503674310332142786460746500146849349349445026552,
+   0.04001694576637302136860503674310332142786460746500146849349349445026552,
+   0.03681232096300068981946723669888229500136155240598295693885910098531120,
+   0.03681232096300068981946723669888229500136155240598295693885910098531120,
+   0.03345946679162217434248715089168920184947986786022845559378921866639077,
+   0.03345946679162217434248715089168920184947986786022845559378921866639077,
+   0.02997188462058382535069055807414721006207203595087682892055574360266735,
+   0.02997188462058382535069055807414721006207203595087682892055574360266735,
+   0.02636361892706601696094574523974204769446097176574050822775245491359286,
+   0.02636361892706601696094574523974204769446097176574050822775245491359286,
+   0.02264920158744667649877096421604288732679749902326477597624388874547094,
+   0.02264920158744667649877096421604288732679749902326477597624388874547094,
+   0.01884359585308945844445065339110734926774990201925228031145954277187979,
+   0.01884359585308945844445065339110734926774990201925228031145954277187979,
+   0.01496214493562465102958431912020150403628101637276727864603814712394542,
+   0.01496214493562465102958431912020150403628101637276727864603814712394542,
+   0.01102055103159358049750828816683333275219356054495774496238045272607110,
+   0.01102055103159358049750828816683333275219356054495774496238045272607110,
+   0.00703509959008645147345067831134841086286385703902733685121839711947315,
+   0.00703509959008645147345067831134841086286385703902733685121839711947315,
+   0.00302727898892290507748069817582714097283004200383177338523498505117749,
+   0.00302727898892290507748069817582714097283004200383177338523498505117749,
+  // Order 50;
+   0.06217661665534726232103310736061343086768246920102663310116563761975761,
+   0.06217661665534726232103310736061343086768246920102663310116563761975761,
+   0.06193606742068324338408750978083068857287705669124490494275970611695482,
+   0.06193606742068324338408750978083068857287705669124490494275970611695482,
+   0.06145589959031666375640678608391537509726757576400751430922405035905911,
+   0.06145589959031666375640678608391537509726757576400751430922405035905911,
+   0.06073797084177021603175001538481100160979927323540353572319677456175958,
+   0.06073797084177021603175001538481100160979927323540353572319677456175958,
+   0.05978505870426545750957640531258523079666604207266900458524197880361922,
+   0.05978505870426545750957640531258523079666604207266900458524197880361922,
+   0.05860084981322244583512243663084846620976751344402547331325034247535448,
+   0.05860084981322244583512243663084846620976751344402547331325034247535448,
+   0.05718992564772838372302931506599316301157537225709175493685378135280493,
+   0.05718992564772838372302931506599316301157537225709175493685378135280493,
+   0.05555774480621251762356742561226949759513529998390267581717277851031855,
+   0.05555774480621251762356742561226949759513529998390267581717277851031855,
+   0.05371062188899624652345879725566455276802321352992215304589999918159652,
+   0.05371062188899624652345879725566455276802321352992215304589999918159652,
+   0.05165570306958113848990529584009527964982544939543964509953318645119218,
+   0.05165570306958113848990529584009527964982544939543964509953318645119218,
+   0.04940093844946631492124358075143272869228705096661312479212356024806985,
+   0.04940093844946631492124358075143272869228705096661312479212356024806985,
+   0.04695505130394843296563301363498768251406430618605272996580427934336506,
+   0.04695505130394843296563301363498768251406430618605272996580427934336506,
+   0.04432750433880327549202228683039419746076129835545316566323190682762273,
+   0.04432750433880327549202228683039419746076129835545316566323190682762273,
+   0.04152846309014769742241197896406701780897797548584099007703697795218528,
+   0.04152846309014769742241197896406701780897797548584099007703697795218528,
+   0.03856875661258767524477015023638593486477170500051892651080740015226675,
+   0.03856875661258767524477015023638593486477170500051892651080740015226675,
+   0.03545983561514615416073461100097579709696000049698447091287045085997117,
+   0.03545983561514615416073461100097579709696000049698447091287045085997117,
+   0.03221372822357801664816582732300395344858905883342521715832960541591130,
+   0.03221372822357801664816582732300395344858905883342521715832960541591130,
+   0.02884299358053519802990637311323243251784686559353745783571262305626533,
+   0.02884299358053519802990637311323243251784686559353745783571262305626533,
+   0.02536067357001239044019487838544272346016125997571213733939633295203776,
+   0.02536067357001239044019487838544272346016125997571213733939633295203776,
+   0.02178024317012479298159206906269034122731346235793429604402713944767083,
+   0.02178024317012479298159206906269034122731346235793429604402713944767083,
+   0.01811556071348939035125994342235461984466731704973403542645291587336229,
+   0.01811556071348939035125994342235461984466731704973403542645291587336229,
+   0.01438082276148557441937890892732434993703178617058789277210162215425174,
+   0.01438082276148557441937890892732434993703178617058789277210162215425174,
+   0.01059054838365096926356968149924102233940181908645912945633471714564916,
+   0.01059054838365096926356968149924102233940181908645912945633471714564916,
+   0.00675979919574540150277887817798503180187383240646681055287870585540300,
+   0.00675979919574540150277887817798503180187383240646681055287870585540300,
+   0.00290862255315514095840072434285548080667299645994632061859352728355077,
+   0.00290862255315514095840072434285548080667299645994632061859352728355077,
+  // Order 51;
+   0.06099892484120588015979764309835605055712180152657844981331939359420387,
+   0.06088546484485634388119861422269621972807601028027365238002650290988038,
+   0.06088546484485634388119861422269621972807601028027365238002650290988038,
+   0.06054550693473779513812525146775416275368493437724097338782809100159316,
+   0.06054550693473779513812525146775416275368493437724097338782809100159316,
+   0.05998031577750325209006398799651711617306209554543300357033930307502457,
+   0.05998031577750325209006398799651711617306209554543300357033930307502457,
+   0.05919199392296154378353900774915460887093004603607117948184737093364014,
+   0.05919199392296154378353900774915460887093004603607117948184737093364014,
+   0.05818347398259214059843787766177593266780125764454458260422124493329750,
+   0.05818347398259214059843787766177593266780125764454458260422124493329750,
+   0.05695850772025866210007772673427716487840945032509279446545634266060768,
+   0.05695850772025866210007772673427716487840945032509279446545634266060768,
+   0.05552165209573869301673705909362416078086370541559638841304120999499752,
+   0.05552165209573869301673705909362416078086370541559638841304120999499752,
+   0.05387825231304556143409930169697198376005996774044533168072578604858693,
+   0.05387825231304556143409930169697198376005996774044533168072578604858693,
+   0.05203442193669708756413644746866237321548397471438220298709979379203826,
+   0.05203442193669708756413644746866237321548397471438220298709979379203826,
+   0.04999702015005740977954885536200578556873674938598670749131350575671287,
+   0.04999702015005740977954885536200578556873674938598670749131350575671287,
+   0.04777362624062310199999535370735361734053928047565788767739010836644397,
+   0.04777362624062310199999535370735361734053928047565788767739010836644397,
+   0.04537251140765006874816681498843785131382995671950964358704561190531300,
+   0.04537251140765006874816681498843785131382995671950964358704561190531300,
+   0.04280260799788008665360951424428570083717527402185207761513652063130118,
+   0.04280260799788008665360951424428570083717527402185207761513652063130118,
+   0.04007347628549645318680911592139591120116433102873524205105922524479599,
+   0.04007347628549645318680911592139591120116433102873524205105922524479599,
+   0.03719526892326029284290827581187102513411271037373731002613080499925731,
+   0.03719526892326029284290827581187102513411271037373731002613080499925731,
+   0.03417869320418833623620933859476752904882586358309770474514690332880245,
+   0.03417869320418833623620933859476752904882586358309770474514690332880245,
+   0.03103497129016000845442550295654737729610897816621751289774925456962435,
+   0.03103497129016000845442550295654737729610897816621751289774925456962435,
+   0.02777579859416247719599566563220891636835124864853783957696764020261338,
+   0.02777579859416247719599566563220891636835124864853783957696764020261338,
+   0.02441330057378143427314156541689820874368317047202818414742999942270097,
+   0.02441330057378143427314156541689820874368317047202818414742999942270097,
+   0.02095998840170321057979261840151417207304048518843009609646063386271994,
+   0.02095998840170321057979261840151417207304048518843009609646063386271994,
+   0.01742871472340105225950364643329243556835677829361894028635421620807247,
+   0.01742871472340105225950364643329243556835677829361894028635421620807247,
+   0.01383263400647782229668845302185641595601855207657203854868743591716610,
+   0.01383263400647782229668845302185641595601855207657203854868743591716610,
+   0.01018519129782172993923759178660672838581163608421210042111508522888862,
+   0.01018519129782172993923759178660672838581163608421210042111508522888862,
+   0.00650033778325260029210937519853752883309494300542583878500699911081910,
+   0.00650033778325260029210937519853752883309494300542583878500699911081910,
+   0.00279680717108989557554421688180904822421769963401154216976071309800023,
+   0.00279680717108989557554421688180904822421769963401154216976071309800023,
+  // Order 52;
+   0.05981036574529186024778537881147746094448080363041406293257631474944096,
+   0.05981036574529186024778537881147746094448080363041406293257631474944096,
+   0.05959626017124815825831087874841495366227728038194191553858078112162012,
+   0.05959626017124815825831087874841495366227728038194191553858078112162012,
+   0.05916881546604297036933200239487097832541705221759787978651135245990749,
+   0.05916881546604297036933200239487097832541705221759787978651135245990749,
+   0.05852956177181386855029059897162369363806873274232559883732177028495582,
+   0.05852956177181386855029059897162369363806873274232559883732177028495582,
+   0.05768078745252682765393199766340351953943983505133758448624815317493644,
+   0.05768078745252682765393199766340351953943983505133758448624815317493644,
+   0.05662553090236859719080824047837015056722007281471467622398864982654081,
+   0.05662553090236859719080824047837015056722007281471467622398864982654081,
+   0.05536756966930265254904109345121858229015400325104202341311441181128317,
+   0.05536756966930265254904109345121858229015400325104202341311441181128317,
+   0.05391140693275726475083682489379995957660124695930512588481830015599989,
+   0.05391140693275726475083682489379995957660124695930512588481830015599989,
+   0.05226225538390699303439414442639214370819907808586698487735716805149770,
+   0.05226225538390699303439414442639214370819907808586698487735716805149770,
+   0.05042601856634237721821125408285875446257795876553979698868379894233930,
+   0.05042601856634237721821125408285875446257795876553979698868379894233930,
+   0.04840926974407489685396024928604627800974952172846339728480275627682889,
+   0.04840926974407489685396024928604627800974952172846339728480275627682889,
+   0.04621922837278479350764570533528463922390102162642284050803176581601516,
+   0.04621922837278479350764570533528463922390102162642284050803176581601516,
+   0.04386373425900040799512966557876445016416066653020481599622463392413786,
+   0.04386373425900040799512966557876445016416066653020481599622463392413786,
+   0.04135121950056027167904028642395516293826996931546422766745989246093808,
+   0.04135121950056027167904028642395516293826996931546422766745989246093808,
+   0.03869067831042397898510120674035264692807826599356458606496817232984652,
+   0.03869067831042397898510120674035264692807826599356458606496817232984652,
+   0.03589163483509723294194239328528073878533850306517263626939429118364043,
+   0.03589163483509723294194239328528073878533850306517263626939429118364043,
+   0.03296410908971879791501004477869519617672739257458434880039661383079678,
+   0.03296410908971879791501004477869519617672739257458434880039661383079678,
+   0.02991858114714394664128206873997088793212331551058751748347937246274934,
+   0.02991858114714394664128206873997088793212331551058751748347937246274934,
+   0.02676595374650401344949308028601837885526188449905828725703099643785110,
+   0.02676595374650401344949308028601837885526188449905828725703099643785110,
+   0.02351751355398446159032251991005460942922912900298550122542924911287104,
+   0.02351751355398446159032251991005460942922912900298550122542924911287104,
+   0.02018489150798079220298903420947823723671246708480782019070531530228049,
+   0.02018489150798079220298903420947823723671246708480782019070531530228049,
+   0.01678002339630073567792153687052016208341580916381851600713990987262948,
+   0.01678002339630073567792153687052016208341580916381851600713990987262948,
+   0.01331511498234096065660034447779914855467649973330439121966134743071179,
+   0.01331511498234096065660034447779914855467649973330439121966134743071179,
+   0.00980263457946275206195116811668950232783841185727930527350477273583852,
+   0.00980263457946275206195116811668950232783841185727930527350477273583852,
+   0.00625552396297327689971610216981454661641170465313125936379966235304381,
+   0.00625552396297327689971610216981454661641170465313125936379966235304381,
+   0.00269131695004711111895217986884521802366937376106490041877054789129900,
+   0.00269131695004711111895217986884521802366937376106490041877054789129900,
+  // Order 53;
+   0.05871879415116436452548694444213412627499371709785266226244771814835431,
+   0.05861758623272026331807193704998894153459948066227698693032819683831926,
+   0.05861758623272026331807193704998894153459948066227698693032819683831926,
+   0.05831431136225600755627575633769725605207995124425473567259895075446619,
+   0.05831431136225600755627575633769725605207995124425473567259895075446619,
+   0.05781001499171319631968307609725206286002901123847586495932138471780213,
+   0.05781001499171319631968307609725206286002901123847586495932138471780213,
+   0.05710643553626719177338333929841884133883449542461306172958758742439743,
+   0.05710643553626719177338333929841884133883449542461306172958758742439743,
+   0.05620599838173970980865506209144499375145722517480364181215319614488340,
+   0.05620599838173970980865506209144499375145722517480364181215319614488340,
+   0.05511180752393359900234970476586738755141248848982662206673135645153434,
+   0.05511180752393359900234970476586738755141248848982662206673135645153434,
+   0.05382763486873102904208144163540267431281019967891202025726594002035927,
+   0.05382763486873102904208144163540267431281019967891202025726594002035927,
+   0.05235790722987271819970152098936070445441970869721568363755381371609439,
+   0.05235790722987271819970152098936070445441970869721568363755381371609439,
+   0.05070769106929271529648548263453053759999037333659381474070476069716211,
+   0.05070769106929271529648548263453053759999037333659381474070476069716211,
+   0.04888267503269914042044840758358408340658451464626829287555946352368855,
+   0.04888267503269914042044840758358408340658451464626829287555946352368855,
+   0.04688915034075031402187263956510494786582553583330362615045061555831821,
+   0.04688915034075031402187263956510494786582553583330362615045061555831821,
+   0.04473398910367281021276564591856360613760188371714790084185652290504831,
+   0.04473398910367281021276564591856360613760188371714790084185652290504831,
+   0.04242462063452001359228163756845039880656420797542300726849716531273374,
+   0.04242462063452001359228163756845039880656420797542300726849716531273374,
+   0.03996900584354038212709354578786362591900846337496486547030883453879807,
+   0.03996900584354038212709354578786362591900846337496486547030883453879807,
+   0.03737560980348291567417197278539422220984809437251855855145276888409983,
+   0.03737560980348291567417197278539422220984809437251855855145276888409983,
+   0.03465337258353423795838772051301071357131793543058093603374128825215722,
+   0.03465337258353423795838772051301071357131793543058093603374128825215722,
+   0.03181167845901932306323586203108092026068007008704328444619058208232642,
+   0.03181167845901932306323586203108092026068007008704328444619058208232642,
+   0.02886032361782373626279955304358326186266920628984852731581098132080263,
+   0.02886032361782373626279955304358326186266920628984852731581098132080263,
+   0.02580948251075751771396188816662944090375041844226550362291877373001380,
+   0.02580948251075751771396188816662944090375041844226550362291877373001380,
+   0.02266967305707020839878927523982780946824880780511678449638206089763785,
+   0.02266967305707020839878927523982780946824880780511678449638206089763785,
+   0.01945172110763689538804692222749694041944736471649366710797346223480058,
+   0.01945172110763689538804692222749694041944736471649366710797346223480058,
+   0.01616672525668746392806082840403990143773473139701918047313914819020532,
+   0.01616672525668746392806082840403990143773473139701918047313914819020532,
+   0.01282602614424037917915018296920373176816400873455310424661834272329319,
+   0.01282602614424037917915018296920373176816400873455310424661834272329319,
+   0.00944120228494034438666217882032514328370781491404681092733733718535537,
+   0.00944120228494034438666217882032514328370781491404681092733733718535537,
+   0.00602427622694867328124170681629985910095415207448441755891710644047360,
+   0.00602427622694867328124170681629985910095415207448441755891710644047360,
+   0.00259168372056703181159923943851093098476299769302276967537650038105163,
+   0.00259168372056703181159923943851093098476299769302276967537650038105163,
+  // Order 54;
+   0.05761753670714702467237612880587147717290174472156057228594420626657967,
+   0.05761753670714702467237612880587147717290174472156057228594420626657967,
+   0.05742613705411211485929013177320682938921905705042538570966884420096481,
+   0.05742613705411211485929013177320682938921905705042538570966884420096481,
+   0.05704397355879459856782843425422721209921173621254635390334358990632843,
+   0.05704397355879459856782843425422721209921173621254635390334358990632843,
+   0.05647231573062596503104426468176124795373736212708364234163537062593114,
+   0.05647231573062596503104426468176124795373736212708364234163537062593114,
+   0.05571306256058998768336981742737111068471171711579847786963342747259737,
+   0.05571306256058998768336981742737111068471171711579847786963342747259737,
+   0.05476873621305798630622263471710902072462106656235504863586619578526997,
+   0.05476873621305798630622263471710902072462106656235504863586619578526997,
+   0.05364247364755361127210062772524657686281585960856543988832153223709867,
+   0.05364247364755361127210062772524657686281585960856543988832153223709867,
+   0.05233801619829874466558869475268501318043176697346810288183734923161872,
+   0.05233801619829874466558869475268501318043176697346810288183734923161872,
+   0.05085969714618814431970920697611874591206026538933171477183219325915578,
+   0.05085969714618814431970920697611874591206026538933171477183219325915578,
+   0.04921242732452888606879063036881162807750411298006268163463860651131751,
+   0.04921242732452888606879063036881162807750411298006268163463860651131751,
+   0.04740167880644499105857641011532360363820658898325060882003138912059444,
+   0.04740167880644499105857641011532360363820658898325060882003138912059444,
+   0.04543346672827671397485218075154457153377563901767108151466001311347287,
+   0.04543346672827671397485218075154457153377563901767108151466001311347287,
+   0.04331432930959701544192576037050811819628912404384968865020927949557863,
+   0.04331432930959701544192576037050811819628912404384968865020927949557863,
+   0.04105130613664497422171821087760433419378279744645468875461778782507117,
+   0.04105130613664497422171821087760433419378279744645468875461778782507117,
+   0.03865191478210251683685713905157987623901150935572855403726863251289616,
+   0.03865191478210251683685713905157987623901150935572855403726863251289616,
+   0.03612412584038355258288707420742484597857307993016732988915664349545930,
+   0.03612412584038355258288707420742484597857307993016732988915664349545930,
+   0.03347633646437264571604044483561079271487860742368377296433716762007134,
+   0.03347633646437264571604044483561079271487860742368377296433716762007134,
+   0.03071734249787067605400460991615491101996221207716046549032900324522575,
+   0.03071734249787067605400460991615491101996221207716046549032900324522575,
+   0.02785630931059587028700203476391515123730993562574269655501326421308208,
+   0.02785630931059587028700203476391515123730993562574269655501326421308208,
+   0.02490274146720877305005497127338904257562313287912336035346538542175832,
+   0.02490274146720877305005497127338904257562313287912336035346538542175832,
+   0.02186645142285308594551042653887930098157031656297244206788430667228368,
+   0.02186645142285308594551042653887930098157031656297244206788430667228368,
+   0.01875752762146937791200798428407116268863557474271134279795529856369913,
+   0.01875752762146937791200798428407116268863557474271134279795529856369913,
+   0.01558630303592413170296890970583676546858782235763989620131667134487859,
+   0.01558630303592413170296890970583676546858782235763989620131667134487859,
+   0.01236332812884764416646782426018809646399449894843369304205698366895804,
+   0.01236332812884764416646782426018809646399449894843369304205698366895804,
+   0.00909936945550939694803352106241926172187472240798218020754111730835186,
+   0.00909936945550939694803352106241926172187472240798218020754111730835186,
+   0.00580561101523998487882588774587527341152465198940366678933914155464418,
+   0.00580561101523998487882588774587527341152465198940366678933914155464418,
+   0.00249748183576158577594603875726602987918509746682711194209659932711243,
+   0.00249748183576158577594603875726602987918509746682711194209659932711243,
+  // Order 55;
+   0.05660297644456042544010576198124400403896915010159945889497439541176898,
+   0.05651231824977200140065836763518905413968818315825191562404359576561677,
+   0.05651231824977200140065836763518905413968818315825191562404359576561677,
+   0.05624063407108436802827908809019782727606125971386301467351620853765777,
+   0.05624063407108436802827908809019782727606125971386301467351620853765777,
+   0.05578879419528408710293600710991971467246753538858332235647954503977109,
+   0.05578879419528408710293600710991971467246753538858332235647954503977109,
+   0.05515824600250868759665113956066672143253063739720572710871928797674335,
+   0.05515824600250868759665113956066672143253063739720572710871928797674335,
+   0.05435100932991110207032211815377214880581330910869009512811475750820091,
+   0.05435100932991110207032211815377214880581330910869009512811475750820091,
+   0.05336967000160547272357051563609785372700006314668285835364021748550072,
+   0.05336967000160547272357051563609785372700006314668285835364021748550072,
+   0.05221737154563208456439356328129500996674208580535087948031549273269866,
+   0.05221737154563208456439356328129500996674208580535087948031549273269866,
+   0.05089780512449397922477527428808343882168554091467107377669294467870265,
+   0.05089780512449397922477527428808343882168554091467107377669294467870265,
+   0.04941519771155173948075853901603927568188155532831528744410563292139029,
+   0.04941519771155173948075853901603927568188155532831528744410563292139029,
+   0.04777429855120069555003671471605592563381830714428823679782248112982642,
+   0.04777429855120069555003671471605592563381830714428823679782248112982642,
+   0.04598036394628383810390486087207466812211115409086204050193821902510970,
+   0.04598036394628383810390486087207466812211115409086204050193821902510970,
+   0.04403914042160658989516808565329287313462904494529047512893953712297578,
+   0.04403914042160658989516808565329287313462904494529047512893953712297578,
+   0.04195684631771876239520731669214412257656635822077835229273424789883447,
+   0.04195684631771876239520731669214412257656635822077835229273424789883447,
+   0.03974015187433717960946383190339983586802685138168597880792989033879793,
+   0.03974015187433717960946383190339983586802685138168597880792989033879793,
+   0.03739615786796554528291559858245754951510340150392099097402662484817202,
+   0.03739615786796554528291559858245754951510340150392099097402662484817202,
+   0.03493237287358988740726822680270648797428746128966276201367537046896181,
+   0.03493237287358988740726822680270648797428746128966276201367537046896181,
+   0.03235668922618583168470559187577686575766839503119350412479536583413783,
+   0.03235668922618583168470559187577686575766839503119350412479536583413783,
+   0.02967735776516104122129650618688536022985864059432973507430640749894869,
+   0.02967735776516104122129650618688536022985864059432973507430640749894869,
+   0.02690296145639627066712002865377909714337666113268002073542511747689528,
+   0.02690296145639627066712002865377909714337666113268002073542511747689528,
+   0.02404238800972562200779157292860345849924615056183080909277455050661017,
+   0.02404238800972562200779157292860345849924615056183080909277455050661017,
+   0.02110480166801645412020930562369833448093437406191705141817264263051741,
+   0.02110480166801645412020930562369833448093437406191705141817264263051741,
+   0.01809961452072906240796820264341223040277849453755297213222489679666912,
+   0.01809961452072906240796820264341223040277849453755297213222489679666912,
+   0.01503645833351178821315089890193728171182224949953581758215770257414126,
+   0.01503645833351178821315089890193728171182224949953581758215770257414126,
+   0.01192516071984861217075255315758988829264034744798894921441742270636432,
+   0.01192516071984861217075255315758988829264034744798894921441742270636432,
+   0.00877574610705852817738960068331783816445644076069593519617199132366699,
+   0.00877574610705852817738960068331783816445644076069593519617199132366699,
+   0.00559863226656076735408341687185985724515129524166675999706187433702123,
+   0.00559863226656076735408341687185985724515129524166675999706187433702123,
+   0.00240832361997978881917019348912527870416962754170570552231077713018288,
+   0.00240832361997978881917019348912527870416962754170570552231077713018288,
+  // Order 56;
+   0.05557974630651439584627342683516117014406662255634295900417220875365757,
+   0.05557974630651439584627342683516117014406662255634295900417220875365757,
+   0.05540795250324512321779339184391001890956203138066301799579294868838796,
+   0.05540795250324512321779339184391001890956203138066301799579294868838796,
+   0.05506489590176242579630459754785032534135551280065901257751427186576637,
+   0.05506489590176242579630459754785032534135551280065901257751427186576637,
+   0.05455163687088942106175065489009017994406072378091635263215900515518769,
+   0.05455163687088942106175065489009017994406072378091635263215900515518769,
+   0.05386976186571448570895441040669799424792453567188824744844644930517314,
+   0.05386976186571448570895441040669799424792453567188824744844644930517314,
+   0.05302137852401076396799155860769146872738143408102400654960592957146809,
+   0.05302137852401076396799155860769146872738143408102400654960592957146809,
+   0.05200910915174139984305226482748472167053258531290135838776782023347393,
+   0.05200910915174139984305226482748472167053258531290135838776782023347393,
+   0.05083608261779848056012401847019865598299163793208421551375660902813689,
+   0.05083608261779848056012401847019865598299163793208421551375660902813689,
+   0.04950592468304757891996604643084555641871884907131799595682924113468048,
+   0.04950592468304757891996604643084555641871884907131799595682924113468048,
+   0.04802274679360025812073550566699971214401687677002427010031478823220854,
+   0.04802274679360025812073550566699971214401687677002427010031478823220854,
+   0.04639113337300189676219019106649603423460980610050049030557563163824913,
+   0.04639113337300189676219019106649603423460980610050049030557563163824913,
+   0.04461612765269228321341519292762374032584643841629670422564705254998945,
+   0.04461612765269228321341519292762374032584643841629670422564705254998945,
+   0.04270321608466708651103857236247708089347094596661757489041502918688311,
+   0.04270321608466708651103857236247708089347094596661757489041502918688311,
+   0.04065831138474451788012502277885276307554227304905272231839991774347583,
+   0.04065831138474451788012502277885276307554227304905272231839991774347583,
+   0.03848773425924766248682559162338127934381963468148201326099569683990080,
+   0.03848773425924766248682559162338127934381963468148201326099569683990080,
+   0.03619819387231518603588446828888624540063023467231421692084602665646780,
+   0.03619819387231518603588446828888624540063023467231421692084602665646780,
+   0.03379676711561176129542663122544704981760707167826714515412135920214319,
+   0.03379676711561176129542663122544704981760707167826714515412135920214319,
+   0.03129087674731044786783547779302534697784601318722771661424612065909786,
+   0.03129087674731044786783547779302534697784601318722771661424612065909786,
+   0.02868826847382274172988588443039427260413413704684522936686237448179409,
+   0.02868826847382274172988588443039427260413413704684522936686237448179409,
+   0.02599698705839195219181943220727235144801025205069435937331709245680726,
+   0.02599698705839195219181943220727235144801025205069435937331709245680726,
+   0.02322535156256531693725815757678852655572201982457900443380382771045252,
+   0.02322535156256531693725815757678852655572201982457900443380382771045252,
+   0.02038192988240257263480598366693334750711946439861200845022642425448198,
+   0.02038192988240257263480598366693334750711946439861200845022642425448198,
+   0.01747551291140094650495936890545715023078028057687649000660827930110062,
+   0.01747551291140094650495936890545715023078028057687649000660827930110062,
+   0.01451508927802147180777074053301299102409619849924425759019071493895799,
+   0.01451508927802147180777074053301299102409619849924425759019071493895799,
+   0.01150982434038338217377275932449711927485590481796914358535504066772954,
+   0.01150982434038338217377275932449711927485590481796914358535504066772954,
+   0.00846906316330788766162711237500816017607748757412691594893727036234005,
+   0.00846906316330788766162711237500816017607748757412691594893727036234005,
+   0.00540252224601533776131126094412087284162781818411397735758557792943458,
+   0.00540252224601533776131126094412087284162781818411397735758557792943458,
+   0.00232385537577321550110227644339586473759320991735859403050729145255354,
+   0.00232385537577321550110227644339586473759320991735859403050729145255354,
+  // Order 57;
+   0.05463432875658402406284138798805207653622876414854290646187740966799247,
+   0.05455280360476188648013899536419651447601534822950253908594385002828643,
+   0.05455280360476188648013899536419651447601534822950253908594385002828643,
+   0.05430847145249864313874677295479156026337757612847777236257665487125484,
+   0.05430847145249864313874677295479156026337757612847777236257665487125484,
+   0.05390206148329857464280948173060145348662767458734071680956549901265619,
+   0.05390206148329857464280948173060145348662767458734071680956549901265619,
+   0.05333478658481915842657697799144062509594704623784393728224997430378570,
+   0.05333478658481915842657697799144062509594704623784393728224997430378570,
+   0.05260833972917743244023138164088418962525591642898259276857039772259059,
+   0.05260833972917743244023138164088418962525591642898259276857039772259059,
+   0.05172488892051782472062390866514698062586927648945425530305851454895094,
+   0.05172488892051782472062390866514698062586927648945425530305851454895094,
+   0.05068707072492740865664042556363657955310479871164995364866106771432984,
+   0.05068707072492740865664042556363657955310479871164995364866106771432984,
+   0.04949798240201967899383794449938792626467289607625868535088436991370345,
+   0.04949798240201967899383794449938792626467289607625868535088436991370345,
+   0.04816117266168775126885105175681673671624285431952997775093367719818216,
+   0.04816117266168775126885105175681673671624285431952997775093367719818216,
+   0.04668063107364150378384089277883357088305499652429297785818413672688200,
+   0.04668063107364150378384089277883357088305499652429297785818413672688200,
+   0.04506077616138115779721352952583297035411133664160267419485298209316888,
+   0.04506077616138115779721352952583297035411133664160267419485298209316888,
+   0.04330644221621519659643210832842612570436465134272580841839197899323189,
+   0.04330644221621519659643210832842612570436465134272580841839197899323189,
+   0.04142286487080111036319690527361043096013511409120154192027098366315577,
+   0.04142286487080111036319690527361043096013511409120154192027098366315577,
+   0.03941566547548011408995272080105550425081517273229457310300034571486597,
+   0.03941566547548011408995272080105550425081517273229457310300034571486597,
+   0.03729083432441731735473526399569896555396987240876805637712711352847729,
+   0.03729083432441731735473526399569896555396987240876805637712711352847729,
+   0.03505471278231261750575097059655006445690125567594090182504225398873138,
+   0.03505471278231261750575097059655006445690125567594090182504225398873138,
+   0.03271397436637156854249010991039349828457476863893067106633468048310271,
+   0.03271397436637156854249010991039349828457476863893067106633468048310271,
+   0.03027560484269399945849059883313721118511845450533766815261805094124224,
+   0.03027560484269399945849059883313721118511845450533766815261805094124224,
+   0.02774688140218019232125795003836375916962084631599526178804628663172975,
+   0.02774688140218019232125795003836375916962084631599526178804628663172975,
+   0.02513535099091812264727378814095548797588091260733460529191558699557253,
+   0.02513535099091812264727378814095548797588091260733460529191558699557253,
+   0.02244880789077643807968923884509088043879620196066273172890977743278717,
+   0.02244880789077643807968923884509088043879620196066273172890977743278717,
+   0.01969527069948852038242245227351485842469704057783950121444114944314285,
+   0.01969527069948852038242245227351485842469704057783950121444114944314285,
+   0.01688295902344154903500082156683327644630596502000044040784924462421883,
+   0.01688295902344154903500082156683327644630596502000044040784924462421883,
+   0.01402027079075355617024715133815025132282684822381284561086045151881263,
+   0.01402027079075355617024715133815025132282684822381284561086045151881263,
+   0.01111576373233599014567544876819003913959043336317862208061157763521781,
+   0.01111576373233599014567544876819003913959043336317862208061157763521781,
+   0.00817816006782123262621099813037940186470942609118705155594958031752640,
+   0.00817816006782123262621099813037940186470942609118705155594958031752640,
+   0.00521653347471877939050662987142008532303141539042764462067331870142347,
+   0.00521653347471877939050662987142008532303141539042764462067331870142347,
+   0.00224375387225066290973478682263501388626751860515453919153779041897407,
+   0.00224375387225066290973478682263501388626751860515453919153779041897407,
+  // Order 58;
+   0.05368111986333484886390595530572461290068199200236194362665462773657470,
+   0.05368111986333484886390595530572461290068199200236194362665462773657470,
+   0.05352634330405825210061081388617018054196748949032392150172316983782372,
+   0.05352634330405825210061081388617018054196748949032392150172316983782372,
+   0.05321723644657901410348098437738479321245792330452184508928871710075898,
+   0.05321723644657901410348098437738479321245792330452184508928871710075898,
+   0.05275469052637083342964576723152317176493359291733747981399214644883951,
+   0.05275469052637083342964576723152317176493359291733747981399214644883951,
+   0.05214003918366981897126055606007182576102169013424334435791077209112682,
+   0.05214003918366981897126055606007182576102169013424334435791077209112682,
+   0.05137505461828572547451482061106538030295810809562320193466052870404921,
+   0.05137505461828572547451482061106538030295810809562320193466052870404921,
+   0.05046194247995312529765982156763177804748796636254514957804189971032262,
+   0.05046194247995312529765982156763177804748796636254514957804189971032262,
+   0.04940333550896239286651086571270131965064442266936116841764727520013401,
+   0.04940333550896239286651086571270131965064442266936116841764727520013401,
+   0.04820228594541774840657040610986690657503071362684686259635555762567868,
+   0.04820228594541774840657040610986690657503071362684686259635555762567868,
+   0.04686225672902634691841807803792003485091361097497449454375913079567662,
+   0.04686225672902634691841807803792003485091361097497449454375913079567662,
+   0.04538711151481980250398053608886604914916176864495213521148254008578308,
+   0.04538711151481980250398053608886604914916176864495213521148254008578308,
+   0.04378110353364025103902569234833607324275611766009737826160540483654613,
+   0.04378110353364025103902569234833607324275611766009737826160540483654613,
+   0.04204886332958212599456998191725423146226654023551906034594302298644131,
+   0.04204886332958212599456998191725423146226654023551906034594302298644131,
+   0.04019538540986779688807675082688229235791404022070778443566244178491630,
+   0.04019538540986779688807675082688229235791404022070778443566244178491630,
+   0.03822601384585843322945903445714854006594276398631915647282201867928806,
+   0.03822601384585843322945903445714854006594276398631915647282201867928806,
+   0.03614642686708727054078085697585522723334279129912698339317710840393446,
+   0.03614642686708727054078085697585522723334279129912698339317710840393446,
+   0.03396262049341601079772755518458479943878377639496480055482245188802654,
+   0.03396262049341601079772755518458479943878377639496480055482245188802654,
+   0.03168089125380932732029203962195029668728616452408798732590671787818813,
+   0.03168089125380932732029203962195029668728616452408798732590671787818813,
+   0.02930781804416049071839402688844381003496160137195318956252433229639968,
+   0.02930781804416049071839402688844381003496160137195318956252433229639968,
+   0.02685024318198186847590747867814495559102746465718600657699644688996396,
+   0.02685024318198186847590747867814495559102746465718600657699644688996396,
+   0.02431525272496395254025876062579850974429118651343630588732727641043339,
+   0.02431525272496395254025876062579850974429118651343630588732727641043339,
+   0.02171015614014623576691680949511828992260293407795033703387559773210580,
+   0.02171015614014623576691680949511828992260293407795033703387559773210580,
+   0.01904246546189340865578765948210760393336413293429666221711805451060692,
+   0.01904246546189340865578765948210760393336413293429666221711805451060692,
+   0.01631987423497096505212083041957088748218161052776906015277321400104756,
+   0.01631987423497096505212083041957088748218161052776906015277321400104756,
+   0.01355023711298881214517896640176186183083085318298650165770473127320321,
+   0.01355023711298881214517896640176186183083085318298650165770473127320321,
+   0.01074155353287877411685636191366187372356745001774165828140272137456217,
+   0.01074155353287877411685636191366187372356745001774165828140272137456217,
+   0.00790197384999867475401674567484775950725497451144570022674691420286447,
+   0.00790197384999867475401674567484775950725497451144570022674691420286447,
+   0.00503998161265024308501750117462242355333087943674126261830570679883068,
+   0.00503998161265024308501750117462242355333087943674126261830570679883068,
+   0.00216772324962744994305434292498451143103544022457861832376947271587330,
+   0.00216772324962744994305434292498451143103544022457861832376947271587330,
+  // Order 59;
+   0.05279801262199042141551233243085526729901567440267116843945866306323662,
+   0.05272443385912793196130424887061250287188393750354426697922463948134981,
+   0.05272443385912793196130424887061250287188393750354426697922463948134981,
+   0.05250390264782873905094132201428846536078805848590753052765879020086029,
+   0.05250390264782873905094132201428846536078805848590753052765879020086029,
+   0.05213703364837539138398720830781823387459757987948494976002117346359846,
+   0.05213703364837539138398720830781823387459757987948494976002117346359846,
+   0.05162484939089148214643993977342280859376433774926873706711294734947173,
+   0.05162484939089148214643993977342280859376433774926873706711294734947173,
+   0.05096877742539391685024796899368101009830960978521198926021032331843842,
+   0.05096877742539391685024796899368101009830960978521198926021032331843842,
+   0.05017064634299690281072043044216568214384410571586829528659023598082587,
+   0.05017064634299690281072043044216568214384410571586829528659023598082587,
+   0.04923268067936198577969362001502418838286303587052332727190008485690078,
+   0.04923268067936198577969362001502418838286303587052332727190008485690078,
+   0.04815749471460644038814682928593578396046421872100791110787804417939258,
+   0.04815749471460644038814682928593578396046421872100791110787804417939258,
+   0.04694808518696201919315973648292895223854591747457069802697773745029243,
+   0.04694808518696201919315973648292895223854591747457069802697773745029243,
+   0.04560782294050976983186821315837421141799445972046155764707960177841196,
+   0.04560782294050976983186821315837421141799445972046155764707960177841196,
+   0.04414044353029738069079808473308096858918633266813071768477789710091845,
+   0.04414044353029738069079808473308096858918633266813071768477789710091845,
+   0.04255003681106763866730820048471312744572341334593283115326469575744861,
+   0.04255003681106763866730820048471312744572341334593283115326469575744861,
+   0.04084103553868670766020210808946930868600647590289364049170995470651687,
+   0.04084103553868670766020210808946930868600647590289364049170995470651687,
+   0.03901820301616000950303077721128551341909183793902441697052228259677149,
+   0.03901820301616000950303077721128551341909183793902441697052228259677149,
+   0.03708661981887092269183791703527735827894996394913449146838873374150925,
+   0.03708661981887092269183791703527735827894996394913449146838873374150925,
+   0.03505166963640010878371835896107825111672508118785725456908097468488728,
+   0.03505166963640010878371835896107825111672508118785725456908097468488728,
+   0.03291902427104527775751126435359880808026987655740782528157857869419671,
+   0.03291902427104527775751126435359880808026987655740782528157857869419671,
+   0.03069462783611168323975032819248080535952674800582832962043088276608069,
+   0.03069462783611168323975032819248080535952674800582832962043088276608069,
+   0.02838468020053479790515286933538849877031418376304233583921527631813746,
+   0.02838468020053479790515286933538849877031418376304233583921527631813746,
+   0.02599561973129850018665050680170793271398480973161802306740029754371251,
+   0.02599561973129850018665050680170793271398480973161802306740029754371251,
+   0.02353410539371336342527536007835770029878448503836891520253640093649900,
+   0.02353410539371336342527536007835770029878448503836891520253640093649900,
+   0.02100699828843718735046147321866926505068902778651109394073411038484584,
+   0.02100699828843718735046147321866926505068902778651109394073411038484584,
+   0.01842134275361002936061575105644531831052684871711224009635800424184110,
+   0.01842134275361002936061575105644531831052684871711224009635800424184110,
+   0.01578434731308146614732048039724917037307255386895795190627822188798141,
+   0.01578434731308146614732048039724917037307255386895795190627822188798141,
+   0.01310336630634519101831954648421696696556483923400709095569502566198997,
+   0.01310336630634519101831954648421696696556483923400709095569502566198997,
+   0.01038588550099586219379787441098304036744482914933800613387746267015635,
+   0.01038588550099586219379787441098304036744482914933800613387746267015635,
+   0.00763952945348757514270068297475436525755164120840651149662826727137997,
+   0.00763952945348757514270068297475436525755164120840651149662826727137997,
+   0.00487223916826528476858200113292406855604266062886634061255898083989778,
+   0.00487223916826528476858200113292406855604266062886634061255898083989778,
+   0.00209549228454122340270073148864005976798129321037713635458104260406861,
+   0.00209549228454122340270073148864005976798129321037713635458104260406861,
+  // Order 60;
+   0.05190787763122063973286493836226968018015159556564093559948752392081555,
+   0.05190787763122063973286493836226968018015159556564093559948752392081555,
+   0.05176794317491018754380364302882373293234694549920156407325853688846437,
+   0.05176794317491018754380364302882373293234694549920156407325853688846437,
+   0.05148845150098093399504439717705431173392382665958082480323322905845893,
+   0.05148845150098093399504439717705431173392382665958082480323322905845893,
+   0.05107015606985562740454912073449103536619708311367105474450831793563487,
+   0.05107015606985562740454912073449103536619708311367105474450831793563487,
+   0.05051418453250937459823873574165364323995616273741662814404286974035745,
+   0.05051418453250937459823873574165364323995616273741662814404286974035745,
+   0.04982203569055018101115923089370331247921559724378476973336922258463655,
+   0.04982203569055018101115923089370331247921559724378476973336922258463655,
+   0.04899557545575683538947568685789429835758389599909024248058598177431482,
+   0.04899557545575683538947568685789429835758389599909024248058598177431482,
+   0.04803703181997118096366665272873365360250002924692195693676432545775173,
+   0.04803703181997118096366665272873365360250002924692195693676432545775173,
+   0.04694898884891220484701315639470156627557490258344444292436328860948455,
+   0.04694898884891220484701315639470156627557490258344444292436328860948455,
+   0.04573437971611448664719645529090933300793497425868495444885644189785554,
+   0.04573437971611448664719645529090933300793497425868495444885644189785554,
+   0.04439647879578711332778416409137736966388498573401429851123645922404651,
+   0.04439647879578711332778416409137736966388498573401429851123645922404651,
+   0.04293889283593564195423122065638280694921177196491647898979741190202011,
+   0.04293889283593564195423122065638280694921177196491647898979741190202011,
+   0.04136555123558475561316383680665889688018700852151071424867954734910172,
+   0.04136555123558475561316383680665889688018700852151071424867954734910172,
+   0.03968069545238079947012283481171000876280351129417421865491951892215732,
+   0.03968069545238079947012283481171000876280351129417421865491951892215732,
+   0.03788886756924344403094079420927603181008428106380637154349889028518060,
+   0.03788886756924344403094079420927603181008428106380637154349889028518060,
+   0.03599489805108450306657864628806233859424242002100358385811585994825755,
+   0.03599489805108450306657864628806233859424242002100358385811585994825755,
+   0.03400389272494642283491440155525874118727622355285887601203061141115328,
+   0.03400389272494642283491440155525874118727622355285887601203061141115328,
+   0.03192121901929632894945889953676047676669729228299142098138158475893212,
+   0.03192121901929632894945889953676047676669729228299142098138158475893212,
+   0.02975249150078894524083648467348771033247515812410723195063279315700783,
+   0.02975249150078894524083648467348771033247515812410723195063279315700783,
+   0.02750355674992479163522319763862224764840347075416217725456695689922699,
+   0.02750355674992479163522319763862224764840347075416217725456695689922699,
+   0.02518047762152124837957096597236127913178083294418954861443703546439310,
+   0.02518047762152124837957096597236127913178083294418954861443703546439310,
+   0.02278951694399781986378345819290020781016738421520825823290391616554319,
+   0.02278951694399781986378345819290020781016738421520825823290391616554319,
+   0.02033712072945728677503214741710630146201711250534390381772268066313249,
+   0.02033712072945728677503214741710630146201711250534390381772268066313249,
+   0.01782990101420772026039626124834856763385921958339324690183988393108214,
+   0.01782990101420772026039626124834856763385921958339324690183988393108214,
+   0.01527461859678479930672603809882533517790938411507286448239224931925041,
+   0.01527461859678479930672603809882533517790938411507286448239224931925041,
+   0.01267816647681596013149537926951423498833836430263294560389540309438737,
+   0.01267816647681596013149537926951423498833836430263294560389540309438737,
+   0.01004755718228798435788576437705725649965174748767738434323897928069969,
+   0.01004755718228798435788576437705725649965174748767738434323897928069969,
+   0.00738993116334545553151695602208606088222818020622509208760447407680247,
+   0.00738993116334545553151695602208606088222818020622509208760447407680247,
+   0.00471272992695356864089482171407723594808497019371506011529061862254809,
+   0.00471272992695356864089482171407723594808497019371506011529061862254809,
+   0.00202681196887375849643171020989232469531166822555894990734538765730268,
+   0.00202681196887375849643171020989232469531166822555894990734538765730268,
+  // Order 61;
+   0.05108111944078621797792109560630985280205762640408927879119892153390267,
+   0.05101448703869726354373508057385201076820237542338634681327221694578219,
+   0.05101448703869726354373508057385201076820237542338634681327221694578219,
+   0.05081476366881834320770052922347869734784234385656766471673070080876687,
+   0.05081476366881834320770052922347869734784234385656766471673070080876687,
+   0.05048247038679740464814446518815126917289915200008866956862344495170261,
+   0.05048247038679740464814446518815126917289915200008866956862344495170261,
+   0.05001847410817825342505161500635862544205591923667243401298315560772473,
+   0.05001847410817825342505161500635862544205591923667243401298315560772473,
+   0.04942398534673558993996877665111649941665965666774848113144084110221336,
+   0.04942398534673558993996877665111649941665965666774848113144084110221336,
+   0.04870055505641152608753008831470560675869837218145057629891513027066084,
+   0.04870055505641152608753008831470560675869837218145057629891513027066084,
+   0.04785007058509560716183342751869966271340125297023681588392111275991563,
+   0.04785007058509560716183342751869966271340125297023681588392111275991563,
+   0.04687475075080906597642944558859073593371427235439648139693087943260061,
+   0.04687475075080906597642944558859073593371427235439648139693087943260061,
+   0.04577714005314595937133983384682479196153481455209210396715505238509437,
+   0.04577714005314595937133983384682479196153481455209210396715505238509437,
+   0.04456010203508348827154141983108835293335633519476516306144152073567659,
+   0.04456010203508348827154141983108835293335633519476516306144152073567659,
+   0.04322681181249609790104364582268287335029674435381313565915702771460713,
+   0.04322681181249609790104364582268287335029674435381313565915702771460713,
+   0.04178074779088849206667557235107300751269737408356478772659676634965706,
+   0.04178074779088849206667557235107300751269737408356478772659676634965706,
+   0.04022568259099824736763998375751157915592852852473845142464150161227105,
+   0.04022568259099824736763998375751157915592852852473845142464150161227105,
+   0.03856567320700817274615204762965380282922293321495739814607344968761284,
+   0.03856567320700817274615204762965380282922293321495739814607344968761284,
+   0.03680505042315481738432104286406746087590072359161771334168991491252205,
+   0.03680505042315481738432104286406746087590072359161771334168991491252205,
+   0.03494840751653335109085191920921927825500947094150758364477506684462989,
+   0.03494840751653335109085191920921927825500947094150758364477506684462989,
+   0.03300058827590741063272368344100449280740893980815058615178288037588303,
+   0.03300058827590741063272368344100449280740893980815058615178288037588303,
+   0.03096667436839739482469794661248938376670927102752538434035865133646750,
+   0.03096667436839739482469794661248938376670927102752538434035865133646750,
+   0.02885197208818340150434177554559025254350711993469388744900943080393778,
+   0.02885197208818340150434177554559025254350711993469388744900943080393778,
+   0.02666199852415088966281070684496801956405541912412060736997616430092624,
+   0.02666199852415088966281070684496801956405541912412060736997616430092624,
+   0.02440246718754420291534065973246753232577019850402360075854066703065001,
+   0.02440246718754420291534065973246753232577019850402360075854066703065001,
+   0.02207927314831904400247576562818162743617212408293122864464035696782554,
+   0.02207927314831904400247576562818162743617212408293122864464035696782554,
+   0.01969847774610118133051783021268456666579663613604383402694446103074330,
+   0.01969847774610118133051783021268456666579663613604383402694446103074330,
+   0.01726629298761374359443321277243662118418805452051927189378365354559634,
+   0.01726629298761374359443321277243662118418805452051927189378365354559634,
+   0.01478906588493791454617851578148826126037152853378020679995051502106957,
+   0.01478906588493791454617851578148826126037152853378020679995051502106957,
+   0.01227326350781210462927780035952613135449266049142567548241867374444092,
+   0.01227326350781210462927780035952613135449266049142567548241867374444092,
+   0.00972546183035613373613667175557011832684334637992202657696257054021176,
+   0.00972546183035613373613667175557011832684334637992202657696257054021176,
+   0.00715235499174908958583399309169417557127328166702841504170316924920453,
+   0.00715235499174908958583399309169417557127328166702841504170316924920453,
+   0.00456092400601241718453893257974278827081304337831533151198638421623426,
+   0.00456092400601241718453893257974278827081304337831533151198638421623426,
+   0.00196145336167028267177306446192684809414929406187149776199517894842008,
+   0.00196145336167028267177306446192684809414929406187149776199517894842008,
+  // Order 62;
+   0.05024800037525628168840294899513566831650472347656578092778888391492213,
+   0.05024800037525628168840294899513566831650472347656578092778888391492213,
+   0.05012106956904328807480410010153096800489531993392136104126426525280317,
+   0.05012106956904328807480410010153096800489531993392136104126426525280317,
+   0.04986752859495239424476131063484281688819595904527461420902640676188170,
+   0.04986752859495239424476131063484281688819595904527461420902640676188170,
+   0.04948801791969929252786581090477401846363378821095710780965038879928757,
+   0.04948801791969929252786581090477401846363378821095710780965038879928757,
+   0.04898349622051783710485112702621737256534890279639974940517473312043194,
+   0.04898349622051783710485112702621737256534890279639974940517473312043194,
+   0.04835523796347767283480318147845898676220050246238905618101272642531442,
+   0.04835523796347767283480318147845898676220050246238905618101272642531442,
+   0.04760483018410123227045008826786637306073741804949714463085528134384221,
+   0.04760483018410123227045008826786637306073741804949714463085528134384221,
+   0.04673416847841552480220705507948477876215978342901445512266959086721609,
+   0.04673416847841552480220705507948477876215978342901445512266959086721609,
+   0.04574545221457018077723227229769618767040394637762586464215093797804187,
+   0.04574545221457018077723227229769618767040394637762586464215093797804187,
+   0.04464117897712441429364469180913778441034875570807671634009702850532798,
+   0.04464117897712441429364469180913778441034875570807671634009702850532798,
+   0.04342413825804741958006923043394430419577132991468060605827531335688787,
+   0.04342413825804741958006923043394430419577132991468060605827531335688787,
+   0.04209740441038509664302262690383884601008708641913504672929433698876402,
+   0.04209740441038509664302262690383884601008708641913504672929433698876402,
+   0.04066432888241744096828501751666341731298671867166857447425210977094222,
+   0.04066432888241744096828501751666341731298671867166857447425210977094222,
+   0.03912853175196308412331080182260886062617991494346947913580100554270260,
+   0.03912853175196308412331080182260886062617991494346947913580100554270260,
+   0.03749389258228002998561856351879302823433185316753499043575607284825190,
+   0.03749389258228002998561856351879302823433185316753499043575607284825190,
+   0.03576454062276814128558737836172204258459806773117380190798456033244375,
+   0.03576454062276814128558737836172204258459806773117380190798456033244375,
+   0.03394484437941054509111747725423605778640654173271147033254812921750735,
+   0.03394484437941054509111747725423605778640654173271147033254812921750735,
+   0.03203940058162467810633923727815637313049303486293426263175606311944408,
+   0.03203940058162467810633923727815637313049303486293426263175606311944408,
+   0.03005302257398987007700946922706237948622878155453537354245100930343227,
+   0.03005302257398987007700946922706237948622878155453537354245100930343227,
+   0.02799072816331463754123829275404130487368380889597929636828922953993698,
+   0.02799072816331463754123829275404130487368380889597929636828922953993698,
+   0.02585772695402469802709556655351051559485987002574742329067046350852758,
+   0.02585772695402469802709556655351051559485987002574742329067046350852758,
+   0.02365940720868279257451680065053456470143152943084045354276618342434598,
+   0.02365940720868279257451680065053456470143152943084045354276618342434598,
+   0.02140132227766996884117908996490527764083752058057333039343740784697295,
+   0.02140132227766996884117908996490527764083752058057333039343740784697295,
+   0.01908917665857319873250371248228380577444267504732171150644197785800711,
+   0.01908917665857319873250371248228380577444267504732171150644197785800711,
+   0.01672881179017731628855047178409245836313193723342913243755451839595830,
+   0.01672881179017731628855047178409245836313193723342913243755451839595830,
+   0.01432619182380651776740288230941459607709994607566547857861037993611240,
+   0.01432619182380651776740288230941459607709994607566547857861037993611240,
+   0.01188739011701050194481893896679793652742859626999072436341284683543684,
+   0.01188739011701050194481893896679793652742859626999072436341284683543684,
+   0.00941857942842038763793756340656642815543364295156699934785834065387504,
+   0.00941857942842038763793756340656642815543364295156699934785834065387504,
+   0.00692604190183096087170282409925706711954721309845612181563982306179686,
+   0.00692604190183096087170282409925706711954721309845612181563982306179686,
+   0.00441633345693090481327412425549064072971198213049489616520564653090079,
+   0.00441633345693090481327412425549064072971198213049489616520564653090079,
+   0.00189920567951369048039734386093514017087884977236897663230433895868402,
+   0.00189920567951369048039734386093514017087884977236897663230433895868402,
+  // Order 63;
+   0.04947236662393102088866936042092594461353225394238326723944788470050941,
+   0.04941183303991817896703964611670485969772839008454096959991688195528833,
+   0.04941183303991817896703964611670485969772839008454096959991688195528833,
+   0.04923038042374756078504311698814458759187653281991422328112462351339863,
+   0.04923038042374756078504311698814458759187653281991422328112462351339863,
+   0.04892845282051198994470936154921482123252580998161526816866192615527818,
+   0.04892845282051198994470936154921482123252580998161526816866192615527818,
+   0.04850678909788384786409009914580158202759176924782665496504473949450238,
+   0.04850678909788384786409009914580158202759176924782665496504473949450238,
+   0.04796642113799513141105275619513225361068492143214658059284015391459741,
+   0.04796642113799513141105275619513225361068492143214658059284015391459741,
+   0.04730867131226891908060498833884406238662000197264571811984948412678884,
+   0.04730867131226891908060498833884406238662000197264571811984948412678884,
+   0.04653514924538369651039541874695318722782247717379842167658937487465189,
+   0.04653514924538369651039541874695318722782247717379842167658937487465189,
+   0.04564774787629260868588599260854252242660732393896392981386526001655025,
+   0.04564774787629260868588599260854252242660732393896392981386526001655025,
+   0.04464863882594139537033266951681339323410056356252033365432727272664889,
+   0.04464863882594139537033266951681339323410056356252033365432727272664889,
+   0.04354026708302759079896431570440113964093121192838053809413066997511735,
+   0.04354026708302759079896431570440113964093121192838053809413066997511735,
+   0.04232534502081582298250548540302745648284337891419637508998967462156947,
+   0.04232534502081582298250548540302745648284337891419637508998967462156947,
+   0.04100684575966639863511003700907235074017796621249930393159847953295138,
+   0.04100684575966639863511003700907235074017796621249930393159847953295138,
+   0.03958799589154409398480792814920236445419493911410243880836436192596474,
+   0.03958799589154409398480792814920236445419493911410243880836436192596474,
+   0.03807226758434955676363832492788921862730335725417542949059221531555995,
+   0.03807226758434955676363832492788921862730335725417542949059221531555995,
+   0.03646337008545728963045240978754179183183295025429651122993433007616730,
+   0.03646337008545728963045240978754179183183295025429651122993433007616730,
+   0.03476524064535587769718050464278815710707330249414719432367976155661782,
+   0.03476524064535587769718050464278815710707330249414719432367976155661782,
+   0.03298203488377934176568317967245930713779421615727785559062452432773634,
+   0.03298203488377934176568317967245930713779421615727785559062452432773634,
+   0.03111811662221981750821598855718858202491118953291511265097272306399049,
+   0.03111811662221981750821598855718858202491118953291511265097272306399049,
+   0.02917804720828052694555150215402880228294094592080542683035506771839609,
+   0.02917804720828052694555150215402880228294094592080542683035506771839609,
+   0.02716657435909793322518983943941272660664268398662912748456490376205997,
+   0.02716657435909793322518983943941272660664268398662912748456490376205997,
+   0.02508862055334498661863013806844335610235380744763357244745649810745859,
+   0.02508862055334498661863013806844335610235380744763357244745649810745859,
+   0.02294927100488993314894231956177050589104749991908682842920474227014795,
+   0.02294927100488993314894231956177050589104749991908682842920474227014795,
+   0.02075376125803909077534195342147315334781326487844182112090143797243518,
+   0.02075376125803909077534195342147315334781326487844182112090143797243518,
+   0.01850746446016127040926054580515796311023892141763128543356877747727074,
+   0.01850746446016127040926054580515796311023892141763128543356877747727074,
+   0.01621587841033833888228367297513091491581560382993090097089049390807502,
+   0.01621587841033833888228367297513091491581560382993090097089049390807502,
+   0.01388461261611561082486608636762443491927765825349064754906966272881159,
+   0.01388461261611561082486608636762443491927765825349064754906966272881159,
+   0.01151937607688004175075060614861806484158879394538898323570397047820656,
+   0.01151937607688004175075060614861806484158879394538898323570397047820656,
+   0.00912596867632665635405864542175995484969241778837534966967438534092938,
+   0.00912596867632665635405864542175995484969241778837534966967438534092938,
+   0.00671029176596013625190693072972880397343602855571611024379717620616182,
+   0.00671029176596013625190693072972880397343602855571611024379717620616182,
+   0.00427850834686376186607841108262278551712747267087521140233821556823362,
+   0.00427850834686376186607841108262278551712747267087521140233821556823362,
+   0.00183987459557708411709244555404392385263847233884024248064426893817914,
+   0.00183987459557708411709244555404392385263847233884024248064426893817914,
+  // Order 64;
+   0.04869095700913972038336539073474991244262869228387433050866880424569142,
+   0.04869095700913972038336539073474991244262869228387433050866880424569142,
+   0.04857546744150342693479906678397811368755654470492948571115167610251582,
+   0.04857546744150342693479906678397811368755654470492948571115167610251582,
+   0.04834476223480295716976952715801780970369255060950108062944220144524983,
+   0.04834476223480295716976952715801780970369255060950108062944220144524983,
+   0.04799938859645830772812617987134606995431671347149362094463239309333352,
+   0.04799938859645830772812617987134606995431671347149362094463239309333352,
+   0.04754016571483030866228220694422317164082525126253875215847403187847352,
+   0.04754016571483030866228220694422317164082525126253875215847403187847352,
+   0.04696818281621001732532628575458107519989752847381256498292408868619005,
+   0.04696818281621001732532628575458107519989752847381256498292408868619005,
+   0.04628479658131441729595324923226118496965030753244680077783408183646989,
+   0.04628479658131441729595324923226118496965030753244680077783408183646989,
+   0.04549162792741814447977099697126905888732346180239989681688340816065046,
+   0.04549162792741814447977099697126905888732346180239989681688340816065046,
+   0.04459055816375656306013471003094484329402379999122172564321932868619484,
+   0.04459055816375656306013471003094484329402379999122172564321932868619484,
+   0.04358372452932345337682786097373748092278889749711801505321939255025695,
+   0.04358372452932345337682786097373748092278889749711801505321939255025695,
+   0.04247351512365358900733976790881736616554664818064966973146077220552454,
+   0.04247351512365358900733976790881736616554664818064966973146077220552454,
+   0.04126256324262352861015629747363804773993063553054741054290347791227050,
+   0.04126256324262352861015629747363804773993063553054741054290347791227050,
+   0.03995374113272034138665692612833607391867695067033363011140370269815705,
+   0.03995374113272034138665692612833607391867695067033363011140370269815705,
+   0.03855015317861562912896249694680899101278711220171803196623788540880053,
+   0.03855015317861562912896249694680899101278711220171803196623788540880053,
+   0.03705512854024004604041510180958337508346494530565630217475362720280916,
+   0.03705512854024004604041510180958337508346494530565630217475362720280916,
+   0.03547221325688238381069314671524594794809463100241009469265148481993811,
+   0.03547221325688238381069314671524594794809463100241009469265148481993811,
+   0.03380516183714160939156548211072543102104992631400453466755006504003237,
+   0.03380516183714160939156548211072543102104992631400453466755006504003237,
+   0.03205792835485155358546750434789871696622157388139806225016940785453528,
+   0.03205792835485155358546750434789871696622157388139806225016940785453528,
+   0.03023465707240247886797405981954865915828139776848124163602654204596916,
+   0.03023465707240247886797405981954865915828139776848124163602654204596916,
+   0.02833967261425948322751130520023735198120758412575433599079551850845002,
+   0.02833967261425948322751130520023735198120758412575433599079551850845002,
+   0.02637746971505465867169179262522518567559933084224571844961567368530216,
+   0.02637746971505465867169179262522518567559933084224571844961567368530216,
+   0.02435270256871087333817755040906898764997841551337841198199856855355368,
+   0.02435270256871087333817755040906898764997841551337841198199856855355368,
+   0.02227017380838325415929833038415500242295929059975940514552054297449145,
+   0.02227017380838325415929833038415500242295929059975940514552054297449145,
+   0.02013482315353020937234031672854389708952668010079195192200723432767698,
+   0.02013482315353020937234031672854389708952668010079195192200723432767698,
+   0.01795171577569734308504530200111936889716735703641585729771842735692473,
+   0.01795171577569734308504530200111936889716735703641585729771842735692473,
+   0.01572603047602471932196599529753979442602900984315651215289439322842105,
+   0.01572603047602471932196599529753979442602900984315651215289439322842105,
+   0.01346304789671864259806076668595568410842577197734967081846827852219836,
+   0.01346304789671864259806076668595568410842577197734967081846827852219836,
+   0.01116813946013112881859049301920813507277879781682728721525136227396970,
+   0.01116813946013112881859049301920813507277879781682728721525136227396970,
+   0.00884675982636394772303091465973064769517626607922049979847157692961104,
+   0.00884675982636394772303091465973064769517626607922049979847157692961104,
+   0.00650445796897836285611736039998126677113176105495234009524487925756851,
+   0.00650445796897836285611736039998126677113176105495234009524487925756851,
+   0.00414703326056246763528753572855141531330281925368480246287636614318348,
+   0.00414703326056246763528753572855141531330281925368480246287636614318348,
+   0.00178328072169643294729607914497193317995934727192795566953080636558585,
+   0.00178328072169643294729607914497193317995934727192795566953080636558585
+};
+
+static_assert( sizeof( point_table ) / sizeof( double ) ==
+    quad::max_order * ( quad::max_order + 1 ) / 2, "Incomplete point table" );
+static_assert( sizeof( weight_table ) / sizeof( double ) ==
+    quad::max_order * ( quad::max_order + 1 ) / 2, "Incomplete weight table" );
+
+/* Given the order of integration, return the view of that rule in the table,
+ * or an empty view if the order is not tabulated. */
+quad::Span table_rule( const double * table, int order )
 {
-  std::vector<double> legendre_roots;
-
-  // Points for different orders provided by:
-  // http://pomax.github.io/bezierinfo/legendre-gauss.html
-  if ( order == 1 ) {
-    legendre_roots = {
-      0.0
-    };
-  }
-
-  else if ( order == 2 ) {
-    legendre_roots = {
-     -0.57735026918962576450914878050195745564760175127012687601860232648397767,
-      0.57735026918962576450914878050195745564760175127012687601860232648397767
-    };
-  }
-
-  else if ( order == 3 ) {
-    legendre_roots = {
-     -0.77459666924148337703585307995647992216658434105831816531751475322269662,
-      0,
-      0.77459666924148337703585307995647992216658434105831816531751475322269662
-    };
-  }
-
-  else if ( order == 4 ) {
-    legendre_roots = {
-     -0.86113631159405257522394648889280950509572537962971763761572192090652947,
-     -0.33998104358485626480266575910324468720057586977091435259295397682102003,
-      0.33998104358485626480266575910324468720057586977091435259295397682102003,
-      0.86113631159405257522394648889280950509572537962971763761572192090652947
-    };
-  }
-
-  else if ( order == 5 ) {
-    legendre_roots = {
-     -0.90617984593866399279762687829939296512565191076253086287376228654377079,
-     -0.53846931010568309103631442070020880496728660690555995620223162705947119,
-      0,
-      0.53846931010568309103631442070020880496728660690555995620223162705947119,
-      0.90617984593866399279762687829939296512565191076253086287376228654377079
-    };
-  }
-
-  else if ( order == 6 ) {
-    legendre_roots = {
-      0.66120938646626451366139959501990534700644856439517007081452670585218350,
-     -0.66120938646626451366139959501990534700644856439517007081452670585218350,
-     -0.23861918608319690863050172168071193541861063014002135018139516457427493,
-      0.23861918608319690863050172168071193541861063014002135018139516457427493,
-     -0.93246951420315202781230155449399460913476573771228982487254961652661350,
-      0.93246951420315202781230155449399460913476573771228982487254961652661350
-    };
-  }
-
-  else if ( order == 7 ) {
-    legendre_roots = {
-      0,
-      0.40584515137739716690660641207696146334738201409937012638704325179466381,
-     -0.40584515137739716690660641207696146334738201409937012638704325179466381,
-     -0.74153118559939443986386477328078840707414764714139026011995535196742987,
-      0.74153118559939443986386477328078840707414764714139026011995535196742987,
-     -0.94910791234275852452618968404785126240077093767061778354876910391306333,
-      0.94910791234275852452618968404785126240077093767061778354876910391306333
-    };
-  }
-
-  else if ( order == 8 ) {
-    legendre_roots = {
-     -0.96028985649753623168356086856947299042823523430145203827163977737242490,
-     -0.79666647741362673959155393647583043683717173161596483207017029503921731,
-     -0.52553240991632898581773904918924634904196424312039285775085709927245482,
-     -0.18343464249564980493947614236018398066675781291297378231718847369920447,
-      0.18343464249564980493947614236018398066675781291297378231718847369920447,
-      0.52553240991632898581773904918924634904196424312039285775085709927245482,
-      0.79666647741362673959155393647583043683717173161596483207017029503921731,
-      0.96028985649753623168356086856947299042823523430145203827163977737242490
-    };
-  }
-
-  else if ( order == 9 ) {
-    legendre_roots = {
-      0,
-     -0.83603110732663579429942978806973487654410671812467599610437197963945501,
-      0.83603110732663579429942978806973487654410671812467599610437197963945501,
-     -0.96816023950762608983557620290367287004940480049192532955002331184908037,
-      0.96816023950762608983557620290367287004940480049192532955002331184908037,
-     -0.32425342340380892903853801464333660857195626073697308882704747684218658,
-      0.32425342340380892903853801464333660857195626073697308882704747684218658,
-     -0.61337143270059039730870203934147418478572060494056469287281294228126735,
-      0.61337143270059039730870203934147418478572060494056469287281294228126735
-    };
-  }
-
-  else if ( order == 10 ) {
-    legendre_roots = {
-     -0.14887433898163121088482600112971998461756485942069169570798925351590362,
-      0.14887433898163121088482600112971998461756485942069169570798925351590362,
-     -0.43339539412924719079926594316578416220007183765624649650270151314376699,
-      0.43339539412924719079926594316578416220007183765624649650270151314376699,
-     -0.67940956829902440623432736511487357576929471183480946766481718895255858,
-      0.67940956829902440623432736511487357576929471183480946766481718895255858,
-     -0.86506336668898451073209668842349304852754301496533045252195973184537476,
-      0.86506336668898451073209668842349304852754301496533045252195973184537476,
-     -0.97390652851717172007796401208445205342826994669238211923121206669659520,
-      0.97390652851717172007796401208445205342826994669238211923121206669659520
-    };
-  }
-
-  else if ( order == 11 ) {
-    legendre_roots = {
-      0,
-     -0.26954315595234497233153198540086152467962186243905228162392563188005707,
-      0.26954315595234497233153198540086152467962186243905228162392563188005707,
-     -0.51909612920681181592572566945860955448022711511992848902092261148669593,
-      0.51909612920681181592572566945860955448022711511992848902092261148669593,
-     -0.73015200557404932409341625203115345804964306202613031197837833968701325,
-      0.73015200557404932409341625203115345804964306202613031197837833968701325,
-     -0.88706259976809529907515776930392726663167575122531438496741105553761131,
-      0.88706259976809529907515776930392726663167575122531438496741105553761131,
-     -0.97822865814605699280393800112285739077142240891978441542580106598366380,
-      0.97822865814605699280393800112285739077142240891978441542580106598366380
-    };
-  }
-
-  else if ( order == 12 ) {
-    legendre_roots = {
-     -0.12523340851146891547244136946385312998339691630544427321292175474846206,
-      0.12523340851146891547244136946385312998339691630544427321292175474846206,
-     -0.36783149899818019375269153664371756125636014133540962131179987950408993,
-      0.36783149899818019375269153664371756125636014133540962131179987950408993,
-     -0.58731795428661744729670241894053428036909851404805248151027087966734070,
-      0.58731795428661744729670241894053428036909851404805248151027087966734070,
-     -0.76990267419430468703689383321281807598492575001893163766441906424911654,
-      0.76990267419430468703689383321281807598492575001893163766441906424911654,
-     -0.90411725637047485667846586611909619253759670921329754655407576068123480,
-      0.90411725637047485667846586611909619253759670921329754655407576068123480,
-     -0.98156063424671925069054909014928082296015519981373151046268212180779324,
-      0.98156063424671925069054909014928082296015519981373151046268212180779324
-    };
-  }
-
-  else if ( order == 13 ) {
-    legendre_roots = {
-      0,
-     -0.23045831595513479406552812109798883521154237588353116346926149783716208,
-      0.23045831595513479406552812109798883521154237588353116346926149783716208,
-     -0.44849275103644685287791285212763986780192166744175787895828294745824409,
-      0.44849275103644685287791285212763986780192166744175787895828294745824409,
-     -0.64234933944034022064398460699551565007169739826157685738914240791864355,
-      0.64234933944034022064398460699551565007169739826157685738914240791864355,
-     -0.80157809073330991279420648958285989030561572479050002989738471385922212,
-      0.80157809073330991279420648958285989030561572479050002989738471385922212,
-     -0.91759839922297796520654783650071951239047479011168329589528534565965921,
-      0.91759839922297796520654783650071951239047479011168329589528534565965921,
-     -0.98418305471858814947282944880710961106499056192587490869400732042859524,
-      0.98418305471858814947282944880710961106499056192587490869400732042859524
-    };
-  }
-
-  else if ( order == 14 ) {
-    legendre_roots = {
-     -0.10805494870734366206624465021983474761195160547423755704082106130801353,
-      0.10805494870734366206624465021983474761195160547423755704082106130801353,
-     -0.31911236892788976043567182416847546683426120353384395659665018725733344,
-      0.31911236892788976043567182416847546683426120353384395659665018725733344,
-     -0.51524863635815409196529071855118866230888528256930603695150476909278495,
-      0.51524863635815409196529071855118866230888528256930603695150476909278495,
-     -0.68729290481168547014801980301933413753840121274717067561926648862818490,
-      0.68729290481168547014801980301933413753840121274717067561926648862818490,
-     -0.82720131506976499318979474265039496103970110147508118156070905424147983,
-      0.82720131506976499318979474265039496103970110147508118156070905424147983,
-     -0.92843488366357351733639113937787426447703921040983761871796244748213109,
-      0.92843488366357351733639113937787426447703921040983761871796244748213109,
-     -0.98628380869681233884159726670405280167609140723922588164407081177774955,
-      0.98628380869681233884159726670405280167609140723922588164407081177774955
-    };
-  }
-
-  else if ( order == 15 ) {
-    legendre_roots = {
-      0,
-     -0.20119409399743452230062830339459620781283645446263767961594972460994824,
-      0.20119409399743452230062830339459620781283645446263767961594972460994824,
-     -0.39415134707756336989720737098104546836275277615869825503116534395160896,
-      0.39415134707756336989720737098104546836275277615869825503116534395160896,
-     -0.57097217260853884753722673725391064123838639628274960485326541705419538,
-      0.57097217260853884753722673725391064123838639628274960485326541705419538,
-     -0.72441773136017004741618605461393800963089929458410256355142342070412378,
-      0.72441773136017004741618605461393800963089929458410256355142342070412378,
-     -0.84820658341042721620064832077421685136625617473699263409572755876067508,
-      0.84820658341042721620064832077421685136625617473699263409572755876067508,
-     -0.93727339240070590430775894771020947124399627351530445790136307635020297,
-      0.93727339240070590430775894771020947124399627351530445790136307635020297,
-     -0.98799251802048542848956571858661258114697281712376148999999751558738844,
-      0.98799251802048542848956571858661258114697281712376148999999751558738844
-    };
-  }
-
-  else if ( order == 16 ) {
-    legendre_roots = {
-     -0.09501250983763744018531933542495806313035305568906545669721981722512530,
-      0.09501250983763744018531933542495806313035305568906545669721981722512530,
-     -0.28160355077925891323046050146049610648606949077059980054883473395592518,
-      0.28160355077925891323046050146049610648606949077059980054883473395592518,
-     -0.45801677765722738634241944298357757354003161303552349090115475094775917,
-      0.45801677765722738634241944298357757354003161303552349090115475094775917,
-     -0.61787624440264374844667176404879101899188221776565779410379735554173332,
-      0.61787624440264374844667176404879101899188221776565779410379735554173332,
-     -0.75540440835500303389510119484744226835381365645750300978175717692229686,
-      0.75540440835500303389510119484744226835381365645750300978175717692229686,
-     -0.86563120238783174388046789771239313238733538484752670810351142556776040,
-      0.86563120238783174388046789771239313238733538484752670810351142556776040,
-     -0.94457502307323257607798841553460834509113927259107260092555365206660979,
-      0.94457502307323257607798841553460834509113927259107260092555365206660979,
-     -0.98940093499164993259615417345033262742627407165764513005122390473132414,
-      0.98940093499164993259615417345033262742627407165764513005122390473132414
-    };
-  }
-
-  else if ( order == 17 ) {
-    legendre_roots = {
-      0,
-     -0.17848418149584785585067749365406555747541933269152564356295181427069755,
-      0.17848418149584785585067749365406555747541933269152564356295181427069755,
-     -0.35123176345387631529718551709534600504053975157567502331916101954779426,
-      0.35123176345387631529718551709534600504053975157567502331916101954779426,
-     -0.51269053708647696788624656862955187458292372241117290591273149896428492,
-      0.51269053708647696788624656862955187458292372241117290591273149896428492,
-     -0.65767115921669076585030221664300233514780589147597324380523169550732430,
-      0.65767115921669076585030221664300233514780589147597324380523169550732430,
-     -0.78151400389680140692523005552047605022397247274056851251331453551257762,
-      0.78151400389680140692523005552047605022397247274056851251331453551257762,
-     -0.88023915372698590212295569448815569262341681793442790035191015932402713,
-      0.88023915372698590212295569448815569262341681793442790035191015932402713,
-     -0.95067552176876776122271695789580302144338504655910870766996921241211537,
-      0.95067552176876776122271695789580302144338504655910870766996921241211537,
-     -0.99057547531441733567543401994066527650778985045956430278390878674234386,
-      0.99057547531441733567543401994066527650778985045956430278390878674234386
-    };
-  }
-
-  else if ( order == 18 ) {
-    legendre_roots = {
-     -0.08477501304173530124226185293578381173331738690608992004336451762549979,
-      0.08477501304173530124226185293578381173331738690608992004336451762549979,
-     -0.25188622569150550958897285487791123016286176565964045802027103173678449,
-      0.25188622569150550958897285487791123016286176565964045802027103173678449,
-     -0.41175116146284264603593179383305163707898968212002551128114886779038967,
-      0.41175116146284264603593179383305163707898968212002551128114886779038967,
-     -0.55977083107394753460787154852532913692762648577070941663998694406218453,
-      0.55977083107394753460787154852532913692762648577070941663998694406218453,
-     -0.69168704306035320787489108128884838945227057281750775890216265683719737,
-      0.69168704306035320787489108128884838945227057281750775890216265683719737,
-     -0.80370495897252311568241745501459079710329892161192248175042806419538811,
-      0.80370495897252311568241745501459079710329892161192248175042806419538811,
-     -0.89260246649755573920606059112714551540789527135229821418746631490724058,
-      0.89260246649755573920606059112714551540789527135229821418746631490724058,
-     -0.95582394957139775518119589292977630997284413481130647884538762969089807,
-      0.95582394957139775518119589292977630997284413481130647884538762969089807,
-     -0.99156516842093094673001600470615077025257893684543969291967563023985709,
-      0.99156516842093094673001600470615077025257893684543969291967563023985709
-    };
-  }
-
-  else if ( order == 19 ) {
-    legendre_roots = {
-      0,
-     -0.16035864564022537586809611574074354950487350047087537887464345160632061,
-      0.16035864564022537586809611574074354950487350047087537887464345160632061,
-     -0.31656409996362983199011732884984491789228521913288724515572898679789289,
-      0.31656409996362983199011732884984491789228521913288724515572898679789289,
-     -0.46457074137596094571726714810410236797628571462413659698430887757568412,
-      0.46457074137596094571726714810410236797628571462413659698430887757568412,
-     -0.60054530466168102346963816494623927986832208273229256758658672566838491,
-      0.60054530466168102346963816494623927986832208273229256758658672566838491,
-     -0.72096617733522937861709586082378162965714183290866677493859047138661456,
-      0.72096617733522937861709586082378162965714183290866677493859047138661456,
-     -0.82271465653714282497892248671271390177453848620683004136986388860550034,
-      0.82271465653714282497892248671271390177453848620683004136986388860550034,
-     -0.90315590361481790164266092853231248780939393405735581769503242476163580,
-      0.90315590361481790164266092853231248780939393405735581769503242476163580,
-     -0.96020815213483003085277884068765152661509150327413810591781633443220075,
-      0.96020815213483003085277884068765152661509150327413810591781633443220075,
-     -0.99240684384358440318901767025326049358931640140321078667967943909123190,
-      0.99240684384358440318901767025326049358931640140321078667967943909123190
-    };
-  }
-
-  else if ( order == 20 ) {
-    legendre_roots = {
-     -0.99312859918509492478612238847132027822264713090165589614818413121798472,
-     -0.96397192727791379126766613119727722191206032780618885606353759389204158,
-     -0.91223442825132590586775244120329811304918479742369177479588221915807089,
-     -0.83911697182221882339452906170152068532962936506563737325249272553286109,
-     -0.74633190646015079261430507035564159031073067956917644413954590606853536,
-     -0.63605368072651502545283669622628593674338911679936846393944662254654126,
-     -0.51086700195082709800436405095525099842549132920242683347234861989473497,
-     -0.37370608871541956067254817702492723739574632170568271182794861351564576,
-     -0.22778585114164507808049619536857462474308893768292747231463573920717134,
-     -0.07652652113349733375464040939883821100479626681349750080479524438425634,
-      0.07652652113349733375464040939883821100479626681349750080479524438425634,
-      0.22778585114164507808049619536857462474308893768292747231463573920717134,
-      0.37370608871541956067254817702492723739574632170568271182794861351564576,
-      0.51086700195082709800436405095525099842549132920242683347234861989473497,
-      0.63605368072651502545283669622628593674338911679936846393944662254654126,
-      0.74633190646015079261430507035564159031073067956917644413954590606853536,
-      0.83911697182221882339452906170152068532962936506563737325249272553286109,
-      0.91223442825132590586775244120329811304918479742369177479588221915807089,
-      0.96397192727791379126766613119727722191206032780618885606353759389204158,
-      0.99312859918509492478612238847132027822264713090165589614818413121798472
-    };
-  }
-
-  else if ( order == 21 ) {
-    legendre_roots = {
-      0,
-     -0.14556185416089509093703098233868633011632602443793775742148838998554728,
-      0.14556185416089509093703098233868633011632602443793775742148838998554728,
-     -0.28802131680240109660079251606460031990901826364603322875428152474924494,
-      0.28802131680240109660079251606460031990901826364603322875428152474924494,
-     -0.42434212020743878357366888854378805209644523183963458422425823589648688,
-      0.42434212020743878357366888854378805209644523183963458422425823589648688,
-     -0.55161883588721980705901879672431328662206022423067966500430583949960478,
-      0.55161883588721980705901879672431328662206022423067966500430583949960478,
-     -0.66713880419741231930596666999033916259702934331140284247546708234719419,
-      0.66713880419741231930596666999033916259702934331140284247546708234719419,
-     -0.76843996347567790861587785130622803482097670577136955086872666503001874,
-      0.76843996347567790861587785130622803482097670577136955086872666503001874,
-     -0.85336336458331728364725063858756767027610580317934397074299162939424291,
-      0.85336336458331728364725063858756767027610580317934397074299162939424291,
-     -0.92009933415040082879018713371496889415914760964822169717613548709098156,
-      0.92009933415040082879018713371496889415914760964822169717613548709098156,
-     -0.96722683856630629431662221490769516142469368732984684995297112808512096,
-      0.96722683856630629431662221490769516142469368732984684995297112808512096,
-     -0.99375217062038950026024203593794092919333845478232918558087385471309611,
-      0.99375217062038950026024203593794092919333845478232918558087385471309611
-    };
-  }
-
-  else if ( order == 22 ) {
-    legendre_roots = {
-     -0.06973927331972222121384179611862808182229629948023147470668194651160937,
-      0.06973927331972222121384179611862808182229629948023147470668194651160937,
-     -0.20786042668822128547884653391954573421567510909793364966865330436820084,
-      0.20786042668822128547884653391954573421567510909793364966865330436820084,
-     -0.34193582089208422515814742042737961955917329917068734399686238368901344,
-      0.34193582089208422515814742042737961955917329917068734399686238368901344,
-     -0.46935583798675702640633071096640634609534379113073654779610002969357701,
-      0.46935583798675702640633071096640634609534379113073654779610002969357701,
-     -0.58764040350691159295887692763864734887761560357371783977003382137246838,
-      0.58764040350691159295887692763864734887761560357371783977003382137246838,
-     -0.69448726318668278005068983576225677126734228997743516112173377539228594,
-      0.69448726318668278005068983576225677126734228997743516112173377539228594,
-     -0.78781680597920816200427795540835152138817867133156315812169339771113228,
-      0.78781680597920816200427795540835152138817867133156315812169339771113228,
-     -0.86581257772030013653642563701937872908479675558844615612709336926271689,
-      0.86581257772030013653642563701937872908479675558844615612709336926271689,
-     -0.92695677218717400052069293925905319663532965337205198204457319152713612,
-      0.92695677218717400052069293925905319663532965337205198204457319152713612,
-     -0.97006049783542872712395098676526871080596892313780296955973821233637426,
-      0.97006049783542872712395098676526871080596892313780296955973821233637426,
-     -0.99429458548239929207303142116129898039305419839603153497702292496665650,
-      0.99429458548239929207303142116129898039305419839603153497702292496665650
-    };
-  }
-
-  else if ( order == 23 ) {
-    legendre_roots = {
-      0,
-     -0.13325682429846611093174268224176613701040527625338215651094537718704789,
-      0.13325682429846611093174268224176613701040527625338215651094537718704789,
-     -0.26413568097034493053386953828330960297901325019413960486907887705232885,
-      0.26413568097034493053386953828330960297901325019413960486907887705232885,
-     -0.39030103803029083142148887288060545857805085069250348121920526331671262,
-      0.39030103803029083142148887288060545857805085069250348121920526331671262,
-     -0.50950147784600754968979304786684643054484276918485762322718938082127501,
-      0.50950147784600754968979304786684643054484276918485762322718938082127501,
-     -0.61960987576364615638509731164959565338718065880709229570086558560911981,
-      0.61960987576364615638509731164959565338718065880709229570086558560911981,
-     -0.71866136313195019446162448374861884832992974513129279575478128821405113,
-      0.71866136313195019446162448374861884832992974513129279575478128821405113,
-     -0.80488840161883989215111840699677855794143013973030802258543243567170676,
-      0.80488840161883989215111840699677855794143013973030802258543243567170676,
-     -0.87675235827044166737815688593414567163892902996065063490940111576055164,
-      0.87675235827044166737815688593414567163892902996065063490940111576055164,
-     -0.93297108682601610234919698903842297823570182015139077069290125460197783,
-      0.93297108682601610234919698903842297823570182015139077069290125460197783,
-     -0.97254247121811523195602407682077737518161379535397394249125615873579704,
-      0.97254247121811523195602407682077737518161379535397394249125615873579704,
-     -0.99476933499755212352392571544557436057362737245887042092679388416707408,
-      0.99476933499755212352392571544557436057362737245887042092679388416707408
-    };
-  }
-
-  else if ( order == 24 ) {
-    legendre_roots = {
-     -0.06405689286260562608504308262474503859099919542074739342435108178973928,
-      0.06405689286260562608504308262474503859099919542074739342435108178973928,
-     -0.19111886747361630915863982075706963184040510331475335614891857658808595,
-      0.19111886747361630915863982075706963184040510331475335614891857658808595,
-     -0.31504267969616337438679329131981024078647826082481726875423012952988216,
-      0.31504267969616337438679329131981024078647826082481726875423012952988216,
-     -0.43379350762604513848708423191334971245242151092796880808080128465676441,
-      0.43379350762604513848708423191334971245242151092796880808080128465676441,
-     -0.54542147138883953565837561721837237001078399258761817543361438983056484,
-      0.54542147138883953565837561721837237001078399258761817543361438983056484,
-     -0.64809365193697556925249578691074762666965829861895678029893366502444832,
-      0.64809365193697556925249578691074762666965829861895678029893366502444832,
-     -0.74012419157855436424382810309997842552329248701418545686638236827190034,
-      0.74012419157855436424382810309997842552329248701418545686638236827190034,
-     -0.82000198597390292195394987266974520807612647766785558724398102600138298,
-      0.82000198597390292195394987266974520807612647766785558724398102600138298,
-     -0.88641552700440103421315434198219675508733304330892004037103791677567483,
-      0.88641552700440103421315434198219675508733304330892004037103791677567483,
-     -0.93827455200273275852364900170872144965481965807745134663502717590958950,
-      0.93827455200273275852364900170872144965481965807745134663502717590958950,
-     -0.97472855597130949819839199300816906174118305304017871981159356510718112,
-      0.97472855597130949819839199300816906174118305304017871981159356510718112,
-     -0.99518721999702136017999740970073681187459769259600287744160054511428383,
-      0.99518721999702136017999740970073681187459769259600287744160054511428383
-    };
-  }
-
-  else if ( order == 25 ) {
-    legendre_roots = {
-      0,
-     -0.12286469261071039638735981880803680553220534604978373842389353789270883,
-      0.12286469261071039638735981880803680553220534604978373842389353789270883,
-     -0.24386688372098843204519036279745158640563315632598447642113565325038747,
-      0.24386688372098843204519036279745158640563315632598447642113565325038747,
-     -0.36117230580938783773582173012764066742207834704337506979457877784674538,
-      0.36117230580938783773582173012764066742207834704337506979457877784674538,
-     -0.47300273144571496052218211500919204133181773846162729090723082769560328,
-      0.47300273144571496052218211500919204133181773846162729090723082769560328,
-     -0.57766293024122296772368984161265406739573503929151825664548350776102301,
-      0.57766293024122296772368984161265406739573503929151825664548350776102301,
-     -0.67356636847346836448512063324762217588341672807274931705965696177828774,
-      0.67356636847346836448512063324762217588341672807274931705965696177828774,
-     -0.75925926303735763057728286520436097638752201889833412091838973544501863,
-      0.75925926303735763057728286520436097638752201889833412091838973544501863,
-     -0.83344262876083400142102110869356956946096411382352078602086471546171813,
-      0.83344262876083400142102110869356956946096411382352078602086471546171813,
-     -0.89499199787827536885104200678280495417455484975358390306170168295917151,
-      0.89499199787827536885104200678280495417455484975358390306170168295917151,
-     -0.94297457122897433941401116965847053190520157060899014192745249713729532,
-      0.94297457122897433941401116965847053190520157060899014192745249713729532,
-     -0.97666392145951751149831538647959406774537055531440674467098742731616387,
-      0.97666392145951751149831538647959406774537055531440674467098742731616387,
-     -0.99555696979049809790878494689390161725756264940480817121080493113293348,
-      0.99555696979049809790878494689390161725756264940480817121080493113293348
-    };
-  }
-
-  else if ( order == 26 ) {
-    legendre_roots = {
-     -0.05923009342931320709371857519840336079023473538903558215427229168438704,
-      0.05923009342931320709371857519840336079023473538903558215427229168438704,
-     -0.17685882035689018396905774841834474997738376380126426148034769978404528,
-      0.17685882035689018396905774841834474997738376380126426148034769978404528,
-     -0.29200483948595689514283538207783029688471938696299037821234419190370162,
-      0.29200483948595689514283538207783029688471938696299037821234419190370162,
-     -0.40305175512348630648107737709888310365993740969931618258914113354818422,
-      0.40305175512348630648107737709888310365993740969931618258914113354818422,
-     -0.50844071482450571769570306472556917537630675418575081372110046960392739,
-      0.50844071482450571769570306472556917537630675418575081372110046960392739,
-     -0.60669229301761806323197874691688705443526457226590989037864331251992813,
-      0.60669229301761806323197874691688705443526457226590989037864331251992813,
-     -0.69642726041995726486381391372942469786075331779081915170455745383836055,
-      0.69642726041995726486381391372942469786075331779081915170455745383836055,
-     -0.77638594882067885619296724724228386697621825625519487216316842162703293,
-      0.77638594882067885619296724724228386697621825625519487216316842162703293,
-     -0.84544594278849801879750706146783816157207510209132956943017647291161691,
-      0.84544594278849801879750706146783816157207510209132956943017647291161691,
-     -0.90263786198430707421766559923121025134112400537290537255516565477946580,
-      0.90263786198430707421766559923121025134112400537290537255516565477946580,
-     -0.94715906666171425013591528351803675452071033768431527001826777960985764,
-      0.94715906666171425013591528351803675452071033768431527001826777960985764,
-     -0.97838544595647099110058035431192630544691656374731850248541486131650515,
-      0.97838544595647099110058035431192630544691656374731850248541486131650515,
-     -0.99588570114561692900321695932290602595685785511955966739652780940556630,
-      0.99588570114561692900321695932290602595685785511955966739652780940556630
-    };
-  }
-
-  else if ( order == 27 ) {
-    legendre_roots = {
-      0,
-     -0.11397258560952996693289498386997662717328053397814099476575390976636549,
-      0.11397258560952996693289498386997662717328053397814099476575390976636549,
-     -0.22645936543953685885723910736023017117944673292820367664662899718377713,
-      0.22645936543953685885723910736023017117944673292820367664662899718377713,
-     -0.33599390363850889973031903420728454179002001890759419072498670709500932,
-      0.33599390363850889973031903420728454179002001890759419072498670709500932,
-     -0.44114825175002688058597415568928145244768459516309938814538721340320070,
-      0.44114825175002688058597415568928145244768459516309938814538721340320070,
-     -0.54055156457945689490030094155998282095918044898718169037433775003594090,
-      0.54055156457945689490030094155998282095918044898718169037433775003594090,
-     -0.63290797194649514092773463763448861210307601756933669729511189902340069,
-      0.63290797194649514092773463763448861210307601756933669729511189902340069,
-     -0.71701347373942369929481621164233954975067205209856314265121620633569483,
-      0.71701347373942369929481621164233954975067205209856314265121620633569483,
-     -0.79177163907050822714439734410727073291940106574786351240728061204682048,
-      0.79177163907050822714439734410727073291940106574786351240728061204682048,
-     -0.85620790801829449030273722270684279776428699860350582697718965412880332,
-      0.85620790801829449030273722270684279776428699860350582697718965412880332,
-     -0.90948232067749110430064501820968925494804433559496095911322755247205627,
-      0.90948232067749110430064501820968925494804433559496095911322755247205627,
-     -0.95090055781470500685190803064388289309258993348441765093381739078738667,
-      0.95090055781470500685190803064388289309258993348441765093381739078738667,
-     -0.97992347596150122285587335566104718456764222138995076323885989305238258,
-      0.97992347596150122285587335566104718456764222138995076323885989305238258,
-     -0.99617926288898856693888720838122999026068805556587118770163649678821775,
-      0.99617926288898856693888720838122999026068805556587118770163649678821775
-    };
-  }
-
-  else if ( order == 28 ) {
-    legendre_roots = {
-     -0.05507928988403427042651652734187997785079599106083368374533858725889454,
-      0.05507928988403427042651652734187997785079599106083368374533858725889454,
-     -0.16456928213338077128147177789116545714572541560116817649428562669533185,
-      0.16456928213338077128147177789116545714572541560116817649428562669533185,
-     -0.27206162763517807767682635612576973482476129669352295249967592650244234,
-      0.27206162763517807767682635612576973482476129669352295249967592650244234,
-     -0.37625151608907871022135720955608698287169397704322291034435272039383172,
-      0.37625151608907871022135720955608698287169397704322291034435272039383172,
-     -0.47587422495511826103441184766743404262721614537865595140911269294327237,
-      0.47587422495511826103441184766743404262721614537865595140911269294327237,
-     -0.56972047181140171930800328335643093312471268565664722782002967766221475,
-      0.56972047181140171930800328335643093312471268565664722782002967766221475,
-     -0.65665109403886496121989817650674282156960169024992996183170349749585030,
-      0.65665109403886496121989817650674282156960169024992996183170349749585030,
-     -0.73561087801363177202814451029253436801606101999304189322852777633581126,
-      0.73561087801363177202814451029253436801606101999304189322852777633581126,
-     -0.80564137091717917144788595542527765867170141480831166821068716178038954,
-      0.80564137091717917144788595542527765867170141480831166821068716178038954,
-     -0.86589252257439504894225456737968680434186283078422633697754673301669441,
-      0.86589252257439504894225456737968680434186283078422633697754673301669441,
-     -0.91563302639213207386968942332992714635249679520912150866150024460300818,
-      0.91563302639213207386968942332992714635249679520912150866150024460300818,
-     -0.95425928062893819725410183970521558900340387408795167541471444862383064,
-      0.95425928062893819725410183970521558900340387408795167541471444862383064,
-     -0.98130316537087275369455994580783027644415495325313830967602568145872845,
-      0.98130316537087275369455994580783027644415495325313830967602568145872845,
-     -0.99644249757395444995043639048331099175013043209642590458567232949048422,
-      0.99644249757395444995043639048331099175013043209642590458567232949048422
-    };
-  }
-
-  else if ( order == 29 ) {
-    legendre_roots = {
-      0,
-     -0.10627823013267923017098239243037698091719543929560713628577527402216534,
-      0.10627823013267923017098239243037698091719543929560713628577527402216534,
-     -0.21135228616600107450637572890293749905665081771209514803840084532205891,
-      0.21135228616600107450637572890293749905665081771209514803840084532205891,
-     -0.31403163786763993494819592319104744825844881909082748129675893089444670,
-      0.31403163786763993494819592319104744825844881909082748129675893089444670,
-     -0.41315288817400866389070658603161682332343851873631391977838466525428335,
-      0.41315288817400866389070658603161682332343851873631391977838466525428335,
-     -0.50759295512422764210262791962752015335122384038458416418506430709821437,
-      0.50759295512422764210262791962752015335122384038458416418506430709821437,
-     -0.59628179713822782037958621118898978007818681038557763847346239323034283,
-      0.59628179713822782037958621118898978007818681038557763847346239323034283,
-     -0.67821453760268651515618500539198592638826293001464516272380985894936650,
-      0.67821453760268651515618500539198592638826293001464516272380985894936650,
-     -0.75246285173447713391261007721213819021259196822898660841199799152469213,
-      0.75246285173447713391261007721213819021259196822898660841199799152469213,
-     -0.81818548761525244498957221457878497563002156188229377113703427229531653,
-      0.81818548761525244498957221457878497563002156188229377113703427229531653,
-     -0.87463780492010279041779342125657854691061686311904137072722082871474184,
-      0.87463780492010279041779342125657854691061686311904137072722082871474184,
-     -0.92118023295305878509375343608310642540883934331229359846899146380595001,
-      0.92118023295305878509375343608310642540883934331229359846899146380595001,
-     -0.95728559577808772579820803698082356373755955395409707056352963615334160,
-      0.95728559577808772579820803698082356373755955395409707056352963615334160,
-     -0.98254550526141317487092601578637695610678194890643155902512009144667259,
-      0.98254550526141317487092601578637695610678194890643155902512009144667259,
-     -0.99667944226059658616319153254935388565177345325088000219815732375678559,
-      0.99667944226059658616319153254935388565177345325088000219815732375678559
-    };
-  }
-
-  else if ( order == 30 ) {
-    legendre_roots = {
-     -0.05147184255531769583302521316672257374914145366656956425516084398796476,
-      0.05147184255531769583302521316672257374914145366656956425516084398796476,
-     -0.15386991360858354696379467274325592041855197124433846171896298291578715,
-      0.15386991360858354696379467274325592041855197124433846171896298291578715,
-     -0.25463692616788984643980512981780510788278930330251842616428597508896353,
-      0.25463692616788984643980512981780510788278930330251842616428597508896353,
-     -0.35270472553087811347103720708937386065363100802142562659418446890026942,
-      0.35270472553087811347103720708937386065363100802142562659418446890026942,
-     -0.44703376953808917678060990032285400016240759386142440975447738172761535,
-      0.44703376953808917678060990032285400016240759386142440975447738172761535,
-     -0.53662414814201989926416979331107279416417800693029710545274348291201491,
-      0.53662414814201989926416979331107279416417800693029710545274348291201491,
-     -0.62052618298924286114047755643118929920736469282952813259505117012433531,
-      0.62052618298924286114047755643118929920736469282952813259505117012433531,
-     -0.69785049479331579693229238802664006838235380065395465637972284673997672,
-      0.69785049479331579693229238802664006838235380065395465637972284673997672,
-     -0.76777743210482619491797734097450313169488361723290845320649438736515857,
-      0.76777743210482619491797734097450313169488361723290845320649438736515857,
-     -0.82956576238276839744289811973250191643906869617034167880695298345365651,
-      0.82956576238276839744289811973250191643906869617034167880695298345365651,
-     -0.88256053579205268154311646253022559005668914714648423206832605312161626,
-      0.88256053579205268154311646253022559005668914714648423206832605312161626,
-     -0.92620004742927432587932427708047400408647453682532906091103713367942300,
-      0.92620004742927432587932427708047400408647453682532906091103713367942300,
-     -0.96002186496830751221687102558179766293035921740392339948566167242493996,
-      0.96002186496830751221687102558179766293035921740392339948566167242493996,
-     -0.98366812327974720997003258160566280194031785470971136351718001015114430,
-      0.98366812327974720997003258160566280194031785470971136351718001015114430,
-     -0.99689348407464954027163005091869528334088203811775079010809429780238770,
-      0.99689348407464954027163005091869528334088203811775079010809429780238770
-    };
-  }
-
-  else if ( order == 31 ) {
-    legendre_roots = {
-      0,
-     -0.09955531215234152032517479011894073383899535877752730606022709097726988,
-      0.09955531215234152032517479011894073383899535877752730606022709097726988,
-     -0.19812119933557062877241299603283393777479481216155487998680225425600521,
-      0.19812119933557062877241299603283393777479481216155487998680225425600521,
-     -0.29471806998170161661790389767170433875285518527835855693629588223606957,
-      0.29471806998170161661790389767170433875285518527835855693629588223606957,
-     -0.38838590160823294306135146128752010198510626789354403575781287847167807,
-      0.38838590160823294306135146128752010198510626789354403575781287847167807,
-     -0.47819378204490248044059403935648574843952337149742312483816105099913688,
-      0.47819378204490248044059403935648574843952337149742312483816105099913688,
-     -0.56324916140714926272094492359516142794860227316688703098576878368745538,
-      0.56324916140714926272094492359516142794860227316688703098576878368745538,
-     -0.64270672292426034618441820323250145399169068333620675650930459647613341,
-      0.64270672292426034618441820323250145399169068333620675650930459647613341,
-     -0.71577678458685328390597086536648595589019347616958843262810824560508627,
-      0.71577678458685328390597086536648595589019347616958843262810824560508627,
-     -0.78173314841662494040636002019468449109541037201339888006487506270355750,
-      0.78173314841662494040636002019468449109541037201339888006487506270355750,
-     -0.83992032014626734008690453594017835605473730107474952283136061389494683,
-      0.83992032014626734008690453594017835605473730107474952283136061389494683,
-     -0.88976002994827104337419200898215926154359741186519094976313205592617100,
-      0.88976002994827104337419200898215926154359741186519094976313205592617100,
-     -0.93075699789664816495694575972926351281339768725808203645533637519068294,
-      0.93075699789664816495694575972926351281339768725808203645533637519068294,
-     -0.96250392509294966178905240410585830189721948515255837677335135702997198,
-      0.96250392509294966178905240410585830189721948515255837677335135702997198,
-     -0.98468590966515248400246516673468471093851826951464367094572865939545995,
-      0.98468590966515248400246516673468471093851826951464367094572865939545995,
-     -0.99708748181947707405562655422310250825144533411706963079212371892665654,
-      0.99708748181947707405562655422310250825144533411706963079212371892665654
-    };
-  }
-
-  else if ( order == 32 ) {
-    legendre_roots = {
-     -0.04830766568773831623481257044050216369084725173084889716779373454636859,
-      0.04830766568773831623481257044050216369084725173084889716779373454636859,
-     -0.14447196158279649348518637359881065220384599131563555213795289382421844,
-      0.14447196158279649348518637359881065220384599131563555213795289382421844,
-     -0.23928736225213707454460320916550152060885542196025301554709609955970291,
-      0.23928736225213707454460320916550152060885542196025301554709609955970291,
-     -0.33186860228212764977991680573018799619577513680505983601822963062853768,
-      0.33186860228212764977991680573018799619577513680505983601822963062853768,
-     -0.42135127613063534536411943617242647833587728863244333054166134045571905,
-      0.42135127613063534536411943617242647833587728863244333054166134045571905,
-     -0.50689990893222939002374747437782123018028369959943546397436628097077126,
-      0.50689990893222939002374747437782123018028369959943546397436628097077126,
-     -0.58771575724076232904074547640182685845094011545442057270317884731292286,
-      0.58771575724076232904074547640182685845094011545442057270317884731292286,
-     -0.66304426693021520097511516866323836897702228596050530101708349649244617,
-      0.66304426693021520097511516866323836897702228596050530101708349649244617,
-     -0.73218211874028968038742666509126714663027048350662910082113957327038525,
-      0.73218211874028968038742666509126714663027048350662910082113957327038525,
-     -0.79448379596794240696309729897042890209547940163883545325075824497205939,
-      0.79448379596794240696309729897042890209547940163883545325075824497205939,
-     -0.84936761373256997013369300496774253895488679304975923310021959861372466,
-      0.84936761373256997013369300496774253895488679304975923310021959861372466,
-     -0.89632115576605212396530724371921226847899649679575957656361541296502498,
-      0.89632115576605212396530724371921226847899649679575957656361541296502498,
-     -0.93490607593773968917091913483540932552867143228283721845840373981181619,
-      0.93490607593773968917091913483540932552867143228283721845840373981181619,
-     -0.96476225558750643077381192811827496038889522044301871932201132183709953,
-      0.96476225558750643077381192811827496038889522044301871932201132183709953,
-     -0.98561151154526833540017504463090197863239571433580631821078217058203058,
-      0.98561151154526833540017504463090197863239571433580631821078217058203058,
-     -0.99726386184948156354498112866504072713853766372946115930111854578623591,
-      0.99726386184948156354498112866504072713853766372946115930111854578623591
-    };
-  }
-
-  else if ( order == 33 ) {
-    legendre_roots = {
-      0,
-     -0.09363106585473338567074292412253772132150577815263688128202519579289400,
-      0.09363106585473338567074292412253772132150577815263688128202519579289400,
-     -0.18643929882799157233579875921882398783734430282316534160934583605100170,
-      0.18643929882799157233579875921882398783734430282316534160934583605100170,
-     -0.27760909715249702940324806729832100575475832927824321891534808932413341,
-      0.27760909715249702940324806729832100575475832927824321891534808932413341,
-     -0.36633925774807334107022062325387111129693468110014017163820556536695725,
-      0.36633925774807334107022062325387111129693468110014017163820556536695725,
-     -0.45185001727245069572599327724076705379877173439053117742637848022022140,
-      0.45185001727245069572599327724076705379877173439053117742637848022022140,
-     -0.53338990478634764354889426499549212545266509222442246935653308972425933,
-      0.53338990478634764354889426499549212545266509222442246935653308972425933,
-     -0.61024234583637902730728751353809743140634293088803394908953142094842796,
-      0.61024234583637902730728751353809743140634293088803394908953142094842796,
-     -0.68173195996974278626821594691932813466893518071429402892273851702882452,
-      0.68173195996974278626821594691932813466893518071429402892273851702882452,
-     -0.74723049644956215785905512489794826885428808646382447861307854286194721,
-      0.74723049644956215785905512489794826885428808646382447861307854286194721,
-     -0.80616235627416658979620087078277717569771061813544611234712513698656798,
-      0.80616235627416658979620087078277717569771061813544611234712513698656798,
-     -0.85800965267650406464306148014606847332735106889672006579713641870185989,
-      0.85800965267650406464306148014606847332735106889672006579713641870185989,
-     -0.90231676774343358304053133151876160747520555819091811495655129076537019,
-      0.90231676774343358304053133151876160747520555819091811495655129076537019,
-     -0.93869437261116835035583512436355371261443448409654682589660978541603909,
-      0.93869437261116835035583512436355371261443448409654682589660978541603909,
-     -0.96682290968999276892837770667859224521831433657998659964673162582856129,
-      0.96682290968999276892837770667859224521831433657998659964673162582856129,
-     -0.98645572623064248811037569826462592158917111421565109972305565823615253,
-      0.98645572623064248811037569826462592158917111421565109972305565823615253,
-     -0.99742469424645521726616801758040416107822901088136192071704013308544482,
-      0.99742469424645521726616801758040416107822901088136192071704013308544482
-    };
-  }
-
-  else if ( order == 34 ) {
-    legendre_roots = {
-     -0.04550982195310254274907567085193016383108415018720540202442509486836049,
-      0.04550982195310254274907567085193016383108415018720540202442509486836049,
-     -0.13615235725918297589442882433111783149728061776453628210580740238670902,
-      0.13615235725918297589442882433111783149728061776453628210580740238670902,
-     -0.22566669161644948386864118093434724435218972104798055299535325641700514,
-      0.22566669161644948386864118093434724435218972104798055299535325641700514,
-     -0.31331108133946324745831676565097799477122986558449294057150606632249500,
-      0.31331108133946324745831676565097799477122986558449294057150606632249500,
-     -0.39835927775864594063149475293235152934246212965564821464728079079255310,
-      0.39835927775864594063149475293235152934246212965564821464728079079255310,
-     -0.48010654519032703419410268050739710858735494890390578413410926306850867,
-      0.48010654519032703419410268050739710858735494890390578413410926306850867,
-     -0.55787550066974664273645988621627458133744137804535389547701762836302057,
-      0.55787550066974664273645988621627458133744137804535389547701762836302057,
-     -0.63102172708052854531777575551900827781089725407344353104519544500069339,
-      0.63102172708052854531777575551900827781089725407344353104519544500069339,
-     -0.69893911321626290793300010657577718263776403145575631042344540842848842,
-      0.69893911321626290793300010657577718263776403145575631042344540842848842,
-     -0.76106487662987301418740896897873683360449936672619692168001610040361333,
-      0.76106487662987301418740896897873683360449936672619692168001610040361333,
-     -0.81688422790093366459157890658697325839314991097425390211936409194174079,
-      0.81688422790093366459157890658697325839314991097425390211936409194174079,
-     -0.86593463833456446926357209067129984469663530173678306865959420774588425,
-      0.86593463833456446926357209067129984469663530173678306865959420774588425,
-     -0.90780967771832446880089988901928746016239757280315209404146319753338523,
-      0.90780967771832446880089988901928746016239757280315209404146319753338523,
-     -0.94216239740510709163167602546057290300620569233711755821350240169761824,
-      0.94216239740510709163167602546057290300620569233711755821350240169761824,
-     -0.96870826253334428176464657305599351096780874535347333599206692316486694,
-      0.96870826253334428176464657305599351096780874535347333599206692316486694,
-     -0.98722781640630948504975043109968497294877014866013221923440890065749020,
-      0.98722781640630948504975043109968497294877014866013221923440890065749020,
-     -0.99757175379084191924337243745462923140050988268492977293994429655257213,
-      0.99757175379084191924337243745462923140050988268492977293994429655257213
-    };
-  }
-
-  else if ( order == 35 ) {
-    legendre_roots = {
-      0,
-     -0.08837134327565926360092943349754880342411743476509814139725086668186612,
-      0.08837134327565926360092943349754880342411743476509814139725086668186612,
-     -0.17605106116598956997430365644505992967542971232975704741088801268954288,
-      0.17605106116598956997430365644505992967542971232975704741088801268954288,
-     -0.26235294120929605797089520045558051348630439864578128365820622160315956,
-      0.26235294120929605797089520045558051348630439864578128365820622160315956,
-     -0.34660155443081394587697983493023823180840876937729210872687988554085497,
-      0.34660155443081394587697983493023823180840876937729210872687988554085497,
-     -0.42813754151781425418762061300147985878471844648853384395397197681584829,
-      0.42813754151781425418762061300147985878471844648853384395397197681584829,
-     -0.50632277324148861502429755583732737658608793863636924753107281751191386,
-      0.50632277324148861502429755583732737658608793863636924753107281751191386,
-     -0.58054534474976450993450200818969007093207020356433243389225780721009714,
-      0.58054534474976450993450200818969007093207020356433243389225780721009714,
-     -0.65022436466589038867579280898455926336976232592837400126498692372829521,
-      0.65022436466589038867579280898455926336976232592837400126498692372829521,
-     -0.71481450155662878326440863122444674696204396852173051192539184344641780,
-      0.71481450155662878326440863122444674696204396852173051192539184344641780,
-     -0.77381025228691255526742300920988748101181007297154592634339916728344613,
-      0.77381025228691255526742300920988748101181007297154592634339916728344613,
-     -0.82674989909222540683405061274855757904689061798230734135296924639283503,
-      0.82674989909222540683405061274855757904689061798230734135296924639283503,
-     -0.87321912502522233152328234914138526664433890227937494663482945132374508,
-      0.87321912502522233152328234914138526664433890227937494663482945132374508,
-     -0.91285426135931761446493706355576423048806101362555800492979203053090113,
-      0.91285426135931761446493706355576423048806101362555800492979203053090113,
-     -0.94534514820782732953872598552997464486281125124787315411193699309778400,
-      0.94534514820782732953872598552997464486281125124787315411193699309778400,
-     -0.97043761603922983321507048258477014252488123931237660742063722005049632,
-      0.97043761603922983321507048258477014252488123931237660742063722005049632,
-     -0.98793576444385149803511708918548598531300829571417435475611395754771419,
-      0.98793576444385149803511708918548598531300829571417435475611395754771419,
-     -0.99770656909960029726016313931209472519327463717101331659229771374251911,
-      0.99770656909960029726016313931209472519327463717101331659229771374251911
-    };
-  }
-
-  else if ( order == 36 ) {
-    legendre_roots = {
-     -0.04301819847370860722696897822836343455429479480600918976840018055882080,
-      0.04301819847370860722696897822836343455429479480600918976840018055882080,
-     -0.12873610380938478865199338800515230117728972459937313360590289103530612,
-      0.12873610380938478865199338800515230117728972459937313360590289103530612,
-     -0.21350089231686557894322622890271391675846173127276819455010391037208566,
-      0.21350089231686557894322622890271391675846173127276819455010391037208566,
-     -0.29668499534402827050323904774517045270024182295982532670161445277305354,
-      0.29668499534402827050323904774517045270024182295982532670161445277305354,
-     -0.37767254711968921632273638966990762216617280488528786620739067011126464,
-      0.37767254711968921632273638966990762216617280488528786620739067011126464,
-     -0.45586394443342026720721766932744092595784238829685747265617950947825943,
-      0.45586394443342026720721766932744092595784238829685747265617950947825943,
-     -0.53068028592624516164070908012156981766122287264682207647587856084579465,
-      0.53068028592624516164070908012156981766122287264682207647587856084579465,
-     -0.60156765813598053507994497507359475174295415598675190997523759202647799,
-      0.60156765813598053507994497507359475174295415598675190997523759202647799,
-     -0.66800123658552106209719134434091763916470249021263765340159586476396946,
-      0.66800123658552106209719134434091763916470249021263765340159586476396946,
-     -0.72948917159355658209026047900610898556584304690519700410583108042219796,
-      0.72948917159355658209026047900610898556584304690519700410583108042219796,
-     -0.78557623013220651282776896508029260330233050583960136064813263719755623,
-      0.78557623013220651282776896508029260330233050583960136064813263719755623,
-     -0.83584716699247530641882087249860065334677937939232514421886425954884739,
-      0.83584716699247530641882087249860065334677937939232514421886425954884739,
-     -0.87992980089039713198242733746583558877329284208075692776787359843381671,
-      0.87992980089039713198242733746583558877329284208075692776787359843381671,
-     -0.91749777451565906607586722302615639993690946781365485585199310667193136,
-      0.91749777451565906607586722302615639993690946781365485585199310667193136,
-     -0.94827298439950754520247411494522784628937652533367363255021103692942064,
-      0.94827298439950754520247411494522784628937652533367363255021103692942064,
-     -0.97202769104969794933560504843110832761604639626595174057281228388387443,
-      0.97202769104969794933560504843110832761604639626595174057281228388387443,
-     -0.98858647890221223807339510787710744660716252006528705578819152713454141,
-      0.98858647890221223807339510787710744660716252006528705578819152713454141,
-     -0.99783046248408583619882834558075023864981646239663131259054116779973136,
-      0.99783046248408583619882834558075023864981646239663131259054116779973136
-    };
-  }
-
-  else if ( order == 37 ) {
-    legendre_roots = {
-      0,
-     -0.08367040895476990194304833173639917756352163203515229361529331764554141,
-      0.08367040895476990194304833173639917756352163203515229361529331764554141,
-     -0.16675393023985197696867173041182443746664839603127634900410799882912685,
-      0.16675393023985197696867173041182443746664839603127634900410799882912685,
-     -0.24866779279136575880556775148771621853167765168294515767851682697071531,
-      0.24866779279136575880556775148771621853167765168294515767851682697071531,
-     -0.32883742988370699949847180133994048368002257529230803802293551800389282,
-      0.32883742988370699949847180133994048368002257529230803802293551800389282,
-     -0.40670050931832611010093159161396660852247127935055889959630397048489653,
-      0.40670050931832611010093159161396660852247127935055889959630397048489653,
-     -0.48171087780320555414719286888263917198952243434735039595510893699442599,
-      0.48171087780320555414719286888263917198952243434735039595510893699442599,
-     -0.55334239186158178123509835822926447347228655224098232397199961173386928,
-      0.55334239186158178123509835822926447347228655224098232397199961173386928,
-     -0.62109260840892448314815259159505731004172640060413515922390186643614757,
-      0.62109260840892448314815259159505731004172640060413515922390186643614757,
-     -0.68448630913095935744552321243115370804434381097007768743284097760206610,
-      0.68448630913095935744552321243115370804434381097007768743284097760206610,
-     -0.74307883398196526254704741747381287908990185326301260235214708346322831,
-      0.74307883398196526254704741747381287908990185326301260235214708346322831,
-     -0.79645920050990229339304633550032452348563115894052160758188377804224538,
-      0.79645920050990229339304633550032452348563115894052160758188377804224538,
-     -0.84425298734055596798745627617486023169063449589762218411906551980678089,
-      0.84425298734055596798745627617486023169063449589762218411906551980678089,
-     -0.88612496215548607894614950901688644010681323482689630769855031804283394,
-      0.88612496215548607894614950901688644010681323482689630769855031804283394,
-     -0.92178143741246374266814368670071348878159526716232966114141050837926465,
-      0.92178143741246374266814368670071348878159526716232966114141050837926465,
-     -0.95097234326209482132857609681632593399754857980457738551756067210927540,
-      0.95097234326209482132857609681632593399754857980457738551756067210927540,
-     -0.97349303005648574432889047566575934481538461670860826835950340942525497,
-      0.97349303005648574432889047566575934481538461670860826835950340942525497,
-     -0.98918596321431918668409906058427230896245291758067398047602164555467738,
-      0.98918596321431918668409906058427230896245291758067398047602164555467738,
-     -0.99794458247791364894080307431736328366900784948672915406882677468633248,
-      0.99794458247791364894080307431736328366900784948672915406882677468633248
-    };
-  }
-
-  else if ( order == 38 ) {
-    legendre_roots = {
-     -0.04078514790457823991331643232978492078477364268365481169359747782594000,
-      0.04078514790457823991331643232978492078477364268365481169359747782594000,
-     -0.12208402533786741986961238132940711656811814149930000880377455109963712,
-      0.12208402533786741986961238132940711656811814149930000880377455109963712,
-     -0.20257045389211670320397778151460705737165508575370351724766672234903390,
-      0.20257045389211670320397778151460705737165508575370351724766672234903390,
-     -0.28170880979016526136011407141870007676967050878361133180017628607438288,
-      0.28170880979016526136011407141870007676967050878361133180017628607438288,
-     -0.35897244047943501325671762145653429179606294921136807378820965052268564,
-      0.35897244047943501325671762145653429179606294921136807378820965052268564,
-     -0.43384716943237648437325616251784220400592380040683912370241895496554475,
-      0.43384716943237648437325616251784220400592380040683912370241895496554475,
-     -0.50583471792793110324053371646765200279384655063718764501622005899210663,
-      0.50583471792793110324053371646765200279384655063718764501622005899210663,
-     -0.57445602104780708113292750092447251021019959785379876460707767610621709,
-      0.57445602104780708113292750092447251021019959785379876460707767610621709,
-     -0.63925441582968170718034486950026027170117039540966142889623559323424441,
-      0.63925441582968170718034486950026027170117039540966142889623559323424441,
-     -0.69979868037918435591282584062741587563820701530059043773071895245523690,
-      0.69979868037918435591282584062741587563820701530059043773071895245523690,
-     -0.75568590375397068073773809677938741350383757074670392730168635916117741,
-      0.75568590375397068073773809677938741350383757074670392730168635916117741,
-     -0.80654416760531681555156537597969832573177298132931962120550838811954502,
-      0.80654416760531681555156537597969832573177298132931962120550838811954502,
-     -0.85203502193236218885964971124727628044038503732763096888155711243838041,
-      0.85203502193236218885964971124727628044038503732763096888155711243838041,
-     -0.89185573900463221679493703197391751157989905323451536096208890105840178,
-      0.89185573900463221679493703197391751157989905323451536096208890105840178,
-     -0.92574133204858439682510956221305091148091787648110552072113666084360604,
-      0.92574133204858439682510956221305091148091787648110552072113666084360604,
-     -0.95346633093352959567054215311744121738577897072292870974403278599865997,
-      0.95346633093352959567054215311744121738577897072292870974403278599865997,
-     -0.97484632859015350764088554094638864259197535876607351599155357952136154,
-      0.97484632859015350764088554094638864259197535876607351599155357952136154,
-     -0.98973945426638557194442589110567934732438124690802220638383149907385890,
-      0.98973945426638557194442589110567934732438124690802220638383149907385890,
-     -0.99804993053568761981284707655158099749046537027458809016074439401393486,
-      0.99804993053568761981284707655158099749046537027458809016074439401393486
-    };
-  }
-
-  else if ( order == 39 ) {
-    legendre_roots = {
-      0,
-     -0.07944380460875547758191708319264064688500316510674193325522939167469064,
-      0.07944380460875547758191708319264064688500316510674193325522939167469064,
-     -0.15838533999783779992270106136139938446682623686514314046635275971942828,
-      0.15838533999783779992270106136139938446682623686514314046635275971942828,
-     -0.23632551246183576733600632733265044806571922479405759593034932012974608,
-      0.23632551246183576733600632733265044806571922479405759593034932012974608,
-     -0.31277155924818592253599691178562873960190560997753935026481762464100209,
-      0.31277155924818592253599691178562873960190560997753935026481762464100209,
-     -0.38724016397156145585388196563696269601257617271682661588014750519569093,
-      0.38724016397156145585388196563696269601257617271682661588014750519569093,
-     -0.45926051230913604866324663310957236293874915369601723787608993884857901,
-      0.45926051230913604866324663310957236293874915369601723787608993884857901,
-     -0.52837726866043747389634363580822250534071765348542477598529062836050265,
-      0.52837726866043747389634363580822250534071765348542477598529062836050265,
-     -0.59415345495727798869289007461910606816559154467812653537082647115657417,
-      0.59415345495727798869289007461910606816559154467812653537082647115657417,
-     -0.65617321343201091073442593497625618488010761157697043054180554677722745,
-      0.65617321343201091073442593497625618488010761157697043054180554677722745,
-     -0.71404443589453467913386703615183078966434528189369821519767544776761602,
-      0.71404443589453467913386703615183078966434528189369821519767544776761602,
-     -0.76740124293106349983227240422834294547283411345901066174765116605532532,
-      0.76740124293106349983227240422834294547283411345901066174765116605532532,
-     -0.81590629743014310435323267840962982772781406052092385735904434373004359,
-      0.81590629743014310435323267840962982772781406052092385735904434373004359,
-     -0.85925293799990615391379743912604237053508444531982206052615424053113580,
-      0.85925293799990615391379743912604237053508444531982206052615424053113580,
-     -0.89716711929299288784829109086081365106569207797562300249825142878351892,
-      0.89716711929299288784829109086081365106569207797562300249825142878351892,
-     -0.92940914848673822969781696435773456184410280950770352688827288274141616,
-      0.92940914848673822969781696435773456184410280950770352688827288274141616,
-     -0.95577521232465227711089189719108220300177179063887613583055850459824684,
-      0.95577521232465227711089189719108220300177179063887613583055850459824684,
-     -0.97609870933347105384485031988951849429074741268010170277760373863111165,
-      0.97609870933347105384485031988951849429074741268010170277760373863111165,
-     -0.99025153685468598363977511724707820470969382104019179625882941958347224,
-      0.99025153685468598363977511724707820470969382104019179625882941958347224,
-     -0.99814738306643290600547230285182044183200974004966421176121791796500921,
-      0.99814738306643290600547230285182044183200974004966421176121791796500921
-    };
-  }
-
-  else if ( order == 40 ) {
-    legendre_roots = {
-     -0.03877241750605082193319344402462329467936463438314159916863718143800658,
-      0.03877241750605082193319344402462329467936463438314159916863718143800658,
-     -0.11608407067525520848345128440802411376872853085421594903029743216157916,
-      0.11608407067525520848345128440802411376872853085421594903029743216157916,
-     -0.19269758070137109971551685206514989481409202110520887488546759223650272,
-      0.19269758070137109971551685206514989481409202110520887488546759223650272,
-     -0.26815218500725368114118434480859618342480437323624698145725997487382119,
-      0.26815218500725368114118434480859618342480437323624698145725997487382119,
-     -0.34199409082575847300749248117919431006695362002732579646340958409814371,
-      0.34199409082575847300749248117919431006695362002732579646340958409814371,
-     -0.41377920437160500152487974580371368297409962405291823829440225106864266,
-      0.41377920437160500152487974580371368297409962405291823829440225106864266,
-     -0.48307580168617871290856657424482300459902239553311410078933524322594344,
-      0.48307580168617871290856657424482300459902239553311410078933524322594344,
-     -0.54946712509512820207593130552951797023397510159565146490256547172185575,
-      0.54946712509512820207593130552951797023397510159565146490256547172185575,
-     -0.61255388966798023795261245023069487738012378168314961113534756253019097,
-      0.61255388966798023795261245023069487738012378168314961113534756253019097,
-     -0.67195668461417954837935451496149410997032598138385115007109296898666248,
-      0.67195668461417954837935451496149410997032598138385115007109296898666248,
-     -0.72731825518992710328099645175493054855737867353332813754755124418592911,
-      0.72731825518992710328099645175493054855737867353332813754755124418592911,
-     -0.77830565142651938769497154550649484802069131612689179424534206062931194,
-      0.77830565142651938769497154550649484802069131612689179424534206062931194,
-     -0.82461223083331166319632023066609877390724038424298779969179096315280717,
-      0.82461223083331166319632023066609877390724038424298779969179096315280717,
-     -0.86595950321225950382078180835461996357054655301110164945994025480668208,
-      0.86595950321225950382078180835461996357054655301110164945994025480668208,
-     -0.90209880696887429672825333086849310358448808105766946772526011154037018,
-      0.90209880696887429672825333086849310358448808105766946772526011154037018,
-     -0.93281280827867653336085216684520571643475357528269244922934301541564052,
-      0.93281280827867653336085216684520571643475357528269244922934301541564052,
-     -0.95791681921379165580454099945275928509488349060274703156905384358175836,
-      0.95791681921379165580454099945275928509488349060274703156905384358175836,
-     -0.97725994998377426266337028371290380697866793203798609642926201601106321,
-      0.97725994998377426266337028371290380697866793203798609642926201601106321,
-     -0.99072623869945700645305435222137215496222208135108653788307624430407890,
-      0.99072623869945700645305435222137215496222208135108653788307624430407890,
-     -0.99823770971055920034962270242058649233577038159504590660333611709683886,
-      0.99823770971055920034962270242058649233577038159504590660333611709683886
-    };
-  }
-
-  else if ( order == 41 ) {
-    legendre_roots = {
-      0,
-     -0.07562325898916299692376619365120026748105063560665694875010381709435917,
-      0.07562325898916299692376619365120026748105063560665694875010381709435917,
-     -0.15081335486399216357437796788458237577563094532949783096516944199044666,
-      0.15081335486399216357437796788458237577563094532949783096516944199044666,
-     -0.22513960563342277560578625665547233029991242064424322235018785452701158,
-      0.22513960563342277560578625665547233029991242064424322235018785452701158,
-     -0.29817627734182486592298288047892430413995586844614852607454574122271292,
-      0.29817627734182486592298288047892430413995586844614852607454574122271292,
-     -0.36950502264048144142836691329993520562408697133187607875120488833778700,
-      0.36950502264048144142836691329993520562408697133187607875120488833778700,
-     -0.43871727705140708851711985672803924842178575875946864336157142760703434,
-      0.43871727705140708851711985672803924842178575875946864336157142760703434,
-     -0.50541659919940603270833607020269476495107554601518024566832409004937945,
-      0.50541659919940603270833607020269476495107554601518024566832409004937945,
-     -0.56922094161021586965474721528298025161045692397954524383551704532390614,
-      0.56922094161021586965474721528298025161045692397954524383551704532390614,
-     -0.62976483907219632048864909169510350107851478073947087387656754625553774,
-      0.62976483907219632048864909169510350107851478073947087387656754625553774,
-     -0.68670150203495128958460385652913481206643846014967312878694426923738308,
-      0.68670150203495128958460385652913481206643846014967312878694426923738308,
-     -0.73970480306992618106016874446855900039525443905256896547644635833029852,
-      0.73970480306992618106016874446855900039525443905256896547644635833029852,
-     -0.78847114504740937273622178146677028899471207909872721037768646205490123,
-      0.78847114504740937273622178146677028899471207909872721037768646205490123,
-     -0.83272120040136133124427277904854379997697599297858213330417557092070266,
-      0.83272120040136133124427277904854379997697599297858213330417557092070266,
-     -0.87220151169244140883367057423432946028204265553953300184752167181835431,
-      0.87220151169244140883367057423432946028204265553953300184752167181835431,
-     -0.90668594475810117295834041323072297335430718532228485441741783380695945,
-      0.90668594475810117295834041323072297335430718532228485441741783380695945,
-     -0.93597698749785382568231827528476626627123711808734477455719430008316238,
-      0.93597698749785382568231827528476626627123711808734477455719430008316238,
-     -0.95990689173034622609944169606868658206695109082946635065727417463081850,
-      0.95990689173034622609944169606868658206695109082946635065727417463081850,
-     -0.97833867356108338446917070667396719837563678191865428239086385191199790,
-      0.97833867356108338446917070667396719837563678191865428239086385191199790,
-     -0.99116710969901630825015889457316965769275601357000304731392337587529847,
-      0.99116710969901630825015889457316965769275601357000304731392337587529847,
-     -0.99832158857477144151918850808837756793150435151367016643051899950824353,
-      0.99832158857477144151918850808837756793150435151367016643051899950824353
-    };
-  }
-
-  else if ( order == 42 ) {
-    legendre_roots = {
-     -0.03694894316535177581309598003755942664170845224922253134964501060652417,
-      0.03694894316535177581309598003755942664170845224922253134964501060652417,
-     -0.11064502720851986834912254500264100486734402448363080740347614488006331,
-      0.11064502720851986834912254500264100486734402448363080740347614488006331,
-     -0.18373680656485455085275563938074294093332396162251510035441157135321197,
-      0.18373680656485455085275563938074294093332396162251510035441157135321197,
-     -0.25582507934287908396641479101870844876876645646540095466069816670764798,
-      0.25582507934287908396641479101870844876876645646540095466069816670764798,
-     -0.32651612446541151219715658937546566905841147049858452393819663381343621,
-      0.32651612446541151219715658937546566905841147049858452393819663381343621,
-     -0.39542385204297505767709395459437198079917857648635348826197551043823348,
-      0.39542385204297505767709395459437198079917857648635348826197551043823348,
-     -0.46217191207042192975907502993063598510966490847360863109283036213975414,
-      0.46217191207042192975907502993063598510966490847360863109283036213975414,
-     -0.52639574993119228759286755879190146143573976492990992892843235117865284,
-      0.52639574993119228759286755879190146143573976492990992892843235117865284,
-     -0.58774459748510932284071134547399571990543130482800164589825627022186979,
-      0.58774459748510932284071134547399571990543130482800164589825627022186979,
-     -0.64588338886924783395749630371841170116908654384014386468472621835418654,
-      0.64588338886924783395749630371841170116908654384014386468472621835418654,
-     -0.70049459055617121374156992905546553430017594180009318112756928038264573,
-      0.70049459055617121374156992905546553430017594180009318112756928038264573,
-     -0.75127993568948048956847217591465865550256451982954092485393123073617913,
-      0.75127993568948048956847217591465865550256451982954092485393123073617913,
-     -0.79796205325548741323270595254637666013237551129065413405809993851641496,
-      0.79796205325548741323270595254637666013237551129065413405809993851641496,
-     -0.84028598326181690092543999508609981782339857519356835680510727772958176,
-      0.84028598326181690092543999508609981782339857519356835680510727772958176,
-     -0.87802056981217274271198510347862353406281971624391859875586127032350420,
-      0.87802056981217274271198510347862353406281971624391859875586127032350420,
-     -0.91095972490412745258384787920850654231890035133945560387844813369315012,
-      0.91095972490412745258384787920850654231890035133945560387844813369315012,
-     -0.93892355735498817853317343362559197025138781845017187084180342147483647,
-      0.93892355735498817853317343362559197025138781845017187084180342147483647,
-     -0.96175936533820448874692715785332268117172128891403199897862970601663056,
-      0.96175936533820448874692715785332268117172128891403199897862970601663056,
-     -0.97934250806374819370898256654285609558647498012906292861550926997550439,
-      0.97934250806374819370898256654285609558647498012906292861550926997550439,
-     -0.99157728834086091979236125328086883345269326473710401757687904813164473,
-      0.99157728834086091979236125328086883345269326473710401757687904813164473,
-     -0.99839961899006241502286812684705027617787608352278125176485550254510169,
-      0.99839961899006241502286812684705027617787608352278125176485550254510169
-    };
-  }
-
-  else if ( order == 43 ) {
-    legendre_roots = {
-      0,
-     -0.07215299087458623542232725095556109485765527666061430552447044315502569,
-      0.07215299087458623542232725095556109485765527666061430552447044315502569,
-     -0.14392980951071331077029993761074468868278888347134264823300773825365490,
-      0.14392980951071331077029993761074468868278888347134264823300773825365490,
-     -0.21495624486051820901487838147367495373722428638545304444245128162805362,
-      0.21495624486051820901487838147367495373722428638545304444245128162805362,
-     -0.28486199803291362710572289483833793178587981775426116955275308523350303,
-      0.28486199803291362710572289483833793178587981775426116955275308523350303,
-     -0.35328261286430380664547636414346787178044503014256554223927414565852913,
-      0.35328261286430380664547636414346787178044503014256554223927414565852913,
-     -0.41986137602926925248727939456056802607498890771457094808735294343140156,
-      0.41986137602926925248727939456056802607498890771457094808735294343140156,
-     -0.48425117678573472406963343474851377799357708187172329632200571815533073,
-      0.48425117678573472406963343474851377799357708187172329632200571815533073,
-     -0.54611631666008471914040504717966083665485422412475580262460279172606607,
-      0.54611631666008471914040504717966083665485422412475580262460279172606607,
-     -0.60513425963960093572508307112395522143836980789452728929679328226778762,
-      0.60513425963960093572508307112395522143836980789452728929679328226778762,
-     -0.66099731375149813316513476374134539411315681253421329349475931924539702,
-      0.66099731375149813316513476374134539411315681253421329349475931924539702,
-     -0.71341423526895705485192087799090410264252916711363611639604966302635880,
-      0.71341423526895705485192087799090410264252916711363611639604966302635880,
-     -0.76211174719495512146032846302904618780759525868595775625125375455635849,
-      0.76211174719495512146032846302904618780759525868595775625125375455635849,
-     -0.80683596413693863527907474087751212606088624348175259663307053216470437,
-      0.80683596413693863527907474087751212606088624348175259663307053216470437,
-     -0.84735371620931504899908608582179251751259654747723988373417318954255611,
-      0.84735371620931504899908608582179251751259654747723988373417318954255611,
-     -0.88345376521861686333767801164216741786216669424245159853029774638990486,
-      0.88345376521861686333767801164216741786216669424245159853029774638990486,
-     -0.91494790720613872945610287079928561674578010310842305699980049137411923,
-      0.91494790720613872945610287079928561674578010310842305699980049137411923,
-     -0.94167195684763786181847739039793827146647608981382775781879496341258439,
-      0.94167195684763786181847739039793827146647608981382775781879496341258439,
-     -0.96348661301407999341019496357424393986761891227871254633533837760719033,
-      0.96348661301407999341019496357424393986761891227871254633533837760719033,
-     -0.98027822098025533150552938218113639018086759651957348417248932791119963,
-      0.98027822098025533150552938218113639018086759651957348417248932791119963,
-     -0.99195955759324414642071834132961801638705322595895272821468220018605638,
-      0.99195955759324414642071834132961801638705322595895272821468220018605638,
-     -0.99847233224250771351763618731839241196205071784760914329308343678338033,
-      0.99847233224250771351763618731839241196205071784760914329308343678338033
-    };
-  }
-
-  else if ( order == 44 ) {
-    legendre_roots = {
-     -0.03528923696413535905819670463141635588500219758952707677713880500267083,
-      0.03528923696413535905819670463141635588500219758952707677713880500267083,
-     -0.10569190170865324711730584891512175238338599885959761378240149643180111,
-      0.10569190170865324711730584891512175238338599885959761378240149643180111,
-     -0.17556801477551678574650774938097659064737450672451331540702457232926460,
-      0.17556801477551678574650774938097659064737450672451331540702457232926460,
-     -0.24456945692820125150730243474051862053048725928004960367008981648345378,
-      0.24456945692820125150730243474051862053048725928004960367008981648345378,
-     -0.31235246650278581223654516357297853551926362175328863642636121991506618,
-      0.31235246650278581223654516357297853551926362175328863642636121991506618,
-     -0.37857935201470713251176467277219785674282084849567037328983819758898320,
-      0.37857935201470713251176467277219785674282084849567037328983819758898320,
-     -0.44292017452541148383482659364731354953847846030811794924025392402827487,
-      0.44292017452541148383482659364731354953847846030811794924025392402827487,
-     -0.50505439138820231798279835229117723861207329550534861327376929657740431,
-      0.50505439138820231798279835229117723861207329550534861327376929657740431,
-     -0.56467245318547076842463681938207521949074547960426611523556812366792569,
-      0.56467245318547076842463681938207521949074547960426611523556812366792569,
-     -0.62147734590357584780242469912176674714440588001716355915647232282111746,
-      0.62147734590357584780242469912176674714440588001716355915647232282111746,
-     -0.67518607066612236533369903856389992332825540112377087530227717318290560,
-      0.67518607066612236533369903856389992332825540112377087530227717318290560,
-     -0.72553105366071700260696493671995361101246580020809525993302287893869785,
-      0.72553105366071700260696493671995361101246580020809525993302287893869785,
-     -0.77226147924875589901775854923198801372809643956544710976307387942754814,
-      0.77226147924875589901775854923198801372809643956544710976307387942754814,
-     -0.81514453964513501048743763575194055029940057450859424356879422167552265,
-      0.81514453964513501048743763575194055029940057450859424356879422167552265,
-     -0.85396659500471037872830224129268389036116906202906844974800624640506369,
-      0.85396659500471037872830224129268389036116906202906844974800624640506369,
-     -0.88853423828604320233836791019032232475833245820942590006778968355953305,
-      0.88853423828604320233836791019032232475833245820942590006778968355953305,
-     -0.91867525998417577432300108669425204893798526304505300597341221431601374,
-      0.91867525998417577432300108669425204893798526304505300597341221431601374,
-     -0.94423950911819409920325465302698925107245493475992297534389329674063998,
-      0.94423950911819409920325465302698925107245493475992297534389329674063998,
-     -0.96509965042249313939439805058023497471687713858988509277535163451716677,
-      0.96509965042249313939439805058023497471687713858988509277535163451716677,
-     -0.98115183307791396666274900535048782880567555553965773952915523381741693,
-      0.98115183307791396666274900535048782880567555553965773952915523381741693,
-     -0.99231639213851580848333800361353856881189778435221007745825647573239822,
-      0.99231639213851580848333800361353856881189778435221007745825647573239822,
-     -0.99854020063677422493605672060665034905603003317541459799884816568241355,
-      0.99854020063677422493605672060665034905603003317541459799884816568241355
-    };
-  }
-
-  else if ( order == 45 ) {
-    legendre_roots = {
-      0,
-     -0.06898698016314417249041461410381172969392066693096968266540925528852889,
-      0.06898698016314417249041461410381172969392066693096968266540925528852889,
-     -0.13764520598325302875659004142306555310676555654152505961789002992717676,
-      0.13764520598325302875659004142306555310676555654152505961789002992717676,
-     -0.20564748978326374571978722547154393070323638569942983104123381367910746,
-      0.20564748978326374571978722547154393070323638569942983104123381367910746,
-     -0.27266976975237756060876539161564518189821175427664206012150716917639794,
-      0.27266976975237756060876539161564518189821175427664206012150716917639794,
-     -0.33839265425060216164340410003187298953234144313742269794759298348773545,
-      0.33839265425060216164340410003187298953234144313742269794759298348773545,
-     -0.40250294385854191407797450854834645597029935756939643883585768013407520,
-      0.40250294385854191407797450854834645597029935756939643883585768013407520,
-     -0.46469512391963509857960150230974851083981266723719088284724638002550644,
-      0.46469512391963509857960150230974851083981266723719088284724638002550644,
-     -0.52467282046291606709113410046016240260710827080028258689085546576831746,
-      0.52467282046291606709113410046016240260710827080028258689085546576831746,
-     -0.58215021256935318668096733444417713100008882598322714602358602776591446,
-      0.58215021256935318668096733444417713100008882598322714602358602776591446,
-     -0.63685339445322335927122384590338315069203124346567644054284862876198286,
-      0.63685339445322335927122384590338315069203124346567644054284862876198286,
-     -0.68852168077120052523201982588043823595523300561852778072094711167345704,
-      0.68852168077120052523201982588043823595523300561852778072094711167345704,
-     -0.73690884894549035262373884859489201987960568083761708092734339893476057,
-      0.73690884894549035262373884859489201987960568083761708092734339893476057,
-     -0.78178431259390629131236318809860281766027351683906152303928839827665344,
-      0.78178431259390629131236318809860281766027351683906152303928839827665344,
-     -0.82293422050208633703577526002650202999341525805627043354404173117169483,
-      0.82293422050208633703577526002650202999341525805627043354404173117169483,
-     -0.86016247596066422533907887056713438778341442357702210107859349253890176,
-      0.86016247596066422533907887056713438778341442357702210107859349253890176,
-     -0.89329167175324173846464905149305734636540124041379268616271110945467320,
-      0.89329167175324173846464905149305734636540124041379268616271110945467320,
-     -0.92216393671900038809746736096052731926536287725066116835082658949266017,
-      0.92216393671900038809746736096052731926536287725066116835082658949266017,
-     -0.94664169099562906178472059695383707845046834416713505079785560311373070,
-      0.94664169099562906178472059695383707845046834416713505079785560311373070,
-     -0.96660831039689460473642516089247809711667903060941541386797488517235618,
-      0.96660831039689460473642516089247809711667903060941541386797488517235618,
-     -0.98196871503454056823931847363434148153836524922046180798689215000297248,
-      0.98196871503454056823931847363434148153836524922046180798689215000297248,
-     -0.99264999844720374174861712059773534497500164330363935061698792830082420,
-      0.99264999844720374174861712059773534497500164330363935061698792830082420,
-     -0.99860364518193663815654767690082054809228852721447541688895639813678472,
-      0.99860364518193663815654767690082054809228852721447541688895639813678472
-    };
-  }
-
-  else if ( order == 46 ) {
-    legendre_roots = {
-     -0.03377219001605204151955783189143976381591611599620192068210517772826250,
-      0.03377219001605204151955783189143976381591611599620192068210517772826250,
-     -0.10116247530558423951585965700864939088187136050149373961951596045442290,
-      0.10116247530558423951585965700864939088187136050149373961951596045442290,
-     -0.16809117946710352860679673742770212744748928183646939673198254433038120,
-      0.16809117946710352860679673742770212744748928183646939673198254433038120,
-     -0.23425292220626976862605611557379249257408882199049802562252863514570747,
-      0.23425292220626976862605611557379249257408882199049802562252863514570747,
-     -0.29934582270187001548343925657790392935609231755423834922366658784363328,
-      0.29934582270187001548343925657790392935609231755423834922366658784363328,
-     -0.36307287702099571012370697851465168984738884285764247149798374968446198,
-      0.36307287702099571012370697851465168984738884285764247149798374968446198,
-     -0.42514331328282839732214686342856741916933776910793469168205628329840029,
-      0.42514331328282839732214686342856741916933776910793469168205628329840029,
-     -0.48527391838816466277232019370845480831966755928303870354450244890485852,
-      0.48527391838816466277232019370845480831966755928303870354450244890485852,
-     -0.54319033026180263527096269102887683603397847038491608539084024130646786,
-      0.54319033026180263527096269102887683603397847038491608539084024130646786,
-     -0.59862828971271515317717253360016731014846633456462994782216839947628379,
-      0.59862828971271515317717253360016731014846633456462994782216839947628379,
-     -0.65133484620199771510647715581685936722760405731847593944921216035593463,
-      0.65133484620199771510647715581685936722760405731847593944921216035593463,
-     -0.70106951202040569751212208942650045024957598314993864646843729900930116,
-      0.70106951202040569751212208942650045024957598314993864646843729900930116,
-     -0.74760535961566605400033650526800286890572218000254649496931338717575366,
-      0.74760535961566605400033650526800286890572218000254649496931338717575366,
-     -0.79073005707527425518914414742030241114796951308471110986900787968474710,
-      0.79073005707527425518914414742030241114796951308471110986900787968474710,
-     -0.83024683706606605303238530479080611799580625397038060803024487939995120,
-      0.83024683706606605303238530479080611799580625397038060803024487939995120,
-     -0.86597539486685806291588877681659843868730474433790448403030130548263464,
-      0.86597539486685806291588877681659843868730474433790448403030130548263464,
-     -0.89775271153394196570131995131978128945462964530135108998141999815817093,
-      0.89775271153394196570131995131978128945462964530135108998141999815817093,
-     -0.92543379880675395097749135769912425888234375643895584760120362665384903,
-      0.92543379880675395097749135769912425888234375643895584760120362665384903,
-     -0.94889236344608979562221353943691413952577138329324533278109356594892332,
-      0.94889236344608979562221353943691413952577138329324533278109356594892332,
-     -0.96802139185399194273774806637181550852231182635363010071532017388889577,
-      0.96802139185399194273774806637181550852231182635363010071532017388889577,
-     -0.98273366980416686347797957965918872021956337029842880064581916682988875,
-      0.98273366980416686347797957965918872021956337029842880064581916682988875,
-     -0.99296234890617436407309544466619340912110283090838402519884761742266411,
-      0.99296234890617436407309544466619340912110283090838402519884761742266411,
-     -0.99866304213381798112826841739088877458415560743463172609110554500267766,
-      0.99866304213381798112826841739088877458415560743463172609110554500267766
-    };
-  }
-
-  else if ( order == 47 ) {
-    legendre_roots = {
-      0,
-     -0.06608692391635567516047377747413370859227627393622040887227555558397271,
-      0.06608692391635567516047377747413370859227627393622040887227555558397271,
-     -0.13188486655451489705382353072412724136333515343848891295025522392877564,
-      0.13188486655451489705382353072412724136333515343848891295025522392877564,
-     -0.19710611027911180796149135837050461755486287042233966535428938111997185,
-      0.19710611027911180796149135837050461755486287042233966535428938111997185,
-     -0.26146545921497457030698296620517097423332273379687972532139888141187354,
-      0.26146545921497457030698296620517097423332273379687972532139888141187354,
-     -0.32468148633773590221076129917999683639962891600706232588210965677499731,
-      0.32468148633773590221076129917999683639962891600706232588210965677499731,
-     -0.38647776408466713958330238760602327020183760801483001493792485184565682,
-      0.38647776408466713958330238760602327020183760801483001493792485184565682,
-     -0.44658407310485570272518214234940795939341700519872109942992623149021448,
-      0.44658407310485570272518214234940795939341700519872109942992623149021448,
-     -0.50473758386357791977428902535130109027320311922460252932268272788996791,
-      0.50473758386357791977428902535130109027320311922460252932268272788996791,
-     -0.56068400593466419448305831741826879114352345459113743949822323534432675,
-      0.56068400593466419448305831741826879114352345459113743949822323534432675,
-     -0.61417869995637360859546254260425368624817994509020474970208722733890797,
-      0.61417869995637360859546254260425368624817994509020474970208722733890797,
-     -0.66498774739033272913670264857208906143051481453327092576017378147655576,
-      0.66498774739033272913670264857208906143051481453327092576017378147655576,
-     -0.71288897340906430166187932777101881170425024575591714308665542120126268,
-      0.71288897340906430166187932777101881170425024575591714308665542120126268,
-     -0.75767291844543863357399652356968220121341991043365343290431317936901627,
-      0.75767291844543863357399652356968220121341991043365343290431317936901627,
-     -0.79914375416774194291556206920359301204052085619873494319995073489970764,
-      0.79914375416774194291556206920359301204052085619873494319995073489970764,
-     -0.83712013989990212127759894856635236418186894946344259363611542180458186,
-      0.83712013989990212127759894856635236418186894946344259363611542180458186,
-     -0.87143601579689631694098546455560617105192652611577960926759529303147308,
-      0.87143601579689631694098546455560617105192652611577960926759529303147308,
-     -0.90194132943852535686717130197743563963863448643228478025959372055178984,
-      0.90194132943852535686717130197743563963863448643228478025959372055178984,
-     -0.92850269301236064819718492461132098137541878694303398972579294674466930,
-      0.92850269301236064819718492461132098137541878694303398972579294674466930,
-     -0.95100396925770844258980292385144242265360151538737902896871183470512443,
-      0.95100396925770844258980292385144242265360151538737902896871183470512443,
-     -0.96934678732656449714574427756027080533830294697950413648687850552327501,
-      0.96934678732656449714574427756027080533830294697950413648687850552327501,
-     -0.98345100307162370876490103403616985193165421910809377438025512180639463,
-      0.98345100307162370876490103403616985193165421910809377438025512180639463,
-     -0.99325521098776863469218968463246360814571208411063073453930968096452882,
-      0.99325521098776863469218968463246360814571208411063073453930968096452882,
-     -0.99871872858421210918394771478710849162709065123149080921596816254857877,
-      0.99871872858421210918394771478710849162709065123149080921596816254857877
-    };
-  }
-
-  else if ( order == 48 ) {
-    legendre_roots = {
-     -0.03238017096286936203332224315213444204596280236151809242500322001737782,
-      0.03238017096286936203332224315213444204596280236151809242500322001737782,
-     -0.09700469920946269893005395585362452015273622930093698643058076594480404,
-      0.09700469920946269893005395585362452015273622930093698643058076594480404,
-     -0.16122235606889171805643739078349769477437437974189511770324263755651634,
-      0.16122235606889171805643739078349769477437437974189511770324263755651634,
-     -0.22476379039468906122486544017469227743856180404165480616474264104518194,
-      0.22476379039468906122486544017469227743856180404165480616474264104518194,
-     -0.28736248735545557673588646131679768785155830580103977890850003216899984,
-      0.28736248735545557673588646131679768785155830580103977890850003216899984,
-     -0.34875588629216073815981793727040791613430964996839257603212296778128159,
-      0.34875588629216073815981793727040791613430964996839257603212296778128159,
-     -0.40868648199071672991622549581463328645992284299488806477115098332562054,
-      0.40868648199071672991622549581463328645992284299488806477115098332562054,
-     -0.46690290475095840454492886165079850923681210425851694418186919513479439,
-      0.46690290475095840454492886165079850923681210425851694418186919513479439,
-     -0.52316097472223303367822586913750852628918762181188410758022954721941445,
-      0.52316097472223303367822586913750852628918762181188410758022954721941445,
-     -0.57722472608397270381780923854047877285399728614019552805239739942773700,
-      0.57722472608397270381780923854047877285399728614019552805239739942773700,
-     -0.62886739677651362399516493306999465202490899979016177098173299451953191,
-      0.62886739677651362399516493306999465202490899979016177098173299451953191,
-     -0.67787237963266390521185128067590905884995467902604861307104064297549465,
-      0.67787237963266390521185128067590905884995467902604861307104064297549465,
-     -0.72403413092381465467448223349366524658509281228072236272936630257335146,
-      0.72403413092381465467448223349366524658509281228072236272936630257335146,
-     -0.76715903251574033925385543752296905362264233084820737223512858866405084,
-      0.76715903251574033925385543752296905362264233084820737223512858866405084,
-     -0.80706620402944262708255304302453844597301302946041538657586294181218215,
-      0.80706620402944262708255304302453844597301302946041538657586294181218215,
-     -0.84358826162439353071108984451965604987088701173755240151491319989884105,
-      0.84358826162439353071108984451965604987088701173755240151491319989884105,
-     -0.87657202027424788590569355480509675456164853372996199274787575187467271,
-      0.87657202027424788590569355480509675456164853372996199274787575187467271,
-     -0.90587913671556967282207483567101178831226219982741084535248542547101682,
-      0.90587913671556967282207483567101178831226219982741084535248542547101682,
-     -0.93138669070655433311417438010160126771999708561895042987060486425307304,
-      0.93138669070655433311417438010160126771999708561895042987060486425307304,
-     -0.95298770316043086072296066602571834320854133182391873686394760349394587,
-      0.95298770316043086072296066602571834320854133182391873686394760349394587,
-     -0.97059159254624725046141198380066005730243391163088370602837235216532331,
-      0.97059159254624725046141198380066005730243391163088370602837235216532331,
-     -0.98412458372282685774458360002659883058923922341738472995765016798552978,
-      0.98412458372282685774458360002659883058923922341738472995765016798552978,
-     -0.99353017226635075754792875084907411835661474959467192961715183809875462,
-      0.99353017226635075754792875084907411835661474959467192961715183809875462,
-     -0.99877100725242611860054149156311364008893765027672103861294048137545884,
-      0.99877100725242611860054149156311364008893765027672103861294048137545884
-    };
-  }
-
-  else if ( order == 49 ) {
-    legendre_roots = {
-      0,
-     -0.06342068498268678602883482087848497315278687277888038749020913836880464,
-      0.06342068498268678602883482087848497315278687277888038749020913836880464,
-     -0.12658599726967205106798528857553619032448712106686671351096825791623843,
-      0.12658599726967205106798528857553619032448712106686671351096825791623843,
-     -0.18924159246181358648531017385998651117967887767881908934443735410392376,
-      0.18924159246181358648531017385998651117967887767881908934443735410392376,
-     -0.25113517861257727350715594282461127458298417457366425129402655420487586,
-      0.25113517861257727350715594282461127458298417457366425129402655420487586,
-     -0.31201753211974876220786067650641626509683340799438724958339733686198987,
-      0.31201753211974876220786067650641626509683340799438724958339733686198987,
-     -0.37164350126228488886373454094696052761474478673392697674986833659903723,
-      0.37164350126228488886373454094696052761474478673392697674986833659903723,
-     -0.42977299334157652465858414180742303306341789787807200984370710437603330,
-      0.42977299334157652465858414180742303306341789787807200984370710437603330,
-     -0.48617194145249204217697609605857506207511519433493660528059769391875029,
-      0.48617194145249204217697609605857506207511519433493660528059769391875029,
-     -0.54061324699172606655822546722943591692410134623836584659794799056320852,
-      0.54061324699172606655822546722943591692410134623836584659794799056320852,
-     -0.59287769410890071245586433679262853463300101531884759045351079311284616,
-      0.59287769410890071245586433679262853463300101531884759045351079311284616,
-     -0.64275483241923766405685694858390010954033547225327753254148242796004168,
-      0.64275483241923766405685694858390010954033547225327753254148242796004168,
-     -0.69004382442513211350475180727494192763350512618903575099154861639628938,
-      0.69004382442513211350475180727494192763350512618903575099154861639628938,
-     -0.73455425423740269621367421285852488465283545332370183443947098622113965,
-      0.73455425423740269621367421285852488465283545332370183443947098622113965,
-     -0.77610689434544663501814281224845607126445046182918186527103430254079467,
-      0.77610689434544663501814281224845607126445046182918186527103430254079467,
-     -0.81453442735985543153950078776477704449467213582275335173676688287103466,
-      0.81453442735985543153950078776477704449467213582275335173676688287103466,
-     -0.84968211984416570103488187224297933332660433246471624874358696445901776,
-      0.84968211984416570103488187224297933332660433246471624874358696445901776,
-     -0.88140844557300891003703153581700492615924003726239133961752918309943320,
-      0.88140844557300891003703153581700492615924003726239133961752918309943320,
-     -0.90958565582807328521301964035580007104277123111671803910684472038382475,
-      0.90958565582807328521301964035580007104277123111671803910684472038382475,
-     -0.93410029475581014905898246063654490246042295281019199440770187329793242,
-      0.93410029475581014905898246063654490246042295281019199440770187329793242,
-     -0.95485365867413723355524367966818441905469445190027379192298617405390942,
-      0.95485365867413723355524367966818441905469445190027379192298617405390942,
-     -0.97176220090155538013997242150477413349786254718090569331922741800279930,
-      0.97176220090155538013997242150477413349786254718090569331922741800279930,
-     -0.98475789591421300435929899536857471035330746214525295321721635763595906,
-      0.98475789591421300435929899536857471035330746214525295321721635763595906,
-     -0.99378866194416779076011385925795361884130739493865016760460278652463011,
-      0.99378866194416779076011385925795361884130739493865016760460278652463011,
-     -0.99882015060663537936183127270411065512368099786450196411294917730284114,
-      0.99882015060663537936183127270411065512368099786450196411294917730284114
-    };
-  }
-
-  else if ( order == 50 ) {
-    legendre_roots = {
-     -0.03109833832718887611232898966594919424729622295999804297479623566203052,
-      0.03109833832718887611232898966594919424729622295999804297479623566203052,
-     -0.09317470156008614085445037763960034788567138392213861468288915564618025,
-      0.09317470156008614085445037763960034788567138392213861468288915564618025,
-     -0.15489058999814590207162862094110950120185022005493763239673032635355782,
-      0.15489058999814590207162862094110950120185022005493763239673032635355782,
-     -0.21600723687604175684728453261710133370575597251013327270362112636199019,
-      0.21600723687604175684728453261710133370575597251013327270362112636199019,
-     -0.27628819377953199032764527852113018571480158713199615061350557943837692,
-      0.27628819377953199032764527852113018571480158713199615061350557943837692,
-     -0.33550024541943735683698825729107169784121859303679576190043053971098619,
-      0.33550024541943735683698825729107169784121859303679576190043053971098619,
-     -0.39341431189756512739422925382381727024613946867265600307903662085649773,
-      0.39341431189756512739422925382381727024613946867265600307903662085649773,
-     -0.44980633497403878914713146777837581731506451346517366594148066988597085,
-      0.44980633497403878914713146777837581731506451346517366594148066988597085,
-     -0.50445814490746420165145913184914119263537867827067923818273921096822638,
-      0.50445814490746420165145913184914119263537867827067923818273921096822638,
-     -0.55715830451465005431552290962580160781589838223775026131646148676048945,
-      0.55715830451465005431552290962580160781589838223775026131646148676048945,
-     -0.60770292718495023918038179639183289360420502067599435571213118893968565,
-      0.60770292718495023918038179639183289360420502067599435571213118893968565,
-     -0.65589646568543936078162486400367981904141052838233182653093459139210848,
-      0.65589646568543936078162486400367981904141052838233182653093459139210848,
-     -0.70155246870682225108954625788365572814971922848469564274092437903329225,
-      0.70155246870682225108954625788365572814971922848469564274092437903329225,
-     -0.74449430222606853826053625268219424287018793132958457852477914793292979,
-      0.74449430222606853826053625268219424287018793132958457852477914793292979,
-     -0.78455583290039926390530519634099120084731627255644435273885912189313102,
-      0.78455583290039926390530519634099120084731627255644435273885912189313102,
-     -0.82158207085933594835625411087393953776074138334348574852337446061546867,
-      0.82158207085933594835625411087393953776074138334348574852337446061546867,
-     -0.85542976942994608461136264393475746765483303948690596343832992034131863,
-      0.85542976942994608461136264393475746765483303948690596343832992034131863,
-     -0.88596797952361304863754098246675363419429031075580836244655713965488733,
-      0.88596797952361304863754098246675363419429031075580836244655713965488733,
-     -0.91307855665579189308973564277165709478418819169778238962272655320085243,
-      0.91307855665579189308973564277165709478418819169778238962272655320085243,
-     -0.93665661894487793378087494727249660215373159809520292237505427380935613,
-      0.93665661894487793378087494727249660215373159809520292237505427380935613,
-     -0.95661095524280794299774564415662209405143412462604654285597908297305531,
-      0.95661095524280794299774564415662209405143412462604654285597908297305531,
-     -0.97286438510669207371334410460625205366917340704995420174509627522567672,
-      0.97286438510669207371334410460625205366917340704995420174509627522567672,
-     -0.98535408404800588230900962563248940401559263094540580871780922100853508,
-      0.98535408404800588230900962563248940401559263094540580871780922100853508,
-     -0.99403196943209071258510820042069472815747797106832359033652478911593331,
-      0.99403196943209071258510820042069472815747797106832359033652478911593331,
-     -0.99886640442007105018545944497421850599624351290407852517703861765753911,
-      0.99886640442007105018545944497421850599624351290407852517703861765753911
-    };
-  }
-
-  else if ( order == 51 ) {
-    legendre_roots = {
-      0,
-     -0.06096110015057872473419470684320540469703046426951978443297042345580046,
-      0.06096110015057872473419470684320540469703046426951978443297042345580046,
-     -0.12169542101888876696382042096318110874530328748446984437471113710749125,
-      0.12169542101888876696382042096318110874530328748446984437471113710749125,
-     -0.18197702695707754532399870116921444992392011653400331319041496966556364,
-      0.18197702695707754532399870116921444992392011653400331319041496966556364,
-     -0.24158166644779870384673311486926242373879324647241357779819372577537397,
-      0.24158166644779870384673311486926242373879324647241357779819372577537397,
-     -0.30028760633533193953024564964442033333133838051304991601719274909232021,
-      0.30028760633533193953024564964442033333133838051304991601719274909232021,
-     -0.35787645668840950977520108851966635689638392209596833403915550346458296,
-      0.35787645668840950977520108851966635689638392209596833403915550346458296,
-     -0.41413398322630387793687180974465790792397717046939456279732719318881239,
-      0.41413398322630387793687180974465790792397717046939456279732719318881239,
-     -0.46885090428604106361045725881162246880672263543008757950256232424972866,
-      0.46885090428604106361045725881162246880672263543008757950256232424972866,
-     -0.52182366936618584251408778482681802456935024586935804909812692911575777,
-      0.52182366936618584251408778482681802456935024586935804909812692911575777,
-     -0.57285521635130383652239470259019090742094312072379945707362533571859775,
-      0.57285521635130383652239470259019090742094312072379945707362533571859775,
-     -0.62175570460072327375504274540331595005438756687016283567661620690047238,
-      0.62175570460072327375504274540331595005438756687016283567661620690047238,
-     -0.66834322117537008686446041940398887592960851177337599584788165286407587,
-      0.66834322117537008686446041940398887592960851177337599584788165286407587,
-     -0.71244445757703664458052485540014564303694479021724814681615199499309624,
-      0.71244445757703664458052485540014564303694479021724814681615199499309624,
-     -0.75389535448537552576396002545247398763063736381467651456572079500976757,
-      0.75389535448537552576396002545247398763063736381467651456572079500976757,
-     -0.79254171209938120523441087837587573015732246374836771370424761764543915,
-      0.79254171209938120523441087837587573015732246374836771370424761764543915,
-     -0.82823976382306483285481842401656236426238778158632526009844607494524058,
-      0.82823976382306483285481842401656236426238778158632526009844607494524058,
-     -0.86085671118229237147349574371611132357734492551096262820622622385192387,
-      0.86085671118229237147349574371611132357734492551096262820622622385192387,
-     -0.89027121802952730327779537073672689355779979887058883136465987901125116,
-      0.89027121802952730327779537073672689355779979887058883136465987901125116,
-     -0.91637386230978023082357129425147587936604267173137565290400106438550214,
-      0.91637386230978023082357129425147587936604267173137565290400106438550214,
-     -0.93906754400296238343536780639090514416516382215016844060256520521437299,
-      0.93906754400296238343536780639090514416516382215016844060256520521437299,
-     -0.95826784861390819455770703831632372761244401855586884712030945705531431,
-      0.95826784861390819455770703831632372761244401855586884712030945705531431,
-     -0.97390336801932386723175548639418663901310650631571286670207449098126271,
-      0.97390336801932386723175548639418663901310650631571286670207449098126271,
-     -0.98591599173590299658388570755830963265211577808719691674680068120016714,
-      0.98591599173590299658388570755830963265211577808719691674680068120016714,
-     -0.99426126043675257462108489794926312823178439027901499730058325651029110,
-      0.99426126043675257462108489794926312823178439027901499730058325651029110,
-     -0.99890999084890349516899587727338563708424992188818878966860320740571805,
-      0.99890999084890349516899587727338563708424992188818878966860320740571805
-    };
-  }
-
-  else if ( order == 52 ) {
-    legendre_roots = {
-     -0.02991410979733876604368077607079992681884360824994698161985753939115171,
-      0.02991410979733876604368077607079992681884360824994698161985753939115171,
-     -0.08963524464890056548885469112239930316985128719019842048410262943072103,
-      0.08963524464890056548885469112239930316985128719019842048410262943072103,
-     -0.14903550860694918048863404001811357032226976188823353243557086554385416,
-      0.14903550860694918048863404001811357032226976188823353243557086554385416,
-     -0.20790226415636605968646612812234551827266281082820464693541281779460801,
-      0.20790226415636605968646612812234551827266281082820464693541281779460801,
-     -0.26602478360500182747297173059883988445592437496218466846713725720852138,
-      0.26602478360500182747297173059883988445592437496218466846713725720852138,
-     -0.32319500343480782550109906660144717905404753380657945793933873227826156,
-      0.32319500343480782550109906660144717905404753380657945793933873227826156,
-     -0.37920826911609366924668176693944888046212159135119660933601231010352733,
-      0.37920826911609366924668176693944888046212159135119660933601231010352733,
-     -0.43386406771876167030908656820978026074374585241840338581909725560659495,
-      0.43386406771876167030908656820978026074374585241840338581909725560659495,
-     -0.48696674569809607778245824134646555685045503971902368774263448042842110,
-      0.48696674569809607778245824134646555685045503971902368774263448042842110,
-     -0.53832620928582743837595116797535676382349014140308097340985563359376996,
-      0.53832620928582743837595116797535676382349014140308097340985563359376996,
-     -0.58775860497957906990202578155720422388122016653804348995978496117036885,
-      0.58775860497957906990202578155720422388122016653804348995978496117036885,
-     -0.63508697769524592429812457928880965359359898895498966320348379664820657,
-      0.63508697769524592429812457928880965359359898895498966320348379664820657,
-     -0.68014190422716770209223877973664100790099671016577591556545298876012070,
-      0.68014190422716770209223877973664100790099671016577591556545298876012070,
-     -0.72276209974998319367681667607193595478399390521472001992348926892971390,
-      0.72276209974998319367681667607193595478399390521472001992348926892971390,
-     -0.76279499519374496027921116308905084079183057450762154671864775467541722,
-      0.76279499519374496027921116308905084079183057450762154671864775467541722,
-     -0.80009728343046832433475875422580765119764185860770158058730849438319268,
-      0.80009728343046832433475875422580765119764185860770158058730849438319268,
-     -0.83453543232673453496172638962123868524593631266922605323167539537529356,
-      0.83453543232673453496172638962123868524593631266922605323167539537529356,
-     -0.86598616284606758524435851762420694089833895262429082393533454501374966,
-      0.86598616284606758524435851762420694089833895262429082393533454501374966,
-     -0.89433689053449532252084408826352755534558099556237649319269886222377916,
-      0.89433689053449532252084408826352755534558099556237649319269886222377916,
-     -0.91948612891642453989359637654188158502952027270247205718622286062730702,
-      0.91948612891642453989359637654188158502952027270247205718622286062730702,
-     -0.94134385364135905684357918385056700582876554543631919967003187189560693,
-      0.94134385364135905684357918385056700582876554543631919967003187189560693,
-     -0.95983182693308655253202515342506544278784747603767741541499397324362806,
-      0.95983182693308655253202515342506544278784747603767741541499397324362806,
-     -0.97488388422174450314070647039964555445992366394593839782844335056242980,
-      0.97488388422174450314070647039964555445992366394593839782844335056242980,
-     -0.98644619565154984064532285911839736802273903582732623279715297831659114,
-      0.98644619565154984064532285911839736802273903582732623279715297831659114,
-     -0.99447759092921602924504327179957170663191177609788217145885629655824967,
-      0.99447759092921602924504327179957170663191177609788217145885629655824967,
-     -0.99895111110395027809096144071659256127801326111535756167992484050043891,
-      0.99895111110395027809096144071659256127801326111535756167992484050043891
-    };
-  }
-
-  else if ( order == 53 ) {
-    legendre_roots = {
-      0,
-     -0.05868505430025946502271194583323153773559128390264423825777818037745764,
-      0.05868505430025946502271194583323153773559128390264423825777818037745764,
-     -0.11716780907195515014025680877932376792332105234443187896258959131377205,
-      0.11716780907195515014025680877932376792332105234443187896258959131377205,
-     -0.17524666215532575072979100913289524582891614994218911453001860494182021,
-      0.17524666215532575072979100913289524582891614994218911453001860494182021,
-     -0.23272140372427259364336364219991621852620931152163832906394926864819422,
-      0.23272140372427259364336364219991621852620931152163832906394926864819422,
-     -0.28939390645162620642654700659401276779605740146645023144978686634336776,
-      0.28939390645162620642654700659401276779605740146645023144978686634336776,
-     -0.34506880849572235669431064606950091485609334583293545091078365484720973,
-      0.34506880849572235669431064606950091485609334583293545091078365484720973,
-     -0.39955418695395297739256313623839757189451165670694625718850750405958123,
-      0.39955418695395297739256313623839757189451165670694625718850750405958123,
-     -0.45266221946184579138314476075331588362047958849937256072537946966493444,
-      0.45266221946184579138314476075331588362047958849937256072537946966493444,
-     -0.50420983165713343703911697288795803339546222770377472583322402874260261,
-      0.50420983165713343703911697288795803339546222770377472583322402874260261,
-     -0.55401932827706788101473499081004928725576083782432159396607149347476846,
-      0.55401932827706788101473499081004928725576083782432159396607149347476846,
-     -0.60191900571376932746429437196462361309295336573174637544393409660689331,
-      0.60191900571376932746429437196462361309295336573174637544393409660689331,
-     -0.64774374391651006875110618993863342181356004483640224168769729790876565,
-      0.64774374391651006875110618993863342181356004483640224168769729790876565,
-     -0.69133557560136672354074882313894456541549537640418395072470914090911235,
-      0.69133557560136672354074882313894456541549537640418395072470914090911235,
-     -0.73254423080751025378213558672175023156563327376066931012816995632769297,
-      0.73254423080751025378213558672175023156563327376066931012816995632769297,
-     -0.77122765492553230786603587562603974126135441361994677164888418774395253,
-      0.77122765492553230786603587562603974126135441361994677164888418774395253,
-     -0.80725249841689547822048563802590721017763256065553022596622460407688419,
-      0.80725249841689547822048563802590721017763256065553022596622460407688419,
-     -0.84049457654580137543012750982994679689996249373509816854952296140589106,
-      0.84049457654580137543012750982994679689996249373509816854952296140589106,
-     -0.87083929755824135160170008688859408982128016798117404109286788786004683,
-      0.87083929755824135160170008688859408982128016798117404109286788786004683,
-     -0.89818205787542662592552002997308119556704573900175068168250397197464531,
-      0.89818205787542662592552002997308119556704573900175068168250397197464531,
-     -0.92242860304281212826781910008251655134994254241231470748404579474721345,
-      0.92242860304281212826781910008251655134994254241231470748404579474721345,
-     -0.94349535346444187902107066769619277568185750014801566477233905185472876,
-      0.94349535346444187902107066769619277568185750014801566477233905185472876,
-     -0.96130969462313633236985819368263974705042267197213800039570635707149809,
-      0.96130969462313633236985819368263974705042267197213800039570635707149809,
-     -0.97581023371498458163298385810636209351279800357391189685087374023462618,
-      0.97581023371498458163298385810636209351279800357391189685087374023462618,
-     -0.98694703502337152172037308131057818841219951017929625780632237985763824,
-      0.98694703502337152172037308131057818841219951017929625780632237985763824,
-     -0.99468191930800707863603589348399390418282659438797516083073443164266075,
-      0.99468191930800707863603589348399390418282659438797516083073443164266075,
-     -0.99898994777632822712105426703219952258730951565173254434831749312725736,
-      0.99898994777632822712105426703219952258730951565173254434831749312725736
-    };
-  }
-
-  else if ( order == 54 ) {
-    legendre_roots = {
-     -0.02881674819934177765623584750022705298945454217790784837149523901296524,
-      0.02881674819934177765623584750022705298945454217790784837149523901296524,
-     -0.08635451826324821528544317776874963636940153748706358794802999224787391,
-      0.08635451826324821528544317776874963636940153748706358794802999224787391,
-     -0.14360542731625615394708976289878916129470501626006774123452526011764351,
-      0.14360542731625615394708976289878916129470501626006774123452526011764351,
-     -0.20037929360621356977860246282929803045414318609155091875356675888445940,
-      0.20037929360621356977860246282929803045414318609155091875356675888445940,
-     -0.25648752006999730007741121445300830272692187309077415248794252317599904,
-      0.25648752006999730007741121445300830272692187309077415248794252317599904,
-     -0.31174372083446822888255039015212377139294849711018201701917317847600692,
-      0.31174372083446822888255039015212377139294849711018201701917317847600692,
-     -0.36596434037219118198433210816548740612203738970364159961656413188625944,
-      0.36596434037219118198433210816548740612203738970364159961656413188625944,
-     -0.41896926325520452803610269746251000520079018342504758273098915755700927,
-      0.41896926325520452803610269746251000520079018342504758273098915755700927,
-     -0.47058241248138228368321213632774260243144663981442004391572802607538496,
-      0.47058241248138228368321213632774260243144663981442004391572802607538496,
-     -0.52063233438593307332701713874976411887936685525087922045304627749936218,
-      0.52063233438593307332701713874976411887936685525087922045304627749936218,
-     -0.56895276819520942973162483417715394277384143717421161867057268595955712,
-      0.56895276819520942973162483417715394277384143717421161867057268595955712,
-     -0.61538319833112737072993782016172830059597269412949862219050964993977254,
-      0.61538319833112737072993782016172830059597269412949862219050964993977254,
-     -0.65976938763198312469228982285622047478895824859497504866744572773815938,
-      0.65976938763198312469228982285622047478895824859497504866744572773815938,
-     -0.70196388971917291938557097696967060126881111048967943907893437817686328,
-      0.70196388971917291938557097696967060126881111048967943907893437817686328,
-     -0.74182653880918431628576626875357800093972914498281560304073802798105868,
-      0.74182653880918431628576626875357800093972914498281560304073802798105868,
-     -0.77922491534625402153594861484053265574888909482905025910836799557327403,
-      0.77922491534625402153594861484053265574888909482905025910836799557327403,
-     -0.81403478591356783546963830407519894482759018323361397549375530880017134,
-      0.81403478591356783546963830407519894482759018323361397549375530880017134,
-     -0.84614051597077294942588751087284250039663238021414165739520134839875799,
-      0.84614051597077294942588751087284250039663238021414165739520134839875799,
-     -0.87543545406556893941790933572261082248654748480701617204036691082027094,
-      0.87543545406556893941790933572261082248654748480701617204036691082027094,
-     -0.90182228628470158075746723138842796436392840478891847428003603651335607,
-      0.90182228628470158075746723138842796436392840478891847428003603651335607,
-     -0.92521335986665148625627606047979138685558419356683424406807100893076970,
-      0.92521335986665148625627606047979138685558419356683424406807100893076970,
-     -0.94553097516499585376383702290618041256343658850098640676221745890213266,
-      0.94553097516499585376383702290618041256343658850098640676221745890213266,
-     -0.96270764578592358325699392690538994353691817470203757036254645475725827,
-      0.96270764578592358325699392690538994353691817470203757036254645475725827,
-     -0.97668632885790323720001007198830685746780597324000341202437202932315781,
-      0.97668632885790323720001007198830685746780597324000341202437202932315781,
-     -0.98742063739734355855214572040354626153403629083923858775114103816713087,
-      0.98742063739734355855214572040354626153403629083923858775114103816713087,
-     -0.99487511701833888491888999594870265948412675888699982861615668185014480,
-      0.99487511701833888491888999594870265948412675888699982861615668185014480,
-     -0.99902666686734098385107110698395849319804278579696033168165021475409064,
-      0.99902666686734098385107110698395849319804278579696033168165021475409064
-    };
-  }
-
-  else if ( order == 55 ) {
-    legendre_roots = {
-      0,
-     -0.05657275381833677632733761089310843416267574245231218366319446792587767,
-      0.05657275381833677632733761089310843416267574245231218366319446792587767,
-     -0.11296428805932926658843792388871218401203889300933300714882753426208209,
-      0.11296428805932926658843792388871218401203889300933300714882753426208209,
-     -0.16899396364687320828284249351170222934589352957387611076497583891531703,
-      0.16899396364687320828284249351170222934589352957387611076497583891531703,
-     -0.22448230064784548340018906240292645440811700470895206033766419252733561,
-      0.22448230064784548340018906240292645440811700470895206033766419252733561,
-     -0.27925155320080653854986245117567102555818594628297263460754544013910250,
-      0.27925155320080653854986245117567102555818594628297263460754544013910250,
-     -0.33312627889002388518947149023296196304739826192271287443619991128011840,
-      0.33312627889002388518947149023296196304739826192271287443619991128011840,
-     -0.38593390074097942975584854391258997545040708651574305567102667221395891,
-      0.38593390074097942975584854391258997545040708651574305567102667221395891,
-     -0.43750526003717459180848102429746658424251628922059254465859417014954993,
-      0.43750526003717459180848102429746658424251628922059254465859417014954993,
-     -0.48767515818747409720826367353935561150755401956934886424625183542085728,
-      0.48767515818747409720826367353935561150755401956934886424625183542085728,
-     -0.53628288590834329672059957284359755353827560883874391501459076023558292,
-      0.53628288590834329672059957284359755353827560883874391501459076023558292,
-     -0.58317273802603210297430481558768648622186113625478567390508218002596038,
-      0.58317273802603210297430481558768648622186113625478567390508218002596038,
-     -0.62819451224992814009063621503297543291101030900675796842423359565602657,
-      0.62819451224992814009063621503297543291101030900675796842423359565602657,
-     -0.67120399031982639579632672800601560057392727743661060691426406577182052,
-      0.67120399031982639579632672800601560057392727743661060691426406577182052,
-     -0.71206339998663783890935019212116751517265372314517351367372163423973441,
-      0.71206339998663783890935019212116751517265372314517351367372163423973441,
-     -0.75064185634802190867498768270731091792206346446225753536923534550514572,
-      0.75064185634802190867498768270731091792206346446225753536923534550514572,
-     -0.78681578112762236589763625093804138350909114627225052948856446958751040,
-      0.78681578112762236589763625093804138350909114627225052948856446958751040,
-     -0.82046929855932091245424128503472236539296748010513060622931702238491168,
-      0.82046929855932091245424128503472236539296748010513060622931702238491168,
-     -0.85149460661715447146024532096700702781646398940273240154448964704937930,
-      0.85149460661715447146024532096700702781646398940273240154448964704937930,
-     -0.87979232241989550606759090682408639529991362162573447659997225300922779,
-      0.87979232241989550606759090682408639529991362162573447659997225300922779,
-     -0.90527180074400002578191142462962439222760858847029059313551795827534993,
-      0.90527180074400002578191142462962439222760858847029059313551795827534993,
-     -0.92785142472079169681627126923258637919449928056960118396670993693793556,
-      0.92785142472079169681627126923258637919449928056960118396670993693793556,
-     -0.94745886804121074185997984764529183717518632629724078716372608551518166,
-      0.94745886804121074185997984764529183717518632629724078716372608551518166,
-     -0.96403132859313519877853663137736922263748967416412665607029527219191934,
-      0.96403132859313519877853663137736922263748967416412665607029527219191934,
-     -0.97751573550398920885921660634073021154213546275556980088769188940036535,
-      0.97751573550398920885921660634073021154213546275556980088769188940036535,
-     -0.98786894119888919852238568447347353064860155505648642992582879630755758,
-      0.98786894119888919852238568447347353064860155505648642992582879630755758,
-     -0.99505797784741187504318911650620237159410074640539224998635006041353798,
-      0.99505797784741187504318911650620237159410074640539224998635006041353798,
-     -0.99906141956481854147943183951938442315554127892942015733240168471097251,
-      0.99906141956481854147943183951938442315554127892942015733240168471097251
-    };
-  }
-
-  else if ( order == 56 ) {
-    legendre_roots = {
-     -0.02779703528727543709406119677492052188837660314677448776124915586667213,
-      0.02779703528727543709406119677492052188837660314677448776124915586667213,
-     -0.08330518682243537444028735544066244818398741418903054589108857420037993,
-      0.08330518682243537444028735544066244818398741418903054589108857420037993,
-     -0.13855584681037624201288658043849059535149050846252855148336845878939329,
-      0.13855584681037624201288658043849059535149050846252855148336845878939329,
-     -0.19337823863527525824018472301268416181616739276380125903615827249640048,
-      0.19337823863527525824018472301268416181616739276380125903615827249640048,
-     -0.24760290943433720397296655497052697287966324314276700609019023227977405,
-      0.24760290943433720397296655497052697287966324314276700609019023227977405,
-     -0.30106225386722066905309423312523434392507184612438347069683556609248244,
-      0.30106225386722066905309423312523434392507184612438347069683556609248244,
-     -0.35359103217495452096970732703323240563467879438117197646841981557826470,
-      0.35359103217495452096970732703323240563467879438117197646841981557826470,
-     -0.40502688092709127811886696260292289465537138236829072574300605309236042,
-      0.40502688092709127811886696260292289465537138236829072574300605309236042,
-     -0.45521081487845957894883158132460955990722690550390787980196315701691882,
-      0.45521081487845957894883158132460955990722690550390787980196315701691882,
-     -0.50398771838438171419522440121863813770930594935401750244127567401152313,
-      0.50398771838438171419522440121863813770930594935401750244127567401152313,
-     -0.55120682485553461875436351457631660252566257835249024338823238969463470,
-      0.55120682485553461875436351457631660252566257835249024338823238969463470,
-     -0.59672218277066332010413521713840838322050086924194436473325885312971493,
-      0.59672218277066332010413521713840838322050086924194436473325885312971493,
-     -0.64039310680700689426793859606281307892380657294780583081699708702652977,
-      0.64039310680700689426793859606281307892380657294780583081699708702652977,
-     -0.68208461269447045550156147796983633310510936746121019421272085639246341,
-      0.68208461269447045550156147796983633310510936746121019421272085639246341,
-     -0.72166783445018808352259378704755345734404851928573825435554528203894892,
-      0.72166783445018808352259378704755345734404851928573825435554528203894892,
-     -0.75902042270512890220241329444589386736483724927364946933028416658675582,
-      0.75902042270512890220241329444589386736483724927364946933028416658675582,
-     -0.79402692289386649803000830848600047765720330168324204548776927855885186,
-      0.79402692289386649803000830848600047765720330168324204548776927855885186,
-     -0.82657913214288165167212697445685032334304217596386008639720720486182035,
-      0.82657913214288165167212697445685032334304217596386008639720720486182035,
-     -0.85657643376274863540299138676687060407367417470986428066235169682116728,
-      0.85657643376274863540299138676687060407367417470986428066235169682116728,
-     -0.88392610832782754078901228580928672750598141023208925190752050655414911,
-      0.88392610832782754078901228580928672750598141023208925190752050655414911,
-     -0.90854362042065549084610728995724177953221106880958691573184614768242304,
-      0.90854362042065549084610728995724177953221106880958691573184614768242304,
-     -0.93035288024749630054727272329160085302681430599689502674060169763402285,
-      0.93035288024749630054727272329160085302681430599689502674060169763402285,
-     -0.94928647956196263564673760279492806688956352258814452214687015427613606,
-      0.94928647956196263564673760279492806688956352258814452214687015427613606,
-     -0.96528590190549018362619497605509569821755121865766342811133265254243872,
-      0.96528590190549018362619497605509569821755121865766342811133265254243872,
-     -0.97830170914025638337699055153818813122701389775022842384047636964219364,
-      0.97830170914025638337699055153818813122701389775022842384047636964219364,
-     -0.98829371554016151108992516352348621676454114322461616495743099123436593,
-      0.98829371554016151108992516352348621676454114322461616495743099123436593,
-     -0.99523122608106974721630876009894094554853845523399037453385423272546717,
-      0.99523122608106974721630876009894094554853845523399037453385423272546717,
-     -0.99909434380146558435315382509090426217601897845975636977215725847455595,
-      0.99909434380146558435315382509090426217601897845975636977215725847455595
-    };
-  }
-
-  else if ( order == 57 ) {
-    legendre_roots = {
-      0,
-     -0.05460715100164682421983055973733244541044233435972078077180998462866740,
-      0.05460715100164682421983055973733244541044233435972078077180998462866740,
-     -0.10905133280878780097852652131097904945504513750167102688908488517270809,
-      0.10905133280878780097852652131097904945504513750167102688908488517270809,
-     -0.16317006259126425104328037832151206218590998930310571377923693379584590,
-      0.16317006259126425104328037832151206218590998930310571377923693379584590,
-     -0.21680182879612403641361397597955927425658329550447243835011318059739956,
-      0.21680182879612403641361397597955927425658329550447243835011318059739956,
-     -0.26978657316183876576334560979964334429905799435147475947102787460152630,
-      0.26978657316183876576334560979964334429905799435147475947102787460152630,
-     -0.32196616839537864059020791580539723937273946766280631593531453363650807,
-      0.32196616839537864059020791580539723937273946766280631593531453363650807,
-     -0.37318489008659445855213439614488901055646014609263353376625040015836868,
-      0.37318489008659445855213439614488901055646014609263353376625040015836868,
-     -0.42328988145156395096002435347152437901405095213458828985146966650271359,
-      0.42328988145156395096002435347152437901405095213458828985146966650271359,
-     -0.47213160951797570958806008204923474982223792569932668549061903620346910,
-      0.47213160951797570958806008204923474982223792569932668549061903620346910,
-     -0.51956431139118760631515381980621435108063110826951180647850185382151574,
-      0.51956431139118760631515381980621435108063110826951180647850185382151574,
-     -0.56544642926923675901898555280524042937002207422157972944323832995387957,
-      0.56544642926923675901898555280524042937002207422157972944323832995387957,
-     -0.60964103290871536542384890192474062432400057292396461352572253954300682,
-      0.60964103290871536542384890192474062432400057292396461352572253954300682,
-     -0.65201622828097689124936184079570828367066055697215481037719761090427934,
-      0.65201622828097689124936184079570828367066055697215481037719761090427934,
-     -0.69244555119951773904048368844401044565667663461414289000398318361175230,
-      0.69244555119951773904048368844401044565667663461414289000398318361175230,
-     -0.73080834474452332282734467073677831626312211950961220324761585831727488,
-      0.73080834474452332282734467073677831626312211950961220324761585831727488,
-     -0.76699011935945019549171614401813235523664841582239824251664784090273808,
-      0.76699011935945019549171614401813235523664841582239824251664784090273808,
-     -0.80088289454721824207600871879494856770180362015542160244357413526631894,
-      0.80088289454721824207600871879494856770180362015542160244357413526631894,
-     -0.83238552115043912082901089586520321825226565009663945477343547944357900,
-      0.83238552115043912082901089586520321825226565009663945477343547944357900,
-     -0.86140398326204694472224188180521475422193300561323961829160148517285788,
-      0.86140398326204694472224188180521475422193300561323961829160148517285788,
-     -0.88785167888222132951300014764186171613427578726703528227609120649091695,
-      0.88785167888222132951300014764186171613427578726703528227609120649091695,
-     -0.91164967852139121272843056161967031091824841039741330229704711198015509,
-      0.91164967852139121272843056161967031091824841039741330229704711198015509,
-     -0.93272696106710169610075415429735663806748863511663484923738465908695793,
-      0.93272696106710169610075415429735663806748863511663484923738465908695793,
-     -0.95102062644787674191190411060519032863779933966269042809816168512956238,
-      0.95102062644787674191190411060519032863779933966269042809816168512956238,
-     -0.96647608517188667911485858394233318896849009450238562033620253627617610,
-      0.96647608517188667911485858394233318896849009450238562033620253627617610,
-     -0.97904722670946871379882087536650775736093122376778068469678718910130078,
-      0.97904722670946871379882087536650775736093122376778068469678718910130078,
-     -0.98869657765022204884975839838385543851008408669894400588603165816685088,
-      0.98869657765022204884975839838385543851008408669894400588603165816685088,
-     -0.99539552367843031113512502736241900597506886891341396400349175650223998,
-      0.99539552367843031113512502736241900597506886891341396400349175650223998,
-     -0.99912556562526285057200984955424988499912758600701357536605252428746353,
-      0.99912556562526285057200984955424988499912758600701357536605252428746353
-    };
-  }
+  if( order < 1 || order > quad::max_order )
+    return quad::Span{ nullptr, 0 };
+  return quad::Span{ table + order * ( order - 1 ) / 2,
+    static_cast<std::size_t>( order ) };
+}
 
-  else if ( order == 58 ) {
-    legendre_roots = {
-     -0.02684701236594235580333868951737998584342117663189360997782882456435164,
-      0.02684701236594235580333868951737998584342117663189360997782882456435164,
-     -0.08046363021414272930984779238050319488933489683186480992118177513695097,
-      0.08046363021414272930984779238050319488933489683186480992118177513695097,
-     -0.13384825059546685702237684787454091195295752427056041957107994476021781,
-      0.13384825059546685702237684787454091195295752427056041957107994476021781,
-     -0.18684695183576132137438388146402240606154788844121703472114989815194892,
-      0.18684695183576132137438388146402240606154788844121703472114989815194892,
-     -0.23930692496615345442894850908533478770052882803533030660399510215707305,
-      0.23930692496615345442894850908533478770052882803533030660399510215707305,
-     -0.29107691431110918953302526831430330218951710085754934768899662153167309,
-      0.29107691431110918953302526831430330218951710085754934768899662153167309,
-     -0.34200765359799526124836826748399695087767282162928728905069200868387540,
-      0.34200765359799526124836826748399695087767282162928728905069200868387540,
-     -0.39195229633075315037121694121301070218501762442300421544387505889820922,
-      0.39195229633075315037121694121301070218501762442300421544387505889820922,
-     -0.44076683918683956519370306221430441412241480190817639721346641741605662,
-      0.44076683918683956519370306221430441412241480190817639721346641741605662,
-     -0.48831053721671846361555257273678542089422872080245127934358141448101952,
-      0.48831053721671846361555257273678542089422872080245127934358141448101952,
-     -0.53444630964884758639980241742520435578876328735633708412088364355761369,
-      0.53444630964884758639980241742520435578876328735633708412088364355761369,
-     -0.57904113513022503048997711713608340382017681668396034116565748121599479,
-      0.57904113513022503048997711713608340382017681668396034116565748121599479,
-     -0.62196643526307911103398405874549112023223525384925508500485779709311754,
-      0.62196643526307911103398405874549112023223525384925508500485779709311754,
-     -0.66309844533212526643301629975356569196064362430412199148686545633124825,
-      0.66309844533212526643301629975356569196064362430412199148686545633124825,
-     -0.70231857115390811347975730145820138366068581664760688899940040644718389,
-      0.70231857115390811347975730145820138366068581664760688899940040644718389,
-     -0.73951373102004226784661723485103279097065744804820352989813696350038390,
-      0.73951373102004226784661723485103279097065744804820352989813696350038390,
-     -0.77457668174965274526614004649682666564897000062728078698321702127962560,
-      0.77457668174965274526614004649682666564897000062728078698321702127962560,
-     -0.80740632791308814104899715220739522798328342401013054235580824950741979,
-      0.80740632791308814104899715220739522798328342401013054235580824950741979,
-     -0.83790801333937331635209792062162436128686730569794239385414661600017801,
-      0.83790801333937331635209792062162436128686730569794239385414661600017801,
-     -0.86599379407480747927507123251208765769427414860556106290842012027624977,
-      0.86599379407480747927507123251208765769427414860556106290842012027624977,
-     -0.89158269202203017639988282081279754648255184994103064947349764349574843,
-      0.89158269202203017639988282081279754648255184994103064947349764349574843,
-     -0.91460092856435254068650564989752182049561509542540611471705610821976712,
-      0.91460092856435254068650564989752182049561509542540611471705610821976712,
-     -0.93498213758825934848084323476624749540914742274456394350805107772760688,
-      0.93498213758825934848084323476624749540914742274456394350805107772760688,
-     -0.95266755751886909144284551002293033370558762897549122618990301189094356,
-      0.95266755751886909144284551002293033370558762897549122618990301189094356,
-     -0.96760620250292409015330078462120619491287277499442596029127840212506408,
-      0.96760620250292409015330078462120619491287277499442596029127840212506408,
-     -0.97975501469435030910781633439259803486987594569128913875488397517376694,
-      0.97975501469435030910781633439259803486987594569128913875488397517376694,
-     -0.98907900824844263649991025527544205688320536550132150533901249264013417,
-      0.98907900824844263649991025527544205688320536550132150533901249264013417,
-     -0.99555147659729090260277152617994614127696728024297488086595191404168555,
-      0.99555147659729090260277152617994614127696728024297488086595191404168555,
-     -0.99915520040738660644273704418460576104581358587271563071181861120815186,
-      0.99915520040738660644273704418460576104581358587271563071181861120815186
-    };
-  }
+} // namespace;
 
-  else if ( order == 59 ) {
-    legendre_roots = {
-      0,
-     -0.05277348408831000395168032860333853782470076950917810531402242600484623,
-      0.05277348408831000395168032860333853782470076950917810531402242600484623,
-     -0.10539987901634414383691438776186928705392541093682229170346197180707444,
-      0.10539987901634414383691438776186928705392541093682229170346197180707444,
-     -0.15773250558785796811521785627155430412417462420270318836895230218733952,
-      0.15773250558785796811521785627155430412417462420270318836895230218733952,
-     -0.20962550339203654492336679063149109633205047431449317463114303915943527,
-      0.20962550339203654492336679063149109633205047431449317463114303915943527,
-     -0.26093423734281171161061626741427838000354448343313036164401445506841760,
-      0.26093423734281171161061626741427838000354448343313036164401445506841760,
-     -0.31151570080301370031836014910574975012565923760298034192656503395147593,
-      0.31151570080301370031836014910574975012565923760298034192656503395147593,
-     -0.36122891416979480999231245233404895795341396017483940421597055235592427,
-      0.36122891416979480999231245233404895795341396017483940421597055235592427,
-     -0.40993531781041896672282369375587912101472146267823341721410421591667653,
-      0.40993531781041896672282369375587912101472146267823341721410421591667653,
-     -0.45749915825326669022621526043496150817642577591233421790258669715484443,
-      0.45749915825326669022621526043496150817642577591233421790258669715484443,
-     -0.50378786655771797876808728045730889215098064889787585886397892397269686,
-      0.50378786655771797876808728045730889215098064889787585886397892397269686,
-     -0.54867242780839638437225630038700585744067331832400930164463123410650424,
-      0.54867242780839638437225630038700585744067331832400930164463123410650424,
-     -0.59202774070403014446417615975653433980424816968069367591655332988010578,
-      0.59202774070403014446417615975653433980424816968069367591655332988010578,
-     -0.63373296623885009751258093017500791255189837643896226290002703802918060,
-      0.63373296623885009751258093017500791255189837643896226290002703802918060,
-     -0.67367186450493722702402721275525368441506427511554588645758193136912576,
-      0.67367186450493722702402721275525368441506427511554588645758193136912576,
-     -0.71173311867719773159591572196590935391076245280231223404591653671354685,
-      0.71173311867719773159591572196590935391076245280231223404591653671354685,
-     -0.74781064527864023188925757901321238792089493398551449101294474531843849,
-      0.74781064527864023188925757901321238792089493398551449101294474531843849,
-     -0.78180388986236090563267881276748262802966695695039443066991025823597405,
-      0.78180388986236090563267881276748262802966695695039443066991025823597405,
-     -0.81361810728821157143508977382120044741070406508964745370342391678308701,
-      0.81361810728821157143508977382120044741070406508964745370342391678308701,
-     -0.84316462581687220147035095397223663847022596081723219257729891523807161,
-      0.84316462581687220147035095397223663847022596081723219257729891523807161,
-     -0.87036109429288226096342623310414520128418694739618765771511710420070657,
-      0.87036109429288226096342623310414520128418694739618765771511710420070657,
-     -0.89513171174347208536429682946245927502953713940999927656753936042698828,
-      0.89513171174347208536429682946245927502953713940999927656753936042698828,
-     -0.91740743878815528135254148521524582687314349000380399347839368114293972,
-      0.91740743878815528135254148521524582687314349000380399347839368114293972,
-     -0.93712619035345385940513847104328988491060212647114705992669222427885221,
-      0.93712619035345385940513847104328988491060212647114705992669222427885221,
-     -0.95423300937695105586323311218564993707390813827454712563123155665016366,
-      0.95423300937695105586323311218564993707390813827454712563123155665016366,
-     -0.96868022168178153135363333967256205766488944332981848563431229183027392,
-      0.96868022168178153135363333967256205766488944332981848563431229183027392,
-     -0.98042757395671568844960798140326777546255785113970301059584553273597224,
-      0.98042757395671568844960798140326777546255785113970301059584553273597224,
-     -0.98944236513373093178218393502270579347325528002329934256944009136321882,
-      0.98944236513373093178218393502270579347325528002329934256944009136321882,
-     -0.99569964038324596468720182343344830766185577690859122700798419998589485,
-      0.99569964038324596468720182343344830766185577690859122700798419998589485,
-     -0.99918335390929468375642401950467818497422597033002270855107230127165519,
-      0.99918335390929468375642401950467818497422597033002270855107230127165519
-    };
-  }
+/* -------------------------------------------------------------------------- */
 
-  else if ( order == 60 ) {
-    legendre_roots = {
-     -0.02595977230124779858917038540034482566031476071727522549261664083083447,
-      0.02595977230124779858917038540034482566031476071727522549261664083083447,
-     -0.07780933394953656941928550708222528757759478289772395501421876123249594,
-      0.07780933394953656941928550708222528757759478289772395501421876123249594,
-     -0.12944913539694500314644416464957577475987352436647214341541575913812178,
-      0.12944913539694500314644416464957577475987352436647214341541575913812178,
-     -0.18073996487342541724087694126185263123177216863904549273045410396132498,
-      0.18073996487342541724087694126185263123177216863904549273045410396132498,
-     -0.23154355137602933801034463134675544074353905193958573194603141402493913,
-      0.23154355137602933801034463134675544074353905193958573194603141402493913,
-     -0.28172293742326169169069486033944159830826306079537742435534234691911549,
-      0.28172293742326169169069486033944159830826306079537742435534234691911549,
-     -0.33114284826844819425235296535055270480012149637631120289541190496669949,
-      0.33114284826844819425235296535055270480012149637631120289541190496669949,
-     -0.37967005657679797715495267052188770405637443316238986606386316304310027,
-      0.37967005657679797715495267052188770405637443316238986606386316304310027,
-     -0.42717374158307838930745285353031192335344213618423209020824420553405994,
-      0.42717374158307838930745285353031192335344213618423209020824420553405994,
-     -0.47352584176170711110816305375279463800786800509983688974970579944608986,
-      0.47352584176170711110816305375279463800786800509983688974970579944608986,
-     -0.51860140005856974741788934848472130132984667628868557269080527683149102,
-      0.51860140005856974741788934848472130132984667628868557269080527683149102,
-     -0.56227890075394453917827258748599872906318823765939539959758707905681163,
-      0.56227890075394453917827258748599872906318823765939539959758707905681163,
-     -0.60444059704851036344420877631120172065042105359105983804959276292861023,
-      0.60444059704851036344420877631120172065042105359105983804959276292861023,
-     -0.64497282848947706781344789642044471716519001934666099624465517485878927,
-      0.64497282848947706781344789642044471716519001934666099624465517485878927,
-     -0.68376632738135543722293023922429715908759460433887497987905815214823772,
-      0.68376632738135543722293023922429715908759460433887497987905815214823772,
-     -0.72071651335573039943602106101352107776477399473323904319016138834459438,
-      0.72071651335573039943602106101352107776477399473323904319016138834459438,
-     -0.75572377530658568686884206660237310592890019956470772482289378263724741,
-      0.75572377530658568686884206660237310592890019956470772482289378263724741,
-     -0.78869373993226405456994479977721573524633292787922761963527585617280421,
-      0.78869373993226405456994479977721573524633292787922761963527585617280421,
-     -0.81953752616214575936851810851972357189949051896959250957509466821226937,
-      0.81953752616214575936851810851972357189949051896959250957509466821226937,
-     -0.84817198478592963249051549499437560129752871650677819695098879074915256,
-      0.84817198478592963249051549499437560129752871650677819695098879074915256,
-     -0.87451992264689831512930809991243580515918229443578207585720422776504067,
-      0.87451992264689831512930809991243580515918229443578207585720422776504067,
-     -0.89851031081004594193778932957262833016445844274707382454373400447195217,
-      0.89851031081004594193778932957262833016445844274707382454373400447195217,
-     -0.92007847617762755285665686251989682878376887601370603992322936497236376,
-      0.92007847617762755285665686251989682878376887601370603992322936497236376,
-     -0.93916627611642324949541901160970509641940342040119803154831649371477749,
-      0.93916627611642324949541901160970509641940342040119803154831649371477749,
-     -0.95572225583999610739723184582969950248009374476661421963609490605769058,
-      0.95572225583999610739723184582969950248009374476661421963609490605769058,
-     -0.96970178876505273372154409891379427254093434486824707208632751667730305,
-      0.96970178876505273372154409891379427254093434486824707208632751667730305,
-     -0.98106720175259818561857679982677003388053857922189174349637328911307522,
-      0.98106720175259818561857679982677003388053857922189174349637328911307522,
-     -0.98978789522222171736727898701609604257739315378693904081957256319454428,
-      0.98978789522222171736727898701609604257739315378693904081957256319454428,
-     -0.99584052511883817387674671337744065277489029497713910190748324131308084,
-      0.99584052511883817387674671337744065277489029497713910190748324131308084,
-     -0.99921012322743602203422958579764926639879897871132567069202288908270495,
-      0.99921012322743602203422958579764926639879897871132567069202288908270495
-    };
-  }
+/* Given the order of integration, return a view of the Gauss point locations
+ * in the static table. */
+quad::Span quad::gauss_pts( int order )
+{
+  return table_rule( point_table, order );
+}
 
-  else if ( order == 61 ) {
-    legendre_roots = {
-      0,
-     -0.05105890670797434936688750061890079807018425404125653846839174151781703,
-      0.05105890670797434936688750061890079807018425404125653846839174151781703,
-     -0.10198460656227406895720840476436564197678981705575171044068979586391127,
-      0.10198460656227406895720840476436564197678981705575171044068979586391127,
-     -0.15264424023081530052950676177347741688353897661745930142311807731896352,
-      0.15264424023081530052950676177347741688353897661745930142311807731896352,
-     -0.20290564251805849922694720334305705450143905185836343340962549950047507,
-      0.20290564251805849922694720334305705450143905185836343340962549950047507,
-     -0.25263768716905349583369086333440510622751074756005922208492381818600550,
-      0.25263768716905349583369086333440510622751074756005922208492381818600550,
-     -0.30171062896303071260448652545697712524119763287003732754562632071771687,
-      0.30171062896303071260448652545697712524119763287003732754562632071771687,
-     -0.34999644220406683453343447706209384978750461740488398299245484657712093,
-      0.34999644220406683453343447706209384978750461740488398299245484657712093,
-     -0.39736915472575660917829184736858922181287289269372192014992301061781050,
-      0.39736915472575660917829184736858922181287289269372192014992301061781050,
-     -0.44370517653853160199558930106582255938232463747223832403155674644506182,
-      0.44370517653853160199558930106582255938232463747223832403155674644506182,
-     -0.48888362226225211882069851142582959751653092472499616825177085297872762,
-      0.48888362226225211882069851142582959751653092472499616825177085297872762,
-     -0.53278662650292526563848171637307164032481991094547415386276764631664982,
-      0.53278662650292526563848171637307164032481991094547415386276764631664982,
-     -0.57529965135083061860036998194497287899733192533772913458968916781141362,
-      0.57529965135083061860036998194497287899733192533772913458968916781141362,
-     -0.61631178519792172470961685932859103589567168396123272499725192869020808,
-      0.61631178519792172470961685932859103589567168396123272499725192869020808,
-     -0.65571603209507087169918577783630688700084734644168225850664155308566058,
-      0.65571603209507087169918577783630688700084734644168225850664155308566058,
-     -0.69340959089449115549918436396023173728437756854618545989961199759752808,
-      0.69340959089449115549918436396023173728437756854618545989961199759752808,
-     -0.72929412344946510968895669013553179857637101453817734882212278490922616,
-      0.72929412344946510968895669013553179857637101453817734882212278490922616,
-     -0.76327601117231219714591466849435037104451915109862147348582296876826055,
-      0.76327601117231219714591466849435037104451915109862147348582296876826055,
-     -0.79526659928235964915204880275254626487323687020583117925272640717605629,
-      0.79526659928235964915204880275254626487323687020583117925272640717605629,
-     -0.82518242810865995066428189245084752700639465995958312633826529643126808,
-      0.82518242810865995066428189245084752700639465995958312633826529643126808,
-     -0.85294545084766344556484690467417053833995325998446013231578818563572590,
-      0.85294545084766344556484690467417053833995325998446013231578818563572590,
-     -0.87848323721488103247894751389335263145955452028041794615608376469759371,
-      0.87848323721488103247894751389335263145955452028041794615608376469759371,
-     -0.90172916247400117064204004268351116465311752108726357703149621423389954,
-      0.90172916247400117064204004268351116465311752108726357703149621423389954,
-     -0.92262258138295526125755150055584544545063516129871751244050735688221085,
-      0.92262258138295526125755150055584544545063516129871751244050735688221085,
-     -0.94110898668136114747754386097778900828047471105845942211915981527564994,
-      0.94110898668136114747754386097778900828047471105845942211915981527564994,
-     -0.95714015191298409137208028742121526110444034092702351027681629194699741,
-      0.95714015191298409137208028742121526110444034092702351027681629194699741,
-     -0.97067425883318290824740845354791027256833637675753031967845577977875939,
-      0.97067425883318290824740845354791027256833637675753031967845577977875939,
-     -0.98167601128403707968517254075131942216007406209492654557703609344387199,
-      0.98167601128403707968517254075131942216007406209492654557703609344387199,
-     -0.99011674523251705096553168569991650162875678117649731349622432737914590,
-      0.99011674523251705096553168569991650162875678117649731349622432737914590,
-     -0.99597459981512023426801276071228827628684886478913172543562886755521645,
-      0.99597459981512023426801276071228827628684886478913172543562886755521645,
-     -0.99923559763136347173186225956913086285344204850300083138763718025741131,
-      0.99923559763136347173186225956913086285344204850300083138763718025741131
-    };
-  }
+/* -------------------------------------------------------------------------- */
 
-  else if ( order == 62 ) {
-    legendre_roots = {
-     -0.02512929142182061472708827599914696231450491802481494897912027110322304,
-      0.02512929142182061472708827599914696231450491802481494897912027110322304,
-     -0.07532439549623433276382693911787087757684581231442079983724598775989517,
-      0.07532439549623433276382693911787087757684581231442079983724598775989517,
-     -0.12532922361589680861964899949972625779675540078947580463455089046824509,
-      0.12532922361589680861964899949972625779675540078947580463455089046824509,
-     -0.17501745924901562855568742390423603170050770944644703966654343695794503,
-      0.17501745924901562855568742390423603170050770944644703966654343695794503,
-     -0.22426358560416553166899139334488270060896525671749469265480555772714357,
-      0.22426358560416553166899139334488270060896525671749469265480555772714357,
-     -0.27294320269672634318868362797348098085486162034350993616834598677716929,
-      0.27294320269672634318868362797348098085486162034350993616834598677716929,
-     -0.32093334159419400407410160100345638508585870215936296478986948250902417,
-      0.32093334159419400407410160100345638508585870215936296478986948250902417,
-     -0.36811277504656452966302183095250792201723545553516474466075939693795924,
-      0.36811277504656452966302183095250792201723545553516474466075939693795924,
-     -0.41436232371712604812958875065761134513588929957184224763670322460173238,
-      0.41436232371712604812958875065761134513588929957184224763670322460173238,
-     -0.45956515724011339520714397807575265141860208701364659752653127841452745,
-      0.45956515724011339520714397807575265141860208701364659752653127841452745,
-     -0.50360708934475595591702080593161627696584196729605374421070685941997099,
-      0.50360708934475595591702080593161627696584196729605374421070685941997099,
-     -0.54637686630025109581610038452363370723217109157838567542878762097026738,
-      0.54637686630025109581610038452363370723217109157838567542878762097026738,
-     -0.58776644795308733800214955012198776385819749684764301758987435967807676,
-      0.58776644795308733800214955012198776385819749684764301758987435967807676,
-     -0.62767128064688518072695476491616278858720843830369250261820679540297983,
-      0.62767128064688518072695476491616278858720843830369250261820679540297983,
-     -0.66599056133547944699754603408238807993320858447569586843446674967342574,
-      0.66599056133547944699754603408238807993320858447569586843446674967342574,
-     -0.70262749222229705512097276505998672314403128528957965494480596351982702,
-      0.70262749222229705512097276505998672314403128528957965494480596351982702,
-     -0.73748952528315674986078427650143946028010343563118008573513418261088288,
-      0.73748952528315674986078427650143946028010343563118008573513418261088288,
-     -0.77048859605541931899094469499504818845380926550542398615054446579200069,
-      0.77048859605541931899094469499504818845380926550542398615054446579200069,
-     -0.80154134610397637153850551449538634730618948310785039391755648750537440,
-      0.80154134610397637153850551449538634730618948310785039391755648750537440,
-     -0.83056933360400485134593110947720822291981123949520651563299132731949770,
-      0.83056933360400485134593110947720822291981123949520651563299132731949770,
-     -0.85749923151207092281840332054467550689150893751162174641809427706595302,
-      0.85749923151207092281840332054467550689150893751162174641809427706595302,
-     -0.88226301283189736307268662435582975601712579191938623991913074558369480,
-      0.88226301283189736307268662435582975601712579191938623991913074558369480,
-     -0.90479812252109346575848560242837562439844989261032305174824658538600693,
-      0.90479812252109346575848560242837562439844989261032305174824658538600693,
-     -0.92504763563620375522730013075704861944863052404265812459719856088185091,
-      0.92504763563620375522730013075704861944863052404265812459719856088185091,
-     -0.94296040139232850382636481162335158724141815874021217488810983961296196,
-      0.94296040139232850382636481162335158724141815874021217488810983961296196,
-     -0.95849117297392709202956047516597094331710664778284721115812577475703514,
-      0.95849117297392709202956047516597094331710664778284721115812577475703514,
-     -0.97160072337165180644717948254030583515416055392926467745800193891593339,
-      0.97160072337165180644717948254030583515416055392926467745800193891593339,
-     -0.98225594909723664949110312800979247156300120305395084501598221709033339,
-      0.98225594909723664949110312800979247156300120305395084501598221709033339,
-     -0.99042997118929035242807106186068064500231531367714058003215861671366151,
-      0.99042997118929035242807106186068064500231531367714058003215861671366151,
-     -0.99610229631626713288514843047617149263214021727984195773426915709055681,
-      0.99610229631626713288514843047617149263214021727984195773426915709055681,
-     -0.99925985930877702969840846503579893801963446051022185306139551423418719,
-      0.99925985930877702969840846503579893801963446051022185306139551423418719
-    };
-  }
+/* Given the order of integration, return a view of the Gauss weights in the
+ * static table. */
+quad::Span quad::gauss_wts( int order )
+{
+  return table_rule( weight_table, order );
+}
 
-  else if ( order == 63 ) {
-    legendre_roots = {
-      0,
-     -0.04945218711615962723423381805180760989775545689991594606316301200337425,
-      0.04945218711615962723423381805180760989775545689991594606316301200337425,
-     -0.09878335644694527952970366945392210343955860117894321729223309883236469,
-      0.09878335644694527952970366945392210343955860117894321729223309883236469,
-     -0.14787278635787196856983909655297294344146366408396302911734900665663934,
-      0.14787278635787196856983909655297294344146366408396302911734900665663934,
-     -0.19660034679150668455762745706571769792078300580349275988855047201860717,
-      0.19660034679150668455762745706571769792078300580349275988855047201860717,
-     -0.24484679324595336274840459392482937014834217535821483279903376694643348,
-      0.24484679324595336274840459392482937014834217535821483279903376694643348,
-     -0.29249405858625144003615715555066692368934587193884236970604552487129801,
-      0.29249405858625144003615715555066692368934587193884236970604552487129801,
-     -0.33942554197458440246883443159431508504391804671870448527148420145391405,
-      0.33942554197458440246883443159431508504391804671870448527148420145391405,
-     -0.38552639421224789247761502227439815027504570543713342740705917954278406,
-      0.38552639421224789247761502227439815027504570543713342740705917954278406,
-     -0.43068379879511160066208893391862998206648141720003732528477945292317312,
-      0.43068379879511160066208893391862998206648141720003732528477945292317312,
-     -0.47478724799480439992221230985149474928601795896973316966711836225115911,
-      0.47478724799480439992221230985149474928601795896973316966711836225115911,
-     -0.51772881329003324812447758452631553557737395502174835046316174601568355,
-      0.51772881329003324812447758452631553557737395502174835046316174601568355,
-     -0.55940340948628501326769780007005469654052841560665752733698746575880395,
-      0.55940340948628501326769780007005469654052841560665752733698746575880395,
-     -0.59970905187762523573900892686879986107116952399752914562710897100462168,
-      0.59970905187762523573900892686879986107116952399752914562710897100462168,
-     -0.63854710582136538500030695387337648123329492461318163956158286516017699,
-      0.63854710582136538500030695387337648123329492461318163956158286516017699,
-     -0.67582252811498609013110331596954450877981125472379970647423639886614819,
-      0.67582252811498609013110331596954450877981125472379970647423639886614819,
-     -0.71144409958484580785143153770401487912828251178701249195340107778139063,
-      0.71144409958484580785143153770401487912828251178701249195340107778139063,
-     -0.74532464831784741782932166103758763231460294726194072573502963183661618,
-      0.74532464831784741782932166103758763231460294726194072573502963183661618,
-     -0.77738126299037233556333018991104275575979914204810200254119695026049538,
-      0.77738126299037233556333018991104275575979914204810200254119695026049538,
-     -0.80753549577345676005146598636324313459419236077749630005732100696017067,
-      0.80753549577345676005146598636324313459419236077749630005732100696017067,
-     -0.83571355431950284347180776961570545282361447758388598140006592985930021,
-      0.83571355431950284347180776961570545282361447758388598140006592985930021,
-     -0.86184648236412371953961183943105995399653622521626831383589266763794010,
-      0.86184648236412371953961183943105995399653622521626831383589266763794010,
-     -0.88587032850785342629029845731336987514986846948785371656042312456841470,
-      0.88587032850785342629029845731336987514986846948785371656042312456841470,
-     -0.90772630277853155803695313291595322554779392827565820821769425337851092,
-      0.90772630277853155803695313291595322554779392827565820821769425337851092,
-     -0.92736092062184320544703138132512156945605436106860191751711002600831308,
-      0.92736092062184320544703138132512156945605436106860191751711002600831308,
-     -0.94472613404100980296637531962750066374458068895776698179936366138705419,
-      0.94472613404100980296637531962750066374458068895776698179936366138705419,
-     -0.95977944975894192707035416625898896916541650316165542691431002097238381,
-      0.95977944975894192707035416625898896916541650316165542691431002097238381,
-     -0.97248403469757002280196067857681094816497654120309783825229426366042670,
-      0.97248403469757002280196067857681094816497654120309783825229426366042670,
-     -0.98280881059372723486251140569161173920259916195620734199530573384062428,
-      0.98280881059372723486251140569161173920259916195620734199530573384062428,
-     -0.99072854689218946681089466720470345305426226535032777976683156639717251,
-      0.99072854689218946681089466720470345305426226535032777976683156639717251,
-     -0.99622401277797010860219336114631135329307697185752329787632166639161707,
-      0.99622401277797010860219336114631135329307697185752329787632166639161707,
-     -0.99928298402912378037893614092894446107279671818624281315175615271126840,
-      0.99928298402912378037893614092894446107279671818624281315175615271126840
-    };
-  }
+/* -------------------------------------------------------------------------- */
 
-  else if ( order == 64 ) {
-    legendre_roots = {
-     -0.02435029266342443250895584285371566142688710931497580916345316639605670,
-      0.02435029266342443250895584285371566142688710931497580916345316639605670,
-     -0.07299312178779903944954294194033749324412618166877885335631633233773952,
-      0.07299312178779903944954294194033749324412618166877885335631633233773952,
-     -0.12146281929612055447037646349224787821868363833719129404234958260069318,
-      0.12146281929612055447037646349224787821868363833719129404234958260069318,
-     -0.16964442042399281803731362974826984419999026673437785058941787468843424,
-      0.16964442042399281803731362974826984419999026673437785058941787468843424,
-     -0.21742364374000708414964874898882261757848583114122234863038040188568963,
-      0.21742364374000708414964874898882261757848583114122234863038040188568963,
-     -0.26468716220876741637396417251002011798041313629509324395598954481262064,
-      0.26468716220876741637396417251002011798041313629509324395598954481262064,
-     -0.31132287199021095615751269856015688355771535786805012699545717098581691,
-      0.31132287199021095615751269856015688355771535786805012699545717098581691,
-     -0.35722015833766811595044261504620253162626446464090911202123701934009918,
-      0.35722015833766811595044261504620253162626446464090911202123701934009918,
-     -0.40227015796399160369576677126015884871326520561502080827604318431290872,
-      0.40227015796399160369576677126015884871326520561502080827604318431290872,
-     -0.44636601725346408798494771475891518920675075782625017630826068202129376,
-      0.44636601725346408798494771475891518920675075782625017630826068202129376,
-     -0.48940314570705295747852630702192139084937329746373983733165407932403156,
-      0.48940314570705295747852630702192139084937329746373983733165407932403156,
-     -0.53127946401989454565801390354445524740852558873418023805326804716604178,
-      0.53127946401989454565801390354445524740852558873418023805326804716604178,
-     -0.57189564620263403428387811665918864318319100609125099322732847194189122,
-      0.57189564620263403428387811665918864318319100609125099322732847194189122,
-     -0.61115535517239325024885297101854891869612455930797184433679766669330884,
-      0.61115535517239325024885297101854891869612455930797184433679766669330884,
-     -0.64896547125465733985776123199340488552969043347320117287925026243660576,
-      0.64896547125465733985776123199340488552969043347320117287925026243660576,
-     -0.68523631305423324256355837103137630193564107853967186813240427499136120,
-      0.68523631305423324256355837103137630193564107853967186813240427499136120,
-     -0.71988185017161082684894021783194724475813800331490195262204731511844686,
-      0.71988185017161082684894021783194724475813800331490195262204731511844686,
-     -0.75281990726053189661186377488569398555171427132208719324619877611677226,
-      0.75281990726053189661186377488569398555171427132208719324619877611677226,
-     -0.78397235894334140761022052521376828405641412498982593341327596174768166,
-      0.78397235894334140761022052521376828405641412498982593341327596174768166,
-     -0.81326531512279755974192333808630334069814182256559721669564851493565863,
-      0.81326531512279755974192333808630334069814182256559721669564851493565863,
-     -0.84062929625258036275169154469587330298248982380175535392820268307559347,
-      0.84062929625258036275169154469587330298248982380175535392820268307559347,
-     -0.86599939815409281976078338507015750241250191875824964256642795118083567,
-      0.86599939815409281976078338507015750241250191875824964256642795118083567,
-     -0.88931544599511410585340403827285162242919446151045218931947445660848111,
-      0.88931544599511410585340403827285162242919446151045218931947445660848111,
-     -0.91052213707850280575638066800832986101348808488836402925317237144671022,
-      0.91052213707850280575638066800832986101348808488836402925317237144671022,
-     -0.92956917213193957582149015455922560734742701442971549759281168336124310,
-      0.92956917213193957582149015455922560734742701442971549759281168336124310,
-     -0.94641137485840281606248149134726479527939497179523319023177897129736644,
-      0.94641137485840281606248149134726479527939497179523319023177897129736644,
-     -0.96100879965205371891861412189715720676211461103784594944615861586239199,
-      0.96100879965205371891861412189715720676211461103784594944615861586239199,
-     -0.97332682778991096374185350735227266802614529445517417588191397819781523,
-      0.97332682778991096374185350735227266802614529445517417588191397819781523,
-     -0.98333625388462595693129930215683111694524750662374038374648721312334261,
-      0.98333625388462595693129930215683111694524750662374038374648721312334261,
-     -0.99101337147674432073938238344330311364134944539079048522254274593781317,
-      0.99101337147674432073938238344330311364134944539079048522254274593781317,
-     -0.99634011677195527934692450067639912320985750634022661213525221995070306,
-      0.99634011677195527934692450067639912320985750634022661213525221995070306,
-     -0.99930504173577213945690562434563631196971219167560877606280729546176465,
-      0.99930504173577213945690562434563631196971219167560877606280729546176465
-    };
-  }
-  else {
+/* Given the order of integration, return the gauss point locations. */
+std::vector<double> quad::get_gauss_pts( int order )
+{
+  Span points = gauss_pts( order );
+  if( points.empty( ) )
     std::cout << "Invalid Gauss Order";
-  }
-
-  return legendre_roots;
+  return std::vector<double>( points.begin( ), points.end( ) );
 }
 
 /* -------------------------------------------------------------------------- */
@@ -2438,15 +4370,29 @@ std::vector<double> quad::get_gauss_pts(
     const std::array<double, 2> & interval_ends
     )
 {
-  // Get the Gauss points and map them to the new interval;
-  std::vector<double> legendre_roots = get_gauss_pts( order );
+  std::vector<double> points = get_gauss_pts( order );
+  map_gauss_pts( order, interval_ends, points.data( ) );
+  return points;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given the integration order, the ends of the integration interval and
+ * storage for (at least) order values, write the integration points moved &
+ * scaled to the correct interval. */
+void quad::map_gauss_pts(
+    int order,
+    const std::array<double, 2> & interval_ends,
+    double * points
+    )
+{
+  // Map the tabulated points to the new interval;
+  Span roots = gauss_pts( order );
   double end0 = interval_ends[0];
   double end1 = interval_ends[1];
   double length = end1 - end0;
-  for( int i{0}; i != order; ++i )
-    legendre_roots[i] = 0.5 * ( end0 + end1 + legendre_roots[i] * length );
-
-  return legendre_roots;
+  for( std::size_t i{0}; i != roots.size( ); ++i )
+    points[i] = 0.5 * ( end0 + end1 + roots[i] * length );
 }
 
 /* -------------------------------------------------------------------------- */
@@ -2454,2414 +4400,10 @@ std::vector<double> quad::get_gauss_pts(
 /* Given the order of integration, return the gauss weights. */
 std::vector<double> quad::get_gauss_wts( int order )
 {
-  std::vector<double> quadrature_weights;
-
-  // Weights for different orders provided by:
-  // http://pomax.github.io/bezierinf.o/legendre-gauss.html
-  if ( order == 1 ) {
-    quadrature_weights = {
-      2.00000000000000000000000000000000000000000000000000000000000000000000000
-    };
-  }
-
-  else if ( order == 2 ) {
-    quadrature_weights = {
-      1.00000000000000000000000000000000000000000000000000000000000000000000000,
-      1.00000000000000000000000000000000000000000000000000000000000000000000000
-    };
-  }
-
-  else if ( order == 3 ) {
-    quadrature_weights = {
-      0.55555555555555555555555555555555555555555555555555555555555555555555556,
-      0.88888888888888888888888888888888888888888888888888888888888888888888889,
-      0.55555555555555555555555555555555555555555555555555555555555555555555556
-    };
-  }
-
-  else if ( order == 4 ) {
-    quadrature_weights = {
-      0.34785484513745385737306394922199940723534869583389354049252931951875187,
-      0.65214515486254614262693605077800059276465130416610645950747068048124813,
-      0.65214515486254614262693605077800059276465130416610645950747068048124813,
-      0.34785484513745385737306394922199940723534869583389354049252931951875187
-    };
-  }
-
-  else if ( order == 5 ) {
-    quadrature_weights = {
-      0.23692688505618908751426404071991736264326000221241401558282788822171729,
-      0.47862867049936646804129151483563819291229555334314153997272766733383827,
-      0.56888888888888888888888888888888888888888888888888888888888888888888889,
-      0.47862867049936646804129151483563819291229555334314153997272766733383827,
-      0.23692688505618908751426404071991736264326000221241401558282788822171729
-    };
-  }
-
-  else if ( order == 6 ) {
-    quadrature_weights = {
-      0.36076157304813860756983351383771611166152189274674548228973924023714004,
-      0.36076157304813860756983351383771611166152189274674548228973924023714004,
-      0.46791393457269104738987034398955099481165560576921053531162531996391420,
-      0.46791393457269104738987034398955099481165560576921053531162531996391420,
-      0.17132449237917034504029614217273289352682250148404398239863543979894576,
-      0.17132449237917034504029614217273289352682250148404398239863543979894576
-    };
-  }
-
-  else if ( order == 7 ) {
-    quadrature_weights = {
-      0.41795918367346938775510204081632653061224489795918367346938775510204082,
-      0.38183005050511894495036977548897513387836508353386273475108345103070555,
-      0.38183005050511894495036977548897513387836508353386273475108345103070555,
-      0.27970539148927666790146777142377958248692506522659876453701403269361881,
-      0.27970539148927666790146777142377958248692506522659876453701403269361881,
-      0.12948496616886969327061143267908201832858740225994666397720863872465523,
-      0.12948496616886969327061143267908201832858740225994666397720863872465523
-    };
-  }
-
-  else if ( order == 8 ) {
-    quadrature_weights = {
-      0.10122853629037625915253135430996219011539409105168495705900369806474018,
-      0.22238103445337447054435599442624088443013087005124956472590928929361681,
-      0.31370664587788728733796220198660131326032899900273493769026394507495627,
-      0.36268378337836198296515044927719561219414603989433054052482306756668673,
-      0.36268378337836198296515044927719561219414603989433054052482306756668673,
-      0.31370664587788728733796220198660131326032899900273493769026394507495627,
-      0.22238103445337447054435599442624088443013087005124956472590928929361681,
-      0.10122853629037625915253135430996219011539409105168495705900369806474018
-    };
-  }
-
-  else if ( order == 9 ) {
-    quadrature_weights = {
-      0.33023935500125976316452506928697404887881078357268833459309649785840262,
-      0.18064816069485740405847203124291280951433782173204048449833590647135729,
-      0.18064816069485740405847203124291280951433782173204048449833590647135729,
-      0.08127438836157441197189215811052365067566172078241075071110767688068669,
-      0.08127438836157441197189215811052365067566172078241075071110767688068669,
-      0.31234707704000284006863040658444366559875486126190464555401116559914390,
-      0.31234707704000284006863040658444366559875486126190464555401116559914390,
-      0.26061069640293546231874286941863284977184020443729995193999700211961082,
-      0.26061069640293546231874286941863284977184020443729995193999700211961082
-    };
-  }
-
-  else if ( order == 10 ) {
-    quadrature_weights = {
-      0.29552422471475287017389299465133832942104671702685360135430802975599594,
-      0.29552422471475287017389299465133832942104671702685360135430802975599594,
-      0.26926671930999635509122692156946935285975993846088379580056327624215343,
-      0.26926671930999635509122692156946935285975993846088379580056327624215343,
-      0.21908636251598204399553493422816319245877187052267708988095654363519991,
-      0.21908636251598204399553493422816319245877187052267708988095654363519991,
-      0.14945134915058059314577633965769733240255663966942736783547726875323865,
-      0.14945134915058059314577633965769733240255663966942736783547726875323865,
-      0.06667134430868813759356880989333179285786483432015814512869488161341206,
-      0.06667134430868813759356880989333179285786483432015814512869488161341206
-    };
-  }
-
-  else if ( order == 11 ) {
-    quadrature_weights = {
-      0.27292508677790063071448352833634218915604196989478374759760041145322531,
-      0.26280454451024666218068886989050919537276467760314455638005537148551280,
-      0.26280454451024666218068886989050919537276467760314455638005537148551280,
-      0.23319376459199047991852370484317513943179817231695850902731972212193221,
-      0.23319376459199047991852370484317513943179817231695850902731972212193221,
-      0.18629021092773425142609764143165589169128474804020341178150640417387235,
-      0.18629021092773425142609764143165589169128474804020341178150640417387235,
-      0.12558036946490462463469429922394010019761579139540350066393401081791458,
-      0.12558036946490462463469429922394010019761579139540350066393401081791458,
-      0.05566856711617366648275372044254857872851562569689814834838428567415541,
-      0.05566856711617366648275372044254857872851562569689814834838428567415541
-    };
-  }
-
-  else if ( order == 12 ) {
-    quadrature_weights = {
-      0.24914704581340278500056243604295121083046090256961883139535100311627943,
-      0.24914704581340278500056243604295121083046090256961883139535100311627943,
-      0.23349253653835480876084989892487805625940997219975487473052349782149200,
-      0.23349253653835480876084989892487805625940997219975487473052349782149200,
-      0.20316742672306592174906445580979837650651814727459014639859456579764563,
-      0.20316742672306592174906445580979837650651814727459014639859456579764563,
-      0.16007832854334622633465252954335907187201173049086417790989954415795423,
-      0.16007832854334622633465252954335907187201173049086417790989954415795423,
-      0.10693932599531843096025471819399622421457017347032488000512604210281899,
-      0.10693932599531843096025471819399622421457017347032488000512604210281899,
-      0.04717533638651182719461596148501706031702907399484708956050534700380972,
-      0.04717533638651182719461596148501706031702907399484708956050534700380972
-    };
-  }
-
-  else if ( order == 13 ) {
-    quadrature_weights = {
-      0.23255155323087391019458951526883594815662747730679798611866543934476002,
-      0.22628318026289723841209018603977661843475773761555701986496854877157566,
-      0.22628318026289723841209018603977661843475773761555701986496854877157566,
-      0.20781604753688850231252321930605276338658260919950354921911111991653854,
-      0.20781604753688850231252321930605276338658260919950354921911111991653854,
-      0.17814598076194573828004669199609799551281265066101650298679444028914507,
-      0.17814598076194573828004669199609799551281265066101650298679444028914507,
-      0.13887351021978723846360177686887146762186271826329822764635501650577252,
-      0.13887351021978723846360177686887146762186271826329822764635501650577252,
-      0.09212149983772844791442177595379712092368399986223683908839154733959373,
-      0.09212149983772844791442177595379712092368399986223683908839154733959373,
-      0.04048400476531587952002159220098606004198654574498886813504660750499446,
-      0.04048400476531587952002159220098606004198654574498886813504660750499446
-    };
-  }
-
-  else if ( order == 14 ) {
-    quadrature_weights = {
-      0.21526385346315779019587644331626003527499755805412880021977639254361879,
-      0.21526385346315779019587644331626003527499755805412880021977639254361879,
-      0.20519846372129560396592406566121805571033906130941945171689729028336714,
-      0.20519846372129560396592406566121805571033906130941945171689729028336714,
-      0.18553839747793781374171659012515703624892260293733165902003492506909835,
-      0.18553839747793781374171659012515703624892260293733165902003492506909835,
-      0.15720316715819353456960193862384215660566803733732337496931704387476818,
-      0.15720316715819353456960193862384215660566803733732337496931704387476818,
-      0.12151857068790318468941480907247662595666934569007467229107539254315974,
-      0.12151857068790318468941480907247662595666934569007467229107539254315974,
-      0.08015808715976020980563327706285430958369778539459476520139906548957147,
-      0.08015808715976020980563327706285430958369778539459476520139906548957147,
-      0.03511946033175186303183287613819178061970560927712727658149989019641632,
-      0.03511946033175186303183287613819178061970560927712727658149989019641632
-    };
-  }
-
-  else if ( order == 15 ) {
-    quadrature_weights = {
-      0.20257824192556127288062019996751931483866215800947735679670411605143540,
-      0.19843148532711157645611832644383932481869255995754199348473792792912480,
-      0.19843148532711157645611832644383932481869255995754199348473792792912480,
-      0.18616100001556221102680056186642282450622601227792840281549572731001326,
-      0.18616100001556221102680056186642282450622601227792840281549572731001326,
-      0.16626920581699393355320086048120881113090018009841290732186519056355356,
-      0.16626920581699393355320086048120881113090018009841290732186519056355356,
-      0.13957067792615431444780479451102832252085027531551124320239112863108844,
-      0.13957067792615431444780479451102832252085027531551124320239112863108844,
-      0.10715922046717193501186954668586930341554371575810198068702238912187799,
-      0.10715922046717193501186954668586930341554371575810198068702238912187799,
-      0.07036604748810812470926741645066733846670803275433071982590729291438706,
-      0.07036604748810812470926741645066733846670803275433071982590729291438706,
-      0.03075324199611726835462839357720441772174814483343407426422828550423719,
-      0.03075324199611726835462839357720441772174814483343407426422828550423719
-    };
-  }
-
-  else if ( order == 16 ) {
-    quadrature_weights = {
-      0.18945061045506849628539672320828310514690898839590297503751324520002289,
-      0.18945061045506849628539672320828310514690898839590297503751324520002289,
-      0.18260341504492358886676366796921993938355622365464928241849514437943046,
-      0.18260341504492358886676366796921993938355622365464928241849514437943046,
-      0.16915651939500253818931207903035996221163947341602828174508293568080366,
-      0.16915651939500253818931207903035996221163947341602828174508293568080366,
-      0.14959598881657673208150173054747854897049106820783646680542196218736040,
-      0.14959598881657673208150173054747854897049106820783646680542196218736040,
-      0.12462897125553387205247628219201642014488685922220267994475059042941096,
-      0.12462897125553387205247628219201642014488685922220267994475059042941096,
-      0.09515851168249278480992510760224622635526350318371265815682228722963176,
-      0.09515851168249278480992510760224622635526350318371265815682228722963176,
-      0.06225352393864789286284383699437769427498650835290685790130351581953574,
-      0.06225352393864789286284383699437769427498650835290685790130351581953574,
-      0.02715245941175409485178057245601810351226737556676079799061031907380411,
-      0.02715245941175409485178057245601810351226737556676079799061031907380411
-    };
-  }
-
-  else if ( order == 17 ) {
-    quadrature_weights = {
-      0.17944647035620652545826564426188562144878031989766852366766869795559675,
-      0.17656270536699264632527099011319723915092441800074811804314440691320904,
-      0.17656270536699264632527099011319723915092441800074811804314440691320904,
-      0.16800410215645004450997066378832315502119812896507401426995585134032311,
-      0.16800410215645004450997066378832315502119812896507401426995585134032311,
-      0.15404576107681028808143159480195861194048305847101793438526471135144674,
-      0.15404576107681028808143159480195861194048305847101793438526471135144674,
-      0.13513636846852547328631998170235019737212585323448902037799461068886724,
-      0.13513636846852547328631998170235019737212585323448902037799461068886724,
-      0.11188384719340397109478838562635592673584342426307705001848648244909568,
-      0.11188384719340397109478838562635592673584342426307705001848648244909568,
-      0.08503614831717918088353537019106207385049138921850547576641036073878399,
-      0.08503614831717918088353537019106207385049138921850547576641036073878399,
-      0.05545952937398720112944016535824466051284625195322884699372407871025743,
-      0.05545952937398720112944016535824466051284625195322884699372407871025743,
-      0.02414830286854793196011002628756532469169731594502527831118514883021840,
-      0.02414830286854793196011002628756532469169731594502527831118514883021840
-    };
-  }
-
-  else if ( order == 18 ) {
-    quadrature_weights = {
-      0.16914238296314359184065647013498661033410581937034388026987519154905944,
-      0.16914238296314359184065647013498661033410581937034388026987519154905944,
-      0.16427648374583272298605377646592759041233895399735295324449697091164842,
-      0.16427648374583272298605377646592759041233895399735295324449697091164842,
-      0.15468467512626524492541800383637477219321839626735417266664191472778287,
-      0.15468467512626524492541800383637477219321839626735417266664191472778287,
-      0.14064291467065065120473130375194722809550241033097255988345619526046559,
-      0.14064291467065065120473130375194722809550241033097255988345619526046559,
-      0.12255520671147846018451912680020155522816389733343909716725351365405744,
-      0.12255520671147846018451912680020155522816389733343909716725351365405744,
-      0.10094204410628716556281398492483460706280113888767890161037453665565080,
-      0.10094204410628716556281398492483460706280113888767890161037453665565080,
-      0.07642573025488905652912967761663652560531790620835828744952137923441001,
-      0.07642573025488905652912967761663652560531790620835828744952137923441001,
-      0.04971454889496979645333494620263864168086624612891020224630430786557234,
-      0.04971454889496979645333494620263864168086624612891020224630430786557234,
-      0.02161601352648331031334271026645246938768523147558994546207599014135309,
-      0.02161601352648331031334271026645246938768523147558994546207599014135309
-    };
-  }
-
-  else if ( order == 19 ) {
-    quadrature_weights = {
-      0.16105444984878369597916362532091673503990255857851690212832315273577105,
-      0.15896884339395434764995643946504720167878015819512609575117491532474098,
-      0.15896884339395434764995643946504720167878015819512609575117491532474098,
-      0.15276604206585966677885540089766299846100826723642862352310155307481104,
-      0.15276604206585966677885540089766299846100826723642862352310155307481104,
-      0.14260670217360661177574610944190297247566834482447386092657165590645825,
-      0.14260670217360661177574610944190297247566834482447386092657165590645825,
-      0.12875396253933622767551578485687711705583957709346303454710438462230360,
-      0.12875396253933622767551578485687711705583957709346303454710438462230360,
-      0.11156664554733399471602390168176599748133185383989377552146114287645898,
-      0.11156664554733399471602390168176599748133185383989377552146114287645898,
-      0.09149002162244999946446209412383965266091165129659878466498934490206222,
-      0.09149002162244999946446209412383965266091165129659878466498934490206222,
-      0.06904454273764122658070825800601304496184803168761313112290042769603497,
-      0.06904454273764122658070825800601304496184803168761313112290042769603497,
-      0.04481422676569960033283815740199421195175422746785760208585452676764299,
-      0.04481422676569960033283815740199421195175422746785760208585452676764299,
-      0.01946178822972647703631204146443843575290660906928664079268047246160144,
-      0.01946178822972647703631204146443843575290660906928664079268047246160144
-    };
-  }
-
-  else if ( order == 20 ) {
-    quadrature_weights = {
-      0.01761400713915211831186196235185281636214310554333673252434932667734842,
-      0.04060142980038694133103995227493210987909063998995153681760685456183230,
-      0.06267204833410906356950653518704160635160107657843636409958434543797481,
-      0.08327674157670474872475814322204620610017782858316329074488206078569308,
-      0.10193011981724043503675013548034987616669165602339255626197161619685232,
-      0.11819453196151841731237737771138228700504121954896877544688995202017475,
-      0.13168863844917662689849449974816313491611051114698352699643649370885436,
-      0.14209610931838205132929832506716493303451541339202030333736708298382809,
-      0.14917298647260374678782873700196943669267990408136831649621121780984442,
-      0.15275338713072585069808433195509759349194864511237859727470104981759745,
-      0.15275338713072585069808433195509759349194864511237859727470104981759745,
-      0.14917298647260374678782873700196943669267990408136831649621121780984442,
-      0.14209610931838205132929832506716493303451541339202030333736708298382809,
-      0.13168863844917662689849449974816313491611051114698352699643649370885436,
-      0.11819453196151841731237737771138228700504121954896877544688995202017475,
-      0.10193011981724043503675013548034987616669165602339255626197161619685232,
-      0.08327674157670474872475814322204620610017782858316329074488206078569308,
-      0.06267204833410906356950653518704160635160107657843636409958434543797481,
-      0.04060142980038694133103995227493210987909063998995153681760685456183230,
-      0.01761400713915211831186196235185281636214310554333673252434932667734842
-    };
-  }
-
-  else if ( order == 21 ) {
-    quadrature_weights = {
-      0.14608113364969042719198514768337118824480957694196544410732258751543859,
-      0.14452440398997005906382716655375254360994996219709983475247298888609731,
-      0.14452440398997005906382716655375254360994996219709983475247298888609731,
-      0.13988739479107315472213342386758311089279316095491960437373132632424326,
-      0.13988739479107315472213342386758311089279316095491960437373132632424326,
-      0.13226893863333746178105257449677560432901154014315682321835032315178260,
-      0.13226893863333746178105257449677560432901154014315682321835032315178260,
-      0.12183141605372853419536717712573359835633762556153745024298380784275890,
-      0.12183141605372853419536717712573359835633762556153745024298380784275890,
-      0.10879729916714837766347457807010564203369959579385633055278208716897364,
-      0.10879729916714837766347457807010564203369959579385633055278208716897364,
-      0.09344442345603386155328974111393208848352664736159284486669527163257790,
-      0.09344442345603386155328974111393208848352664736159284486669527163257790,
-      0.07610011362837930201705165330018317922615435242396602852146848581645352,
-      0.07610011362837930201705165330018317922615435242396602852146848581645352,
-      0.05713442542685720828363582647244795749128759682625604144250732342704906,
-      0.05713442542685720828363582647244795749128759682625604144250732342704906,
-      0.03695378977085249379995066829932966618894430814872983742716918187878575,
-      0.03695378977085249379995066829932966618894430814872983742716918187878575,
-      0.01601722825777433332422461685847101526589042211790248254817791011355877,
-      0.01601722825777433332422461685847101526589042211790248254817791011355877
-    };
-  }
-
-  else if ( order == 22 ) {
-    quadrature_weights = {
-      0.13925187285563199337541024834180995787392021745742585812619787707303771,
-      0.13925187285563199337541024834180995787392021745742585812619787707303771,
-      0.13654149834601517135257383123151739658636765298868616810946973493820756,
-      0.13654149834601517135257383123151739658636765298868616810946973493820756,
-      0.13117350478706237073296499253030744587574189418803065312537970342454461,
-      0.13117350478706237073296499253030744587574189418803065312537970342454461,
-      0.12325237681051242428556098615481447195944499900496797242842197188513550,
-      0.12325237681051242428556098615481447195944499900496797242842197188513550,
-      0.11293229608053921839340060742178431911426333212099470427259754624861313,
-      0.11293229608053921839340060742178431911426333212099470427259754624861313,
-      0.10041414444288096493207883783053628235081108876769962578496091434045310,
-      0.10041414444288096493207883783053628235081108876769962578496091434045310,
-      0.08594160621706772741444368137270286618914440534907978328657001104824602,
-      0.08594160621706772741444368137270286618914440534907978328657001104824602,
-      0.06979646842452048809496141893021765739877505295508052738631137176394640,
-      0.06979646842452048809496141893021765739877505295508052738631137176394640,
-      0.05229333515268328594031205127321125611215009356923631612271008329767634,
-      0.05229333515268328594031205127321125611215009356923631612271008329767634,
-      0.03377490158481415479330224686591290134916931447447466043288319455995151,
-      0.03377490158481415479330224686591290134916931447447466043288319455995151,
-      0.01462799529827220068499109804718544519021194912432373092449759142018811,
-      0.01462799529827220068499109804718544519021194912432373092449759142018811
-    };
-  }
-
-  else if ( order == 23 ) {
-    quadrature_weights = {
-      0.13365457218610617535145711054584433858315280763688331748193597799144098,
-      0.13246203940469661737164246470331692580503566947422352432251226803848601,
-      0.13246203940469661737164246470331692580503566947422352432251226803848601,
-      0.12890572218808214997859533939979365325971549719178349244434043171798946,
-      0.12890572218808214997859533939979365325971549719178349244434043171798946,
-      0.12304908430672953046757840067200965481585281254647057443567033290169047,
-      0.12304908430672953046757840067200965481585281254647057443567033290169047,
-      0.11499664022241136494164351293396130149141052292958560660907570340279959,
-      0.11499664022241136494164351293396130149141052292958560660907570340279959,
-      0.10489209146454141007408618501474385485847158319397500550282519233877938,
-      0.10489209146454141007408618501474385485847158319397500550282519233877938,
-      0.09291576606003514747701861736976464860346007174312989373265950461193728,
-      0.09291576606003514747701861736976464860346007174312989373265950461193728,
-      0.07928141177671895492289252474204322691371199193840650255563454033204300,
-      0.07928141177671895492289252474204322691371199193840650255563454033204300,
-      0.06423242140852585212716961515891099803915827575480683049534668205291755,
-      0.06423242140852585212716961515891099803915827575480683049534668205291755,
-      0.04803767173108466857164107163203399656121630830351161133368366686985809,
-      0.04803767173108466857164107163203399656121630830351161133368366686985809,
-      0.03098800585697944431069421964188450538377252899992806643488780659861778,
-      0.03098800585697944431069421964188450538377252899992806643488780659861778,
-      0.01341185948714177208130949345861506497661833410573723339239588213916089,
-      0.01341185948714177208130949345861506497661833410573723339239588213916089
-    };
-  }
-
-  else if ( order == 24 ) {
-    quadrature_weights = {
-      0.12793819534675215697405616522469537185171123954166788242129957637234759,
-      0.12793819534675215697405616522469537185171123954166788242129957637234759,
-      0.12583745634682829612137538251118368872640332558134540417809151688139387,
-      0.12583745634682829612137538251118368872640332558134540417809151688139387,
-      0.12167047292780339120446315347626242560702955920380577877747175451262539,
-      0.12167047292780339120446315347626242560702955920380577877747175451262539,
-      0.11550566805372560135334448390678355986227031137649647058444936008867025,
-      0.11550566805372560135334448390678355986227031137649647058444936008867025,
-      0.10744427011596563478257734244660622279462869013422002176654164088682187,
-      0.10744427011596563478257734244660622279462869013422002176654164088682187,
-      0.09761865210411388826988066446424715442791896885368594408331061002295434,
-      0.09761865210411388826988066446424715442791896885368594408331061002295434,
-      0.08619016153195327591718520298374266718508058823793300558840714386128688,
-      0.08619016153195327591718520298374266718508058823793300558840714386128688,
-      0.07334648141108030573403361525311651811933650984849947140270249066004139,
-      0.07334648141108030573403361525311651811933650984849947140270249066004139,
-      0.05929858491543678074636775850010858454120012656521349103737655129409830,
-      0.05929858491543678074636775850010858454120012656521349103737655129409830,
-      0.04427743881741980616860274821133822885931284183385789674139722972102438,
-      0.04427743881741980616860274821133822885931284183385789674139722972102438,
-      0.02853138862893366318130781595187828644919779793190811660166480475764401,
-      0.02853138862893366318130781595187828644919779793190811660166480475764401,
-      0.01234122979998719954680566707003729157591004089136651681728732094109173,
-      0.01234122979998719954680566707003729157591004089136651681728732094109173
-    };
-  }
-
-  else if ( order == 25 ) {
-    quadrature_weights = {
-      0.12317605372671545120390287307905014243823362751815166539135219731691201,
-      0.12224244299031004168895951894585150583505924756305904090758008223203897,
-      0.12224244299031004168895951894585150583505924756305904090758008223203897,
-      0.11945576353578477222817812651290104739017670141372642551958788133518409,
-      0.11945576353578477222817812651290104739017670141372642551958788133518409,
-      0.11485825914571164833932554586955580864093619166818014959151499003148280,
-      0.11485825914571164833932554586955580864093619166818014959151499003148280,
-      0.10851962447426365311609395705011661934007758798672201615649430734883929,
-      0.10851962447426365311609395705011661934007758798672201615649430734883929,
-      0.10053594906705064420220689039268582698846609452814190706986904199941295,
-      0.10053594906705064420220689039268582698846609452814190706986904199941295,
-      0.09102826198296364981149722070289165338099255895933431097048376896701738,
-      0.09102826198296364981149722070289165338099255895933431097048376896701738,
-      0.08014070033500101801323495966911130229022573285367589371620146297361283,
-      0.08014070033500101801323495966911130229022573285367589371620146297361283,
-      0.06803833381235691720718718565670796855470949435463656261507122147483647,
-      0.06803833381235691720718718565670796855470949435463656261507122147483647,
-      0.05490469597583519192593689154047332416010998555311134904850849824459377,
-      0.05490469597583519192593689154047332416010998555311134904850849824459377,
-      0.04093915670130631265562348771164595366084578336410434650469841489929743,
-      0.04093915670130631265562348771164595366084578336410434650469841489929743,
-      0.02635498661503213726190181529529914493596328170332246875536616578387093,
-      0.02635498661503213726190181529529914493596328170332246875536616578387093,
-      0.01139379850102628794790296411323477360332052629290969644894806111618989,
-      0.01139379850102628794790296411323477360332052629290969644894806111618989
-    };
-  }
-
-  else if ( order == 26 ) {
-    quadrature_weights = {
-      0.11832141527926227651637108570046868464989027082890531809432019937962069,
-      0.11832141527926227651637108570046868464989027082890531809432019937962069,
-      0.11666044348529658204466250754036221363196488122192421646016269721126567,
-      0.11666044348529658204466250754036221363196488122192421646016269721126567,
-      0.11336181654631966654944071844259814524595036292501521398828792988748911,
-      0.11336181654631966654944071844259814524595036292501521398828792988748911,
-      0.10847184052857659065657942672799758228943820342130664452960570860946140,
-      0.10847184052857659065657942672799758228943820342130664452960570860946140,
-      0.10205916109442542323841407025343079232720881135424201033187381940865267,
-      0.10205916109442542323841407025343079232720881135424201033187381940865267,
-      0.09421380035591414846366488306730319854916574591420727986331490236803450,
-      0.09421380035591414846366488306730319854916574591420727986331490236803450,
-      0.08504589431348523921044776507998169658392031677667827618605618141998779,
-      0.08504589431348523921044776507998169658392031677667827618605618141998779,
-      0.07468414976565974588707579610284833863874716188104068077903084174281963,
-      0.07468414976565974588707579610284833863874716188104068077903084174281963,
-      0.06327404632957483553945368990704509572222284201269451066609588660798839,
-      0.06327404632957483553945368990704509572222284201269451066609588660798839,
-      0.05097582529714781199831990072407337952587931854297193482383768599941731,
-      0.05097582529714781199831990072407337952587931854297193482383768599941731,
-      0.03796238329436276395030314124885049469077042174404895767531182465280790,
-      0.03796238329436276395030314124885049469077042174404895767531182465280790,
-      0.02441785109263190878961582751978840024049592619727034205204689507569172,
-      0.02441785109263190878961582751978840024049592619727034205204689507569172,
-      0.01055137261734300715565118768525197790434573717969461455005542763676322,
-      0.01055137261734300715565118768525197790434573717969461455005542763676322
-    };
-  }
-
-  else if ( order == 27 ) {
-    quadrature_weights = {
-      0.11422086737895698904504573690183524868072144335016533032174771657919413,
-      0.11347634610896514862036994809209925792052451881047202589641654957702234,
-      0.11347634610896514862036994809209925792052451881047202589641654957702234,
-      0.11125248835684519267216309604284867483292038008508326709640350969793208,
-      0.11125248835684519267216309604284867483292038008508326709640350969793208,
-      0.10757828578853318721216298442665740481896609906376466551235890651519449,
-      0.10757828578853318721216298442665740481896609906376466551235890651519449,
-      0.10250163781774579867124771153266380932440989491471732986978183238298748,
-      0.10250163781774579867124771153266380932440989491471732986978183238298748,
-      0.09608872737002850756565264655810585916021162953702933442813111353401513,
-      0.09608872737002850756565264655810585916021162953702933442813111353401513,
-      0.08842315854375695019432280285374911105653675005109910980587113709659270,
-      0.08842315854375695019432280285374911105653675005109910980587113709659270,
-      0.07960486777305777126307495900984240297614667298700295141340876380275273,
-      0.07960486777305777126307495900984240297614667298700295141340876380275273,
-      0.06974882376624559298432288835666727613282469325695200037741878162105936,
-      0.06974882376624559298432288835666727613282469325695200037741878162105936,
-      0.05898353685983359911030083371953163316524059070641216254021521491382113,
-      0.05898353685983359911030083371953163316524059070641216254021521491382113,
-      0.04744941252061506270409671011418471822472562016618472851731001266917821,
-      0.04744941252061506270409671011418471822472562016618472851731001266917821,
-      0.03529705375741971102257828930471164113613888952294181158222778509490883,
-      0.03529705375741971102257828930471164113613888952294181158222778509490883,
-      0.02268623159618062319603420644676148881276772028816635563144213023907583,
-      0.02268623159618062319603420644676148881276772028816635563144213023907583,
-      0.00979899605129436026115005509125909809822581893509159216814040456586263,
-      0.00979899605129436026115005509125909809822581893509159216814040456586263
-    };
-  }
-
-  else if ( order == 28 ) {
-    quadrature_weights = {
-      0.11004701301647519628237626560181761395662552949123163327866810122961241,
-      0.11004701301647519628237626560181761395662552949123163327866810122961241,
-      0.10871119225829413525357151930367336787527845466604396765712117047731333,
-      0.10871119225829413525357151930367336787527845466604396765712117047731333,
-      0.10605576592284641791041643699681082878992296268515951683062029628592251,
-      0.10605576592284641791041643699681082878992296268515951683062029628592251,
-      0.10211296757806076981421663850571213504658000235792054093397545220284640,
-      0.10211296757806076981421663850571213504658000235792054093397545220284640,
-      0.09693065799792991585048900609544060176503312335646160495687628181436939,
-      0.09693065799792991585048900609544060176503312335646160495687628181436939,
-      0.09057174439303284094218603133678412982285748545448487237586853385445672,
-      0.09057174439303284094218603133678412982285748545448487237586853385445672,
-      0.08311341722890121839039649824433247986113441344385133299635567173254245,
-      0.08311341722890121839039649824433247986113441344385133299635567173254245,
-      0.07464621423456877902393188717302203802163586120633344743932005621496384,
-      0.07464621423456877902393188717302203802163586120633344743932005621496384,
-      0.06527292396699959579339756677550463635363543116260702633548481815207689,
-      0.06527292396699959579339756677550463635363543116260702633548481815207689,
-      0.05510734567571674543148291822694559121905796422566538840689275397294262,
-      0.05510734567571674543148291822694559121905796422566538840689275397294262,
-      0.04427293475900422783958787765320739061499411270856684371514706188422418,
-      0.04427293475900422783958787765320739061499411270856684371514706188422418,
-      0.03290142778230437997763081917053204598153081742009718785926162060376464,
-      0.03290142778230437997763081917053204598153081742009718785926162060376464,
-      0.02113211259277125975150038099326543445136935072328563779766849025106516,
-      0.02113211259277125975150038099326543445136935072328563779766849025106516,
-      0.00912428259309451773881615392295170624034449109829099941673969132389946,
-      0.00912428259309451773881615392295170624034449109829099941673969132389946
-    };
-  }
-
-  else if ( order == 29 ) {
-    quadrature_weights = {
-      0.10647938171831424424651112690967756833018503161299597975297290106788132,
-      0.10587615509732094140659132785218789307483131374227803982815534552502264,
-      0.10587615509732094140659132785218789307483131374227803982815534552502264,
-      0.10407331007772937391332847128512006891065222067546769164369405414788030,
-      0.10407331007772937391332847128512006891065222067546769164369405414788030,
-      0.10109127375991496612182054690749736364756727885252519912283202330577702,
-      0.10109127375991496612182054690749736364756727885252519912283202330577702,
-      0.09696383409440860630190007488268875917635627792180356426049546674623288,
-      0.09696383409440860630190007488268875917635627792180356426049546674623288,
-      0.09173775713925876334796641107711080689822902098195457127582987469869372,
-      0.09173775713925876334796641107711080689822902098195457127582987469869372,
-      0.08547225736617252754534484929720807138169825661359339532189074338243199,
-      0.08547225736617252754534484929720807138169825661359339532189074338243199,
-      0.07823832713576378382814488865968033136687907695966970946757519532476054,
-      0.07823832713576378382814488865968033136687907695966970946757519532476054,
-      0.07011793325505127856958148694887917310239488867477358191480742147483647,
-      0.07011793325505127856958148694887917310239488867477358191480742147483647,
-      0.06120309065707913854210984802390704492406453977913020831787741211199444,
-      0.06120309065707913854210984802390704492406453977913020831787741211199444,
-      0.05159482690249792391259438117954259791962211064614206768186283132730412,
-      0.05159482690249792391259438117954259791962211064614206768186283132730412,
-      0.04140206251868283610483001011407692153349078038857439725792487943479244,
-      0.04140206251868283610483001011407692153349078038857439725792487943479244,
-      0.03074049220209362264440852537461674974711626096870951032208435936635163,
-      0.03074049220209362264440852537461674974711626096870951032208435936635163,
-      0.01973208505612270598385980164039563114960656819036158765605384467534436,
-      0.01973208505612270598385980164039563114960656819036158765605384467534436,
-      0.00851690387874640965426381330224980300239888979851848605243009455946529,
-      0.00851690387874640965426381330224980300239888979851848605243009455946529
-    };
-  }
-
-  else if ( order == 30 ) {
-    quadrature_weights = {
-      0.10285265289355884034128563670541504386837555706492822258631898667601624,
-      0.10285265289355884034128563670541504386837555706492822258631898667601624,
-      0.10176238974840550459642895216855404463270628948712684086426094541964251,
-      0.10176238974840550459642895216855404463270628948712684086426094541964251,
-      0.09959342058679526706278028210356947652986926366670427722136514618394666,
-      0.09959342058679526706278028210356947652986926366670427722136514618394666,
-      0.09636873717464425963946862635180986509640646143016024591299427573283753,
-      0.09636873717464425963946862635180986509640646143016024591299427573283753,
-      0.09212252223778612871763270708761876719691323441823410752767504700197305,
-      0.09212252223778612871763270708761876719691323441823410752767504700197305,
-      0.08689978720108297980238753071512570257675332874354534401222212988215358,
-      0.08689978720108297980238753071512570257675332874354534401222212988215358,
-      0.08075589522942021535469493846052973087589280370843929989025859370605118,
-      0.08075589522942021535469493846052973087589280370843929989025859370605118,
-      0.07375597473770520626824385002219073415377052603704943894126918237459940,
-      0.07375597473770520626824385002219073415377052603704943894126918237459940,
-      0.06597422988218049512812851511596236123744295365666037896703151604214367,
-      0.06597422988218049512812851511596236123744295365666037896703151604214367,
-      0.05749315621761906648172168940205612879712067072176313454871579900323215,
-      0.05749315621761906648172168940205612879712067072176313454871579900323215,
-      0.04840267283059405290293814042280751781527180919737273634519193679180543,
-      0.04840267283059405290293814042280751781527180919737273634519193679180543,
-      0.03879919256962704959680193644634769203320097676639535210773278970594697,
-      0.03879919256962704959680193644634769203320097676639535210773278970594697,
-      0.02878470788332336934971917961129204363958889454628749647418012260814599,
-      0.02878470788332336934971917961129204363958889454628749647418012260814599,
-      0.01846646831109095914230213191204726909620653396818140337129836551458560,
-      0.01846646831109095914230213191204726909620653396818140337129836551458560,
-      0.00796819249616660561546588347467362245048069658715172122948516335692004,
-      0.00796819249616660561546588347467362245048069658715172122948516335692004
-    };
-  }
-
-  else if ( order == 31 ) {
-    quadrature_weights = {
-      0.09972054479342645142753383373434943964325341150020435148561457956409281,
-      0.09922501122667230787487551442861501401754321995556306978120314251546907,
-      0.09922501122667230787487551442861501401754321995556306978120314251546907,
-      0.09774333538632872509347401097899670383572878867609511450951464450145246,
-      0.09774333538632872509347401097899670383572878867609511450951464450145246,
-      0.09529024291231951280720419748759668454132473824695902271144946592846881,
-      0.09529024291231951280720419748759668454132473824695902271144946592846881,
-      0.09189011389364147821536287160715012549731082537915780417848561650424870,
-      0.09189011389364147821536287160715012549731082537915780417848561650424870,
-      0.08757674060847787612619806969533309222925815977120425150354121196912542,
-      0.08757674060847787612619806969533309222925815977120425150354121196912542,
-      0.08239299176158926390382336743196177061576826655664627781038392425063087,
-      0.08239299176158926390382336743196177061576826655664627781038392425063087,
-      0.07639038659877661642635767490133064492575691369420865409219008164640825,
-      0.07639038659877661642635767490133064492575691369420865409219008164640825,
-      0.06962858323541036616775612625512571051508570739734339371107271703674269,
-      0.06962858323541036616775612625512571051508570739734339371107271703674269,
-      0.06217478656102842691034354368669666715872879936465131528150750533149109,
-      0.06217478656102842691034354368669666715872879936465131528150750533149109,
-      0.05410308242491685371166625908662004272038946259621180769400782105129990,
-      0.05410308242491685371166625908662004272038946259621180769400782105129990,
-      0.04549370752720110290231585789462967726355271931002896489351663612152439,
-      0.04549370752720110290231585789462967726355271931002896489351663612152439,
-      0.03643227391238546402439201046780344232714533204766768590141903939633341,
-      0.03643227391238546402439201046780344232714533204766768590141903939633341,
-      0.02700901918497942180060870809193215614235664600211664585687474984727009,
-      0.02700901918497942180060870809193215614235664600211664585687474984727009,
-      0.01731862079031058246315799608682114136627286276799577663275518378881015,
-      0.01731862079031058246315799608682114136627286276799577663275518378881015,
-      0.00747083157924877585869687503221240702215085248404803969927097032867827,
-      0.00747083157924877585869687503221240702215085248404803969927097032867827
-    };
-  }
-
-  else if ( order == 32 ) {
-    quadrature_weights = {
-      0.09654008851472780056676483006357579473686063123557006873231820995774978,
-      0.09654008851472780056676483006357579473686063123557006873231820995774978,
-      0.09563872007927485941908200220413110059489050816200555095298985094370674,
-      0.09563872007927485941908200220413110059489050816200555095298985094370674,
-      0.09384439908080456563918023766811726003610007574623645005062756963556951,
-      0.09384439908080456563918023766811726003610007574623645005062756963556951,
-      0.09117387869576388471286857711163706254486141327539000532312787397770315,
-      0.09117387869576388471286857711163706254486141327539000532312787397770315,
-      0.08765209300440381114277146275180228754844972170175722231922280347470612,
-      0.08765209300440381114277146275180228754844972170175722231922280347470612,
-      0.08331192422694675522219907460434861153874688394283445984018640472875941,
-      0.08331192422694675522219907460434861153874688394283445984018640472875941,
-      0.07819389578707030647174091882830667103978679848215919030748155386949370,
-      0.07819389578707030647174091882830667103978679848215919030748155386949370,
-      0.07234579410884850622539935647848779160433698330182487073976328235117653,
-      0.07234579410884850622539935647848779160433698330182487073976328235117653,
-      0.06582222277636184683765006370693877287753644737324651537109166968524124,
-      0.06582222277636184683765006370693877287753644737324651537109166968524124,
-      0.05868409347853554714528363730017088675012046745754675871500327861328775,
-      0.05868409347853554714528363730017088675012046745754675871500327861328775,
-      0.05099805926237617619616324468952169526018477673976284370690712365250305,
-      0.05099805926237617619616324468952169526018477673976284370690712365250305,
-      0.04283589802222668065687864660612552849281085759894073956202194089110439,
-      0.04283589802222668065687864660612552849281085759894073956202194089110439,
-      0.03427386291302143310268773225237270699484020291162743378140574541923105,
-      0.03427386291302143310268773225237270699484020291162743378140574541923105,
-      0.02539206530926205945575258978922402928755404754694872093625128221921548,
-      0.02539206530926205945575258978922402928755404754694872093625128221921548,
-      0.01627439473090567060517056220638661817954296379520956642959317496133697,
-      0.01627439473090567060517056220638661817954296379520956642959317496133697,
-      0.00701861000947009660040706373885318251337722072893960323200823561921512,
-      0.00701861000947009660040706373885318251337722072893960323200823561921512
-    };
-  }
-
-  else if ( order == 33 ) {
-    quadrature_weights = {
-      0.09376844616020999656730454154634878438447336398182668128674869556807258,
-      0.09335642606559611616099912627427546495200398608863080496621924773900846,
-      0.09335642606559611616099912627427546495200398608863080496621924773900846,
-      0.09212398664331684621324097771736306072147100320398172055990358696877164,
-      0.09212398664331684621324097771736306072147100320398172055990358696877164,
-      0.09008195866063857723974370550022362118737068207949148498896103099561882,
-      0.09008195866063857723974370550022362118737068207949148498896103099561882,
-      0.08724828761884433760728167094544645656669607129390228839164452049037836,
-      0.08724828761884433760728167094544645656669607129390228839164452049037836,
-      0.08364787606703870761392801451766059742032768654582601651883280481778315,
-      0.08364787606703870761392801451766059742032768654582601651883280481778315,
-      0.07931236479488673836390838494199758808868802939229864270837630672162333,
-      0.07931236479488673836390838494199758808868802939229864270837630672162333,
-      0.07427985484395414934247217591847204671009839319625532346496716686053092,
-      0.07427985484395414934247217591847204671009839319625532346496716686053092,
-      0.06859457281865671280595507301495865248736109294038869769707091534231261,
-      0.06859457281865671280595507301495865248736109294038869769707091534231261,
-      0.06230648253031748003162772577089761142176842757931310682597253128880078,
-      0.06230648253031748003162772577089761142176842757931310682597253128880078,
-      0.05547084663166356128494449543925911042050840715022044034425696822554649,
-      0.05547084663166356128494449543925911042050840715022044034425696822554649,
-      0.04814774281871169567014688013811964974175114867696906133826921907330759,
-      0.04814774281871169567014688013811964974175114867696906133826921907330759,
-      0.04040154133166959156340979052739849616686278838265391694601391861203622,
-      0.04040154133166959156340979052739849616686278838265391694601391861203622,
-      0.03230035863232895328156144724943128806825272305067292722953161704350005,
-      0.03230035863232895328156144724943128806825272305067292722953161704350005,
-      0.02391554810174948035053325752918624206600836114451491924556293127226971,
-      0.02391554810174948035053325752918624206600836114451491924556293127226971,
-      0.01532170151293467612794576853366186675753535478075623678151001071722549,
-      0.01532170151293467612794576853366186675753535478075623678151001071722549,
-      0.00660622784758737805864923520847385503105916250321107134953287604725008,
-      0.00660622784758737805864923520847385503105916250321107134953287604725008
-    };
-  }
-
-  else if ( order == 34 ) {
-    quadrature_weights = {
-      0.09095674033025987361533760394857795992460561626025944011561256806984403,
-      0.09095674033025987361533760394857795992460561626025944011561256806984403,
-      0.09020304437064072957394224201749392884102950005063063569498612276182111,
-      0.09020304437064072957394224201749392884102950005063063569498612276182111,
-      0.08870189783569386928707645736488071274428300670380413096632052504020247,
-      0.08870189783569386928707645736488071274428300670380413096632052504020247,
-      0.08646573974703574978424685628074758031407069090181757249502276495180684,
-      0.08646573974703574978424685628074758031407069090181757249502276495180684,
-      0.08351309969984565518702022804614939058071559385754669160122886214739868,
-      0.08351309969984565518702022804614939058071559385754669160122886214739868,
-      0.07986844433977184473881883280643799355055587197219429959490047041705660,
-      0.07986844433977184473881883280643799355055587197219429959490047041705660,
-      0.07556197466003193127083397422843572405881926948134146252829336707442046,
-      0.07556197466003193127083397422843572405881926948134146252829336707442046,
-      0.07062937581425572499903879656768535500116272049090596511848655436056393,
-      0.07062937581425572499903879656768535500116272049090596511848655436056393,
-      0.06511152155407641137854443006489377358363724607281319188475173513664116,
-      0.06511152155407641137854443006489377358363724607281319188475173513664116,
-      0.05905413582752449319396097235052619082848618234650448303311109894008261,
-      0.05905413582752449319396097235052619082848618234650448303311109894008261,
-      0.05250741457267810616824597484246759965871968094696986592482249882766579,
-      0.05250741457267810616824597484246759965871968094696986592482249882766579,
-      0.04552561152335327245382256339527060299823841899631538209462227884038903,
-      0.04552561152335327245382256339527060299823841899631538209462227884038903,
-      0.03816659379638751632176592028997655882394700612666735161337668559040374,
-      0.03816659379638751632176592028997655882394700612666735161337668559040374,
-      0.03049138063844613180944238768131759103062684538958078747991213977662820,
-      0.03049138063844613180944238768131759103062684538958078747991213977662820,
-      0.02256372198549497008409408871495426124903458838818783377146845580087790,
-      0.02256372198549497008409408871495426124903458838818783377146845580087790,
-      0.01445016274859503541520221032874699068754043358465606014173403388756892,
-      0.01445016274859503541520221032874699068754043358465606014173403388756892,
-      0.00622914055590868471860646107143778612452732842980484594134983837662854,
-      0.00622914055590868471860646107143778612452732842980484594134983837662854
-    };
-  }
-
-  else if ( order == 35 ) {
-    quadrature_weights = {
-      0.08848679490710429063820738777761566918240915001060542332039305475648319,
-      0.08814053043027546297073880759309664142545431727449083717057178460222917,
-      0.08814053043027546297073880759309664142545431727449083717057178460222917,
-      0.08710444699718353424332203160554093668505671509385493140445383422179679,
-      0.08710444699718353424332203160554093668505671509385493140445383422179679,
-      0.08538665339209912522594398739111756764119098828375075112053146186876541,
-      0.08538665339209912522594398739111756764119098828375075112053146186876541,
-      0.08300059372885658837992652821617700348517450381345111995528884968722505,
-      0.08300059372885658837992652821617700348517450381345111995528884968722505,
-      0.07996494224232426293266208098504575632883549943008884738043654410797917,
-      0.07996494224232426293266208098504575632883549943008884738043654410797917,
-      0.07630345715544205353865853788422622552708008189563653436772884519687454,
-      0.07630345715544205353865853788422622552708008189563653436772884519687454,
-      0.07204479477256006466546190978527775614726739302742726056329682156206093,
-      0.07204479477256006466546190978527775614726739302742726056329682156206093,
-      0.06722228526908690396430550874814855854709311914960480846055927495170417,
-      0.06722228526908690396430550874814855854709311914960480846055927495170417,
-      0.06187367196608018888701413878868865226537122580409643507340429175296949,
-      0.06187367196608018888701413878868865226537122580409643507340429175296949,
-      0.05604081621237012857832774716510096444034853490455634554970528511503582,
-      0.05604081621237012857832774716510096444034853490455634554970528511503582,
-      0.04976937040135352980519967608499495859449495319457316369573066436191541,
-      0.04976937040135352980519967608499495859449495319457316369573066436191541,
-      0.04310842232617021878230645937490820342280658716399020871006291908060782,
-      0.04310842232617021878230645937490820342280658716399020871006291908060782,
-      0.03611011586346338053271696964754993830853577896998694316678639524243321,
-      0.03611011586346338053271696964754993830853577896998694316678639524243321,
-      0.02882926010889425404871603971448491626152772662959499974747374084211657,
-      0.02882926010889425404871603971448491626152772662959499974747374084211657,
-      0.02132297991148358088343798396620507832380964471993620726489845562559719,
-      0.02132297991148358088343798396620507832380964471993620726489845562559719,
-      0.01365082834836149226640400292051638397399403784142492099719009988256449,
-      0.01365082834836149226640400292051638397399403784142492099719009988256449,
-      0.00588343342044308497575389624011262403075431779823297371168420451988319,
-      0.00588343342044308497575389624011262403075431779823297371168420451988319
-    };
-  }
-
-  else if ( order == 36 ) {
-    quadrature_weights = {
-      0.08598327567039474749008517479052655416005491560349585229075207013342692,
-      0.08598327567039474749008517479052655416005491560349585229075207013342692,
-      0.08534668573933862749185054307648977099878658549729129412848497090336996,
-      0.08534668573933862749185054307648977099878658549729129412848497090336996,
-      0.08407821897966193493345762429159582120393591395760604550398237147861195,
-      0.08407821897966193493345762429159582120393591395760604550398237147861195,
-      0.08218726670433970951722347354494230286496307293462212098080902841424394,
-      0.08218726670433970951722347354494230286496307293462212098080902841424394,
-      0.07968782891207160190872466550186390732753415751472602018755167051098262,
-      0.07968782891207160190872466550186390732753415751472602018755167051098262,
-      0.07659841064587067452875773372150164172792755683199183378203784650532939,
-      0.07659841064587067452875773372150164172792755683199183378203784650532939,
-      0.07294188500565306135387337694127421828694695261699054440281241495508419,
-      0.07294188500565306135387337694127421828694695261699054440281241495508419,
-      0.06874532383573644261368963936361320834173076464213849122955072618565618,
-      0.06874532383573644261368963936361320834173076464213849122955072618565618,
-      0.06403979735501548955638479862585633974602147055084072492743474315731960,
-      0.06403979735501548955638479862585633974602147055084072492743474315731960,
-      0.05886014424532481730967539981892003594275409578255928924565305144275785,
-      0.05886014424532481730967539981892003594275409578255928924565305144275785,
-      0.05324471397775991909202562828621964968892961105894292068727376767106987,
-      0.05324471397775991909202562828621964968892961105894292068727376767106987,
-      0.04723508349026597841661682961667483207315178743436963026401837934791768,
-      0.04723508349026597841661682961667483207315178743436963026401837934791768,
-      0.04087575092364489547411454514326319154793706111907814620784329388909819,
-      0.04087575092364489547411454514326319154793706111907814620784329388909819,
-      0.03421381077030722992124506156271455407009691132677648352974384584449831,
-      0.03421381077030722992124506156271455407009691132677648352974384584449831,
-      0.02729862149856877909441718086798335799045682814205085535541414495848519,
-      0.02729862149856877909441718086798335799045682814205085535541414495848519,
-      0.02018151529773547153209892895822112741958651024086156525054936917401231,
-      0.02018151529773547153209892895822112741958651024086156525054936917401231,
-      0.01291594728406557440450341149779164919196121285147967185003039204362092,
-      0.01291594728406557440450341149779164919196121285147967185003039204362092,
-      0.00556571966424504536125598439054783741722459189417851017605791338451490,
-      0.00556571966424504536125598439054783741722459189417851017605791338451490
-    };
-  }
-
-  else if ( order == 37 ) {
-    quadrature_weights = {
-      0.08376836099313890479701736636945939171687528006847671922807114606603521,
-      0.08347457362586278725225300948451869902043531020302605005984610975699199,
-      0.08347457362586278725225300948451869902043531020302605005984610975699199,
-      0.08259527223643725089123030115283847077330645260203976818432580899354220,
-      0.08259527223643725089123030115283847077330645260203976818432580899354220,
-      0.08113662450846503050987760179979226356646004497462493854939450587276089,
-      0.08113662450846503050987760179979226356646004497462493854939450587276089,
-      0.07910886183752938076721218739664523851600693506418236602175058639946006,
-      0.07910886183752938076721218739664523851600693506418236602175058639946006,
-      0.07652620757052923788588799120662251549536331553154405161251461988320280,
-      0.07652620757052923788588799120662251549536331553154405161251461988320280,
-      0.07340677724848817272462663151979546498346994219764821463322177661030138,
-      0.07340677724848817272462663151979546498346994219764821463322177661030138,
-      0.06977245155570034488508135679301929118602367869775608738004010270708184,
-      0.06977245155570034488508135679301929118602367869775608738004010270708184,
-      0.06564872287275124948402376629797121819667732114972492649740086096873613,
-      0.06564872287275124948402376629797121819667732114972492649740086096873613,
-      0.06106451652322598613098810450049658567799400906236310487461042242097297,
-      0.06106451652322598613098810450049658567799400906236310487461042242097297,
-      0.05605198799827491780853923966425266642675385528776707882883525912558897,
-      0.05605198799827491780853923966425266642675385528776707882883525912558897,
-      0.05064629765482460160387586308671634405270576294535410972861539845575235,
-      0.05064629765482460160387586308671634405270576294535410972861539845575235,
-      0.04488536466243716665741030411019636019472330651441393295679996302426600,
-      0.04488536466243716665741030411019636019472330651441393295679996302426600,
-      0.03880960250193454448896237032847601996738918927368540082289450246165791,
-      0.03880960250193454448896237032847601996738918927368540082289450246165791,
-      0.03246163984752148106723425350145872879909455912252466641255207993778621,
-      0.03246163984752148106723425350145872879909455912252466641255207993778621,
-      0.02588603699055893352275948136248729802948418257510327043311049725166497,
-      0.02588603699055893352275948136248729802948418257510327043311049725166497,
-      0.01912904448908396604350194794010617413029523574621032565224674679017081,
-      0.01912904448908396604350194794010617413029523574621032565224674679017081,
-      0.01223878010030755652630485243634657594229095311126608230404168902988928,
-      0.01223878010030755652630485243634657594229095311126608230404168902988928,
-      0.00527305727949793935172205423353038918308830590652726543376349727715563,
-      0.00527305727949793935172205423353038918308830590652726543376349727715563
-    };
-  }
-
-  else if ( order == 38 ) {
-    quadrature_weights = {
-      0.08152502928038578669921876988583005560164265147049679843810259698106137,
-      0.08152502928038578669921876988583005560164265147049679843810259698106137,
-      0.08098249377059710062326946994905814193651516978408875414156602856749565,
-      0.08098249377059710062326946994905814193651516978408875414156602856749565,
-      0.07990103324352782158602768392518569655030123958968157898060370265306479,
-      0.07990103324352782158602768392518569655030123958968157898060370265306479,
-      0.07828784465821094807537540333573626256490374485784182557475124683143960,
-      0.07828784465821094807537540333573626256490374485784182557475124683143960,
-      0.07615366354844639606599354110447252799634521883255451879248372140752606,
-      0.07615366354844639606599354110447252799634521883255451879248372140752606,
-      0.07351269258474345714520644484833647857663719509243175535650230474100372,
-      0.07351269258474345714520644484833647857663719509243175535650230474100372,
-      0.07038250706689895473928296759365884083926170176246120645937901625116529,
-      0.07038250706689895473928296759365884083926170176246120645937901625116529,
-      0.06678393797914041193504615152901925995595215603527924173047658748758730,
-      0.06678393797914041193504615152901925995595215603527924173047658748758730,
-      0.06274093339213305405296967152513706432090388899690875834113004503362330,
-      0.06274093339213305405296967152513706432090388899690875834113004503362330,
-      0.05828039914699720602230586825814005591512770215855598650196942014192493,
-      0.05828039914699720602230586825814005591512770215855598650196942014192493,
-      0.05343201991033231997375699063124875607691531033875608561570336243418609,
-      0.05343201991033231997375699063124875607691531033875608561570336243418609,
-      0.04822806186075868337435217991142022418936100278527613228996817107144976,
-      0.04822806186075868337435217991142022418936100278527613228996817107144976,
-      0.04270315850467443423587843435880770867841748456815214424375531708254665,
-      0.04270315850467443423587843435880770867841748456815214424375531708254665,
-      0.03689408159402473816494016233681495034735611724058348996596961210968987,
-      0.03689408159402473816494016233681495034735611724058348996596961210968987,
-      0.03083950054517505465873108631330868892041189549719851884752109831461726,
-      0.03083950054517505465873108631330868892041189549719851884752109831461726,
-      0.02457973973823237589520120544670628744595916222720204669603507633942322,
-      0.02457973973823237589520120544670628744595916222720204669603507633942322,
-      0.01815657770961323689887612575478220226291233903979712242503785378863930,
-      0.01815657770961323689887612575478220226291233903979712242503785378863930,
-      0.01161344471646867417766830120043742735723674786011232968501070110995284,
-      0.01161344471646867417766830120043742735723674786011232968501070110995284,
-      0.00500288074963934567589954209189937046383927186262170591403413765360298,
-      0.00500288074963934567589954209189937046383927186262170591403413765360298
-    };
-  }
-
-  else if ( order == 39 ) {
-    quadrature_weights = {
-      0.07952762213944285241741819660585099384560677476586481430988476983521029,
-      0.07927622256836847101015577175450793052380414867826642470020418734083409,
-      0.07927622256836847101015577175450793052380414867826642470020418734083409,
-      0.07852361328737117672506330098552347152258147640924886094658145130790723,
-      0.07852361328737117672506330098552347152258147640924886094658145130790723,
-      0.07727455254468201672851163673311729912049525148879115093682908402332931,
-      0.07727455254468201672851163673311729912049525148879115093682908402332931,
-      0.07553693732283605770478444699080939909418797859002184433882858884203957,
-      0.07553693732283605770478444699080939909418797859002184433882858884203957,
-      0.07332175341426861738115393286504830644789342425097513077964204018007254,
-      0.07332175341426861738115393286504830644789342425097513077964204018007254,
-      0.07064300597060876077011493152813113646742968415902816927059838771359352,
-      0.07064300597060876077011493152813113646742968415902816927059838771359352,
-      0.06751763096623126536302132804644859377515270808347703580825568588593987,
-      0.06751763096623126536302132804644859377515270808347703580825568588593987,
-      0.06396538813868238898670640441006364485577691688997987973016570051693605,
-      0.06396538813868238898670640441006364485577691688997987973016570051693605,
-      0.06000873608859614957494177354881949973667822709184630434136608158175697,
-      0.06000873608859614957494177354881949973667822709184630434136608158175697,
-      0.05567269034091629990739113978968148270696094807358006843429227657495119,
-      0.05567269034091629990739113978968148270696094807358006843429227657495119,
-      0.05098466529212940521402103367658133501761308388128490529512758169200995,
-      0.05098466529212940521402103367658133501761308388128490529512758169200995,
-      0.04597430110891663188417663939923278059886169303399946391659734220538604,
-      0.04597430110891663188417663939923278059886169303399946391659734220538604,
-      0.04067327684793384393905655608226140368757243599606290477644928249830311,
-      0.04067327684793384393905655608226140368757243599606290477644928249830311,
-      0.03511511149813133076106518529723281636666148761972668562635370812961968,
-      0.03511511149813133076106518529723281636666148761972668562635370812961968,
-      0.02933495598390337859215598635625142561141146710160456530919271000521666,
-      0.02933495598390337859215598635625142561141146710160456530919271000521666,
-      0.02336938483217816459471234444292469889119755546375666589435319100349092,
-      0.02336938483217816459471234444292469889119755546375666589435319100349092,
-      0.01725622909372491904080547118335504721371590189046231536119328911844040,
-      0.01725622909372491904080547118335504721371590189046231536119328911844040,
-      0.01103478893916459424267680545217728945350713937311815593936799764960656,
-      0.01103478893916459424267680545217728945350713937311815593936799764960656,
-      0.00475294469163510137077621315490694198569508454183706143965902881296120,
-      0.00475294469163510137077621315490694198569508454183706143965902881296120
-    };
-  }
-
-  else if ( order == 40 ) {
-    quadrature_weights = {
-      0.07750594797842481126372396295832632696366865278810643573295427385407213,
-      0.07750594797842481126372396295832632696366865278810643573295427385407213,
-      0.07703981816424796558830753428381024852443975416394041548918089243254164,
-      0.07703981816424796558830753428381024852443975416394041548918089243254164,
-      0.07611036190062624237155807592249482301255955384507110705418245902929924,
-      0.07611036190062624237155807592249482301255955384507110705418245902929924,
-      0.07472316905796826420018933626132467319120293442035982173134089141765340,
-      0.07472316905796826420018933626132467319120293442035982173134089141765340,
-      0.07288658239580405906051068344251783585755908098579863047625481683299056,
-      0.07288658239580405906051068344251783585755908098579863047625481683299056,
-      0.07061164739128677969548363085528683235955910399558609731068426896266370,
-      0.07061164739128677969548363085528683235955910399558609731068426896266370,
-      0.06791204581523390382569010823192398598419723837928595471789620359304078,
-      0.06791204581523390382569010823192398598419723837928595471789620359304078,
-      0.06480401345660103807455452956675273003269296420848890636319524427128397,
-      0.06480401345660103807455452956675273003269296420848890636319524427128397,
-      0.06130624249292893916653799640839859590259376351117432198689763868686816,
-      0.06130624249292893916653799640839859590259376351117432198689763868686816,
-      0.05743976909939155136661773091042598560010483585445362650668126692554836,
-      0.05743976909939155136661773091042598560010483585445362650668126692554836,
-      0.05322784698393682435499647977226050455532117182200645076436088052652082,
-      0.05322784698393682435499647977226050455532117182200645076436088052652082,
-      0.04869580763507223206143416044814638806784302737711977514064605127517843,
-      0.04869580763507223206143416044814638806784302737711977514064605127517843,
-      0.04387090818567327199167468604171549581100683717023688975852590864980179,
-      0.04387090818567327199167468604171549581100683717023688975852590864980179,
-      0.03878216797447201763997203129044616225345921123202585783726688891953873,
-      0.03878216797447201763997203129044616225345921123202585783726688891953873,
-      0.03346019528254784739267818308641084897724178665376435041319117669905240,
-      0.03346019528254784739267818308641084897724178665376435041319117669905240,
-      0.02793700698002340109848915750772107730255086205076639844808591645037490,
-      0.02793700698002340109848915750772107730255086205076639844808591645037490,
-      0.02224584919416695726150432418420857320703319667935442788073424000569131,
-      0.02224584919416695726150432418420857320703319667935442788073424000569131,
-      0.01642105838190788871286348488236392729234229334695776197190391551359044,
-      0.01642105838190788871286348488236392729234229334695776197190391551359044,
-      0.01049828453115281361474217106727965237679262131579677971567512361162530,
-      0.01049828453115281361474217106727965237679262131579677971567512361162530,
-      0.00452127709853319125847173287818533272783111019970599070034194234266395,
-      0.00452127709853319125847173287818533272783111019970599070034194234266395
-    };
-  }
-
-  else if ( order == 41 ) {
-    quadrature_weights = {
-      0.07569553564729837231877996107636025589111888139523123313254945373964097,
-      0.07547874709271582402724706267461674907360636090306277622973473798794224,
-      0.07547874709271582402724706267461674907360636090306277622973473798794224,
-      0.07482962317622155189130507263350532294568306737803071757806924416758782,
-      0.07482962317622155189130507263350532294568306737803071757806924416758782,
-      0.07375188202722346993928081832484867947791628042833964273801417984402688,
-      0.07375188202722346993928081832484867947791628042833964273801417984402688,
-      0.07225169686102307339634639834878735488529477052487254889842838027176476,
-      0.07225169686102307339634639834878735488529477052487254889842838027176476,
-      0.07033766062081749748165898996988145600123338016781027972433402304191554,
-      0.07033766062081749748165898996988145600123338016781027972433402304191554,
-      0.06802073676087676673553323972624892825669912013859416544939224714973294,
-      0.06802073676087676673553323972624892825669912013859416544939224714973294,
-      0.06531419645352741043616371265379634041985923672106812634137161043887827,
-      0.06531419645352741043616371265379634041985923672106812634137161043887827,
-      0.06223354258096631647157341708334648543015986994494342937317276510694374,
-      0.06223354258096631647157341708334648543015986994494342937317276510694374,
-      0.05879642094987194499118585338073427400088123860272694086523171272306998,
-      0.05879642094987194499118585338073427400088123860272694086523171272306998,
-      0.05502251924257874188014681017142226997377533660536959050205790787740028,
-      0.05502251924257874188014681017142226997377533660536959050205790787740028,
-      0.05093345429461749478117035711568863142080344678687032877581547425250855,
-      0.05093345429461749478117035711568863142080344678687032877581547425250855,
-      0.04655264836901434206075658686461142313099019858059018502054911073676186,
-      0.04655264836901434206075658686461142313099019858059018502054911073676186,
-      0.04190519519590968942934027431104883793626637743202238325255031708089979,
-      0.04190519519590968942934027431104883793626637743202238325255031708089979,
-      0.03701771670350798843526125158016066860627154632186754277922743555190648,
-      0.03701771670350798843526125158016066860627154632186754277922743555190648,
-      0.03191821173169928178706694685714554370118775329751101256557527610068154,
-      0.03191821173169928178706694685714554370118775329751101256557527610068154,
-      0.02663589920711044546754857525871327704469049200524813802906015007591532,
-      0.02663589920711044546754857525871327704469049200524813802906015007591532,
-      0.02120106336877955307569703349337662657171705432735830818583652084483505,
-      0.02120106336877955307569703349337662657171705432735830818583652084483505,
-      0.01564493840781858853082684447953367744081788936964635635197204297247322,
-      0.01564493840781858853082684447953367744081788936964635635197204297247322,
-      0.00999993877390594533849629662969883955022493577115020595166121219105502,
-      0.00999993877390594533849629662969883955022493577115020595166121219105502,
-      0.00430614035816488768400447790465448618636220399530170482167092471388021,
-      0.00430614035816488768400447790465448618636220399530170482167092471388021
-    };
-  }
-
-  else if ( order == 42 ) {
-    quadrature_weights = {
-      0.07386423423217287999638556114979141312847052050207090807397170278873049,
-      0.07386423423217287999638556114979141312847052050207090807397170278873049,
-      0.07346081345346752826402825705430393873365578345040523936275210130068436,
-      0.07346081345346752826402825705430393873365578345040523936275210130068436,
-      0.07265617524380410488790576149253303127678368396842722999573047387551125,
-      0.07265617524380410488790576149253303127678368396842722999573047387551125,
-      0.07145471426517098292181044411746215502258986387750371863264046414803710,
-      0.07145471426517098292181044411746215502258986387750371863264046414803710,
-      0.06986299249259415976615478638148220444392731304743209370753105712777818,
-      0.06986299249259415976615478638148220444392731304743209370753105712777818,
-      0.06788970337652194485536340221376630726613473465859319786989871232618132,
-      0.06788970337652194485536340221376630726613473465859319786989871232618132,
-      0.06554562436490897892700510785179442560978229408579308233164828946689449,
-      0.06554562436490897892700510785179442560978229408579308233164828946689449,
-      0.06284355804500257640931825132377988915279704392188973871878697143795195,
-      0.06284355804500257640931825132377988915279704392188973871878697143795195,
-      0.05979826222758665431283154575353485150985341869594390945323300836553634,
-      0.05979826222758665431283154575353485150985341869594390945323300836553634,
-      0.05642636935801838164642685513969568939887315857628850742288088345478246,
-      0.05642636935801838164642685513969568939887315857628850742288088345478246,
-      0.05274629569917407034394253904409747703156598782718611962174047259984234,
-      0.05274629569917407034394253904409747703156598782718611962174047259984234,
-      0.04877814079280324502744936312840272392111769693422690303101223652526448,
-      0.04877814079280324502744936312840272392111769693422690303101223652526448,
-      0.04454357777196587787431636598523424131859546603712758124526016367570478,
-      0.04454357777196587787431636598523424131859546603712758124526016367570478,
-      0.04006573518069226176059612483003693455373370186574561509922719978202689,
-      0.04006573518069226176059612483003693455373370186574561509922719978202689,
-      0.03536907109759211083266218112650754190574852178064145007283220372013970,
-      0.03536907109759211083266218112650754190574852178064145007283220372013970,
-      0.03047924069960346836290473352339239779176965424440089482364391641498459,
-      0.03047924069960346836290473352339239779176965424440089482364391641498459,
-      0.02542295952611304788674244290943086438613541037397895486118189690745360,
-      0.02542295952611304788674244290943086438613541037397895486118189690745360,
-      0.02022786956905264475705571907935418508267142655242209621165358092674144,
-      0.02022786956905264475705571907935418508267142655242209621165358092674144,
-      0.01492244369735749414467767810586576762009274749010789659465733447011190,
-      0.01492244369735749414467767810586576762009274749010789659465733447011190,
-      0.00953622030174850241182010029269799818868479873501257251186520364280319,
-      0.00953622030174850241182010029269799818868479873501257251186520364280319,
-      0.00410599860464908461060277949683596265701677337480229035785212704283915,
-      0.00410599860464908461060277949683596265701677337480229035785212704283915
-    };
-  }
-
-  else if ( order == 43 ) {
-    quadrature_weights = {
-      0.07221575169379898797746233171373688014707069052525034897015534688844060,
-      0.07202750197142197434530755167085708775350424594741470164484497387259599,
-      0.07202750197142197434530755167085708775350424594741470164484497387259599,
-      0.07146373425251414129758111770291024858090001936779567323931861212031975,
-      0.07146373425251414129758111770291024858090001936779567323931861212031975,
-      0.07052738776508502812628635547794074318373616678496415006778588216945921,
-      0.07052738776508502812628635547794074318373616678496415006778588216945921,
-      0.06922334419365668428229947912263514780930498957092782381957157848661869,
-      0.06922334419365668428229947912263514780930498957092782381957157848661869,
-      0.06755840222936516919240790475626559214294629258572960827354579253449867,
-      0.06755840222936516919240790475626559214294629258572960827354579253449867,
-      0.06554124212632279749123376424920783022496253377845482632252950681319924,
-      0.06554124212632279749123376424920783022496253377845482632252950681319924,
-      0.06318238044939611232562981777340826425669623463946884668037323809631300,
-      0.06318238044939611232562981777340826425669623463946884668037323809631300,
-      0.06049411524999129451967874199136279335850887987042858743121812453829042,
-      0.06049411524999129451967874199136279335850887987042858743121812453829042,
-      0.05749046195691051942760891684441651192786886819456543268923113959603172,
-      0.05749046195691051942760891684441651192786886819456543268923113959603172,
-      0.05418708031888178686337317832626541358839055267071128470353816551726490,
-      0.05418708031888178686337317832626541358839055267071128470353816551726490,
-      0.05060119278439015652385039895301474574989800909801219097384428437740183,
-      0.05060119278439015652385039895301474574989800909801219097384428437740183,
-      0.04675149475434658001064676633710293393286309593566385684419173805218697,
-      0.04675149475434658001064676633710293393286309593566385684419173805218697,
-      0.04265805719798208376380720533851389410494709123676725067333932903369501,
-      0.04265805719798208376380720533851389410494709123676725067333932903369501,
-      0.03834222219413265757212842466284911488007256286839717552085984890685832,
-      0.03834222219413265757212842466284911488007256286839717552085984890685832,
-      0.03382649208686029234496847575380209105330161064713236692120216893114583,
-      0.03382649208686029234496847575380209105330161064713236692120216893114583,
-      0.02913441326149849491594042482578119378755056984019203195997054141962823,
-      0.02913441326149849491594042482578119378755056984019203195997054141962823,
-      0.02429045661383881590201832425424924845523703933581213749868522167959554,
-      0.02429045661383881590201832425424924845523703933581213749868522167959554,
-      0.01931990142368390039612461089207135231702355908825696855523372443515824,
-      0.01931990142368390039612461089207135231702355908825696855523372443515824,
-      0.01424875643157648610854160172200419357207399314416233527423287907996924,
-      0.01424875643157648610854160172200419357207399314416233527423287907996924,
-      0.00910399663740140331886860829589672381301797555982670407706283368224966,
-      0.00910399663740140331886860829589672381301797555982670407706283368224966,
-      0.00391949025384412728296716519257643543366036457269087234434274321329924,
-      0.00391949025384412728296716519257643543366036457269087234434274321329924
-    };
-  }
-
-  else if ( order == 44 ) {
-    quadrature_weights = {
-      0.07054915778935406881133828748029988499106342550892364479074143262602088,
-      0.07054915778935406881133828748029988499106342550892364479074143262602088,
-      0.07019768547355821258714204194439938766882668621562845793333283870825390,
-      0.07019768547355821258714204194439938766882668621562845793333283870825390,
-      0.06949649186157257803708409092501125678209347538117422736004197705577861,
-      0.06949649186157257803708409092501125678209347538117422736004197705577861,
-      0.06844907026936666098545866070434987244515554363590004089829438754294689,
-      0.06844907026936666098545866070434987244515554363590004089829438754294689,
-      0.06706063890629365239570491935171935078071301307276156795675110186196903,
-      0.06706063890629365239570491935171935078071301307276156795675110186196903,
-      0.06533811487918143498424089484562218949601080112967692858353400960418482,
-      0.06533811487918143498424089484562218949601080112967692858353400960418482,
-      0.06329007973320385495013887101971493063802428824409418544374398504192041,
-      0.06329007973320385495013887101971493063802428824409418544374398504192041,
-      0.06092673670156196803855783687437410067257248948165011222929579423587486,
-      0.06092673670156196803855783687437410067257248948165011222929579423587486,
-      0.05825985987759549533421068984427716800475616910335356735469657387338029,
-      0.05825985987759549533421068984427716800475616910335356735469657387338029,
-      0.05530273556372805254874663264315299147153484641761776010149357199983233,
-      0.05530273556372805254874663264315299147153484641761776010149357199983233,
-      0.05207009609170446188123180299319875105626417474111692655863906810455175,
-      0.05207009609170446188123180299319875105626417474111692655863906810455175,
-      0.04857804644835203752763943669129273761505139910682467592574384978788409,
-      0.04857804644835203752763943669129273761505139910682467592574384978788409,
-      0.04484398408197003144624318640305110718096302165573399969031007896976075,
-      0.04484398408197003144624318640305110718096302165573399969031007896976075,
-      0.04088651231034621890844716928306848685407928902670259604243284296206535,
-      0.04088651231034621890844716928306848685407928902670259604243284296206535,
-      0.03672534781380887364290929234870179971070878799974687289110922507468071,
-      0.03672534781380887364290929234870179971070878799974687289110922507468071,
-      0.03238122281206982088084693954011160114694805178002942050692477366761675,
-      0.03238122281206982088084693954011160114694805178002942050692477366761675,
-      0.02787578282128101008111429177938706432205883989299034864474913459283563,
-      0.02787578282128101008111429177938706432205883989299034864474913459283563,
-      0.02323148190201921062895826293873141748822190203565799718221613623938914,
-      0.02323148190201921062895826293873141748822190203565799718221613623938914,
-      0.01847148173681474917204222374339984411552073831390187733490476456489099,
-      0.01847148173681474917204222374339984411552073831390187733490476456489099,
-      0.01361958675557998552020506639006137887326671975487072331107636510578370,
-      0.01361958675557998552020506639006137887326671975487072331107636510578370,
-      0.00870048136752484412256562342431314020846842115836189609337444898274293,
-      0.00870048136752484412256562342431314020846842115836189609337444898274293,
-      0.00374540480311277751517377883176153847769791634328217316659363939763619,
-      0.00374540480311277751517377883176153847769791634328217316659363939763619
-    };
-  }
-
-  else if ( order == 45 ) {
-    quadrature_weights = {
-      0.06904182482923202011079855515940474072332289227500477807714605016099802,
-      0.06887731697766132288200284829805578888452413011064854515874106838508300,
-      0.06887731697766132288200284829805578888452413011064854515874106838508300,
-      0.06838457737866967453169209933431609707348491305464494638088944561495321,
-      0.06838457737866967453169209933431609707348491305464494638088944561495321,
-      0.06756595416360753627091022387364863097947258092394646199345358731424360,
-      0.06756595416360753627091022387364863097947258092394646199345358731424360,
-      0.06642534844984252808291471563910373761317454675067481595603892552331090,
-      0.06642534844984252808291471563910373761317454675067481595603892552331090,
-      0.06496819575072343085382657035907569508384972548758327305202375499135275,
-      0.06496819575072343085382657035907569508384972548758327305202375499135275,
-      0.06320144007381993774996373029066688186630023727582281702085863359414505,
-      0.06320144007381993774996373029066688186630023727582281702085863359414505,
-      0.06113350083106652250188637053632557326012423426524212007350864262577336,
-      0.06113350083106652250188637053632557326012423426524212007350864262577336,
-      0.05877423271884173857436151763183142253126572546098020811657592611954254,
-      0.05877423271884173857436151763183142253126572546098020811657592611954254,
-      0.05613487875978647664392394037486976324148018494616301580044509125307116,
-      0.05613487875978647664392394037486976324148018494616301580044509125307116,
-      0.05322801673126895194590404401931040379848221694017551596604825362168980,
-      0.05322801673126895194590404401931040379848221694017551596604825362168980,
-      0.05006749923795202979913210247487431739149869293514643723048218857431636,
-      0.05006749923795202979913210247487431739149869293514643723048218857431636,
-      0.04666838771837336526776847574165410120498614148785358251276678547986296,
-      0.04666838771837336526776847574165410120498614148785358251276678547986296,
-      0.04304688070916497115169111308116694178831923616319132015431680713677642,
-      0.04304688070916497115169111308116694178831923616319132015431680713677642,
-      0.03922023672930244756418718534392933821813012459630666980722787151688068,
-      0.03922023672930244756418718534392933821813012459630666980722787151688068,
-      0.03520669220160901624769979826157509081008807471271464134077435327527104,
-      0.03520669220160901624769979826157509081008807471271464134077435327527104,
-      0.03102537493451546716250793889376806388592115212397480044185417175054066,
-      0.03102537493451546716250793889376806388592115212397480044185417175054066,
-      0.02669621396757766480567477879310752778782491056589152356853644981431207,
-      0.02669621396757766480567477879310752778782491056589152356853644981431207,
-      0.02223984755057873239395075855216899334487570870129997071960988624487377,
-      0.02223984755057873239395075855216899334487570870129997071960988624487377,
-      0.01767753525793759061709254666957708852065127812646578801736417339579142,
-      0.01767753525793759061709254666957708852065127812646578801736417339579142,
-      0.01303110499158278432063108246968692602714117158263899114091066650151719,
-      0.01303110499158278432063108246968692602714117158263899114091066650151719,
-      0.00832318929621824164573585312223385375615793129294822189495647921585574,
-      0.00832318929621824164573585312223385375615793129294822189495647921585574,
-      0.00358266315528355893114302865935139257058563635818394461404381297033728,
-      0.00358266315528355893114302865935139257058563635818394461404381297033728
-    };
-  }
-
-  else if ( order == 46 ) {
-    quadrature_weights = {
-      0.06751868584903645882021418916430108021214826953981825514516993548710416,
-      0.06751868584903645882021418916430108021214826953981825514516993548710416,
-      0.06721061360067817586237415482709759617653968116564520215977612294592253,
-      0.06721061360067817586237415482709759617653968116564520215977612294592253,
-      0.06659587476845488737576196642273370194436370880099210926975104209929120,
-      0.06659587476845488737576196642273370194436370880099210926975104209929120,
-      0.06567727426778120737875756568555576762171613977381171548143142168437550,
-      0.06567727426778120737875756568555576762171613977381171548143142168437550,
-      0.06445900346713906958827943910825506392379564504501849249747919895739187,
-      0.06445900346713906958827943910825506392379564504501849249747919895739187,
-      0.06294662106439450817895195224711093123324616503178622087107980536943922,
-      0.06294662106439450817895195224711093123324616503178622087107980536943922,
-      0.06114702772465048101535660790419103777278163285785360762773974364720188,
-      0.06114702772465048101535660790419103777278163285785360762773974364720188,
-      0.05906843459554631480755072263690773709821694849223029677199640494868415,
-      0.05906843459554631480755072263690773709821694849223029677199640494868415,
-      0.05672032584399123581687440360328671458642702260911475474112192488846714,
-      0.05672032584399123581687440360328671458642702260911475474112192488846714,
-      0.05411341538585675449163764325922307525989746904113506623787225204015913,
-      0.05411341538585675449163764325922307525989746904113506623787225204015913,
-      0.05125959800714302133536529937144803346418150162653053249563800282758403,
-      0.05125959800714302133536529937144803346418150162653053249563800282758403,
-      0.04817189510171220053046886322322093668197549236746216916742177807882374,
-      0.04817189510171220053046886322322093668197549236746216916742177807882374,
-      0.04486439527731812676709461356277485644228670051842517837723850911023577,
-      0.04486439527731812676709461356277485644228670051842517837723850911023577,
-      0.04135219010967872970422017587023147842420622411377262615230355615738415,
-      0.04135219010967872970422017587023147842420622411377262615230355615738415,
-      0.03765130535738607132766079922845911702695511945426067196254619570465670,
-      0.03765130535738607132766079922845911702695511945426067196254619570465670,
-      0.03377862799910689652060389388114532872779948047520031100216741307296773,
-      0.03377862799910689652060389388114532872779948047520031100216741307296773,
-      0.02975182955220275579905172923572293709302875381894886748899444344708495,
-      0.02975182955220275579905172923572293709302875381894886748899444344708495,
-      0.02558928639713001063469951220034402810287956073861699395379774315363457,
-      0.02558928639713001063469951220034402810287956073861699395379774315363457,
-      0.02130999875413650105447936107087840182884377652052401639497607872415278,
-      0.02130999875413650105447936107087840182884377652052401639497607872415278,
-      0.01693351400783623804623071367176043133372644382569415108576281432292440,
-      0.01693351400783623804623071367176043133372644382569415108576281432292440,
-      0.01247988377098868420673457175098337517752254738535089049100929689966282,
-      0.01247988377098868420673457175098337517752254738535089049100929689966282,
-      0.00796989822972462245161303892632496542628877099259653938039749999797563,
-      0.00796989822972462245161303892632496542628877099259653938039749999797563,
-      0.00343030086810704828601878314804340444117294580521133124432881643487595,
-      0.00343030086810704828601878314804340444117294580521133124432881643487595
-    };
-  }
-
-  else if ( order == 47 ) {
-    quadrature_weights = {
-      0.06613512962365547965344035433105497119536045271793124056642871984638833,
-      0.06599053358881047453357065533049825957735827762650299788915344028102368,
-      0.06599053358881047453357065533049825957735827762650299788915344028102368,
-      0.06555737776654974025114300232607591228199989080873359789579123902971592,
-      0.06555737776654974025114300232607591228199989080873359789579123902971592,
-      0.06483755623894572670260393911080601888499475260182831880342450596300125,
-      0.06483755623894572670260393911080601888499475260182831880342450596300125,
-      0.06383421660571703063129377985581353348233634369068597255588050322806703,
-      0.06383421660571703063129377985581353348233634369068597255588050322806703,
-      0.06255174622092166264056438144995353675341584345846042531837212695154761,
-      0.06255174622092166264056438144995353675341584345846042531837212695154761,
-      0.06099575300873964533071057813343752118109320430201587679892184540974463,
-      0.06099575300873964533071057813343752118109320430201587679892184540974463,
-      0.05917304094233887597615455638574129246383235149307405047070878600757854,
-      0.05917304094233887597615455638574129246383235149307405047070878600757854,
-      0.05709158029323154022201660530838277291032942596524699678941695340613384,
-      0.05709158029323154022201660530838277291032942596524699678941695340613384,
-      0.05476047278153022595712517688850480590379536634850721295827930604882259,
-      0.05476047278153022595712517688850480590379536634850721295827930604882259,
-      0.05218991178005714487221194170967607772173497996203217667008315714483520,
-      0.05218991178005714487221194170967607772173497996203217667008315714483520,
-      0.04939113774736116960457048586200492311999402379049431699982593392768124,
-      0.04939113774736116960457048586200492311999402379049431699982593392768124,
-      0.04637638908650591120440184824274509254869604526289591051847374824003012,
-      0.04637638908650591120440184824274509254869604526289591051847374824003012,
-      0.04315884864847953826830179344650313954771937778244714170333993345855227,
-      0.04315884864847953826830179344650313954771937778244714170333993345855227,
-      0.03975258612253100378090138014196101659164946881568305925953844571623373,
-      0.03975258612253100378090138014196101659164946881568305925953844571623373,
-      0.03617249658417495161345992976631124867344528220138057243663375572397796,
-      0.03617249658417495161345992976631124867344528220138057243663375572397796,
-      0.03243423551518475676761746317417015869308868087328658991804612443930359,
-      0.03243423551518475676761746317417015869308868087328658991804612443930359,
-      0.02855415070064338650473992462581108160687521783269186835774632624401929,
-      0.02855415070064338650473992462581108160687521783269186835774632624401929,
-      0.02454921165965881853783415715250576713766315216483130989338686699617436,
-      0.02454921165965881853783415715250576713766315216483130989338686699617436,
-      0.02043693814766842764203476068625538642723104902415690370321229082323509,
-      0.02043693814766842764203476068625538642723104902415690370321229082323509,
-      0.01623533314643305967072568740789862101589291904397500672547888233888681,
-      0.01623533314643305967072568740789862101589291904397500672547888233888681,
-      0.01196284846431232096394345484994851252339290836246802253233640356129955,
-      0.01196284846431232096394345484994851252339290836246802253233640356129955,
-      0.00763861629584883361410435677113165550442058982256510535804317064617837,
-      0.00763861629584883361410435677113165550442058982256510535804317064617837,
-      0.00328745384252801488324996420833617985136062240707094616069189449076317,
-      0.00328745384252801488324996420833617985136062240707094616069189449076317
-    };
-  }
-
-  else if ( order == 48 ) {
-    quadrature_weights = {
-      0.06473769681268392250302493873659155355208191894663651001456309552308308,
-      0.06473769681268392250302493873659155355208191894663651001456309552308308,
-      0.06446616443595008220650419365770506572569192445553030876055845653739235,
-      0.06446616443595008220650419365770506572569192445553030876055845653739235,
-      0.06392423858464818662390620182551540891897408498264299989087420749955378,
-      0.06392423858464818662390620182551540891897408498264299989087420749955378,
-      0.06311419228625402565712602275023331812741364337110079121114724790803812,
-      0.06311419228625402565712602275023331812741364337110079121114724790803812,
-      0.06203942315989266390419778413759851830638339966509146156903781450273904,
-      0.06203942315989266390419778413759851830638339966509146156903781450273904,
-      0.06070443916589388005296923202782047788526086425647775511151144466063789,
-      0.06070443916589388005296923202782047788526086425647775511151144466063789,
-      0.05911483969839563574647481743351991065965560255705499855629113348583514,
-      0.05911483969839563574647481743351991065965560255705499855629113348583514,
-      0.05727729210040321570515023468470057624152712300411207753884993747681745,
-      0.05727729210040321570515023468470057624152712300411207753884993747681745,
-      0.05519950369998416286820349519163543900445092560756100054805625793058524,
-      0.05519950369998416286820349519163543900445092560756100054805625793058524,
-      0.05289018948519366709550505626469891466172648563310918638649123384829276,
-      0.05289018948519366709550505626469891466172648563310918638649123384829276,
-      0.05035903555385447495780761908786560603299409302590633069379205724693441,
-      0.05035903555385447495780761908786560603299409302590633069379205724693441,
-      0.04761665849249047482590662347892983015799806674344968539676989627880989,
-      0.04761665849249047482590662347892983015799806674344968539676989627880989,
-      0.04467456085669428041944858712585039498846278686250200843292144633919149,
-      0.04467456085669428041944858712585039498846278686250200843292144633919149,
-      0.04154508294346474921405882236106479775347282603403806308273482122272583,
-      0.04154508294346474921405882236106479775347282603403806308273482122272583,
-      0.03824135106583070631721725652371561786382396835498228892925819103405054,
-      0.03824135106583070631721725652371561786382396835498228892925819103405054,
-      0.03477722256477043889254858596380241059728139690706809871800663617967672,
-      0.03477722256477043889254858596380241059728139690706809871800663617967672,
-      0.03116722783279808890206575684635441945428534148356953550954371886143141,
-      0.03116722783279808890206575684635441945428534148356953550954371886143141,
-      0.02742650970835694820007383626250582045118415516165097599728093749937650,
-      0.02742650970835694820007383626250582045118415516165097599728093749937650,
-      0.02357076083932437914051930137844923022172973852218859873423906486456506,
-      0.02357076083932437914051930137844923022172973852218859873423906486456506,
-      0.01961616045735552781446071965221270969581303773413223918112083050740925,
-      0.01961616045735552781446071965221270969581303773413223918112083050740925,
-      0.01557931572294384872817695583446031397637626899155246951309343105269243,
-      0.01557931572294384872817695583446031397637626899155246951309343105269243,
-      0.01147723457923453948959266760909162808642050630874764065376681674103504,
-      0.01147723457923453948959266760909162808642050630874764065376681674103504,
-      0.00732755390127626210238397962178655005870790255920135327488182954880698,
-      0.00732755390127626210238397962178655005870790255920135327488182954880698,
-      0.00315334605230583863267731154389148757828393883169362229520949325031959,
-      0.00315334605230583863267731154389148757828393883169362229520949325031959
-    };
-  }
-
-  else if ( order == 49 ) {
-    quadrature_weights = {
-      0.06346328140479059771825346787952963499962952230825221918577749709540971,
-      0.06333550929649174859083692740009052014797141656482582044731117607574844,
-      0.06333550929649174859083692740009052014797141656482582044731117607574844,
-      0.06295270746519569947439955578289100636372542776957004137230575183762572,
-      0.06295270746519569947439955578289100636372542776957004137230575183762572,
-      0.06231641732005726740107682521594970422413353622132083384423851912547607,
-      0.06231641732005726740107682521594970422413353622132083384423851912547607,
-      0.06142920097919293629682664614030107494319000919209793372105041005294553,
-      0.06142920097919293629682664614030107494319000919209793372105041005294553,
-      0.06029463095315201730310611687554159049777650891972548781495204583168153,
-      0.06029463095315201730310611687554159049777650891972548781495204583168153,
-      0.05891727576002726602452765074249251626249611385947945979416544168624078,
-      0.05891727576002726602452765074249251626249611385947945979416544168624078,
-      0.05730268153018747548516459235081653635058043880311968159066044315620183,
-      0.05730268153018747548516459235081653635058043880311968159066044315620183,
-      0.05545734967480358869043158148269806720425152407379438375832397303490421,
-      0.05545734967480358869043158148269806720425152407379438375832397303490421,
-      0.05338871070825896852794293373017620616558606944822720942216824895397361,
-      0.05338871070825896852794293373017620616558606944822720942216824895397361,
-      0.05110509433014459067462280604931856138961244932974338891455793740664447,
-      0.05110509433014459067462280604931856138961244932974338891455793740664447,
-      0.04861569588782824027765119728786853088136892861859307263924063514609524,
-      0.04861569588782824027765119728786853088136892861859307263924063514609524,
-      0.04593053935559585354249961997212767100882432235462340867676276848035008,
-      0.04593053935559585354249961997212767100882432235462340867676276848035008,
-      0.04306043698125959798834548400103849580671358123982176010434847450816205,
-      0.04306043698125959798834548400103849580671358123982176010434847450816205,
-      0.04001694576637302136860503674310332142786460746500146849349349445026552,
-      0.04001694576637302136860503674310332142786460746500146849349349445026552,
-      0.03681232096300068981946723669888229500136155240598295693885910098531120,
-      0.03681232096300068981946723669888229500136155240598295693885910098531120,
-      0.03345946679162217434248715089168920184947986786022845559378921866639077,
-      0.03345946679162217434248715089168920184947986786022845559378921866639077,
-      0.02997188462058382535069055807414721006207203595087682892055574360266735,
-      0.02997188462058382535069055807414721006207203595087682892055574360266735,
-      0.02636361892706601696094574523974204769446097176574050822775245491359286,
-      0.02636361892706601696094574523974204769446097176574050822775245491359286,
-      0.02264920158744667649877096421604288732679749902326477597624388874547094,
-      0.02264920158744667649877096421604288732679749902326477597624388874547094,
-      0.01884359585308945844445065339110734926774990201925228031145954277187979,
-      0.01884359585308945844445065339110734926774990201925228031145954277187979,
-      0.01496214493562465102958431912020150403628101637276727864603814712394542,
-      0.01496214493562465102958431912020150403628101637276727864603814712394542,
-      0.01102055103159358049750828816683333275219356054495774496238045272607110,
-      0.01102055103159358049750828816683333275219356054495774496238045272607110,
-      0.00703509959008645147345067831134841086286385703902733685121839711947315,
-      0.00703509959008645147345067831134841086286385703902733685121839711947315,
-      0.00302727898892290507748069817582714097283004200383177338523498505117749,
-      0.00302727898892290507748069817582714097283004200383177338523498505117749
-    };
-  }
-
-  else if ( order == 50 ) {
-    quadrature_weights = {
-      0.06217661665534726232103310736061343086768246920102663310116563761975761,
-      0.06217661665534726232103310736061343086768246920102663310116563761975761,
-      0.06193606742068324338408750978083068857287705669124490494275970611695482,
-      0.06193606742068324338408750978083068857287705669124490494275970611695482,
-      0.06145589959031666375640678608391537509726757576400751430922405035905911,
-      0.06145589959031666375640678608391537509726757576400751430922405035905911,
-      0.06073797084177021603175001538481100160979927323540353572319677456175958,
-      0.06073797084177021603175001538481100160979927323540353572319677456175958,
-      0.05978505870426545750957640531258523079666604207266900458524197880361922,
-      0.05978505870426545750957640531258523079666604207266900458524197880361922,
-      0.05860084981322244583512243663084846620976751344402547331325034247535448,
-      0.05860084981322244583512243663084846620976751344402547331325034247535448,
-      0.05718992564772838372302931506599316301157537225709175493685378135280493,
-      0.05718992564772838372302931506599316301157537225709175493685378135280493,
-      0.05555774480621251762356742561226949759513529998390267581717277851031855,
-      0.05555774480621251762356742561226949759513529998390267581717277851031855,
-      0.05371062188899624652345879725566455276802321352992215304589999918159652,
-      0.05371062188899624652345879725566455276802321352992215304589999918159652,
-      0.05165570306958113848990529584009527964982544939543964509953318645119218,
-      0.05165570306958113848990529584009527964982544939543964509953318645119218,
-      0.04940093844946631492124358075143272869228705096661312479212356024806985,
-      0.04940093844946631492124358075143272869228705096661312479212356024806985,
-      0.04695505130394843296563301363498768251406430618605272996580427934336506,
-      0.04695505130394843296563301363498768251406430618605272996580427934336506,
-      0.04432750433880327549202228683039419746076129835545316566323190682762273,
-      0.04432750433880327549202228683039419746076129835545316566323190682762273,
-      0.04152846309014769742241197896406701780897797548584099007703697795218528,
-      0.04152846309014769742241197896406701780897797548584099007703697795218528,
-      0.03856875661258767524477015023638593486477170500051892651080740015226675,
-      0.03856875661258767524477015023638593486477170500051892651080740015226675,
-      0.03545983561514615416073461100097579709696000049698447091287045085997117,
-      0.03545983561514615416073461100097579709696000049698447091287045085997117,
-      0.03221372822357801664816582732300395344858905883342521715832960541591130,
-      0.03221372822357801664816582732300395344858905883342521715832960541591130,
-      0.02884299358053519802990637311323243251784686559353745783571262305626533,
-      0.02884299358053519802990637311323243251784686559353745783571262305626533,
-      0.02536067357001239044019487838544272346016125997571213733939633295203776,
-      0.02536067357001239044019487838544272346016125997571213733939633295203776,
-      0.02178024317012479298159206906269034122731346235793429604402713944767083,
-      0.02178024317012479298159206906269034122731346235793429604402713944767083,
-      0.01811556071348939035125994342235461984466731704973403542645291587336229,
-      0.01811556071348939035125994342235461984466731704973403542645291587336229,
-      0.01438082276148557441937890892732434993703178617058789277210162215425174,
-      0.01438082276148557441937890892732434993703178617058789277210162215425174,
-      0.01059054838365096926356968149924102233940181908645912945633471714564916,
-      0.01059054838365096926356968149924102233940181908645912945633471714564916,
-      0.00675979919574540150277887817798503180187383240646681055287870585540300,
-      0.00675979919574540150277887817798503180187383240646681055287870585540300,
-      0.00290862255315514095840072434285548080667299645994632061859352728355077,
-      0.00290862255315514095840072434285548080667299645994632061859352728355077
-    };
-  }
-
-  else if ( order == 51 ) {
-    quadrature_weights = {
-      0.06099892484120588015979764309835605055712180152657844981331939359420387,
-      0.06088546484485634388119861422269621972807601028027365238002650290988038,
-      0.06088546484485634388119861422269621972807601028027365238002650290988038,
-      0.06054550693473779513812525146775416275368493437724097338782809100159316,
-      0.06054550693473779513812525146775416275368493437724097338782809100159316,
-      0.05998031577750325209006398799651711617306209554543300357033930307502457,
-      0.05998031577750325209006398799651711617306209554543300357033930307502457,
-      0.05919199392296154378353900774915460887093004603607117948184737093364014,
-      0.05919199392296154378353900774915460887093004603607117948184737093364014,
-      0.05818347398259214059843787766177593266780125764454458260422124493329750,
-      0.05818347398259214059843787766177593266780125764454458260422124493329750,
-      0.05695850772025866210007772673427716487840945032509279446545634266060768,
-      0.05695850772025866210007772673427716487840945032509279446545634266060768,
-      0.05552165209573869301673705909362416078086370541559638841304120999499752,
-      0.05552165209573869301673705909362416078086370541559638841304120999499752,
-      0.05387825231304556143409930169697198376005996774044533168072578604858693,
-      0.05387825231304556143409930169697198376005996774044533168072578604858693,
-      0.05203442193669708756413644746866237321548397471438220298709979379203826,
-      0.05203442193669708756413644746866237321548397471438220298709979379203826,
-      0.04999702015005740977954885536200578556873674938598670749131350575671287,
-      0.04999702015005740977954885536200578556873674938598670749131350575671287,
-      0.04777362624062310199999535370735361734053928047565788767739010836644397,
-      0.04777362624062310199999535370735361734053928047565788767739010836644397,
-      0.04537251140765006874816681498843785131382995671950964358704561190531300,
-      0.04537251140765006874816681498843785131382995671950964358704561190531300,
-      0.04280260799788008665360951424428570083717527402185207761513652063130118,
-      0.04280260799788008665360951424428570083717527402185207761513652063130118,
-      0.04007347628549645318680911592139591120116433102873524205105922524479599,
-      0.04007347628549645318680911592139591120116433102873524205105922524479599,
-      0.03719526892326029284290827581187102513411271037373731002613080499925731,
-      0.03719526892326029284290827581187102513411271037373731002613080499925731,
-      0.03417869320418833623620933859476752904882586358309770474514690332880245,
-      0.03417869320418833623620933859476752904882586358309770474514690332880245,
-      0.03103497129016000845442550295654737729610897816621751289774925456962435,
-      0.03103497129016000845442550295654737729610897816621751289774925456962435,
-      0.02777579859416247719599566563220891636835124864853783957696764020261338,
-      0.02777579859416247719599566563220891636835124864853783957696764020261338,
-      0.02441330057378143427314156541689820874368317047202818414742999942270097,
-      0.02441330057378143427314156541689820874368317047202818414742999942270097,
-      0.02095998840170321057979261840151417207304048518843009609646063386271994,
-      0.02095998840170321057979261840151417207304048518843009609646063386271994,
-      0.01742871472340105225950364643329243556835677829361894028635421620807247,
-      0.01742871472340105225950364643329243556835677829361894028635421620807247,
-      0.01383263400647782229668845302185641595601855207657203854868743591716610,
-      0.01383263400647782229668845302185641595601855207657203854868743591716610,
-      0.01018519129782172993923759178660672838581163608421210042111508522888862,
-      0.01018519129782172993923759178660672838581163608421210042111508522888862,
-      0.00650033778325260029210937519853752883309494300542583878500699911081910,
-      0.00650033778325260029210937519853752883309494300542583878500699911081910,
-      0.00279680717108989557554421688180904822421769963401154216976071309800023,
-      0.00279680717108989557554421688180904822421769963401154216976071309800023
-    };
-  }
-
-  else if ( order == 52 ) {
-    quadrature_weights = {
-      0.05981036574529186024778537881147746094448080363041406293257631474944096,
-      0.05981036574529186024778537881147746094448080363041406293257631474944096,
-      0.05959626017124815825831087874841495366227728038194191553858078112162012,
-      0.05959626017124815825831087874841495366227728038194191553858078112162012,
-      0.05916881546604297036933200239487097832541705221759787978651135245990749,
-      0.05916881546604297036933200239487097832541705221759787978651135245990749,
-      0.05852956177181386855029059897162369363806873274232559883732177028495582,
-      0.05852956177181386855029059897162369363806873274232559883732177028495582,
-      0.05768078745252682765393199766340351953943983505133758448624815317493644,
-      0.05768078745252682765393199766340351953943983505133758448624815317493644,
-      0.05662553090236859719080824047837015056722007281471467622398864982654081,
-      0.05662553090236859719080824047837015056722007281471467622398864982654081,
-      0.05536756966930265254904109345121858229015400325104202341311441181128317,
-      0.05536756966930265254904109345121858229015400325104202341311441181128317,
-      0.05391140693275726475083682489379995957660124695930512588481830015599989,
-      0.05391140693275726475083682489379995957660124695930512588481830015599989,
-      0.05226225538390699303439414442639214370819907808586698487735716805149770,
-      0.05226225538390699303439414442639214370819907808586698487735716805149770,
-      0.05042601856634237721821125408285875446257795876553979698868379894233930,
-      0.05042601856634237721821125408285875446257795876553979698868379894233930,
-      0.04840926974407489685396024928604627800974952172846339728480275627682889,
-      0.04840926974407489685396024928604627800974952172846339728480275627682889,
-      0.04621922837278479350764570533528463922390102162642284050803176581601516,
-      0.04621922837278479350764570533528463922390102162642284050803176581601516,
-      0.04386373425900040799512966557876445016416066653020481599622463392413786,
-      0.04386373425900040799512966557876445016416066653020481599622463392413786,
-      0.04135121950056027167904028642395516293826996931546422766745989246093808,
-      0.04135121950056027167904028642395516293826996931546422766745989246093808,
-      0.03869067831042397898510120674035264692807826599356458606496817232984652,
-      0.03869067831042397898510120674035264692807826599356458606496817232984652,
-      0.03589163483509723294194239328528073878533850306517263626939429118364043,
-      0.03589163483509723294194239328528073878533850306517263626939429118364043,
-      0.03296410908971879791501004477869519617672739257458434880039661383079678,
-      0.03296410908971879791501004477869519617672739257458434880039661383079678,
-      0.02991858114714394664128206873997088793212331551058751748347937246274934,
-      0.02991858114714394664128206873997088793212331551058751748347937246274934,
-      0.02676595374650401344949308028601837885526188449905828725703099643785110,
-      0.02676595374650401344949308028601837885526188449905828725703099643785110,
-      0.02351751355398446159032251991005460942922912900298550122542924911287104,
-      0.02351751355398446159032251991005460942922912900298550122542924911287104,
-      0.02018489150798079220298903420947823723671246708480782019070531530228049,
-      0.02018489150798079220298903420947823723671246708480782019070531530228049,
-      0.01678002339630073567792153687052016208341580916381851600713990987262948,
-      0.01678002339630073567792153687052016208341580916381851600713990987262948,
-      0.01331511498234096065660034447779914855467649973330439121966134743071179,
-      0.01331511498234096065660034447779914855467649973330439121966134743071179,
-      0.00980263457946275206195116811668950232783841185727930527350477273583852,
-      0.00980263457946275206195116811668950232783841185727930527350477273583852,
-      0.00625552396297327689971610216981454661641170465313125936379966235304381,
-      0.00625552396297327689971610216981454661641170465313125936379966235304381,
-      0.00269131695004711111895217986884521802366937376106490041877054789129900,
-      0.00269131695004711111895217986884521802366937376106490041877054789129900
-    };
-  }
-
-  else if ( order == 53 ) {
-    quadrature_weights = {
-      0.05871879415116436452548694444213412627499371709785266226244771814835431,
-      0.05861758623272026331807193704998894153459948066227698693032819683831926,
-      0.05861758623272026331807193704998894153459948066227698693032819683831926,
-      0.05831431136225600755627575633769725605207995124425473567259895075446619,
-      0.05831431136225600755627575633769725605207995124425473567259895075446619,
-      0.05781001499171319631968307609725206286002901123847586495932138471780213,
-      0.05781001499171319631968307609725206286002901123847586495932138471780213,
-      0.05710643553626719177338333929841884133883449542461306172958758742439743,
-      0.05710643553626719177338333929841884133883449542461306172958758742439743,
-      0.05620599838173970980865506209144499375145722517480364181215319614488340,
-      0.05620599838173970980865506209144499375145722517480364181215319614488340,
-      0.05511180752393359900234970476586738755141248848982662206673135645153434,
-      0.05511180752393359900234970476586738755141248848982662206673135645153434,
-      0.05382763486873102904208144163540267431281019967891202025726594002035927,
-      0.05382763486873102904208144163540267431281019967891202025726594002035927,
-      0.05235790722987271819970152098936070445441970869721568363755381371609439,
-      0.05235790722987271819970152098936070445441970869721568363755381371609439,
-      0.05070769106929271529648548263453053759999037333659381474070476069716211,
-      0.05070769106929271529648548263453053759999037333659381474070476069716211,
-      0.04888267503269914042044840758358408340658451464626829287555946352368855,
-      0.04888267503269914042044840758358408340658451464626829287555946352368855,
-      0.04688915034075031402187263956510494786582553583330362615045061555831821,
-      0.04688915034075031402187263956510494786582553583330362615045061555831821,
-      0.04473398910367281021276564591856360613760188371714790084185652290504831,
-      0.04473398910367281021276564591856360613760188371714790084185652290504831,
-      0.04242462063452001359228163756845039880656420797542300726849716531273374,
-      0.04242462063452001359228163756845039880656420797542300726849716531273374,
-      0.03996900584354038212709354578786362591900846337496486547030883453879807,
-      0.03996900584354038212709354578786362591900846337496486547030883453879807,
-      0.03737560980348291567417197278539422220984809437251855855145276888409983,
-      0.03737560980348291567417197278539422220984809437251855855145276888409983,
-      0.03465337258353423795838772051301071357131793543058093603374128825215722,
-      0.03465337258353423795838772051301071357131793543058093603374128825215722,
-      0.03181167845901932306323586203108092026068007008704328444619058208232642,
-      0.03181167845901932306323586203108092026068007008704328444619058208232642,
-      0.02886032361782373626279955304358326186266920628984852731581098132080263,
-      0.02886032361782373626279955304358326186266920628984852731581098132080263,
-      0.02580948251075751771396188816662944090375041844226550362291877373001380,
-      0.02580948251075751771396188816662944090375041844226550362291877373001380,
-      0.02266967305707020839878927523982780946824880780511678449638206089763785,
-      0.02266967305707020839878927523982780946824880780511678449638206089763785,
-      0.01945172110763689538804692222749694041944736471649366710797346223480058,
-      0.01945172110763689538804692222749694041944736471649366710797346223480058,
-      0.01616672525668746392806082840403990143773473139701918047313914819020532,
-      0.01616672525668746392806082840403990143773473139701918047313914819020532,
-      0.01282602614424037917915018296920373176816400873455310424661834272329319,
-      0.01282602614424037917915018296920373176816400873455310424661834272329319,
-      0.00944120228494034438666217882032514328370781491404681092733733718535537,
-      0.00944120228494034438666217882032514328370781491404681092733733718535537,
-      0.00602427622694867328124170681629985910095415207448441755891710644047360,
-      0.00602427622694867328124170681629985910095415207448441755891710644047360,
-      0.00259168372056703181159923943851093098476299769302276967537650038105163,
-      0.00259168372056703181159923943851093098476299769302276967537650038105163
-    };
-  }
-
-  else if ( order == 54 ) {
-    quadrature_weights = {
-      0.05761753670714702467237612880587147717290174472156057228594420626657967,
-      0.05761753670714702467237612880587147717290174472156057228594420626657967,
-      0.05742613705411211485929013177320682938921905705042538570966884420096481,
-      0.05742613705411211485929013177320682938921905705042538570966884420096481,
-      0.05704397355879459856782843425422721209921173621254635390334358990632843,
-      0.05704397355879459856782843425422721209921173621254635390334358990632843,
-      0.05647231573062596503104426468176124795373736212708364234163537062593114,
-      0.05647231573062596503104426468176124795373736212708364234163537062593114,
-      0.05571306256058998768336981742737111068471171711579847786963342747259737,
-      0.05571306256058998768336981742737111068471171711579847786963342747259737,
-      0.05476873621305798630622263471710902072462106656235504863586619578526997,
-      0.05476873621305798630622263471710902072462106656235504863586619578526997,
-      0.05364247364755361127210062772524657686281585960856543988832153223709867,
-      0.05364247364755361127210062772524657686281585960856543988832153223709867,
-      0.05233801619829874466558869475268501318043176697346810288183734923161872,
-      0.05233801619829874466558869475268501318043176697346810288183734923161872,
-      0.05085969714618814431970920697611874591206026538933171477183219325915578,
-      0.05085969714618814431970920697611874591206026538933171477183219325915578,
-      0.04921242732452888606879063036881162807750411298006268163463860651131751,
-      0.04921242732452888606879063036881162807750411298006268163463860651131751,
-      0.04740167880644499105857641011532360363820658898325060882003138912059444,
-      0.04740167880644499105857641011532360363820658898325060882003138912059444,
-      0.04543346672827671397485218075154457153377563901767108151466001311347287,
-      0.04543346672827671397485218075154457153377563901767108151466001311347287,
-      0.04331432930959701544192576037050811819628912404384968865020927949557863,
-      0.04331432930959701544192576037050811819628912404384968865020927949557863,
-      0.04105130613664497422171821087760433419378279744645468875461778782507117,
-      0.04105130613664497422171821087760433419378279744645468875461778782507117,
-      0.03865191478210251683685713905157987623901150935572855403726863251289616,
-      0.03865191478210251683685713905157987623901150935572855403726863251289616,
-      0.03612412584038355258288707420742484597857307993016732988915664349545930,
-      0.03612412584038355258288707420742484597857307993016732988915664349545930,
-      0.03347633646437264571604044483561079271487860742368377296433716762007134,
-      0.03347633646437264571604044483561079271487860742368377296433716762007134,
-      0.03071734249787067605400460991615491101996221207716046549032900324522575,
-      0.03071734249787067605400460991615491101996221207716046549032900324522575,
-      0.02785630931059587028700203476391515123730993562574269655501326421308208,
-      0.02785630931059587028700203476391515123730993562574269655501326421308208,
-      0.02490274146720877305005497127338904257562313287912336035346538542175832,
-      0.02490274146720877305005497127338904257562313287912336035346538542175832,
-      0.02186645142285308594551042653887930098157031656297244206788430667228368,
-      0.02186645142285308594551042653887930098157031656297244206788430667228368,
-      0.01875752762146937791200798428407116268863557474271134279795529856369913,
-      0.01875752762146937791200798428407116268863557474271134279795529856369913,
-      0.01558630303592413170296890970583676546858782235763989620131667134487859,
-      0.01558630303592413170296890970583676546858782235763989620131667134487859,
-      0.01236332812884764416646782426018809646399449894843369304205698366895804,
-      0.01236332812884764416646782426018809646399449894843369304205698366895804,
-      0.00909936945550939694803352106241926172187472240798218020754111730835186,
-      0.00909936945550939694803352106241926172187472240798218020754111730835186,
-      0.00580561101523998487882588774587527341152465198940366678933914155464418,
-      0.00580561101523998487882588774587527341152465198940366678933914155464418,
-      0.00249748183576158577594603875726602987918509746682711194209659932711243,
-      0.00249748183576158577594603875726602987918509746682711194209659932711243
-    };
-  }
-
-  else if ( order == 55 ) {
-    quadrature_weights = {
-      0.05660297644456042544010576198124400403896915010159945889497439541176898,
-      0.05651231824977200140065836763518905413968818315825191562404359576561677,
-      0.05651231824977200140065836763518905413968818315825191562404359576561677,
-      0.05624063407108436802827908809019782727606125971386301467351620853765777,
-      0.05624063407108436802827908809019782727606125971386301467351620853765777,
-      0.05578879419528408710293600710991971467246753538858332235647954503977109,
-      0.05578879419528408710293600710991971467246753538858332235647954503977109,
-      0.05515824600250868759665113956066672143253063739720572710871928797674335,
-      0.05515824600250868759665113956066672143253063739720572710871928797674335,
-      0.05435100932991110207032211815377214880581330910869009512811475750820091,
-      0.05435100932991110207032211815377214880581330910869009512811475750820091,
-      0.05336967000160547272357051563609785372700006314668285835364021748550072,
-      0.05336967000160547272357051563609785372700006314668285835364021748550072,
-      0.05221737154563208456439356328129500996674208580535087948031549273269866,
-      0.05221737154563208456439356328129500996674208580535087948031549273269866,
-      0.05089780512449397922477527428808343882168554091467107377669294467870265,
-      0.05089780512449397922477527428808343882168554091467107377669294467870265,
-      0.04941519771155173948075853901603927568188155532831528744410563292139029,
-      0.04941519771155173948075853901603927568188155532831528744410563292139029,
-      0.04777429855120069555003671471605592563381830714428823679782248112982642,
-      0.04777429855120069555003671471605592563381830714428823679782248112982642,
-      0.04598036394628383810390486087207466812211115409086204050193821902510970,
-      0.04598036394628383810390486087207466812211115409086204050193821902510970,
-      0.04403914042160658989516808565329287313462904494529047512893953712297578,
-      0.04403914042160658989516808565329287313462904494529047512893953712297578,
-      0.04195684631771876239520731669214412257656635822077835229273424789883447,
-      0.04195684631771876239520731669214412257656635822077835229273424789883447,
-      0.03974015187433717960946383190339983586802685138168597880792989033879793,
-      0.03974015187433717960946383190339983586802685138168597880792989033879793,
-      0.03739615786796554528291559858245754951510340150392099097402662484817202,
-      0.03739615786796554528291559858245754951510340150392099097402662484817202,
-      0.03493237287358988740726822680270648797428746128966276201367537046896181,
-      0.03493237287358988740726822680270648797428746128966276201367537046896181,
-      0.03235668922618583168470559187577686575766839503119350412479536583413783,
-      0.03235668922618583168470559187577686575766839503119350412479536583413783,
-      0.02967735776516104122129650618688536022985864059432973507430640749894869,
-      0.02967735776516104122129650618688536022985864059432973507430640749894869,
-      0.02690296145639627066712002865377909714337666113268002073542511747689528,
-      0.02690296145639627066712002865377909714337666113268002073542511747689528,
-      0.02404238800972562200779157292860345849924615056183080909277455050661017,
-      0.02404238800972562200779157292860345849924615056183080909277455050661017,
-      0.02110480166801645412020930562369833448093437406191705141817264263051741,
-      0.02110480166801645412020930562369833448093437406191705141817264263051741,
-      0.01809961452072906240796820264341223040277849453755297213222489679666912,
-      0.01809961452072906240796820264341223040277849453755297213222489679666912,
-      0.01503645833351178821315089890193728171182224949953581758215770257414126,
-      0.01503645833351178821315089890193728171182224949953581758215770257414126,
-      0.01192516071984861217075255315758988829264034744798894921441742270636432,
-      0.01192516071984861217075255315758988829264034744798894921441742270636432,
-      0.00877574610705852817738960068331783816445644076069593519617199132366699,
-      0.00877574610705852817738960068331783816445644076069593519617199132366699,
-      0.00559863226656076735408341687185985724515129524166675999706187433702123,
-      0.00559863226656076735408341687185985724515129524166675999706187433702123,
-      0.00240832361997978881917019348912527870416962754170570552231077713018288,
-      0.00240832361997978881917019348912527870416962754170570552231077713018288
-    };
-  }
-
-  else if ( order == 56 ) {
-    quadrature_weights = {
-      0.05557974630651439584627342683516117014406662255634295900417220875365757,
-      0.05557974630651439584627342683516117014406662255634295900417220875365757,
-      0.05540795250324512321779339184391001890956203138066301799579294868838796,
-      0.05540795250324512321779339184391001890956203138066301799579294868838796,
-      0.05506489590176242579630459754785032534135551280065901257751427186576637,
-      0.05506489590176242579630459754785032534135551280065901257751427186576637,
-      0.05455163687088942106175065489009017994406072378091635263215900515518769,
-      0.05455163687088942106175065489009017994406072378091635263215900515518769,
-      0.05386976186571448570895441040669799424792453567188824744844644930517314,
-      0.05386976186571448570895441040669799424792453567188824744844644930517314,
-      0.05302137852401076396799155860769146872738143408102400654960592957146809,
-      0.05302137852401076396799155860769146872738143408102400654960592957146809,
-      0.05200910915174139984305226482748472167053258531290135838776782023347393,
-      0.05200910915174139984305226482748472167053258531290135838776782023347393,
-      0.05083608261779848056012401847019865598299163793208421551375660902813689,
-      0.05083608261779848056012401847019865598299163793208421551375660902813689,
-      0.04950592468304757891996604643084555641871884907131799595682924113468048,
-      0.04950592468304757891996604643084555641871884907131799595682924113468048,
-      0.04802274679360025812073550566699971214401687677002427010031478823220854,
-      0.04802274679360025812073550566699971214401687677002427010031478823220854,
-      0.04639113337300189676219019106649603423460980610050049030557563163824913,
-      0.04639113337300189676219019106649603423460980610050049030557563163824913,
-      0.04461612765269228321341519292762374032584643841629670422564705254998945,
-      0.04461612765269228321341519292762374032584643841629670422564705254998945,
-      0.04270321608466708651103857236247708089347094596661757489041502918688311,
-      0.04270321608466708651103857236247708089347094596661757489041502918688311,
-      0.04065831138474451788012502277885276307554227304905272231839991774347583,
-      0.04065831138474451788012502277885276307554227304905272231839991774347583,
-      0.03848773425924766248682559162338127934381963468148201326099569683990080,
-      0.03848773425924766248682559162338127934381963468148201326099569683990080,
-      0.03619819387231518603588446828888624540063023467231421692084602665646780,
-      0.03619819387231518603588446828888624540063023467231421692084602665646780,
-      0.03379676711561176129542663122544704981760707167826714515412135920214319,
-      0.03379676711561176129542663122544704981760707167826714515412135920214319,
-      0.03129087674731044786783547779302534697784601318722771661424612065909786,
-      0.03129087674731044786783547779302534697784601318722771661424612065909786,
-      0.02868826847382274172988588443039427260413413704684522936686237448179409,
-      0.02868826847382274172988588443039427260413413704684522936686237448179409,
-      0.02599698705839195219181943220727235144801025205069435937331709245680726,
-      0.02599698705839195219181943220727235144801025205069435937331709245680726,
-      0.02322535156256531693725815757678852655572201982457900443380382771045252,
-      0.02322535156256531693725815757678852655572201982457900443380382771045252,
-      0.02038192988240257263480598366693334750711946439861200845022642425448198,
-      0.02038192988240257263480598366693334750711946439861200845022642425448198,
-      0.01747551291140094650495936890545715023078028057687649000660827930110062,
-      0.01747551291140094650495936890545715023078028057687649000660827930110062,
-      0.01451508927802147180777074053301299102409619849924425759019071493895799,
-      0.01451508927802147180777074053301299102409619849924425759019071493895799,
-      0.01150982434038338217377275932449711927485590481796914358535504066772954,
-      0.01150982434038338217377275932449711927485590481796914358535504066772954,
-      0.00846906316330788766162711237500816017607748757412691594893727036234005,
-      0.00846906316330788766162711237500816017607748757412691594893727036234005,
-      0.00540252224601533776131126094412087284162781818411397735758557792943458,
-      0.00540252224601533776131126094412087284162781818411397735758557792943458,
-      0.00232385537577321550110227644339586473759320991735859403050729145255354,
-      0.00232385537577321550110227644339586473759320991735859403050729145255354
-    };
-  }
-
-  else if ( order == 57 ) {
-    quadrature_weights = {
-      0.05463432875658402406284138798805207653622876414854290646187740966799247,
-      0.05455280360476188648013899536419651447601534822950253908594385002828643,
-      0.05455280360476188648013899536419651447601534822950253908594385002828643,
-      0.05430847145249864313874677295479156026337757612847777236257665487125484,
-      0.05430847145249864313874677295479156026337757612847777236257665487125484,
-      0.05390206148329857464280948173060145348662767458734071680956549901265619,
-      0.05390206148329857464280948173060145348662767458734071680956549901265619,
-      0.05333478658481915842657697799144062509594704623784393728224997430378570,
-      0.05333478658481915842657697799144062509594704623784393728224997430378570,
-      0.05260833972917743244023138164088418962525591642898259276857039772259059,
-      0.05260833972917743244023138164088418962525591642898259276857039772259059,
-      0.05172488892051782472062390866514698062586927648945425530305851454895094,
-      0.05172488892051782472062390866514698062586927648945425530305851454895094,
-      0.05068707072492740865664042556363657955310479871164995364866106771432984,
-      0.05068707072492740865664042556363657955310479871164995364866106771432984,
-      0.04949798240201967899383794449938792626467289607625868535088436991370345,
-      0.04949798240201967899383794449938792626467289607625868535088436991370345,
-      0.04816117266168775126885105175681673671624285431952997775093367719818216,
-      0.04816117266168775126885105175681673671624285431952997775093367719818216,
-      0.04668063107364150378384089277883357088305499652429297785818413672688200,
-      0.04668063107364150378384089277883357088305499652429297785818413672688200,
-      0.04506077616138115779721352952583297035411133664160267419485298209316888,
-      0.04506077616138115779721352952583297035411133664160267419485298209316888,
-      0.04330644221621519659643210832842612570436465134272580841839197899323189,
-      0.04330644221621519659643210832842612570436465134272580841839197899323189,
-      0.04142286487080111036319690527361043096013511409120154192027098366315577,
-      0.04142286487080111036319690527361043096013511409120154192027098366315577,
-      0.03941566547548011408995272080105550425081517273229457310300034571486597,
-      0.03941566547548011408995272080105550425081517273229457310300034571486597,
-      0.03729083432441731735473526399569896555396987240876805637712711352847729,
-      0.03729083432441731735473526399569896555396987240876805637712711352847729,
-      0.03505471278231261750575097059655006445690125567594090182504225398873138,
-      0.03505471278231261750575097059655006445690125567594090182504225398873138,
-      0.03271397436637156854249010991039349828457476863893067106633468048310271,
-      0.03271397436637156854249010991039349828457476863893067106633468048310271,
-      0.03027560484269399945849059883313721118511845450533766815261805094124224,
-      0.03027560484269399945849059883313721118511845450533766815261805094124224,
-      0.02774688140218019232125795003836375916962084631599526178804628663172975,
-      0.02774688140218019232125795003836375916962084631599526178804628663172975,
-      0.02513535099091812264727378814095548797588091260733460529191558699557253,
-      0.02513535099091812264727378814095548797588091260733460529191558699557253,
-      0.02244880789077643807968923884509088043879620196066273172890977743278717,
-      0.02244880789077643807968923884509088043879620196066273172890977743278717,
-      0.01969527069948852038242245227351485842469704057783950121444114944314285,
-      0.01969527069948852038242245227351485842469704057783950121444114944314285,
-      0.01688295902344154903500082156683327644630596502000044040784924462421883,
-      0.01688295902344154903500082156683327644630596502000044040784924462421883,
-      0.01402027079075355617024715133815025132282684822381284561086045151881263,
-      0.01402027079075355617024715133815025132282684822381284561086045151881263,
-      0.01111576373233599014567544876819003913959043336317862208061157763521781,
-      0.01111576373233599014567544876819003913959043336317862208061157763521781,
-      0.00817816006782123262621099813037940186470942609118705155594958031752640,
-      0.00817816006782123262621099813037940186470942609118705155594958031752640,
-      0.00521653347471877939050662987142008532303141539042764462067331870142347,
-      0.00521653347471877939050662987142008532303141539042764462067331870142347,
-      0.00224375387225066290973478682263501388626751860515453919153779041897407,
-      0.00224375387225066290973478682263501388626751860515453919153779041897407
-    };
-  }
-
-  else if ( order == 58 ) {
-    quadrature_weights = {
-      0.05368111986333484886390595530572461290068199200236194362665462773657470,
-      0.05368111986333484886390595530572461290068199200236194362665462773657470,
-      0.05352634330405825210061081388617018054196748949032392150172316983782372,
-      0.05352634330405825210061081388617018054196748949032392150172316983782372,
-      0.05321723644657901410348098437738479321245792330452184508928871710075898,
-      0.05321723644657901410348098437738479321245792330452184508928871710075898,
-      0.05275469052637083342964576723152317176493359291733747981399214644883951,
-      0.05275469052637083342964576723152317176493359291733747981399214644883951,
-      0.05214003918366981897126055606007182576102169013424334435791077209112682,
-      0.05214003918366981897126055606007182576102169013424334435791077209112682,
-      0.05137505461828572547451482061106538030295810809562320193466052870404921,
-      0.05137505461828572547451482061106538030295810809562320193466052870404921,
-      0.05046194247995312529765982156763177804748796636254514957804189971032262,
-      0.05046194247995312529765982156763177804748796636254514957804189971032262,
-      0.04940333550896239286651086571270131965064442266936116841764727520013401,
-      0.04940333550896239286651086571270131965064442266936116841764727520013401,
-      0.04820228594541774840657040610986690657503071362684686259635555762567868,
-      0.04820228594541774840657040610986690657503071362684686259635555762567868,
-      0.04686225672902634691841807803792003485091361097497449454375913079567662,
-      0.04686225672902634691841807803792003485091361097497449454375913079567662,
-      0.04538711151481980250398053608886604914916176864495213521148254008578308,
-      0.04538711151481980250398053608886604914916176864495213521148254008578308,
-      0.04378110353364025103902569234833607324275611766009737826160540483654613,
-      0.04378110353364025103902569234833607324275611766009737826160540483654613,
-      0.04204886332958212599456998191725423146226654023551906034594302298644131,
-      0.04204886332958212599456998191725423146226654023551906034594302298644131,
-      0.04019538540986779688807675082688229235791404022070778443566244178491630,
-      0.04019538540986779688807675082688229235791404022070778443566244178491630,
-      0.03822601384585843322945903445714854006594276398631915647282201867928806,
-      0.03822601384585843322945903445714854006594276398631915647282201867928806,
-      0.03614642686708727054078085697585522723334279129912698339317710840393446,
-      0.03614642686708727054078085697585522723334279129912698339317710840393446,
-      0.03396262049341601079772755518458479943878377639496480055482245188802654,
-      0.03396262049341601079772755518458479943878377639496480055482245188802654,
-      0.03168089125380932732029203962195029668728616452408798732590671787818813,
-      0.03168089125380932732029203962195029668728616452408798732590671787818813,
-      0.02930781804416049071839402688844381003496160137195318956252433229639968,
-      0.02930781804416049071839402688844381003496160137195318956252433229639968,
-      0.02685024318198186847590747867814495559102746465718600657699644688996396,
-      0.02685024318198186847590747867814495559102746465718600657699644688996396,
-      0.02431525272496395254025876062579850974429118651343630588732727641043339,
-      0.02431525272496395254025876062579850974429118651343630588732727641043339,
-      0.02171015614014623576691680949511828992260293407795033703387559773210580,
-      0.02171015614014623576691680949511828992260293407795033703387559773210580,
-      0.01904246546189340865578765948210760393336413293429666221711805451060692,
-      0.01904246546189340865578765948210760393336413293429666221711805451060692,
-      0.01631987423497096505212083041957088748218161052776906015277321400104756,
-      0.01631987423497096505212083041957088748218161052776906015277321400104756,
-      0.01355023711298881214517896640176186183083085318298650165770473127320321,
-      0.01355023711298881214517896640176186183083085318298650165770473127320321,
-      0.01074155353287877411685636191366187372356745001774165828140272137456217,
-      0.01074155353287877411685636191366187372356745001774165828140272137456217,
-      0.00790197384999867475401674567484775950725497451144570022674691420286447,
-      0.00790197384999867475401674567484775950725497451144570022674691420286447,
-      0.00503998161265024308501750117462242355333087943674126261830570679883068,
-      0.00503998161265024308501750117462242355333087943674126261830570679883068,
-      0.00216772324962744994305434292498451143103544022457861832376947271587330,
-      0.00216772324962744994305434292498451143103544022457861832376947271587330
-    };
-  }
-
-  else if ( order == 59 ) {
-    quadrature_weights = {
-      0.05279801262199042141551233243085526729901567440267116843945866306323662,
-      0.05272443385912793196130424887061250287188393750354426697922463948134981,
-      0.05272443385912793196130424887061250287188393750354426697922463948134981,
-      0.05250390264782873905094132201428846536078805848590753052765879020086029,
-      0.05250390264782873905094132201428846536078805848590753052765879020086029,
-      0.05213703364837539138398720830781823387459757987948494976002117346359846,
-      0.05213703364837539138398720830781823387459757987948494976002117346359846,
-      0.05162484939089148214643993977342280859376433774926873706711294734947173,
-      0.05162484939089148214643993977342280859376433774926873706711294734947173,
-      0.05096877742539391685024796899368101009830960978521198926021032331843842,
-      0.05096877742539391685024796899368101009830960978521198926021032331843842,
-      0.05017064634299690281072043044216568214384410571586829528659023598082587,
-      0.05017064634299690281072043044216568214384410571586829528659023598082587,
-      0.04923268067936198577969362001502418838286303587052332727190008485690078,
-      0.04923268067936198577969362001502418838286303587052332727190008485690078,
-      0.04815749471460644038814682928593578396046421872100791110787804417939258,
-      0.04815749471460644038814682928593578396046421872100791110787804417939258,
-      0.04694808518696201919315973648292895223854591747457069802697773745029243,
-      0.04694808518696201919315973648292895223854591747457069802697773745029243,
-      0.04560782294050976983186821315837421141799445972046155764707960177841196,
-      0.04560782294050976983186821315837421141799445972046155764707960177841196,
-      0.04414044353029738069079808473308096858918633266813071768477789710091845,
-      0.04414044353029738069079808473308096858918633266813071768477789710091845,
-      0.04255003681106763866730820048471312744572341334593283115326469575744861,
-      0.04255003681106763866730820048471312744572341334593283115326469575744861,
-      0.04084103553868670766020210808946930868600647590289364049170995470651687,
-      0.04084103553868670766020210808946930868600647590289364049170995470651687,
-      0.03901820301616000950303077721128551341909183793902441697052228259677149,
-      0.03901820301616000950303077721128551341909183793902441697052228259677149,
-      0.03708661981887092269183791703527735827894996394913449146838873374150925,
-      0.03708661981887092269183791703527735827894996394913449146838873374150925,
-      0.03505166963640010878371835896107825111672508118785725456908097468488728,
-      0.03505166963640010878371835896107825111672508118785725456908097468488728,
-      0.03291902427104527775751126435359880808026987655740782528157857869419671,
-      0.03291902427104527775751126435359880808026987655740782528157857869419671,
-      0.03069462783611168323975032819248080535952674800582832962043088276608069,
-      0.03069462783611168323975032819248080535952674800582832962043088276608069,
-      0.02838468020053479790515286933538849877031418376304233583921527631813746,
-      0.02838468020053479790515286933538849877031418376304233583921527631813746,
-      0.02599561973129850018665050680170793271398480973161802306740029754371251,
-      0.02599561973129850018665050680170793271398480973161802306740029754371251,
-      0.02353410539371336342527536007835770029878448503836891520253640093649900,
-      0.02353410539371336342527536007835770029878448503836891520253640093649900,
-      0.02100699828843718735046147321866926505068902778651109394073411038484584,
-      0.02100699828843718735046147321866926505068902778651109394073411038484584,
-      0.01842134275361002936061575105644531831052684871711224009635800424184110,
-      0.01842134275361002936061575105644531831052684871711224009635800424184110,
-      0.01578434731308146614732048039724917037307255386895795190627822188798141,
-      0.01578434731308146614732048039724917037307255386895795190627822188798141,
-      0.01310336630634519101831954648421696696556483923400709095569502566198997,
-      0.01310336630634519101831954648421696696556483923400709095569502566198997,
-      0.01038588550099586219379787441098304036744482914933800613387746267015635,
-      0.01038588550099586219379787441098304036744482914933800613387746267015635,
-      0.00763952945348757514270068297475436525755164120840651149662826727137997,
-      0.00763952945348757514270068297475436525755164120840651149662826727137997,
-      0.00487223916826528476858200113292406855604266062886634061255898083989778,
-      0.00487223916826528476858200113292406855604266062886634061255898083989778,
-      0.00209549228454122340270073148864005976798129321037713635458104260406861,
-      0.00209549228454122340270073148864005976798129321037713635458104260406861
-    };
-  }
-
-  else if ( order == 60 ) {
-    quadrature_weights = {
-      0.05190787763122063973286493836226968018015159556564093559948752392081555,
-      0.05190787763122063973286493836226968018015159556564093559948752392081555,
-      0.05176794317491018754380364302882373293234694549920156407325853688846437,
-      0.05176794317491018754380364302882373293234694549920156407325853688846437,
-      0.05148845150098093399504439717705431173392382665958082480323322905845893,
-      0.05148845150098093399504439717705431173392382665958082480323322905845893,
-      0.05107015606985562740454912073449103536619708311367105474450831793563487,
-      0.05107015606985562740454912073449103536619708311367105474450831793563487,
-      0.05051418453250937459823873574165364323995616273741662814404286974035745,
-      0.05051418453250937459823873574165364323995616273741662814404286974035745,
-      0.04982203569055018101115923089370331247921559724378476973336922258463655,
-      0.04982203569055018101115923089370331247921559724378476973336922258463655,
-      0.04899557545575683538947568685789429835758389599909024248058598177431482,
-      0.04899557545575683538947568685789429835758389599909024248058598177431482,
-      0.04803703181997118096366665272873365360250002924692195693676432545775173,
-      0.04803703181997118096366665272873365360250002924692195693676432545775173,
-      0.04694898884891220484701315639470156627557490258344444292436328860948455,
-      0.04694898884891220484701315639470156627557490258344444292436328860948455,
-      0.04573437971611448664719645529090933300793497425868495444885644189785554,
-      0.04573437971611448664719645529090933300793497425868495444885644189785554,
-      0.04439647879578711332778416409137736966388498573401429851123645922404651,
-      0.04439647879578711332778416409137736966388498573401429851123645922404651,
-      0.04293889283593564195423122065638280694921177196491647898979741190202011,
-      0.04293889283593564195423122065638280694921177196491647898979741190202011,
-      0.04136555123558475561316383680665889688018700852151071424867954734910172,
-      0.04136555123558475561316383680665889688018700852151071424867954734910172,
-      0.03968069545238079947012283481171000876280351129417421865491951892215732,
-      0.03968069545238079947012283481171000876280351129417421865491951892215732,
-      0.03788886756924344403094079420927603181008428106380637154349889028518060,
-      0.03788886756924344403094079420927603181008428106380637154349889028518060,
-      0.03599489805108450306657864628806233859424242002100358385811585994825755,
-      0.03599489805108450306657864628806233859424242002100358385811585994825755,
-      0.03400389272494642283491440155525874118727622355285887601203061141115328,
-      0.03400389272494642283491440155525874118727622355285887601203061141115328,
-      0.03192121901929632894945889953676047676669729228299142098138158475893212,
-      0.03192121901929632894945889953676047676669729228299142098138158475893212,
-      0.02975249150078894524083648467348771033247515812410723195063279315700783,
-      0.02975249150078894524083648467348771033247515812410723195063279315700783,
-      0.02750355674992479163522319763862224764840347075416217725456695689922699,
-      0.02750355674992479163522319763862224764840347075416217725456695689922699,
-      0.02518047762152124837957096597236127913178083294418954861443703546439310,
-      0.02518047762152124837957096597236127913178083294418954861443703546439310,
-      0.02278951694399781986378345819290020781016738421520825823290391616554319,
-      0.02278951694399781986378345819290020781016738421520825823290391616554319,
-      0.02033712072945728677503214741710630146201711250534390381772268066313249,
-      0.02033712072945728677503214741710630146201711250534390381772268066313249,
-      0.01782990101420772026039626124834856763385921958339324690183988393108214,
-      0.01782990101420772026039626124834856763385921958339324690183988393108214,
-      0.01527461859678479930672603809882533517790938411507286448239224931925041,
-      0.01527461859678479930672603809882533517790938411507286448239224931925041,
-      0.01267816647681596013149537926951423498833836430263294560389540309438737,
-      0.01267816647681596013149537926951423498833836430263294560389540309438737,
-      0.01004755718228798435788576437705725649965174748767738434323897928069969,
-      0.01004755718228798435788576437705725649965174748767738434323897928069969,
-      0.00738993116334545553151695602208606088222818020622509208760447407680247,
-      0.00738993116334545553151695602208606088222818020622509208760447407680247,
-      0.00471272992695356864089482171407723594808497019371506011529061862254809,
-      0.00471272992695356864089482171407723594808497019371506011529061862254809,
-      0.00202681196887375849643171020989232469531166822555894990734538765730268,
-      0.00202681196887375849643171020989232469531166822555894990734538765730268
-    };
-  }
-
-  else if ( order == 61 ) {
-    quadrature_weights = {
-      0.05108111944078621797792109560630985280205762640408927879119892153390267,
-      0.05101448703869726354373508057385201076820237542338634681327221694578219,
-      0.05101448703869726354373508057385201076820237542338634681327221694578219,
-      0.05081476366881834320770052922347869734784234385656766471673070080876687,
-      0.05081476366881834320770052922347869734784234385656766471673070080876687,
-      0.05048247038679740464814446518815126917289915200008866956862344495170261,
-      0.05048247038679740464814446518815126917289915200008866956862344495170261,
-      0.05001847410817825342505161500635862544205591923667243401298315560772473,
-      0.05001847410817825342505161500635862544205591923667243401298315560772473,
-      0.04942398534673558993996877665111649941665965666774848113144084110221336,
-      0.04942398534673558993996877665111649941665965666774848113144084110221336,
-      0.04870055505641152608753008831470560675869837218145057629891513027066084,
-      0.04870055505641152608753008831470560675869837218145057629891513027066084,
-      0.04785007058509560716183342751869966271340125297023681588392111275991563,
-      0.04785007058509560716183342751869966271340125297023681588392111275991563,
-      0.04687475075080906597642944558859073593371427235439648139693087943260061,
-      0.04687475075080906597642944558859073593371427235439648139693087943260061,
-      0.04577714005314595937133983384682479196153481455209210396715505238509437,
-      0.04577714005314595937133983384682479196153481455209210396715505238509437,
-      0.04456010203508348827154141983108835293335633519476516306144152073567659,
-      0.04456010203508348827154141983108835293335633519476516306144152073567659,
-      0.04322681181249609790104364582268287335029674435381313565915702771460713,
-      0.04322681181249609790104364582268287335029674435381313565915702771460713,
-      0.04178074779088849206667557235107300751269737408356478772659676634965706,
-      0.04178074779088849206667557235107300751269737408356478772659676634965706,
-      0.04022568259099824736763998375751157915592852852473845142464150161227105,
-      0.04022568259099824736763998375751157915592852852473845142464150161227105,
-      0.03856567320700817274615204762965380282922293321495739814607344968761284,
-      0.03856567320700817274615204762965380282922293321495739814607344968761284,
-      0.03680505042315481738432104286406746087590072359161771334168991491252205,
-      0.03680505042315481738432104286406746087590072359161771334168991491252205,
-      0.03494840751653335109085191920921927825500947094150758364477506684462989,
-      0.03494840751653335109085191920921927825500947094150758364477506684462989,
-      0.03300058827590741063272368344100449280740893980815058615178288037588303,
-      0.03300058827590741063272368344100449280740893980815058615178288037588303,
-      0.03096667436839739482469794661248938376670927102752538434035865133646750,
-      0.03096667436839739482469794661248938376670927102752538434035865133646750,
-      0.02885197208818340150434177554559025254350711993469388744900943080393778,
-      0.02885197208818340150434177554559025254350711993469388744900943080393778,
-      0.02666199852415088966281070684496801956405541912412060736997616430092624,
-      0.02666199852415088966281070684496801956405541912412060736997616430092624,
-      0.02440246718754420291534065973246753232577019850402360075854066703065001,
-      0.02440246718754420291534065973246753232577019850402360075854066703065001,
-      0.02207927314831904400247576562818162743617212408293122864464035696782554,
-      0.02207927314831904400247576562818162743617212408293122864464035696782554,
-      0.01969847774610118133051783021268456666579663613604383402694446103074330,
-      0.01969847774610118133051783021268456666579663613604383402694446103074330,
-      0.01726629298761374359443321277243662118418805452051927189378365354559634,
-      0.01726629298761374359443321277243662118418805452051927189378365354559634,
-      0.01478906588493791454617851578148826126037152853378020679995051502106957,
-      0.01478906588493791454617851578148826126037152853378020679995051502106957,
-      0.01227326350781210462927780035952613135449266049142567548241867374444092,
-      0.01227326350781210462927780035952613135449266049142567548241867374444092,
-      0.00972546183035613373613667175557011832684334637992202657696257054021176,
-      0.00972546183035613373613667175557011832684334637992202657696257054021176,
-      0.00715235499174908958583399309169417557127328166702841504170316924920453,
-      0.00715235499174908958583399309169417557127328166702841504170316924920453,
-      0.00456092400601241718453893257974278827081304337831533151198638421623426,
-      0.00456092400601241718453893257974278827081304337831533151198638421623426,
-      0.00196145336167028267177306446192684809414929406187149776199517894842008,
-      0.00196145336167028267177306446192684809414929406187149776199517894842008
-    };
-  }
-
-  else if ( order == 62 ) {
-    quadrature_weights = {
-      0.05024800037525628168840294899513566831650472347656578092778888391492213,
-      0.05024800037525628168840294899513566831650472347656578092778888391492213,
-      0.05012106956904328807480410010153096800489531993392136104126426525280317,
-      0.05012106956904328807480410010153096800489531993392136104126426525280317,
-      0.04986752859495239424476131063484281688819595904527461420902640676188170,
-      0.04986752859495239424476131063484281688819595904527461420902640676188170,
-      0.04948801791969929252786581090477401846363378821095710780965038879928757,
-      0.04948801791969929252786581090477401846363378821095710780965038879928757,
-      0.04898349622051783710485112702621737256534890279639974940517473312043194,
-      0.04898349622051783710485112702621737256534890279639974940517473312043194,
-      0.04835523796347767283480318147845898676220050246238905618101272642531442,
-      0.04835523796347767283480318147845898676220050246238905618101272642531442,
-      0.04760483018410123227045008826786637306073741804949714463085528134384221,
-      0.04760483018410123227045008826786637306073741804949714463085528134384221,
-      0.04673416847841552480220705507948477876215978342901445512266959086721609,
-      0.04673416847841552480220705507948477876215978342901445512266959086721609,
-      0.04574545221457018077723227229769618767040394637762586464215093797804187,
-      0.04574545221457018077723227229769618767040394637762586464215093797804187,
-      0.04464117897712441429364469180913778441034875570807671634009702850532798,
-      0.04464117897712441429364469180913778441034875570807671634009702850532798,
-      0.04342413825804741958006923043394430419577132991468060605827531335688787,
-      0.04342413825804741958006923043394430419577132991468060605827531335688787,
-      0.04209740441038509664302262690383884601008708641913504672929433698876402,
-      0.04209740441038509664302262690383884601008708641913504672929433698876402,
-      0.04066432888241744096828501751666341731298671867166857447425210977094222,
-      0.04066432888241744096828501751666341731298671867166857447425210977094222,
-      0.03912853175196308412331080182260886062617991494346947913580100554270260,
-      0.03912853175196308412331080182260886062617991494346947913580100554270260,
-      0.03749389258228002998561856351879302823433185316753499043575607284825190,
-      0.03749389258228002998561856351879302823433185316753499043575607284825190,
-      0.03576454062276814128558737836172204258459806773117380190798456033244375,
-      0.03576454062276814128558737836172204258459806773117380190798456033244375,
-      0.03394484437941054509111747725423605778640654173271147033254812921750735,
-      0.03394484437941054509111747725423605778640654173271147033254812921750735,
-      0.03203940058162467810633923727815637313049303486293426263175606311944408,
-      0.03203940058162467810633923727815637313049303486293426263175606311944408,
-      0.03005302257398987007700946922706237948622878155453537354245100930343227,
-      0.03005302257398987007700946922706237948622878155453537354245100930343227,
-      0.02799072816331463754123829275404130487368380889597929636828922953993698,
-      0.02799072816331463754123829275404130487368380889597929636828922953993698,
-      0.02585772695402469802709556655351051559485987002574742329067046350852758,
-      0.02585772695402469802709556655351051559485987002574742329067046350852758,
-      0.02365940720868279257451680065053456470143152943084045354276618342434598,
-      0.02365940720868279257451680065053456470143152943084045354276618342434598,
-      0.02140132227766996884117908996490527764083752058057333039343740784697295,
-      0.02140132227766996884117908996490527764083752058057333039343740784697295,
-      0.01908917665857319873250371248228380577444267504732171150644197785800711,
-      0.01908917665857319873250371248228380577444267504732171150644197785800711,
-      0.01672881179017731628855047178409245836313193723342913243755451839595830,
-      0.01672881179017731628855047178409245836313193723342913243755451839595830,
-      0.01432619182380651776740288230941459607709994607566547857861037993611240,
-      0.01432619182380651776740288230941459607709994607566547857861037993611240,
-      0.01188739011701050194481893896679793652742859626999072436341284683543684,
-      0.01188739011701050194481893896679793652742859626999072436341284683543684,
-      0.00941857942842038763793756340656642815543364295156699934785834065387504,
-      0.00941857942842038763793756340656642815543364295156699934785834065387504,
-      0.00692604190183096087170282409925706711954721309845612181563982306179686,
-      0.00692604190183096087170282409925706711954721309845612181563982306179686,
-      0.00441633345693090481327412425549064072971198213049489616520564653090079,
-      0.00441633345693090481327412425549064072971198213049489616520564653090079,
-      0.00189920567951369048039734386093514017087884977236897663230433895868402,
-      0.00189920567951369048039734386093514017087884977236897663230433895868402
-    };
-  }
-
-  else if ( order == 63 ) {
-    quadrature_weights = {
-      0.04947236662393102088866936042092594461353225394238326723944788470050941,
-      0.04941183303991817896703964611670485969772839008454096959991688195528833,
-      0.04941183303991817896703964611670485969772839008454096959991688195528833,
-      0.04923038042374756078504311698814458759187653281991422328112462351339863,
-      0.04923038042374756078504311698814458759187653281991422328112462351339863,
-      0.04892845282051198994470936154921482123252580998161526816866192615527818,
-      0.04892845282051198994470936154921482123252580998161526816866192615527818,
-      0.04850678909788384786409009914580158202759176924782665496504473949450238,
-      0.04850678909788384786409009914580158202759176924782665496504473949450238,
-      0.04796642113799513141105275619513225361068492143214658059284015391459741,
-      0.04796642113799513141105275619513225361068492143214658059284015391459741,
-      0.04730867131226891908060498833884406238662000197264571811984948412678884,
-      0.04730867131226891908060498833884406238662000197264571811984948412678884,
-      0.04653514924538369651039541874695318722782247717379842167658937487465189,
-      0.04653514924538369651039541874695318722782247717379842167658937487465189,
-      0.04564774787629260868588599260854252242660732393896392981386526001655025,
-      0.04564774787629260868588599260854252242660732393896392981386526001655025,
-      0.04464863882594139537033266951681339323410056356252033365432727272664889,
-      0.04464863882594139537033266951681339323410056356252033365432727272664889,
-      0.04354026708302759079896431570440113964093121192838053809413066997511735,
-      0.04354026708302759079896431570440113964093121192838053809413066997511735,
-      0.04232534502081582298250548540302745648284337891419637508998967462156947,
-      0.04232534502081582298250548540302745648284337891419637508998967462156947,
-      0.04100684575966639863511003700907235074017796621249930393159847953295138,
-      0.04100684575966639863511003700907235074017796621249930393159847953295138,
-      0.03958799589154409398480792814920236445419493911410243880836436192596474,
-      0.03958799589154409398480792814920236445419493911410243880836436192596474,
-      0.03807226758434955676363832492788921862730335725417542949059221531555995,
-      0.03807226758434955676363832492788921862730335725417542949059221531555995,
-      0.03646337008545728963045240978754179183183295025429651122993433007616730,
-      0.03646337008545728963045240978754179183183295025429651122993433007616730,
-      0.03476524064535587769718050464278815710707330249414719432367976155661782,
-      0.03476524064535587769718050464278815710707330249414719432367976155661782,
-      0.03298203488377934176568317967245930713779421615727785559062452432773634,
-      0.03298203488377934176568317967245930713779421615727785559062452432773634,
-      0.03111811662221981750821598855718858202491118953291511265097272306399049,
-      0.03111811662221981750821598855718858202491118953291511265097272306399049,
-      0.02917804720828052694555150215402880228294094592080542683035506771839609,
-      0.02917804720828052694555150215402880228294094592080542683035506771839609,
-      0.02716657435909793322518983943941272660664268398662912748456490376205997,
-      0.02716657435909793322518983943941272660664268398662912748456490376205997,
-      0.02508862055334498661863013806844335610235380744763357244745649810745859,
-      0.02508862055334498661863013806844335610235380744763357244745649810745859,
-      0.02294927100488993314894231956177050589104749991908682842920474227014795,
-      0.02294927100488993314894231956177050589104749991908682842920474227014795,
-      0.02075376125803909077534195342147315334781326487844182112090143797243518,
-      0.02075376125803909077534195342147315334781326487844182112090143797243518,
-      0.01850746446016127040926054580515796311023892141763128543356877747727074,
-      0.01850746446016127040926054580515796311023892141763128543356877747727074,
-      0.01621587841033833888228367297513091491581560382993090097089049390807502,
-      0.01621587841033833888228367297513091491581560382993090097089049390807502,
-      0.01388461261611561082486608636762443491927765825349064754906966272881159,
-      0.01388461261611561082486608636762443491927765825349064754906966272881159,
-      0.01151937607688004175075060614861806484158879394538898323570397047820656,
-      0.01151937607688004175075060614861806484158879394538898323570397047820656,
-      0.00912596867632665635405864542175995484969241778837534966967438534092938,
-      0.00912596867632665635405864542175995484969241778837534966967438534092938,
-      0.00671029176596013625190693072972880397343602855571611024379717620616182,
-      0.00671029176596013625190693072972880397343602855571611024379717620616182,
-      0.00427850834686376186607841108262278551712747267087521140233821556823362,
-      0.00427850834686376186607841108262278551712747267087521140233821556823362,
-      0.00183987459557708411709244555404392385263847233884024248064426893817914,
-      0.00183987459557708411709244555404392385263847233884024248064426893817914
-    };
-  }
-
-  else if ( order == 64 ) {
-    quadrature_weights = {
-      0.04869095700913972038336539073474991244262869228387433050866880424569142,
-      0.04869095700913972038336539073474991244262869228387433050866880424569142,
-      0.04857546744150342693479906678397811368755654470492948571115167610251582,
-      0.04857546744150342693479906678397811368755654470492948571115167610251582,
-      0.04834476223480295716976952715801780970369255060950108062944220144524983,
-      0.04834476223480295716976952715801780970369255060950108062944220144524983,
-      0.04799938859645830772812617987134606995431671347149362094463239309333352,
-      0.04799938859645830772812617987134606995431671347149362094463239309333352,
-      0.04754016571483030866228220694422317164082525126253875215847403187847352,
-      0.04754016571483030866228220694422317164082525126253875215847403187847352,
-      0.04696818281621001732532628575458107519989752847381256498292408868619005,
-      0.04696818281621001732532628575458107519989752847381256498292408868619005,
-      0.04628479658131441729595324923226118496965030753244680077783408183646989,
-      0.04628479658131441729595324923226118496965030753244680077783408183646989,
-      0.04549162792741814447977099697126905888732346180239989681688340816065046,
-      0.04549162792741814447977099697126905888732346180239989681688340816065046,
-      0.04459055816375656306013471003094484329402379999122172564321932868619484,
-      0.04459055816375656306013471003094484329402379999122172564321932868619484,
-      0.04358372452932345337682786097373748092278889749711801505321939255025695,
-      0.04358372452932345337682786097373748092278889749711801505321939255025695,
-      0.04247351512365358900733976790881736616554664818064966973146077220552454,
-      0.04247351512365358900733976790881736616554664818064966973146077220552454,
-      0.04126256324262352861015629747363804773993063553054741054290347791227050,
-      0.04126256324262352861015629747363804773993063553054741054290347791227050,
-      0.03995374113272034138665692612833607391867695067033363011140370269815705,
-      0.03995374113272034138665692612833607391867695067033363011140370269815705,
-      0.03855015317861562912896249694680899101278711220171803196623788540880053,
-      0.03855015317861562912896249694680899101278711220171803196623788540880053,
-      0.03705512854024004604041510180958337508346494530565630217475362720280916,
-      0.03705512854024004604041510180958337508346494530565630217475362720280916,
-      0.03547221325688238381069314671524594794809463100241009469265148481993811,
-      0.03547221325688238381069314671524594794809463100241009469265148481993811,
-      0.03380516183714160939156548211072543102104992631400453466755006504003237,
-      0.03380516183714160939156548211072543102104992631400453466755006504003237,
-      0.03205792835485155358546750434789871696622157388139806225016940785453528,
-      0.03205792835485155358546750434789871696622157388139806225016940785453528,
-      0.03023465707240247886797405981954865915828139776848124163602654204596916,
-      0.03023465707240247886797405981954865915828139776848124163602654204596916,
-      0.02833967261425948322751130520023735198120758412575433599079551850845002,
-      0.02833967261425948322751130520023735198120758412575433599079551850845002,
-      0.02637746971505465867169179262522518567559933084224571844961567368530216,
-      0.02637746971505465867169179262522518567559933084224571844961567368530216,
-      0.02435270256871087333817755040906898764997841551337841198199856855355368,
-      0.02435270256871087333817755040906898764997841551337841198199856855355368,
-      0.02227017380838325415929833038415500242295929059975940514552054297449145,
-      0.02227017380838325415929833038415500242295929059975940514552054297449145,
-      0.02013482315353020937234031672854389708952668010079195192200723432767698,
-      0.02013482315353020937234031672854389708952668010079195192200723432767698,
-      0.01795171577569734308504530200111936889716735703641585729771842735692473,
-      0.01795171577569734308504530200111936889716735703641585729771842735692473,
-      0.01572603047602471932196599529753979442602900984315651215289439322842105,
-      0.01572603047602471932196599529753979442602900984315651215289439322842105,
-      0.01346304789671864259806076668595568410842577197734967081846827852219836,
-      0.01346304789671864259806076668595568410842577197734967081846827852219836,
-      0.01116813946013112881859049301920813507277879781682728721525136227396970,
-      0.01116813946013112881859049301920813507277879781682728721525136227396970,
-      0.00884675982636394772303091465973064769517626607922049979847157692961104,
-      0.00884675982636394772303091465973064769517626607922049979847157692961104,
-      0.00650445796897836285611736039998126677113176105495234009524487925756851,
-      0.00650445796897836285611736039998126677113176105495234009524487925756851,
-      0.00414703326056246763528753572855141531330281925368480246287636614318348,
-      0.00414703326056246763528753572855141531330281925368480246287636614318348,
-      0.00178328072169643294729607914497193317995934727192795566953080636558585,
-      0.00178328072169643294729607914497193317995934727192795566953080636558585
-    };
-  }
-  else {
+  Span weights = gauss_wts( order );
+  if( weights.empty( ) )
     std::cout << "Invalid Gauss Order";
-  }
-
-  return quadrature_weights;
+  return std::vector<double>( weights.begin( ), weights.end( ) );
 }
 
 /* -------------------------------------------------------------------------- */
@@ -4873,17 +4415,31 @@ std::vector<double> quad::get_gauss_wts(
     const std::array<double, 2> & interval_ends
     )
 {
-  // Get the Gauss weights and scale them to the physical domain;
   std::vector<double> weights = get_gauss_wts( order );
-  double length = interval_ends[1] - interval_ends[0];
-  for( int i{0}; i != order; ++i )
-    weights[i] = weights[i] * length / 2.0;
-
+  map_gauss_wts( order, interval_ends, weights.data( ) );
   return weights;
 }
 
 /* -------------------------------------------------------------------------- */
 
+/* Given the integration order, the ends of the integration interval and
+ * storage for (at least) order values, write the integration weights scaled to
+ * the physical domain. */
+void quad::map_gauss_wts(
+    int order,
+    const std::array<double, 2> & interval_ends,
+    double * weights
+    )
+{
+  // Scale the tabulated weights to the physical domain;
+  Span ref_weights = gauss_wts( order );
+  double length = interval_ends[1] - interval_ends[0];
+  for( std::size_t i{0}; i != ref_weights.size( ); ++i )
+    weights[i] = ref_weights[i] * length / 2.0;
+}
+
+/* -------------------------------------------------------------------------- */
+
 /* Given a vector of values and a vector of weights, carry out the summation to
  * compute the integral. */
 double quad::integrate( const std::vector<double> & values,
@@ -4976,8 +4532,8 @@ double quad::test_order( int poly_order, int num_intervals )
     ends[0] = i * cell_len;
     ends[1] = (i + 1) * cell_len;
 
-    points = get_gauss_pts( order, ends );
-    weights = get_gauss_wts( order, ends );
+    map_gauss_pts( order, ends, points.data( ) );
+    map_gauss_wts( order, ends, weights.data( ) );
 
     // loop over gauss points in each interval
     for (int j=0; j<order; ++j)
@@ -10,11 +10,35 @@
 #define GUARD_GAUSS_QUADRATURE_H
 
 #include <array>
+#include <cstddef>
 #include <vector>
 #include <Eigen/Dense>
 
 namespace quad {
 
+  /* Highest order of the tabulated Gauss rules. */
+  const int max_order = 64;
+
+  /* Non-owning, read-only view of a contiguous run of doubles (one Gauss rule
+   * in the static tables). */
+  struct Span {
+    const double * ptr;
+    std::size_t count;
+
+    const double * begin( ) const { return ptr; }
+    const double * end( ) const { return ptr + count; }
+    std::size_t size( ) const { return count; }
+    bool empty( ) const { return count == 0; }
+    double operator[]( std::size_t i ) const { return ptr[i]; }
+  };
+
+  /* Given the order of integration, return a view of the Gauss points or
+   * weights on [-1, 1].  The rules live in static constexpr tables, so the
+   * lookup is O(1) and never allocates.  Orders outside [1, max_order] give
+   * an empty view. */
+  Span gauss_pts( int order );
+  Span gauss_wts( int order );
+
   std::vector<double> get_gauss_pts( int order );
   std::vector<double> get_gauss_pts(
       int order,
@@ -27,6 +51,20 @@ namespace quad {
       const std::array<double, 2> & interval_ends
       );
 
+  /* Given the order of integration and the ends of the interval, write the
+   * mapped points or scaled weights into the caller's storage, which must
+   * hold at least order values. */
+  void map_gauss_pts(
+      int order,
+      const std::array<double, 2> & interval_ends,
+      double * points
+      );
+  void map_gauss_wts(
+      int order,
+      const std::array<double, 2> & interval_ends,
+      double * weights
+      );
+
   double integrate( const std::vector<double> & values,
       const std::vector<double> & weights );
 
@@ -36,15 +74,12 @@ namespace quad {
   void test( int num_tests );
   double test_order( int poly_order, int num_intervals );
 
-  /* Given the dimensions of the matrix, a & b, and the function object used to
-   * integrate each term, func, integrate the coefficients and return the
-   * matrix. */
+  /* Given a function object and the integration order, loop the quadrature
+   * points once and call func( xi, weight ) at each.  The function object
+   * evaluates the geometry and all basis values once per point and
+   * accumulates the full element matrices itself. */
   template <typename Func>
-  Eigen::MatrixXd integrate_matrix(
-      Func & func,
-      int int_order,
-      bool sym = false
-      );
+  void integrate_points( Func & func, int int_order );
 
 }
 
@@ -54,47 +89,30 @@ template <typename Func>
 double quad::integrate( const Func & f, int int_order )
 {
   // Get integration points and weights;
-  std::vector<double> points  = get_gauss_pts( int_order );
-  std::vector<double> weights = get_gauss_wts( int_order );
+  const Span points  = gauss_pts( int_order );
+  const Span weights = gauss_wts( int_order );
 
   // Perform integration;
   double ret{ 0.0 };
-  for( int pt{ 0 }; pt != int_order; ++pt )
+  for( std::size_t pt{ 0 }; pt != points.size( ); ++pt )
     ret += f( points[pt] ) * weights[pt];
   return ret;
 }
 
 /* -------------------------------------------------------------------------- */
 
-/* Given the dimensions of the matrix, a & b, and the function object used to
- * integrate each term, func, integrate the coefficients and return the
- * matrix. */
-template <typename Matrix_Func>
-Eigen::MatrixXd quad::integrate_matrix(
-    Matrix_Func &func,
-    int int_order,
-    bool sym
-    )
+/* Given a function object and the integration order, loop the quadrature
+ * points once and call func( xi, weight ) at each. */
+template <typename Point_Func>
+void quad::integrate_points( Point_Func & func, int int_order )
 {
-  // Get the size of the matrix;
-  const std::size_t num_rows = func.get_rows( );
-  const std::size_t num_cols = func.get_cols( );
-
-  // Calculate the matrix matrix;
-  Eigen::MatrixXd matrix = Eigen::MatrixXd::Zero( num_rows, num_cols );
-  for( std::size_t a{ 0 }; a != num_rows; ++a ) {
-    std::size_t b = sym ? a : 0;
-    for( ; b != num_cols; ++b ) {
-      func.a = a;
-      func.b = b;
-      matrix( a, b ) = quad::integrate( func, int_order );
-
-      // If symmetric, then copy the M_{ab} term to M_{ba};
-      if( a != b && sym )
-        matrix( b, a ) = matrix( a, b );
-    }
-  }
-  return matrix;
+  // Get integration points and weights;
+  const Span points  = gauss_pts( int_order );
+  const Span weights = gauss_wts( int_order );
+
+  // Let the function object accumulate each point contribution;
+  for( std::size_t pt{ 0 }; pt != points.size( ); ++pt )
+    func( points[pt], weights[pt] );
 }
 
 #endif
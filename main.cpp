@@ -15,6 +15,7 @@
 #include "exact.h"
 #include "gauss_quadrature.h"
 #include "Material.h"
+#include "mesh_generator.h"
 #include "Node.h"
 
 // System headers;
@@ -23,6 +24,7 @@
 #include <Eigen/Dense>
 #include <fstream>
 #include <iostream>
+#include <vector>
 
 /* ****************************  BEGIN PROGRAM  ***************************** */
 int main( int argc, char *argv[] )
@@ -65,17 +67,13 @@ int main( int argc, char *argv[] )
   std::cout << "    nu = " << nu << "\n";
   std::cout << "    No. Elements = " << num_elem << "\n";
 
-  // Create domain nodes;
+  // Create domain nodes (uniform quadratic mesh, traction at the bore);
   std::cout << "\nCreating domain:\n    Nodes ...\n";
   fem::Domain domain;
-  double elem_size = ( b - a ) / num_elem;
-  for( std::size_t node_i{ 0 }; node_i != 2*num_elem + 1; ++node_i ) {
-    double coord = a + node_i * elem_size / 2.0;
-    if( node_i == 0 )
-      domain.create_node( coord, fem::Node::NBC, P );
-    else
-      domain.create_node( coord );
-  }
+  domain.reserve( 2*num_elem + 1, num_elem );
+  std::vector<double> vertices = mesh::uniform( a, b, num_elem );
+  domain.create_nodes( mesh::node_coords( vertices, 2 ) );
+  domain.set_boundary( 0, fem::Node::NBC, P );
 
   // Create material;
   std::cout << "    Materials ...\n";
@@ -83,14 +81,11 @@ int main( int argc, char *argv[] )
 
   // Create elements;
   std::cout << "    Elements ...\n";
-  for( std::size_t ele_i{ 0 }; ele_i != num_elem; ++ele_i ) {
-    // Get first node index;
-    std::size_t node_0 = 2*ele_i;
-    domain.create_element( {node_0, node_0 + 1, node_0 + 2}, 0 );
-  }
+  domain.create_elements( 3, mesh::chain_connectivity( num_elem, 2 ), 0 );
 
-  // Solve system of equations;
+  // Solve system of equations with the Thomas recurrences (1D chain);
   std::cout << "\nSolving system of equations:\n";
+  domain.set_solver( fem::Domain::THOMAS );
   Eigen::VectorXd disp = domain.solve( 3 );
 
   // Output results with comparison to anayltical;
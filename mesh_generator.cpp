@@ -0,0 +1,132 @@
+/* ************************************************************************** *
+ *                           Frank Nathan Beckwith                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** *
+ *                                                                            *
+ * Radial mesh generators.  Declarations given in mesh_generator.h.           *
+ *                                                                            *
+ * ************************************************************************** */
+
+// Project-specific headers;
+#include "mesh_generator.h"
+
+// System headers;
+#include <cmath>
+#include <stdexcept>
+
+/* Given the radii, a < b, and the number of elements, return vertices spaced
+ * uniformly. */
+std::vector<double> mesh::uniform( double a, double b, std::size_t num_elem )
+{
+  if( num_elem == 0 )
+    throw std::invalid_argument( "mesh::uniform:  no elements" );
+  if( !( a < b ) )
+    throw std::invalid_argument( "mesh::uniform:  need a < b" );
+  std::vector<double> vertices( num_elem + 1 );
+  const double size = ( b - a ) / num_elem;
+  for( std::size_t i{ 0 }; i != num_elem; ++i )
+    vertices[i] = a + i * size;
+  vertices[num_elem] = b;
+  return vertices;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given the radii, a < b, the number of elements, and the growth ratio, return
+ * vertices such that each element is `ratio' times the size of the previous
+ * one (ratio > 1 refines toward a, ratio < 1 toward b). */
+std::vector<double> mesh::geometric( double a, double b, std::size_t num_elem,
+    double ratio )
+{
+  if( num_elem == 0 )
+    throw std::invalid_argument( "mesh::geometric:  no elements" );
+  if( !( a < b ) )
+    throw std::invalid_argument( "mesh::geometric:  need a < b" );
+  if( !( ratio > 0.0 ) )
+    throw std::invalid_argument( "mesh::geometric:  need ratio > 0" );
+  if( ratio == 1.0 )
+    return uniform( a, b, num_elem );
+
+  // First size from the geometric series, h0 ( ratio^n - 1 ) / ( ratio - 1 );
+  std::vector<double> vertices( num_elem + 1 );
+  double size = ( b - a ) * ( ratio - 1.0 ) /
+    ( std::pow( ratio, double( num_elem ) ) - 1.0 );
+  vertices[0] = a;
+  for( std::size_t i{ 1 }; i != num_elem; ++i ) {
+    vertices[i] = vertices[i - 1] + size;
+    size *= ratio;
+  }
+  vertices[num_elem] = b;
+  return vertices;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given the radii, a < b, the number of elements, and the stretching factor,
+ * beta > 0, return vertices clustered in a boundary layer at a with the
+ * hyperbolic tangent stretching. */
+std::vector<double> mesh::boundary_layer( double a, double b,
+    std::size_t num_elem, double beta )
+{
+  if( num_elem == 0 )
+    throw std::invalid_argument( "mesh::boundary_layer:  no elements" );
+  if( !( a < b ) )
+    throw std::invalid_argument( "mesh::boundary_layer:  need a < b" );
+  if( !( beta > 0.0 ) )
+    throw std::invalid_argument( "mesh::boundary_layer:  need beta > 0" );
+  std::vector<double> vertices( num_elem + 1 );
+  const double scale = 1.0 / std::tanh( beta );
+  for( std::size_t i{ 0 }; i != num_elem; ++i ) {
+    double s = double( i ) / num_elem;
+    vertices[i] = a + ( b - a ) * ( 1.0 - std::tanh( beta * ( 1.0 - s ) ) *
+        scale );
+  }
+  vertices[num_elem] = b;
+  return vertices;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given the element vertices and the element order (1 or 2), return the
+ * coordinates of every node, with the interior nodes of each element equally
+ * spaced, numbered from a to b. */
+std::vector<double> mesh::node_coords( const std::vector<double> & vertices,
+    std::size_t order )
+{
+  if( vertices.size( ) < 2 )
+    throw std::invalid_argument( "mesh::node_coords:  need two vertices" );
+  if( order != 1 && order != 2 )
+    throw std::invalid_argument( "mesh::node_coords:  order must be 1 or 2" );
+  const std::size_t num_elem = vertices.size( ) - 1;
+  std::vector<double> coords( num_elem * order + 1 );
+  for( std::size_t e{ 0 }; e != num_elem; ++e ) {
+    const double size = vertices[e + 1] - vertices[e];
+    for( std::size_t k{ 0 }; k != order; ++k )
+      coords[e * order + k] = vertices[e] + size * k / order;
+  }
+  coords[num_elem * order] = vertices[num_elem];
+  return coords;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/* Given the number of elements and the element order, return the node ids of
+ * a chain of elements numbered as in `node_coords,' order + 1 per element,
+ * back to back. */
+std::vector<std::size_t> mesh::chain_connectivity( std::size_t num_elem,
+    std::size_t order )
+{
+  if( num_elem == 0 )
+    throw std::invalid_argument( "mesh::chain_connectivity:  no elements" );
+  if( order != 1 && order != 2 )
+    throw std::invalid_argument(
+        "mesh::chain_connectivity:  order must be 1 or 2" );
+  std::vector<std::size_t> conn( num_elem * ( order + 1 ) );
+  for( std::size_t e{ 0 }; e != num_elem; ++e ) {
+    for( std::size_t k{ 0 }; k != order + 1; ++k )
+      conn[e * ( order + 1 ) + k] = e * order + k;
+  }
+  return conn;
+}
@@ -0,0 +1,65 @@
+/* ************************************************************************** *
+ *                           Frank Nathan Beckwith                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ *                                                                            *
+ * ************************************************************************** */
+
+#ifndef GUARD_MESH_GENERATOR_H
+#define GUARD_MESH_GENERATOR_H
+
+// Project-specific headers;
+
+// System headers;
+#include <cstddef>
+#include <vector>
+
+namespace mesh {
+
+  /* Radial mesh generators.  Each returns the num_elem + 1 element vertices
+   * of a one dimensional mesh of [a, b], from a to b; `node_coords' and
+   * `chain_connectivity' turn them into the arrays taken by the bulk
+   * `Domain::create_nodes' and `Domain::create_elements.'  Every function
+   * throws `std::invalid_argument' for an empty mesh (no elements, or fewer
+   * than two vertices), for b <= a, for a ratio or stretching factor that is
+   * not positive, and for an element order other than 1 or 2. */
+
+  /* Given the radii, a < b, and the number of elements, return vertices
+   * spaced uniformly. */
+  std::vector<double> uniform( double a, double b, std::size_t num_elem );
+
+  /* Given the radii, a < b, the number of elements, and the growth ratio,
+   * return vertices such that each element is `ratio' times the size of the
+   * previous one (ratio > 1 refines toward a, ratio < 1 toward b). */
+  std::vector<double> geometric( double a, double b, std::size_t num_elem,
+      double ratio );
+
+  /* Given the radii, a < b, the number of elements, and the stretching
+   * factor, beta > 0, return vertices clustered in a boundary layer at a
+   * with the hyperbolic tangent stretching,
+   *   r = a + ( b - a ) ( 1 - tanh( beta ( 1 - s ) ) / tanh( beta ) ),
+   * for s uniform on [0, 1].  Larger beta gives a thinner layer. */
+  std::vector<double> boundary_layer( double a, double b, std::size_t num_elem,
+      double beta );
+
+  /* Given the element vertices and the element order (1 or 2), return the
+   * coordinates of every node, with the interior nodes of each element
+   * equally spaced, numbered from a to b. */
+  std::vector<double> node_coords( const std::vector<double> & vertices,
+      std::size_t order );
+
+  /* Given the number of elements and the element order, return the node ids
+   * of a chain of elements numbered as in `node_coords,' order + 1 per
+   * element, back to back. */
+  std::vector<std::size_t> chain_connectivity( std::size_t num_elem,
+      std::size_t order );
+
+} // namespace mesh;
+
+#endif